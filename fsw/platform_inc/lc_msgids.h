@@ -42,9 +42,10 @@
 ** \name LC Telemetry Message IDs */
 /** \{ */
 #define LC_HK_TLM_MID 0x08A7 /**< \brief LC Housekeeping Telemetry */
+#define LC_MID_STATS_TLM_MID \
+    0x08A8 /**< \brief LC MessageID Statistics Telemetry */
 /** \} */
 /*
-#define LC_TLM_SPARE1        0x08A8
 #define LC_TLM_SPARE2        0x08A9
 */
 
@@ -36,14 +36,24 @@
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void LC_SampleAPs(uint16 StartIndex, uint16 EndIndex) {
     uint16 TableIndex;
+    uint16 LiveIndex;
+    uint16 SharedIndex;
     uint8 CurrentAPState;
 
+    /*
+    ** Shared subexpression results are only good for one sample
+    */
+    for (SharedIndex = 0; SharedIndex < LC_OperData.SharedRPNCount;
+         SharedIndex++) {
+        LC_OperData.SharedRPN[SharedIndex].Valid = false;
+    }
+
     /*
     ** If we're specifying a single actionpoint, make sure it's
     ** current state is valid for a sample request
     */
     if (StartIndex == EndIndex) {
-        CurrentAPState = LC_OperData.ARTPtr[StartIndex].CurrentState;
+        CurrentAPState = LC_OperData.APSamples[StartIndex].CurrentState;
 
         if ((CurrentAPState != LC_ACTION_NOT_USED) &&
             (CurrentAPState != LC_APSTATE_PERMOFF)) {
@@ -62,10 +72,22 @@ void LC_SampleAPs(uint16 StartIndex, uint16 EndIndex) {
         }
     } else {
         /*
-        ** Sample selected actionpoints
+        ** Evaluate the equations that can be evaluated together first,
+        ** the results are picked up as each actionpoint is sampled
         */
-        for (TableIndex = StartIndex; TableIndex <= EndIndex; TableIndex++) {
-            LC_SampleSingleAP(TableIndex);
+        LC_EvaluateAPGroups(StartIndex, EndIndex);
+
+        /*
+        ** Sample selected actionpoints that are active or passive, the
+        ** live index is already in sample order
+        */
+        for (LiveIndex = 0; LiveIndex < LC_OperData.LiveAPCount;
+             LiveIndex++) {
+            TableIndex = LC_OperData.LiveAPs[LiveIndex];
+
+            if ((TableIndex >= StartIndex) && (TableIndex <= EndIndex)) {
+                LC_SampleSingleAP(TableIndex);
+            }
         }
     }
 
@@ -79,6 +101,7 @@ void LC_SampleAPs(uint16 StartIndex, uint16 EndIndex) {
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void LC_SampleSingleAP(uint16 APNumber) {
+    LC_APSample_t *APSample = &LC_OperData.APSamples[APNumber];
     uint8 CurrentAPState;
     uint8 PreviousResult;
     uint8 CurrentResult;
@@ -89,7 +112,7 @@ void LC_SampleSingleAP(uint16 APNumber) {
     ** or passive. Other states are ignored since this
     ** routine is called in a loop to process ALL actionpoints.
     */
-    CurrentAPState = LC_OperData.ARTPtr[APNumber].CurrentState;
+    CurrentAPState = APSample->CurrentState;
 
     if ((CurrentAPState == LC_APSTATE_ACTIVE) ||
         (CurrentAPState == LC_APSTATE_PASSIVE)) {
@@ -99,17 +122,43 @@ void LC_SampleSingleAP(uint16 APNumber) {
         */
         LC_AppData.APSampleCount++;
 
-        PreviousResult = LC_OperData.ARTPtr[APNumber].ActionResult;
+        PreviousResult = APSample->ActionResult;
+
+        /*
+        ** The equation only depends on watchpoint and actionpoint
+        ** results, so unless one of them has changed the result is the
+        ** same as last time
+        */
+        if (APSample->Dirty == true) {
+            if (APSample->HaveGroupResult == true) {
+                CurrentResult             = APSample->GroupResult;
+                APSample->HaveGroupResult = false;
+            } else {
+                CurrentResult = LC_EvaluateRPN(APNumber);
+            }
+
+            APSample->ActionResult = CurrentResult;
 
-        CurrentResult = LC_EvaluateRPN(APNumber);
+            /*
+            ** Errors are evaluated again so they are reported again
+            */
+            APSample->Dirty = (CurrentResult == LC_ACTION_ERROR);
 
-        LC_OperData.ARTPtr[APNumber].ActionResult = CurrentResult;
+            /*
+            ** Equations that use this result are evaluated again too
+            */
+            if (CurrentResult != PreviousResult) {
+                LC_MarkAPsDirty(LC_AP_DEPEND_INDEX(APNumber));
+            }
+        } else {
+            CurrentResult = PreviousResult;
+        }
 
         /*****************************************
         ** If actionpoint fails current evaluation
         ******************************************/
         if (CurrentResult == LC_ACTION_FAIL) {
-            LC_OperData.ARTPtr[APNumber].ConsecutiveFailCount++;
+            APSample->ConsecutiveFailCount++;
             LC_OperData.ARTPtr[APNumber].CumulativeFailCount++;
 
             if (PreviousResult == LC_ACTION_PASS) {
@@ -130,8 +179,8 @@ void LC_SampleSingleAP(uint16 APNumber) {
                 }
             }
 
-            if (LC_OperData.ARTPtr[APNumber].ConsecutiveFailCount >=
-                LC_OperData.ADTPtr[APNumber].MaxFailsBeforeRTS) {
+            if (APSample->ConsecutiveFailCount >=
+                APSample->MaxFailsBeforeRTS) {
                 /*
                 ** We have failed enough times to request the RTS
                 */
@@ -139,15 +188,14 @@ void LC_SampleSingleAP(uint16 APNumber) {
                     /*
                     ** Actions go to passive after they've failed
                     */
-                    LC_OperData.ARTPtr[APNumber].CurrentState =
-                        LC_APSTATE_PASSIVE;
+                    APSample->CurrentState = LC_APSTATE_PASSIVE;
 
                     if (LC_AppData.CurrentLCState == LC_STATE_ACTIVE) {
                         /*
                         ** If the LC application state is active, request the
                         ** specified RTS be executed
                         */
-                        LC_ExecuteRTS(LC_OperData.ADTPtr[APNumber].RTSId);
+                        LC_ExecuteRTS(APSample->RTSId);
 
                         LC_OperData.ARTPtr[APNumber].CumulativeRTSExecCount++;
 
@@ -177,9 +225,8 @@ void LC_SampleSingleAP(uint16 APNumber) {
                         CFE_EVS_SendEvent(
                             LC_OperData.ADTPtr[APNumber].EventID,
                             LC_OperData.ADTPtr[APNumber].EventType, EventText,
-                            APNumber,
-                            LC_OperData.ARTPtr[APNumber].ConsecutiveFailCount,
-                            LC_OperData.ADTPtr[APNumber].RTSId);
+                            APNumber, APSample->ConsecutiveFailCount,
+                            APSample->RTSId);
 
                         LC_OperData.ARTPtr[APNumber].CumulativeEventMsgsSent++;
                     } else {
@@ -195,9 +242,8 @@ void LC_SampleSingleAP(uint16 APNumber) {
                                           "AP failed while LC App passive: AP "
                                           "= %d, FailCount = %d, RTS = %d",
                                           APNumber,
-                                          (int)LC_OperData.ARTPtr[APNumber]
-                                              .ConsecutiveFailCount,
-                                          LC_OperData.ADTPtr[APNumber].RTSId);
+                                          (int)APSample->ConsecutiveFailCount,
+                                          APSample->RTSId);
                     }
                 } else {
                     /*
@@ -217,9 +263,8 @@ void LC_SampleSingleAP(uint16 APNumber) {
                                           "AP failed while passive: AP = %d, "
                                           "FailCount = %d, RTS = %d",
                                           APNumber,
-                                          (int)LC_OperData.ARTPtr[APNumber]
-                                              .ConsecutiveFailCount,
-                                          LC_OperData.ADTPtr[APNumber].RTSId);
+                                          (int)APSample->ConsecutiveFailCount,
+                                          APSample->RTSId);
                         LC_OperData.ARTPtr[APNumber].CumulativeEventMsgsSent++;
                     }
                 }
@@ -252,7 +297,7 @@ void LC_SampleSingleAP(uint16 APNumber) {
             /*
             ** Clear consecutive failure counter for this AP
             */
-            LC_OperData.ARTPtr[APNumber].ConsecutiveFailCount = 0;
+            APSample->ConsecutiveFailCount = 0;
         }
 
         /*
@@ -262,7 +307,7 @@ void LC_SampleSingleAP(uint16 APNumber) {
             /*
             ** Make sure the consecutive fail count is zeroed
             */
-            LC_OperData.ARTPtr[APNumber].ConsecutiveFailCount = 0;
+            APSample->ConsecutiveFailCount = 0;
         } else {
             /*
             ** We got back a LC_ACTION_ERROR result, send event
@@ -288,9 +333,11 @@ void LC_SampleSingleAP(uint16 APNumber) {
     ((StackPtr <= 0) ? (IllegalRPN = true) : (RPNStack[--StackPtr]))
 
 #define PUSH_RPN_DATA(x)                                     \
-    ((StackPtr >= LC_MAX_RPN_EQU_SIZE) ? (IllegalRPN = true) \
-                                       : (RPNStack[StackPtr++] = x))
+    ((StackPtr >= LC_MAX_RPN_STACK_DEPTH) ? (IllegalRPN = true) \
+                                          : (RPNStack[StackPtr++] = x))
 uint8 LC_EvaluateRPN(uint16 APNumber) {
+    const LC_APSample_t *APSample = &LC_OperData.APSamples[APNumber];
+    const uint16 *RPNEquation     = &LC_OperData.RPNPool[APSample->RPNStart];
     bool Done;
     bool IllegalRPN;
     bool IllegalOperand;
@@ -298,10 +345,20 @@ uint8 LC_EvaluateRPN(uint16 APNumber) {
     int32 RPNEquationPtr;
     int32 StackPtr;
     uint16 RPNData;
-    uint16 RPNStack[LC_MAX_RPN_EQU_SIZE];
+    uint16 RPNStack[LC_MAX_RPN_STACK_DEPTH];
     uint16 Operand1;
     uint16 Operand2;
 
+#ifndef LC_CHECKED_RPN
+    /*
+    ** Equations verified when the ADT was loaded don't need the
+    ** checks made below
+    */
+    if (APSample->Verified == true) {
+        return (LC_EvaluateVerifiedRPN(APNumber));
+    }
+#endif
+
     StackPtr       = 0;
     RPNEquationPtr = 0;
     IllegalRPN     = false;
@@ -317,7 +374,7 @@ uint8 LC_EvaluateRPN(uint16 APNumber) {
         **  Pick off each piece of the RPN equation and handle
         **  one at a time
         */
-        RPNData = LC_OperData.ADTPtr[APNumber].RPNEquation[RPNEquationPtr++];
+        RPNData = RPNEquation[RPNEquationPtr++];
 
         /*
         **  The data is either an RPN operator or a watchpoint number
@@ -402,11 +459,27 @@ uint8 LC_EvaluateRPN(uint16 APNumber) {
 
             /*
             **  If the data is a watchpoint number then the operand is
-            **  the current value of that watchpoint result
+            **  the current value of that watchpoint result, likewise
+            **  for an actionpoint result operand
             */
             default:
                 if (RPNData < LC_MAX_WATCHPOINTS) {
-                    PUSH_RPN_DATA(LC_OperData.WRTPtr[RPNData].WatchResult);
+                    PUSH_RPN_DATA(LC_OperData.WatchResults[RPNData]);
+                } else if (LC_RPN_IS_AP(RPNData) &&
+                           (LC_RPN_AP_NUMBER(RPNData) < LC_MAX_ACTIONPOINTS)) {
+                    PUSH_RPN_DATA(
+                        LC_OperData.APSamples[LC_RPN_AP_NUMBER(RPNData)]
+                            .ActionResult);
+                } else if (LC_RPN_IS_VOTE(RPNData) &&
+                           (StackPtr >= LC_RPN_VOTE_N(RPNData))) {
+                    /*
+                    ** A K of N vote replaces its N operands with the
+                    ** result
+                    */
+                    StackPtr -= LC_RPN_VOTE_N(RPNData);
+                    Operand1 =
+                        LC_EvaluateVote(RPNData, &RPNStack[StackPtr]);
+                    PUSH_RPN_DATA(Operand1);
                 } else {
                     IllegalRPN = true;
                 }
@@ -416,11 +489,11 @@ uint8 LC_EvaluateRPN(uint16 APNumber) {
 
         /*
         ** If still not done and have no errors - check for the end of the
-        *buffer
+        ** equation (an equation with no LC_RPN_EQUAL fills its whole buffer)
         */
         if ((Done == false) && (IllegalRPN == false) &&
             (IllegalOperand == false)) {
-            if (RPNEquationPtr >= LC_MAX_RPN_EQU_SIZE) {
+            if (RPNEquationPtr >= APSample->RPNLength) {
                 IllegalRPN = true;
             }
         }
@@ -448,13 +521,142 @@ uint8 LC_EvaluateRPN(uint16 APNumber) {
 
 } /* end LC_EvaluateRPN */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Evaluate a verified actionpoint RPN equation                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint8 LC_EvaluateVerifiedRPN(uint16 APNumber) {
+    const LC_APSample_t *APSample = &LC_OperData.APSamples[APNumber];
+    const uint16 *RPNEquation     = &LC_OperData.RPNPool[APSample->RPNStart];
+    const uint16 *RPNEqualPtr     = RPNEquation + APSample->RPNLength - 1;
+    LC_SharedRPN_t *SharedRPN     = LC_OperData.SharedRPN;
+    uint16 RPNStack[LC_MAX_RPN_STACK_DEPTH];
+    uint16 *StackTop = RPNStack;
+    uint16 Operand1;
+    uint16 Operand2;
+    uint8 EvalResult;
+
+    /*
+    ** LC_VerifyRPN proved every operator has its operands, every
+    ** operand is a valid watchpoint or actionpoint and the equation
+    ** ends with one result at its LC_RPN_EQUAL, so nothing is checked
+    ** here. The operators are the same as in LC_EvaluateRPN. Shared
+    ** subexpressions are never nested, so only one is open at a time.
+    */
+    while (RPNEquation < RPNEqualPtr) {
+        switch (*RPNEquation) {
+            case LC_RPN_AND:
+                Operand2 = *--StackTop;
+                Operand1 = StackTop[-1];
+                if ((Operand1 == LC_WATCH_FALSE) ||
+                    (Operand2 == LC_WATCH_FALSE)) {
+                    StackTop[-1] = LC_WATCH_FALSE;
+                } else if ((Operand1 == LC_WATCH_ERROR) ||
+                           (Operand2 == LC_WATCH_ERROR)) {
+                    StackTop[-1] = LC_WATCH_ERROR;
+                } else if ((Operand1 == LC_WATCH_STALE) ||
+                           (Operand2 == LC_WATCH_STALE)) {
+                    StackTop[-1] = LC_WATCH_STALE;
+                } else {
+                    StackTop[-1] = LC_WATCH_TRUE;
+                }
+                break;
+
+            case LC_RPN_OR:
+                Operand2 = *--StackTop;
+                Operand1 = StackTop[-1];
+                if ((Operand1 == LC_WATCH_TRUE) ||
+                    (Operand2 == LC_WATCH_TRUE)) {
+                    StackTop[-1] = LC_WATCH_TRUE;
+                } else if ((Operand1 == LC_WATCH_ERROR) ||
+                           (Operand2 == LC_WATCH_ERROR)) {
+                    StackTop[-1] = LC_WATCH_ERROR;
+                } else if ((Operand1 == LC_WATCH_STALE) ||
+                           (Operand2 == LC_WATCH_STALE)) {
+                    StackTop[-1] = LC_WATCH_STALE;
+                } else {
+                    StackTop[-1] = LC_WATCH_FALSE;
+                }
+                break;
+
+            case LC_RPN_XOR:
+                Operand2 = *--StackTop;
+                Operand1 = StackTop[-1];
+                if ((Operand1 == LC_WATCH_ERROR) ||
+                    (Operand2 == LC_WATCH_ERROR)) {
+                    StackTop[-1] = LC_WATCH_ERROR;
+                } else if ((Operand1 == LC_WATCH_STALE) ||
+                           (Operand2 == LC_WATCH_STALE)) {
+                    StackTop[-1] = LC_WATCH_STALE;
+                } else {
+                    StackTop[-1] = (Operand1 != Operand2);
+                }
+                break;
+
+            case LC_RPN_NOT:
+                Operand1 = StackTop[-1];
+                if ((Operand1 != LC_WATCH_ERROR) &&
+                    (Operand1 != LC_WATCH_STALE)) {
+                    StackTop[-1] = (Operand1 == LC_WATCH_FALSE);
+                }
+                break;
+
+            case LC_RPN_SHARED_BEGIN:
+                SharedRPN = &LC_OperData.SharedRPN[*++RPNEquation];
+                if (SharedRPN->Valid == true) {
+                    *StackTop++ = SharedRPN->Result;
+                    RPNEquation += SharedRPN->Length + 1;
+                }
+                break;
+
+            case LC_RPN_SHARED_END:
+                SharedRPN->Result = StackTop[-1];
+                SharedRPN->Valid  = true;
+                break;
+
+            default:
+                if (*RPNEquation < LC_MAX_WATCHPOINTS) {
+                    *StackTop++ = LC_OperData.WatchResults[*RPNEquation];
+                } else if (LC_RPN_IS_AP(*RPNEquation)) {
+                    *StackTop++ =
+                        LC_OperData.APSamples[LC_RPN_AP_NUMBER(*RPNEquation)]
+                            .ActionResult;
+                } else {
+                    StackTop -= LC_RPN_VOTE_N(*RPNEquation);
+                    *StackTop = LC_EvaluateVote(*RPNEquation, StackTop);
+                    StackTop++;
+                }
+                break;
+        }
+
+        RPNEquation++;
+    }
+
+    EvalResult = (uint8)RPNStack[0];
+
+    if (EvalResult == LC_WATCH_ERROR) {
+        EvalResult = LC_ACTION_ERROR;
+    } else if (EvalResult == LC_WATCH_STALE) {
+        EvalResult = LC_ACTION_STALE;
+    } else if (EvalResult == LC_WATCH_FALSE) {
+        EvalResult = LC_ACTION_PASS;
+    } else if (EvalResult == LC_WATCH_TRUE) {
+        EvalResult = LC_ACTION_FAIL;
+    }
+
+    return (EvalResult);
+
+} /* end LC_EvaluateVerifiedRPN */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Validate the actionpoint definition table (ADT)                 */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 int32 LC_ValidateADT(void *TableData) {
-    LC_ADTEntry_t *TableArray = (LC_ADTEntry_t *)TableData;
+    LC_ADT_t *Table           = (LC_ADT_t *)TableData;
+    LC_ADTEntry_t *TableArray = Table->Entries;
 
     int32 EntryResult = LC_ADTVAL_NO_ERR;
     int32 TableResult = CFE_SUCCESS;
@@ -464,8 +666,9 @@ int32 LC_ValidateADT(void *TableData) {
     uint16 RTSId;
     uint16 MaxFailsBeforeRTS;
     uint16 EventType;
+    uint16 RPNOffset;
+    uint16 RPNLength;
 
-    uint16 *RPNPtr;
     int32 RPNIndex      = 0;
     int32 RPNStackDepth = 0;
 
@@ -473,6 +676,9 @@ int32 LC_ValidateADT(void *TableData) {
     int32 BadCount    = 0;
     int32 UnusedCount = 0;
 
+    uint16 APOrder[LC_MAX_ACTIONPOINTS];
+    uint16 OrderedCount;
+
     /*
     ** Verify each entry in the pending actionpoint definition table
     */
@@ -480,7 +686,8 @@ int32 LC_ValidateADT(void *TableData) {
         DefaultState      = TableArray[TableIndex].DefaultState;
         RTSId             = TableArray[TableIndex].RTSId;
         MaxFailsBeforeRTS = TableArray[TableIndex].MaxFailsBeforeRTS;
-        RPNPtr            = TableArray[TableIndex].RPNEquation;
+        RPNOffset         = TableArray[TableIndex].RPNOffset;
+        RPNLength         = TableArray[TableIndex].RPNLength;
         EventType         = TableArray[TableIndex].EventType;
 
         if (DefaultState == LC_ACTION_NOT_USED) {
@@ -519,11 +726,19 @@ int32 LC_ValidateADT(void *TableData) {
             */
             BadCount++;
             EntryResult = LC_ADTVAL_ERR_EVTTYPE;
+        } else if ((RPNLength == 0) || (RPNOffset >= LC_MAX_RPN_POOL_SIZE) ||
+                   (RPNLength > (LC_MAX_RPN_POOL_SIZE - RPNOffset))) {
+            /*
+            ** Equation doesn't fit in the RPN pool
+            */
+            BadCount++;
+            EntryResult = LC_ADTVAL_ERR_RPNPOOL;
         } else {
             /*
             ** Validate reverse polish equation syntax
             */
-            EntryResult = LC_ValidateRPN(RPNPtr, &RPNIndex, &RPNStackDepth);
+            EntryResult = LC_ValidateRPN(&Table->RPNPool[RPNOffset], RPNLength,
+                                         &RPNIndex, &RPNStackDepth);
 
             if (EntryResult != LC_ADTVAL_NO_ERR) {
                 BadCount++;
@@ -541,6 +756,12 @@ int32 LC_ValidateADT(void *TableData) {
                     LC_ADTVAL_RPNERR_EID, CFE_EVS_EventType_ERROR,
                     "ADT verify RPN err: AP = %d, Index = %d, StackDepth = %d",
                     (int)TableIndex, (int)RPNIndex, (int)RPNStackDepth);
+            } else if (EntryResult == LC_ADTVAL_ERR_RPNPOOL) {
+                CFE_EVS_SendEvent(
+                    LC_ADTVAL_RPNPOOL_ERR_EID, CFE_EVS_EventType_ERROR,
+                    "ADT verify RPN pool err: AP = %d, Offset = %d, "
+                    "Length = %d",
+                    (int)TableIndex, RPNOffset, RPNLength);
             } else {
                 CFE_EVS_SendEvent(LC_ADTVAL_ERR_EID, CFE_EVS_EventType_ERROR,
                                   "ADT verify err: AP = %d, Err = %d, State = "
@@ -555,6 +776,28 @@ int32 LC_ValidateADT(void *TableData) {
 
     } /* end TableIndex for */
 
+    /*
+    ** Actionpoints are sampled after the actionpoints whose results
+    ** they use, which can't be done when the references form a cycle
+    */
+    if (TableResult == CFE_SUCCESS) {
+        OrderedCount = LC_OrderActionpoints(Table, APOrder);
+
+        if (OrderedCount < LC_MAX_ACTIONPOINTS) {
+            GoodCount -= LC_MAX_ACTIONPOINTS - OrderedCount;
+            BadCount += LC_MAX_ACTIONPOINTS - OrderedCount;
+
+            CFE_EVS_SendEvent(LC_ADTVAL_APCYCLE_ERR_EID,
+                              CFE_EVS_EventType_ERROR,
+                              "ADT verify AP reference cycle: AP = %d, "
+                              "Unordered = %d",
+                              APOrder[OrderedCount],
+                              (int)(LC_MAX_ACTIONPOINTS - OrderedCount));
+
+            TableResult = LC_ADTVAL_ERR_APCYCLE;
+        }
+    }
+
     /*
     ** Generate informational event with error totals
     */
@@ -571,23 +814,27 @@ int32 LC_ValidateADT(void *TableData) {
 /* Validate a reverse polish notation (RPN) equation               */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-int32 LC_ValidateRPN(uint16 *RPNPtr, int32 *IndexValue,
+int32 LC_ValidateRPN(uint16 *RPNPtr, uint16 RPNLength, int32 *IndexValue,
                      int32 *StackDepthValue) {
     int32 Result = LC_ADTVAL_NO_ERR;
     int32 BufferIndex;
     int32 StackDepth;
-    uint16 BufferItem;
+    uint16 BufferItem = 0;
 
     /*
-    ** Each equation consists only of watchpoint ID numbers
-    ** and polish symbols (and, or, equal, etc).
+    ** Each equation consists only of watchpoint ID numbers,
+    ** actionpoint result operands and polish symbols (and,
+    ** or, equal, etc).
     **
-    ** Each watchpoint ID increases the stack depth and
+    ** Each watchpoint ID or actionpoint result operand
+    ** increases the stack depth and
     ** each polish symbol (except "not" which has no
-    ** effect) decreases the stack depth.
+    ** effect) decreases the stack depth. A K of N vote
+    ** decreases it by N - 1.
     **
-    ** The stack depth must never become negative and the
-    ** depth must equal 1 when the "=" symbol is found.
+    ** The stack depth must never become negative or exceed
+    ** LC_MAX_RPN_STACK_DEPTH and the depth must equal 1 when
+    ** the "=" symbol is found.
     **
     ** The last symbol in the equation is assumed to be
     ** the "=" symbol, and the test does not examine any
@@ -595,7 +842,7 @@ int32 LC_ValidateRPN(uint16 *RPNPtr, int32 *IndexValue,
     */
     StackDepth = 0;
 
-    for (BufferIndex = 0; BufferIndex < LC_MAX_RPN_EQU_SIZE; BufferIndex++) {
+    for (BufferIndex = 0; BufferIndex < RPNLength; BufferIndex++) {
         BufferItem = RPNPtr[BufferIndex];
 
         if ((BufferItem == LC_RPN_AND) || (BufferItem == LC_RPN_OR) ||
@@ -614,11 +861,31 @@ int32 LC_ValidateRPN(uint16 *RPNPtr, int32 *IndexValue,
             ** Equation ends when LC_RPN_EQUAL is found
             */
             break;
+        } else if (LC_RPN_IS_VOTE(BufferItem)) {
+            /*
+            ** Vote can't need more TRUE operands than it has
+            */
+            if (LC_RPN_VOTE_K(BufferItem) > LC_RPN_VOTE_N(BufferItem)) {
+                break;
+            }
+
+            /*
+            ** Depth test will fail if we haven't already counted N
+            ** watchpoint ID values
+            */
+            StackDepth -= LC_RPN_VOTE_N(BufferItem) - 1;
         } else if (BufferItem < LC_MAX_WATCHPOINTS) {
             /*
             ** Valid watchpoint ID
             */
             StackDepth++;
+        } else if (LC_RPN_IS_AP(BufferItem) &&
+                   (LC_RPN_AP_NUMBER(BufferItem) < LC_MAX_ACTIONPOINTS)) {
+            /*
+            ** Valid actionpoint result operand, cycles are checked
+            ** once the whole table has been validated
+            */
+            StackDepth++;
         } else {
             /*
             ** Not a valid polish symbol or watchpoint ID
@@ -627,9 +894,10 @@ int32 LC_ValidateRPN(uint16 *RPNPtr, int32 *IndexValue,
         }
 
         /*
-        ** Must have more watchpoint ID's than polish symbols
+        ** Must have more watchpoint ID's than polish symbols, but
+        ** not more than the stack holds
         */
-        if (StackDepth <= 0) {
+        if ((StackDepth <= 0) || (StackDepth > LC_MAX_RPN_STACK_DEPTH)) {
             break;
         }
     }
@@ -653,6 +921,1320 @@ int32 LC_ValidateRPN(uint16 *RPNPtr, int32 *IndexValue,
 
 } /* end LC_ValidateRPN */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Build the actionpoint sampling records from the ADT             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_CompileActionpoints(void) {
+    const LC_ADT_t *Table = (const LC_ADT_t *)LC_OperData.ADTPtr;
+    LC_APSample_t *APSample;
+    const uint16 *RPNEquation;
+    uint32 TableIndex;
+    uint16 RPNLength;
+    uint16 ADTLength;
+
+    /*
+    ** The equations are compiled in place in a copy of the ADT pool,
+    ** so those that share words still do
+    */
+    memcpy(LC_OperData.RPNPool, Table->RPNPool, sizeof(Table->RPNPool));
+
+    for (TableIndex = 0; TableIndex < LC_MAX_ACTIONPOINTS; TableIndex++) {
+        APSample    = &LC_OperData.APSamples[TableIndex];
+        RPNEquation = LC_GetADTEquation(Table, (uint16)TableIndex, &ADTLength);
+
+        /*
+        ** Only the words up to the first LC_RPN_EQUAL can ever be
+        ** evaluated
+        */
+        RPNLength = 0;
+        while (RPNLength < ADTLength) {
+            if (RPNEquation[RPNLength++] == LC_RPN_EQUAL) {
+                break;
+            }
+        }
+
+        APSample->RPNStart  = (uint32)(RPNEquation - Table->RPNPool);
+        APSample->RPNLength = RPNLength;
+
+        APSample->RTSId             = LC_OperData.ADTPtr[TableIndex].RTSId;
+        APSample->MaxFailsBeforeRTS =
+            LC_OperData.ADTPtr[TableIndex].MaxFailsBeforeRTS;
+
+        /*
+        ** Nothing is known about the new equation's result yet
+        */
+        APSample->Dirty           = true;
+        APSample->HaveGroupResult = false;
+
+        APSample->Verified = LC_VerifyRPN(TableIndex);
+    }
+
+    /*
+    ** Actionpoints that use another's result are sampled after it
+    */
+    LC_OperData.HaveAPReferences = false;
+
+    for (TableIndex = 0; TableIndex < LC_MAX_ACTIONPOINTS; TableIndex++) {
+        if (LC_RPNReferencesAP(TableIndex) == true) {
+            LC_OperData.HaveAPReferences = true;
+            break;
+        }
+    }
+
+    LC_OrderActionpoints(Table, LC_OperData.APSampleOrder);
+
+    LC_IndexLiveAPs();
+
+    LC_CreateAPDependencies();
+
+    LC_CreateAPGroups();
+
+#ifndef LC_CHECKED_RPN
+    LC_CreateSharedRPN();
+#endif
+
+    return;
+
+} /* end LC_CompileActionpoints */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Index the actionpoints that depend on each watchpoint and       */
+/* actionpoint                                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_CreateAPDependencies(void) {
+    uint32 *DependStart = LC_OperData.APDependStart;
+    const LC_APSample_t *APSample;
+    const uint16 *RPNEquation;
+    uint32 DependCount = LC_MAX_WATCHPOINTS + LC_MAX_ACTIONPOINTS;
+    uint32 TableIndex;
+    uint32 DependIndex;
+    uint16 RPNIndex;
+    uint16 PriorIndex;
+    uint16 RPNData;
+    uint16 Pass;
+
+    /*
+    ** The first pass counts the actionpoints of each watchpoint and
+    ** actionpoint result, the second files each actionpoint under the
+    ** results it uses
+    */
+    memset(DependStart, 0, sizeof(LC_OperData.APDependStart));
+    LC_OperData.APDependOverflow = false;
+
+    for (Pass = 0; Pass < 2; Pass++) {
+        for (TableIndex = 0; TableIndex < LC_MAX_ACTIONPOINTS; TableIndex++) {
+            APSample    = &LC_OperData.APSamples[TableIndex];
+            RPNEquation = &LC_OperData.RPNPool[APSample->RPNStart];
+
+            for (RPNIndex = 0; RPNIndex < APSample->RPNLength; RPNIndex++) {
+                RPNData = RPNEquation[RPNIndex];
+
+                if (RPNData < LC_MAX_WATCHPOINTS) {
+                    DependIndex = RPNData;
+                } else if (LC_RPN_IS_AP(RPNData) &&
+                           (LC_RPN_AP_NUMBER(RPNData) < LC_MAX_ACTIONPOINTS)) {
+                    DependIndex = LC_AP_DEPEND_INDEX(LC_RPN_AP_NUMBER(RPNData));
+                } else {
+                    continue;
+                }
+
+                /*
+                ** Each result lists an actionpoint only once
+                */
+                for (PriorIndex = 0; PriorIndex < RPNIndex; PriorIndex++) {
+                    if (RPNEquation[PriorIndex] == RPNData) {
+                        break;
+                    }
+                }
+
+                if (PriorIndex < RPNIndex) {
+                    continue;
+                }
+
+                if (Pass == 0) {
+                    DependStart[DependIndex + 1]++;
+                } else {
+                    LC_OperData.APDependents[DependStart[DependIndex]++] =
+                        (uint16)TableIndex;
+                }
+            }
+        }
+
+        if (Pass == 0) {
+            /*
+            ** Turn the counts into the first entry of each result
+            */
+            for (DependIndex = 0; DependIndex < DependCount; DependIndex++) {
+                DependStart[DependIndex + 1] += DependStart[DependIndex];
+            }
+
+            /*
+            ** Equations that share pool words can list more results
+            ** than there are words. Then every actionpoint is marked
+            ** instead.
+            */
+            if (DependStart[DependCount] > LC_MAX_RPN_POOL_SIZE) {
+                LC_OperData.APDependOverflow = true;
+                memset(DependStart, 0, sizeof(LC_OperData.APDependStart));
+                return;
+            }
+        }
+    }
+
+    /*
+    ** Filing moved each start up to the next result's start
+    */
+    for (DependIndex = DependCount; DependIndex > 0; DependIndex--) {
+        DependStart[DependIndex] = DependStart[DependIndex - 1];
+    }
+    DependStart[0] = 0;
+
+    return;
+
+} /* end LC_CreateAPDependencies */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Mark the actionpoints that use a watchpoint for re-evaluation   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_MarkAPsDirty(uint16 WatchIndex) {
+    uint32 DependIndex;
+
+    if (LC_OperData.APDependOverflow == true) {
+        for (DependIndex = 0; DependIndex < LC_MAX_ACTIONPOINTS;
+             DependIndex++) {
+            LC_OperData.APSamples[DependIndex].Dirty = true;
+        }
+
+        return;
+    }
+
+    for (DependIndex = LC_OperData.APDependStart[WatchIndex];
+         DependIndex < LC_OperData.APDependStart[WatchIndex + 1];
+         DependIndex++) {
+        LC_OperData.APSamples[LC_OperData.APDependents[DependIndex]].Dirty =
+            true;
+    }
+
+    return;
+
+} /* end LC_MarkAPsDirty */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Copy the working actionpoint results to the ART image           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_SyncART(void) {
+    uint32 TableIndex;
+
+    for (TableIndex = 0; TableIndex < LC_MAX_ACTIONPOINTS; TableIndex++) {
+        LC_OperData.ARTPtr[TableIndex].CurrentState =
+            LC_OperData.APSamples[TableIndex].CurrentState;
+        LC_OperData.ARTPtr[TableIndex].ActionResult =
+            LC_OperData.APSamples[TableIndex].ActionResult;
+        LC_OperData.ARTPtr[TableIndex].ConsecutiveFailCount =
+            LC_OperData.APSamples[TableIndex].ConsecutiveFailCount;
+    }
+
+    return;
+
+} /* end LC_SyncART */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Copy the ART image actionpoint results to the working copy      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_LoadActionResults(void) {
+    uint32 TableIndex;
+
+    for (TableIndex = 0; TableIndex < LC_MAX_ACTIONPOINTS; TableIndex++) {
+        LC_OperData.APSamples[TableIndex].CurrentState =
+            LC_OperData.ARTPtr[TableIndex].CurrentState;
+        LC_OperData.APSamples[TableIndex].ActionResult =
+            LC_OperData.ARTPtr[TableIndex].ActionResult;
+        LC_OperData.APSamples[TableIndex].ConsecutiveFailCount =
+            LC_OperData.ARTPtr[TableIndex].ConsecutiveFailCount;
+        LC_OperData.APSamples[TableIndex].Dirty = true;
+    }
+
+    LC_IndexLiveAPs();
+
+    return;
+
+} /* end LC_LoadActionResults */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Group the actionpoints with the same equation shape             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_CreateAPGroups(void) {
+    uint16 *APOrder = LC_OperData.APOrder;
+    LC_APGroup_t *Group;
+    uint32 TableIndex;
+    uint16 OrderCount = 0;
+    uint16 OrderIndex;
+    uint16 InsertIndex;
+    uint16 RunStart;
+    uint16 LaneCount;
+    uint16 APNumber;
+
+    /*
+    ** Only verified equations can be grouped. Groups are evaluated
+    ** before any actionpoint is sampled, so equations that use another
+    ** actionpoint's result are left out.
+    */
+    for (TableIndex = 0; TableIndex < LC_MAX_ACTIONPOINTS; TableIndex++) {
+        LC_OperData.APSamples[TableIndex].Grouped = false;
+
+        if ((LC_OperData.APSamples[TableIndex].Verified == true) &&
+            (LC_RPNReferencesAP((uint16)TableIndex) == false)) {
+            APOrder[OrderCount++] = (uint16)TableIndex;
+        }
+    }
+
+    /*
+    ** Insertion sort by shape, keeping table order within a shape
+    */
+    for (OrderIndex = 1; OrderIndex < OrderCount; OrderIndex++) {
+        APNumber    = APOrder[OrderIndex];
+        InsertIndex = OrderIndex;
+
+        while ((InsertIndex > 0) &&
+               (LC_CompareRPNShapes(APOrder[InsertIndex - 1], APNumber) > 0)) {
+            APOrder[InsertIndex] = APOrder[InsertIndex - 1];
+            InsertIndex--;
+        }
+
+        APOrder[InsertIndex] = APNumber;
+    }
+
+    /*
+    ** Each run of one shape that is long enough becomes groups of at
+    ** most LC_AP_GROUP_MAX_LANES, shorter runs stay with the stack
+    ** machine
+    */
+    LC_OperData.APGroupCount = 0;
+    RunStart                 = 0;
+
+    for (OrderIndex = 1; OrderIndex <= OrderCount; OrderIndex++) {
+        if ((OrderIndex < OrderCount) &&
+            (LC_CompareRPNShapes(APOrder[RunStart], APOrder[OrderIndex]) ==
+             0)) {
+            continue;
+        }
+
+        if ((OrderIndex - RunStart) >= LC_AP_GROUP_MIN_LANES) {
+            while (RunStart < OrderIndex) {
+                LaneCount = OrderIndex - RunStart;
+
+                if (LaneCount > LC_AP_GROUP_MAX_LANES) {
+                    LaneCount = LC_AP_GROUP_MAX_LANES;
+                }
+
+                Group = &LC_OperData.APGroups[LC_OperData.APGroupCount++];
+                Group->OrderStart = RunStart;
+                Group->LaneCount  = LaneCount;
+
+                while (LaneCount > 0) {
+                    LC_OperData.APSamples[APOrder[RunStart]].Grouped = true;
+                    RunStart++;
+                    LaneCount--;
+                }
+            }
+        }
+
+        RunStart = OrderIndex;
+    }
+
+    return;
+
+} /* end LC_CreateAPGroups */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Verify that an actionpoint equation evaluates without checks    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool LC_VerifyRPN(uint16 APNumber) {
+    const LC_APSample_t *APSample = &LC_OperData.APSamples[APNumber];
+    const uint16 *RPNEquation     = &LC_OperData.RPNPool[APSample->RPNStart];
+    int32 StackDepth              = 0;
+    uint16 RPNIndex;
+
+    for (RPNIndex = 0; RPNIndex < APSample->RPNLength; RPNIndex++) {
+        switch (RPNEquation[RPNIndex]) {
+            case LC_RPN_AND:
+            case LC_RPN_OR:
+            case LC_RPN_XOR:
+                if (StackDepth < 2) {
+                    return (false);
+                }
+                StackDepth--;
+                break;
+
+            case LC_RPN_NOT:
+                if (StackDepth < 1) {
+                    return (false);
+                }
+                break;
+
+            case LC_RPN_EQUAL:
+                return (StackDepth == 1);
+
+            default:
+                if (LC_RPN_IS_VOTE(RPNEquation[RPNIndex])) {
+                    if ((StackDepth < LC_RPN_VOTE_N(RPNEquation[RPNIndex])) ||
+                        (LC_RPN_VOTE_K(RPNEquation[RPNIndex]) >
+                         LC_RPN_VOTE_N(RPNEquation[RPNIndex]))) {
+                        return (false);
+                    }
+                    StackDepth -= LC_RPN_VOTE_N(RPNEquation[RPNIndex]) - 1;
+                    break;
+                }
+                if (LC_RPN_IS_AP(RPNEquation[RPNIndex])) {
+                    if (LC_RPN_AP_NUMBER(RPNEquation[RPNIndex]) >=
+                        LC_MAX_ACTIONPOINTS) {
+                        return (false);
+                    }
+                } else if (RPNEquation[RPNIndex] >= LC_MAX_WATCHPOINTS) {
+                    return (false);
+                }
+                if (StackDepth >= LC_MAX_RPN_STACK_DEPTH) {
+                    return (false);
+                }
+                StackDepth++;
+                break;
+        }
+    }
+
+    /*
+    ** No LC_RPN_EQUAL
+    */
+    return (false);
+
+} /* end LC_VerifyRPN */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Order two actionpoint equations by shape                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 LC_CompareRPNShapes(uint16 APNumber1, uint16 APNumber2) {
+    const LC_APSample_t *APSample1 = &LC_OperData.APSamples[APNumber1];
+    const LC_APSample_t *APSample2 = &LC_OperData.APSamples[APNumber2];
+    const uint16 *RPNEquation1     = &LC_OperData.RPNPool[APSample1->RPNStart];
+    const uint16 *RPNEquation2     = &LC_OperData.RPNPool[APSample2->RPNStart];
+    uint16 RPNIndex;
+    uint16 RPNData1;
+    uint16 RPNData2;
+
+    if (APSample1->RPNLength != APSample2->RPNLength) {
+        return ((APSample1->RPNLength < APSample2->RPNLength) ? -1 : 1);
+    }
+
+    for (RPNIndex = 0; RPNIndex < APSample1->RPNLength; RPNIndex++) {
+        /*
+        ** All watchpoint numbers are the same to the shape
+        */
+        RPNData1 = RPNEquation1[RPNIndex];
+        RPNData2 = RPNEquation2[RPNIndex];
+
+        if (RPNData1 < LC_MAX_WATCHPOINTS) {
+            RPNData1 = 0;
+        }
+        if (RPNData2 < LC_MAX_WATCHPOINTS) {
+            RPNData2 = 0;
+        }
+
+        if (RPNData1 != RPNData2) {
+            return ((RPNData1 < RPNData2) ? -1 : 1);
+        }
+    }
+
+    return (0);
+
+} /* end LC_CompareRPNShapes */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Evaluate the actionpoint groups needed for a sample             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_EvaluateAPGroups(uint16 StartIndex, uint16 EndIndex) {
+    const LC_APGroup_t *Group;
+    LC_APSample_t *APSample;
+    bool HavePlanes = false;
+    uint16 GroupIndex;
+    uint16 Lane;
+    uint16 APNumber;
+    uint32 NeedMask;
+    uint32 ValidBits;
+    uint32 ValueBits;
+    uint32 LaneBit;
+
+    for (GroupIndex = 0; GroupIndex < LC_OperData.APGroupCount;
+         GroupIndex++) {
+        Group = &LC_OperData.APGroups[GroupIndex];
+
+        /*
+        ** Only actionpoints that are about to be sampled and need
+        ** their equation evaluated take a result from the group
+        */
+        NeedMask = 0;
+
+        for (Lane = 0; Lane < Group->LaneCount; Lane++) {
+            APNumber = LC_OperData.APOrder[Group->OrderStart + Lane];
+            APSample = &LC_OperData.APSamples[APNumber];
+
+            if ((APNumber >= StartIndex) && (APNumber <= EndIndex) &&
+                (APSample->Dirty == true) &&
+                ((APSample->CurrentState == LC_APSTATE_ACTIVE) ||
+                 (APSample->CurrentState == LC_APSTATE_PASSIVE))) {
+                NeedMask |= (uint32)1 << Lane;
+            }
+        }
+
+        if (NeedMask == 0) {
+            continue;
+        }
+
+        if (HavePlanes == false) {
+            /*
+            ** A watch result the planes can't hold leaves every
+            ** equation to the stack machine for this sample
+            */
+            if (LC_BuildWatchPlanes() == false) {
+                return;
+            }
+
+            HavePlanes = true;
+        }
+
+        LC_EvaluateAPGroup(Group, &ValidBits, &ValueBits);
+
+        for (Lane = 0; Lane < Group->LaneCount; Lane++) {
+            LaneBit = (uint32)1 << Lane;
+
+            if ((NeedMask & LaneBit) == 0) {
+                continue;
+            }
+
+            APNumber = LC_OperData.APOrder[Group->OrderStart + Lane];
+            APSample = &LC_OperData.APSamples[APNumber];
+
+            if ((ValidBits & LaneBit) != 0) {
+                APSample->GroupResult = ((ValueBits & LaneBit) != 0)
+                                            ? LC_ACTION_FAIL
+                                            : LC_ACTION_PASS;
+            } else {
+                APSample->GroupResult = ((ValueBits & LaneBit) != 0)
+                                            ? LC_ACTION_ERROR
+                                            : LC_ACTION_STALE;
+            }
+
+            APSample->HaveGroupResult = true;
+        }
+    }
+
+    return;
+
+} /* end LC_EvaluateAPGroups */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Split the watch results into the valid and value bit planes     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool LC_BuildWatchPlanes(void) {
+    bool AllStandard = true;
+    uint32 WatchIndex;
+    uint32 WatchBit;
+
+    memset(LC_OperData.WatchValidBits, 0, sizeof(LC_OperData.WatchValidBits));
+    memset(LC_OperData.WatchValueBits, 0, sizeof(LC_OperData.WatchValueBits));
+
+    for (WatchIndex = 0; WatchIndex < LC_MAX_WATCHPOINTS; WatchIndex++) {
+        WatchBit = (uint32)1 << (WatchIndex % 32);
+
+        switch (LC_OperData.WatchResults[WatchIndex]) {
+            case LC_WATCH_TRUE:
+                LC_OperData.WatchValidBits[WatchIndex / 32] |= WatchBit;
+                LC_OperData.WatchValueBits[WatchIndex / 32] |= WatchBit;
+                break;
+
+            case LC_WATCH_FALSE:
+                LC_OperData.WatchValidBits[WatchIndex / 32] |= WatchBit;
+                break;
+
+            case LC_WATCH_ERROR:
+                LC_OperData.WatchValueBits[WatchIndex / 32] |= WatchBit;
+                break;
+
+            case LC_WATCH_STALE:
+                break;
+
+            default:
+                /*
+                ** Only a custom function can produce any other result
+                */
+                AllStandard = false;
+                break;
+        }
+    }
+
+    return (AllStandard);
+
+} /* end LC_BuildWatchPlanes */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Evaluate the equations of an actionpoint group                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_EvaluateAPGroup(const LC_APGroup_t *Group, uint32 *ValidBitsPtr,
+                        uint32 *ValueBitsPtr) {
+    const uint32 *ValidPlane = LC_OperData.WatchValidBits;
+    const uint32 *ValuePlane = LC_OperData.WatchValueBits;
+    uint32 LaneStarts[LC_AP_GROUP_MAX_LANES];
+    uint32 ValidStack[LC_MAX_RPN_STACK_DEPTH];
+    uint32 ValueStack[LC_MAX_RPN_STACK_DEPTH];
+    const LC_APSample_t *APSample;
+    const uint16 *RPNShape;
+    int32 StackPtr = 0;
+    uint16 RPNIndex;
+    uint16 WatchIndex;
+    uint16 WatchWord;
+    uint16 WatchShift;
+    uint16 Lane;
+    uint32 ValidA;
+    uint32 ValueA;
+    uint32 ValidB;
+    uint32 ValueB;
+    uint32 Decided;
+    uint32 Errors;
+
+    for (Lane = 0; Lane < Group->LaneCount; Lane++) {
+        LaneStarts[Lane] =
+            LC_OperData
+                .APSamples[LC_OperData.APOrder[Group->OrderStart + Lane]]
+                .RPNStart;
+    }
+
+    /*
+    ** The operators are the same for every lane, so they are read from
+    ** the first lane's equation
+    */
+    APSample = &LC_OperData.APSamples[LC_OperData.APOrder[Group->OrderStart]];
+    RPNShape = &LC_OperData.RPNPool[APSample->RPNStart];
+
+    /*
+    ** Each result is a valid bit (TRUE or FALSE) and a value bit (TRUE,
+    ** or ERROR when not valid). The operators follow the same ERROR and
+    ** STALE rules as LC_EvaluateRPN, lane by lane
+    */
+    for (RPNIndex = 0; RPNIndex < APSample->RPNLength; RPNIndex++) {
+        switch (RPNShape[RPNIndex]) {
+            case LC_RPN_AND:
+            case LC_RPN_OR:
+            case LC_RPN_XOR:
+                StackPtr--;
+                ValidB = ValidStack[StackPtr];
+                ValueB = ValueStack[StackPtr];
+                ValidA = ValidStack[StackPtr - 1];
+                ValueA = ValueStack[StackPtr - 1];
+
+                Errors = (~ValidA & ValueA) | (~ValidB & ValueB);
+
+                if (RPNShape[RPNIndex] == LC_RPN_AND) {
+                    /*
+                    ** A FALSE operand decides the result
+                    */
+                    Decided = (ValidA & ~ValueA) | (ValidB & ~ValueB);
+                    ValidStack[StackPtr - 1] = Decided | (ValidA & ValidB);
+                    ValueStack[StackPtr - 1] =
+                        ~Decided & (ValidStack[StackPtr - 1] | Errors);
+                } else if (RPNShape[RPNIndex] == LC_RPN_OR) {
+                    /*
+                    ** A TRUE operand decides the result
+                    */
+                    Decided = (ValidA & ValueA) | (ValidB & ValueB);
+                    ValidStack[StackPtr - 1] = Decided | (ValidA & ValidB);
+                    ValueStack[StackPtr - 1] =
+                        Decided | (~ValidStack[StackPtr - 1] & Errors);
+                } else {
+                    ValidStack[StackPtr - 1] = ValidA & ValidB;
+                    ValueStack[StackPtr - 1] =
+                        (ValidStack[StackPtr - 1] & (ValueA ^ ValueB)) |
+                        (~ValidStack[StackPtr - 1] & Errors);
+                }
+                break;
+
+            case LC_RPN_NOT:
+                ValueStack[StackPtr - 1] ^= ValidStack[StackPtr - 1];
+                break;
+
+            case LC_RPN_EQUAL:
+                break;
+
+            default:
+                if (LC_RPN_IS_VOTE(RPNShape[RPNIndex])) {
+                    StackPtr -= LC_RPN_VOTE_N(RPNShape[RPNIndex]);
+                    LC_EvaluateVoteGroup(RPNShape[RPNIndex],
+                                         &ValidStack[StackPtr],
+                                         &ValueStack[StackPtr]);
+                    StackPtr++;
+                    break;
+                }
+
+                /*
+                ** Gather the result of each lane's watchpoint
+                */
+                ValidA = 0;
+                ValueA = 0;
+
+                for (Lane = 0; Lane < Group->LaneCount; Lane++) {
+                    WatchIndex =
+                        LC_OperData.RPNPool[LaneStarts[Lane] + RPNIndex];
+                    WatchWord  = WatchIndex / 32;
+                    WatchShift = WatchIndex % 32;
+
+                    ValidA |= ((ValidPlane[WatchWord] >> WatchShift) & 1)
+                              << Lane;
+                    ValueA |= ((ValuePlane[WatchWord] >> WatchShift) & 1)
+                              << Lane;
+                }
+
+                ValidStack[StackPtr] = ValidA;
+                ValueStack[StackPtr] = ValueA;
+                StackPtr++;
+                break;
+        }
+    }
+
+    *ValidBitsPtr = ValidStack[0];
+    *ValueBitsPtr = ValueStack[0];
+
+    return;
+
+} /* end LC_EvaluateAPGroup */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Share the subexpressions repeated across actionpoint equations  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_CreateSharedRPN(void) {
+    const LC_ADT_t *Table = (const LC_ADT_t *)LC_OperData.ADTPtr;
+    LC_APSample_t *APSample;
+    LC_SharedRPN_t *SharedRPN;
+    const uint16 *RPNEquation;
+    uint16 *RPNPool = LC_OperData.RPNPool;
+    uint32 TableIndex;
+    uint32 PoolIndex = LC_MAX_RPN_POOL_SIZE;
+    uint32 BracketedLength;
+    uint16 RPNLength;
+    uint16 RPNIndex;
+    uint16 SharedIndex;
+    uint32 OperatorCount = 0;
+    uint32 SavedCount    = 0;
+    uint32 SharedOperators;
+
+    LC_OperData.SharedRPNCount = 0;
+
+    LC_HashRPNSubtrees();
+
+    /*
+    ** Only the equations left to the stack machine can share: those
+    ** that are verified and not evaluated in a group
+    */
+    for (TableIndex = 0; TableIndex < LC_MAX_ACTIONPOINTS; TableIndex++) {
+        APSample = &LC_OperData.APSamples[TableIndex];
+
+        if ((APSample->Verified == false) || (APSample->Grouped == true)) {
+            continue;
+        }
+
+        RPNEquation = LC_GetADTEquation(Table, (uint16)TableIndex, NULL);
+
+        for (RPNIndex = 0; RPNIndex < APSample->RPNLength; RPNIndex++) {
+            if (((RPNEquation[RPNIndex] >= LC_RPN_AND) &&
+                 (RPNEquation[RPNIndex] <= LC_RPN_NOT)) ||
+                LC_RPN_IS_VOTE(RPNEquation[RPNIndex])) {
+                OperatorCount++;
+            }
+        }
+
+        RPNIndex = 0;
+        while (RPNIndex < APSample->RPNLength) {
+            SharedRPN =
+                LC_FindSharedRPN((uint16)TableIndex, RPNIndex, true);
+            if (SharedRPN != NULL) {
+                RPNIndex += SharedRPN->Length;
+            } else {
+                RPNIndex++;
+            }
+        }
+    }
+
+    if (LC_OperData.SharedRPNCount == 0) {
+        return;
+    }
+
+    /*
+    ** Copy the equations that share past the ADT pool, bracketing
+    ** every shared subexpression with 3 more words. Those that don't
+    ** fit are left unbracketed in the ADT pool.
+    */
+    for (TableIndex = 0; TableIndex < LC_MAX_ACTIONPOINTS; TableIndex++) {
+        APSample    = &LC_OperData.APSamples[TableIndex];
+        RPNEquation = LC_GetADTEquation(Table, (uint16)TableIndex, NULL);
+        RPNLength   = APSample->RPNLength;
+
+        if ((APSample->Verified == false) || (APSample->Grouped == true)) {
+            continue;
+        }
+
+        BracketedLength = RPNLength;
+
+        RPNIndex = 0;
+        while (RPNIndex < RPNLength) {
+            SharedRPN = LC_FindSharedRPN((uint16)TableIndex, RPNIndex, false);
+            if (SharedRPN != NULL) {
+                BracketedLength += 3;
+                RPNIndex += SharedRPN->Length;
+            } else {
+                RPNIndex++;
+            }
+        }
+
+        if ((BracketedLength == RPNLength) ||
+            ((PoolIndex + BracketedLength) >
+             (LC_MAX_RPN_POOL_SIZE + LC_SHARED_RPN_POOL_WORDS))) {
+            continue;
+        }
+
+        APSample->RPNStart = PoolIndex;
+
+        RPNIndex = 0;
+        while (RPNIndex < RPNLength) {
+            SharedRPN = LC_FindSharedRPN((uint16)TableIndex, RPNIndex, false);
+            if (SharedRPN != NULL) {
+                RPNPool[PoolIndex++] = LC_RPN_SHARED_BEGIN;
+                RPNPool[PoolIndex++] =
+                    (uint16)(SharedRPN - LC_OperData.SharedRPN);
+                memcpy(&RPNPool[PoolIndex], &RPNEquation[RPNIndex],
+                       SharedRPN->Length * sizeof(uint16));
+                PoolIndex += SharedRPN->Length;
+                RPNPool[PoolIndex++] = LC_RPN_SHARED_END;
+
+                RPNIndex += SharedRPN->Length;
+                SharedRPN->Uses++;
+            } else {
+                RPNPool[PoolIndex++] = RPNEquation[RPNIndex++];
+            }
+        }
+
+        APSample->RPNLength = (uint16)(PoolIndex - APSample->RPNStart);
+    }
+
+    /*
+    ** Every use after the first of a shared subexpression saves
+    ** evaluating its operators
+    */
+    for (SharedIndex = 0; SharedIndex < LC_OperData.SharedRPNCount;
+         SharedIndex++) {
+        SharedRPN = &LC_OperData.SharedRPN[SharedIndex];
+
+        if (SharedRPN->Uses > 1) {
+            RPNEquation =
+                &LC_GetADTEquation(Table, SharedRPN->APNumber,
+                                   NULL)[SharedRPN->Offset];
+            SharedOperators = 0;
+
+            for (RPNIndex = 0; RPNIndex < SharedRPN->Length; RPNIndex++) {
+                if (((RPNEquation[RPNIndex] >= LC_RPN_AND) &&
+                     (RPNEquation[RPNIndex] <= LC_RPN_NOT)) ||
+                    LC_RPN_IS_VOTE(RPNEquation[RPNIndex])) {
+                    SharedOperators++;
+                }
+            }
+
+            SavedCount += (SharedRPN->Uses - 1) * SharedOperators;
+        }
+    }
+
+    CFE_EVS_SendEvent(LC_AP_SHARED_RPN_INF_EID, CFE_EVS_EventType_INFORMATION,
+                      "Shared AP subexpressions: Count = %d, Saved = %d/%d",
+                      LC_OperData.SharedRPNCount, (int)SavedCount,
+                      (int)OperatorCount);
+
+    return;
+
+} /* end LC_CreateSharedRPN */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Find the subtrees of the equations that may share               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_HashRPNSubtrees(void) {
+    const LC_ADT_t *Table = (const LC_ADT_t *)LC_OperData.ADTPtr;
+    const LC_APSample_t *APSample;
+    const LC_RPNSubtree_t *Other;
+    LC_RPNSubtree_t *Subtree;
+    const uint16 *RPNEquation;
+    uint32 StackHash[LC_MAX_RPN_STACK_DEPTH];
+    uint16 StackStart[LC_MAX_RPN_STACK_DEPTH];
+    uint32 TableIndex;
+    uint32 Hash;
+    uint32 Bucket;
+    uint16 SubtreeCount = 0;
+    uint16 StackDepth;
+    uint16 RPNIndex;
+    uint16 RPNWord;
+    uint16 Operands;
+    uint16 Operand;
+    uint16 Start;
+    uint16 Match;
+
+    for (Bucket = 0; Bucket < (1 << LC_RPN_SUBTREE_HASH_BITS); Bucket++) {
+        LC_OperData.RPNSubtreeBuckets[Bucket] = LC_RPN_NO_SUBTREE;
+    }
+
+    for (TableIndex = 0; TableIndex < LC_MAX_ACTIONPOINTS; TableIndex++) {
+        LC_OperData.APSubtreeStart[TableIndex] = SubtreeCount;
+
+        APSample = &LC_OperData.APSamples[TableIndex];
+
+        if ((APSample->Verified == false) || (APSample->Grouped == true)) {
+            continue;
+        }
+
+        RPNEquation = LC_GetADTEquation(Table, (uint16)TableIndex, NULL);
+        StackDepth  = 0;
+
+        /*
+        ** One pass over the words before the final LC_RPN_EQUAL. The
+        ** stack holds the first word and the hash of each operand, so
+        ** an operator finds the span of its subtree and hashes it from
+        ** its operands without looking at their words again.
+        */
+        for (RPNIndex = 0; (RPNIndex + 1) < APSample->RPNLength; RPNIndex++) {
+            RPNWord = RPNEquation[RPNIndex];
+
+            if ((RPNWord == LC_RPN_AND) || (RPNWord == LC_RPN_OR) ||
+                (RPNWord == LC_RPN_XOR)) {
+                Operands = 2;
+            } else if (RPNWord == LC_RPN_NOT) {
+                Operands = 1;
+            } else if (LC_RPN_IS_VOTE(RPNWord)) {
+                Operands = LC_RPN_VOTE_N(RPNWord);
+            } else {
+                Operands = 0;
+            }
+
+            if (Operands == 0) {
+                Start = RPNIndex;
+                Hash  = ((uint32)RPNWord + 1) * 0x9E3779B1;
+            } else {
+                StackDepth -= Operands;
+                Start = StackStart[StackDepth];
+                Hash  = (uint32)RPNWord + 1;
+
+                for (Operand = 0; Operand < Operands; Operand++) {
+                    Hash = (Hash * 0x01000193) ^
+                           StackHash[StackDepth + Operand];
+                }
+
+                Hash *= 0x9E3779B1;
+            }
+
+            StackStart[StackDepth] = Start;
+            StackHash[StackDepth]  = Hash;
+            StackDepth++;
+
+            /*
+            ** Subexpressions of fewer than 3 words cost more to share
+            ** than to evaluate
+            */
+            if (((RPNIndex - Start) < 2) ||
+                (SubtreeCount >= LC_MAX_RPN_SUBTREES)) {
+                continue;
+            }
+
+            Subtree              = &LC_OperData.RPNSubtrees[SubtreeCount];
+            Subtree->Hash        = Hash;
+            Subtree->APNumber    = (uint16)TableIndex;
+            Subtree->Offset      = Start;
+            Subtree->Length      = RPNIndex - Start + 1;
+            Subtree->Count       = 1;
+            Subtree->SharedIndex = LC_RPN_NO_SUBTREE;
+            Subtree->Spare       = 0;
+
+            /*
+            ** Look for the same words in the bucket, the hash only
+            ** picks the candidates
+            */
+            Bucket = Hash >> (32 - LC_RPN_SUBTREE_HASH_BITS);
+            Match  = LC_OperData.RPNSubtreeBuckets[Bucket];
+
+            while (Match != LC_RPN_NO_SUBTREE) {
+                Other = &LC_OperData.RPNSubtrees[Match];
+
+                if ((Other->Hash == Hash) &&
+                    (Other->Length == Subtree->Length) &&
+                    (memcmp(&LC_GetADTEquation(Table, Other->APNumber,
+                                               NULL)[Other->Offset],
+                            &RPNEquation[Start],
+                            Subtree->Length * sizeof(uint16)) == 0)) {
+                    break;
+                }
+
+                Match = Other->Next;
+            }
+
+            if (Match == LC_RPN_NO_SUBTREE) {
+                Subtree->Match = SubtreeCount;
+                Subtree->Next  = LC_OperData.RPNSubtreeBuckets[Bucket];
+                LC_OperData.RPNSubtreeBuckets[Bucket] = SubtreeCount;
+            } else {
+                Subtree->Match = Match;
+                Subtree->Next  = LC_RPN_NO_SUBTREE;
+
+                if (LC_OperData.RPNSubtrees[Match].Count < 0xFFFF) {
+                    LC_OperData.RPNSubtrees[Match].Count++;
+                }
+            }
+
+            SubtreeCount++;
+        }
+    }
+
+    LC_OperData.APSubtreeStart[LC_MAX_ACTIONPOINTS] = SubtreeCount;
+
+    return;
+
+} /* end LC_HashRPNSubtrees */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Find the shared subexpression at a position in an equation      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+LC_SharedRPN_t *LC_FindSharedRPN(uint16 APNumber, uint16 RPNIndex,
+                                 bool AddNew) {
+    const LC_RPNSubtree_t *Subtree;
+    LC_RPNSubtree_t *FirstSubtree;
+    LC_SharedRPN_t *SharedRPN;
+    uint16 SubtreeIndex;
+
+    /*
+    ** The subtrees of an equation are in the order of their last
+    ** word, so walking back tries those that start at RPNIndex
+    ** longest first
+    */
+    for (SubtreeIndex = LC_OperData.APSubtreeStart[APNumber + 1];
+         SubtreeIndex > LC_OperData.APSubtreeStart[APNumber];
+         SubtreeIndex--) {
+        Subtree = &LC_OperData.RPNSubtrees[SubtreeIndex - 1];
+
+        if (Subtree->Offset != RPNIndex) {
+            continue;
+        }
+
+        FirstSubtree = &LC_OperData.RPNSubtrees[Subtree->Match];
+
+        if (FirstSubtree->SharedIndex != LC_RPN_NO_SUBTREE) {
+            return (&LC_OperData.SharedRPN[FirstSubtree->SharedIndex]);
+        }
+
+        /*
+        ** New subexpressions are only shared if they occur again
+        */
+        if ((AddNew == true) && (FirstSubtree->Count >= 2) &&
+            (LC_OperData.SharedRPNCount < LC_MAX_SHARED_RPN)) {
+            FirstSubtree->SharedIndex = LC_OperData.SharedRPNCount;
+
+            SharedRPN =
+                &LC_OperData.SharedRPN[LC_OperData.SharedRPNCount++];
+            SharedRPN->APNumber = APNumber;
+            SharedRPN->Offset   = RPNIndex;
+            SharedRPN->Length   = Subtree->Length;
+            SharedRPN->Uses     = 0;
+            SharedRPN->Result   = LC_WATCH_STALE;
+            SharedRPN->Valid    = false;
+
+            return (SharedRPN);
+        }
+    }
+
+    return (NULL);
+
+} /* end LC_FindSharedRPN */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Evaluate a K of N vote                                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint16 LC_EvaluateVote(uint16 VoteWord, const uint16 *Operands) {
+    uint16 OperandCount = LC_RPN_VOTE_N(VoteWord);
+    uint16 TrueNeeded   = LC_RPN_VOTE_K(VoteWord);
+    uint16 TrueCount    = 0;
+    uint16 FalseCount   = 0;
+    uint16 OperandIndex;
+    bool HaveError = false;
+
+    for (OperandIndex = 0; OperandIndex < OperandCount; OperandIndex++) {
+        if (Operands[OperandIndex] == LC_WATCH_TRUE) {
+            TrueCount++;
+        } else if (Operands[OperandIndex] == LC_WATCH_ERROR) {
+            HaveError = true;
+        } else if (Operands[OperandIndex] != LC_WATCH_STALE) {
+            FalseCount++;
+        }
+    }
+
+    /*
+    ** Enough TRUE operands decide the result, as do enough FALSE
+    ** operands that the rest can't make up K. Otherwise it is
+    ** unknown, ERROR before STALE as for the other operators.
+    */
+    if (TrueCount >= TrueNeeded) {
+        return (LC_WATCH_TRUE);
+    } else if ((FalseCount + TrueNeeded) > OperandCount) {
+        return (LC_WATCH_FALSE);
+    } else if (HaveError == true) {
+        return (LC_WATCH_ERROR);
+    } else {
+        return (LC_WATCH_STALE);
+    }
+
+} /* end LC_EvaluateVote */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Evaluate a K of N vote for every lane of a group                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_EvaluateVoteGroup(uint16 VoteWord, uint32 *ValidBits,
+                          uint32 *ValueBits) {
+    uint32 TrueAtLeast[LC_MAX_RPN_STACK_DEPTH + 1];
+    uint32 FalseAtLeast[LC_MAX_RPN_STACK_DEPTH + 1];
+    uint16 OperandCount = LC_RPN_VOTE_N(VoteWord);
+    uint16 TrueNeeded   = LC_RPN_VOTE_K(VoteWord);
+    uint16 FalseNeeded  = OperandCount - TrueNeeded + 1;
+    uint16 OperandIndex;
+    uint16 Count;
+    uint32 TrueBits;
+    uint32 FalseBits;
+    uint32 Errors = 0;
+
+    /*
+    ** Entry j of each count is the lanes with at least j TRUE (or
+    ** FALSE) operands so far, one bit per lane
+    */
+    TrueAtLeast[0]  = 0xFFFFFFFF;
+    FalseAtLeast[0] = 0xFFFFFFFF;
+
+    for (Count = 1; Count <= OperandCount; Count++) {
+        TrueAtLeast[Count]  = 0;
+        FalseAtLeast[Count] = 0;
+    }
+
+    for (OperandIndex = 0; OperandIndex < OperandCount; OperandIndex++) {
+        TrueBits  = ValidBits[OperandIndex] & ValueBits[OperandIndex];
+        FalseBits = ValidBits[OperandIndex] & ~ValueBits[OperandIndex];
+        Errors |= ~ValidBits[OperandIndex] & ValueBits[OperandIndex];
+
+        for (Count = TrueNeeded; Count > 0; Count--) {
+            TrueAtLeast[Count] |= TrueAtLeast[Count - 1] & TrueBits;
+        }
+
+        for (Count = FalseNeeded; Count > 0; Count--) {
+            FalseAtLeast[Count] |= FalseAtLeast[Count - 1] & FalseBits;
+        }
+    }
+
+    /*
+    ** The lanes that are neither are ERROR when any operand is
+    */
+    ValidBits[0] = TrueAtLeast[TrueNeeded] | FalseAtLeast[FalseNeeded];
+    ValueBits[0] = TrueAtLeast[TrueNeeded] | (~ValidBits[0] & Errors);
+
+    return;
+
+} /* end LC_EvaluateVoteGroup */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Order the actionpoints so each follows those it references      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint16 LC_OrderActionpoints(const LC_ADT_t *Table, uint16 *APOrder) {
+    bool Ordered[LC_MAX_ACTIONPOINTS];
+    const uint16 *RPNEquation;
+    uint32 TableIndex;
+    uint16 OrderCount = 0;
+    uint16 OrderedCount;
+    uint16 RPNLength;
+    uint16 RPNIndex;
+    uint16 RPNData;
+    bool Ready;
+    bool Progress;
+
+    memset(Ordered, 0, sizeof(Ordered));
+
+    /*
+    ** Each pass takes, in table order, the actionpoints whose references
+    ** have all been taken, so without references this is the table
+    ** order. Unused entries reference nothing.
+    */
+    do {
+        Progress = false;
+
+        for (TableIndex = 0; TableIndex < LC_MAX_ACTIONPOINTS; TableIndex++) {
+            if (Ordered[TableIndex] == true) {
+                continue;
+            }
+
+            Ready = true;
+            RPNEquation =
+                LC_GetADTEquation(Table, (uint16)TableIndex, &RPNLength);
+
+            if (Table->Entries[TableIndex].DefaultState != LC_ACTION_NOT_USED) {
+                for (RPNIndex = 0; (RPNIndex < RPNLength) &&
+                                   (RPNEquation[RPNIndex] != LC_RPN_EQUAL);
+                     RPNIndex++) {
+                    RPNData = RPNEquation[RPNIndex];
+
+                    if (LC_RPN_IS_AP(RPNData) &&
+                        (LC_RPN_AP_NUMBER(RPNData) < LC_MAX_ACTIONPOINTS) &&
+                        (Ordered[LC_RPN_AP_NUMBER(RPNData)] == false)) {
+                        Ready = false;
+                        break;
+                    }
+                }
+            }
+
+            if (Ready == true) {
+                APOrder[OrderCount++] = (uint16)TableIndex;
+                Ordered[TableIndex]   = true;
+                Progress              = true;
+            }
+        }
+    } while ((Progress == true) && (OrderCount < LC_MAX_ACTIONPOINTS));
+
+    /*
+    ** Whatever is in a cycle, or uses one, goes last in table order
+    */
+    OrderedCount = OrderCount;
+
+    for (TableIndex = 0; TableIndex < LC_MAX_ACTIONPOINTS; TableIndex++) {
+        if (Ordered[TableIndex] == false) {
+            APOrder[OrderCount++] = (uint16)TableIndex;
+        }
+    }
+
+    return (OrderedCount);
+
+} /* end LC_OrderActionpoints */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Check whether an equation uses another actionpoint's result     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool LC_RPNReferencesAP(uint16 APNumber) {
+    const LC_APSample_t *APSample = &LC_OperData.APSamples[APNumber];
+    const uint16 *RPNEquation     = &LC_OperData.RPNPool[APSample->RPNStart];
+    uint16 RPNIndex;
+
+    for (RPNIndex = 0; RPNIndex < APSample->RPNLength; RPNIndex++) {
+        if (LC_RPN_IS_AP(RPNEquation[RPNIndex])) {
+            return (true);
+        }
+    }
+
+    return (false);
+
+} /* end LC_RPNReferencesAP */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Find an actionpoint's equation in the ADT RPN pool              */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+const uint16 *LC_GetADTEquation(const LC_ADT_t *Table, uint16 APNumber,
+                                uint16 *RPNLengthPtr) {
+    const LC_ADTEntry_t *ADTEntry = &Table->Entries[APNumber];
+    const uint16 *RPNEquation     = Table->RPNPool;
+    uint16 RPNLength              = 0;
+
+    /*
+    ** An entry that didn't pass validation may reach outside the
+    ** pool, only the words inside it are used
+    */
+    if (ADTEntry->RPNOffset < LC_MAX_RPN_POOL_SIZE) {
+        RPNEquation = &Table->RPNPool[ADTEntry->RPNOffset];
+        RPNLength   = ADTEntry->RPNLength;
+
+        if (RPNLength > (LC_MAX_RPN_POOL_SIZE - ADTEntry->RPNOffset)) {
+            RPNLength = LC_MAX_RPN_POOL_SIZE - ADTEntry->RPNOffset;
+        }
+    }
+
+    if (RPNLengthPtr != NULL) {
+        *RPNLengthPtr = RPNLength;
+    }
+
+    return (RPNEquation);
+
+} /* end LC_GetADTEquation */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Index the actionpoints that are active or passive               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_IndexLiveAPs(void) {
+    uint16 OrderIndex;
+    uint16 TableIndex;
+    uint8 CurrentAPState;
+
+    LC_OperData.LiveAPCount = 0;
+
+    for (OrderIndex = 0; OrderIndex < LC_MAX_ACTIONPOINTS; OrderIndex++) {
+        /*
+        ** Keep the sample order, each actionpoint after the actionpoints
+        ** whose results its equation uses
+        */
+        if (LC_OperData.HaveAPReferences == true) {
+            TableIndex = LC_OperData.APSampleOrder[OrderIndex];
+        } else {
+            TableIndex = OrderIndex;
+        }
+
+        CurrentAPState = LC_OperData.APSamples[TableIndex].CurrentState;
+
+        if ((CurrentAPState == LC_APSTATE_ACTIVE) ||
+            (CurrentAPState == LC_APSTATE_PASSIVE)) {
+            LC_OperData.LiveAPs[LC_OperData.LiveAPCount++] = TableIndex;
+        }
+    }
+
+    return;
+
+} /* end LC_IndexLiveAPs */
+
 /************************/
 /*  End of File Comment */
 /************************/
@@ -26,6 +26,7 @@
 ** Includes
 *************************************************************************/
 #include "cfe.h"
+#include "lc_app.h"
 
 /************************************************************************
 ** Macro Definitions
@@ -58,7 +59,8 @@
 **       within the bounds of the actionpoint table.
 **
 **  \par Assumptions, External Events, and Notes:
-**       None
+**       Actionpoints whose equations use other actionpoint results
+**       are sampled after those actionpoints
 **
 **  \param [in]   StartIndex   The first actionpoint to sample
 **                             (zero based actionpoint table index)
@@ -95,6 +97,10 @@ void LC_SampleAPs(uint16 StartIndex, uint16 EndIndex);
 *\endcode
 **  \retcode #LC_ADTVAL_ERR_RPN      \retdesc \copydoc LC_ADTVAL_ERR_RPN
 *\endcode
+**  \retcode #LC_ADTVAL_ERR_APCYCLE  \retdesc \copydoc LC_ADTVAL_ERR_APCYCLE
+*\endcode
+**  \retcode #LC_ADTVAL_ERR_RPNPOOL  \retdesc \copydoc LC_ADTVAL_ERR_RPNPOOL
+*\endcode
 **  \endreturns
 **
 **  \sa #LC_ValidateWDT
@@ -127,7 +133,8 @@ void LC_SampleSingleAP(uint16 APNumber);
 **       actionpoint and returns the result
 **
 **  \par Assumptions, External Events, and Notes:
-**       None
+**       Equations accepted by #LC_VerifyRPN are handed to
+**       #LC_EvaluateVerifiedRPN unless #LC_CHECKED_RPN is defined
 **
 **  \param [in]   APNumber     The actionpoint number to evaluate (zero
 **                             based actionpoint definition table index)
@@ -142,6 +149,27 @@ void LC_SampleSingleAP(uint16 APNumber);
 *************************************************************************/
 uint8 LC_EvaluateRPN(uint16 APNumber);
 
+/************************************************************************/
+/** \brief Evaluate verified RPN
+**
+**  \par Description
+**       Support function for #LC_EvaluateRPN that evaluates an
+**       equation accepted by #LC_VerifyRPN without any stack, operand
+**       or length checks
+**
+**  \par Assumptions, External Events, and Notes:
+**       Not used when #LC_CHECKED_RPN is defined
+**
+**  \param [in]   APNumber     The actionpoint number to evaluate (zero
+**                             based actionpoint definition table index)
+**
+**  \returns
+**  \retstmt Returns the same result as #LC_EvaluateRPN \endcode
+**  \endreturns
+**
+*************************************************************************/
+uint8 LC_EvaluateVerifiedRPN(uint16 APNumber);
+
 /************************************************************************/
 /** \brief Validate RPN expression
 **
@@ -151,10 +179,13 @@ uint8 LC_EvaluateRPN(uint16 APNumber);
 **       possible errors.
 **
 **  \par Assumptions, External Events, and Notes:
-**       None
+**       An equation whose stack grows deeper than
+**       #LC_MAX_RPN_STACK_DEPTH is an error
 **
 **  \param [in]   RPNPtr            Pointer to the RPN equation
 **
+**  \param [in]   RPNLength         Number of words the equation may use
+**
 **  \param [in]   IndexValue        A pointer where to store the equation
 **                                  index value if an error is detected
 **
@@ -177,7 +208,444 @@ uint8 LC_EvaluateRPN(uint16 APNumber);
 **  \sa #LC_ValidateADT
 **
 *************************************************************************/
-int32 LC_ValidateRPN(uint16 *RPNPtr, int32 *IndexValue, int32 *StackDepthValue);
+int32 LC_ValidateRPN(uint16 *RPNPtr, uint16 RPNLength, int32 *IndexValue,
+                     int32 *StackDepthValue);
+
+/************************************************************************/
+/** \brief Compile actionpoints
+**
+**  \par Description
+**       Builds the sampling record of every actionpoint from the
+**       actionpoint definition table (ADT) and packs the RPN
+**       equations end to end into the RPN pool, so sampling never
+**       has to touch the ADT unless an actionpoint fails or changes
+**       result
+**
+**  \par Assumptions, External Events, and Notes:
+**       Must be called whenever the ADT pointer is acquired for new
+**       table data.  Only the configuration fields of the sampling
+**       records are written, the current state, last result and
+**       consecutive fail count are left as they are
+**
+*************************************************************************/
+void LC_CompileActionpoints(void);
+
+/************************************************************************/
+/** \brief Create actionpoint dependencies
+**
+**  \par Description
+**       Support function for #LC_CompileActionpoints that indexes, for
+**       each watchpoint, the actionpoints whose RPN equation uses its
+**       result
+**
+**  \par Assumptions, External Events, and Notes:
+**       The RPN pool and the sampling records must already be built.
+**       If the index doesn't fit in APDependents, APDependOverflow is
+**       set and the index is left empty
+**
+**  \sa #LC_MarkAPsDirty
+**
+*************************************************************************/
+void LC_CreateAPDependencies(void);
+
+/************************************************************************/
+/** \brief Mark dependent actionpoints dirty
+**
+**  \par Description
+**       Flags every actionpoint whose RPN equation uses the specified
+**       watchpoint, so its equation is evaluated again the next time
+**       it is sampled.  Called whenever the watchpoint result changes
+**
+**  \par Assumptions, External Events, and Notes:
+**       Passing #LC_AP_DEPEND_INDEX of an actionpoint instead flags
+**       every actionpoint whose equation uses that actionpoint's result.
+**       Every actionpoint is flagged when the dependency index
+**       overflowed
+**
+**  \param [in]   WatchIndex   The watchpoint whose result changed (zero
+**                             based watchpoint definition table index)
+**
+*************************************************************************/
+void LC_MarkAPsDirty(uint16 WatchIndex);
+
+/************************************************************************/
+/** \brief Create actionpoint groups
+**
+**  \par Description
+**       Support function for #LC_CompileActionpoints that sorts the
+**       actionpoints by the shape of their RPN equation and turns each
+**       run of at least #LC_AP_GROUP_MIN_LANES actionpoints with the
+**       same shape into groups that are evaluated together
+**
+**  \par Assumptions, External Events, and Notes:
+**       The RPN pool and the sampling records must already be built
+**
+**  \sa #LC_EvaluateAPGroups
+**
+*************************************************************************/
+void LC_CreateAPGroups(void);
+
+/************************************************************************/
+/** \brief Verify RPN equation
+**
+**  \par Description
+**       Support function for #LC_CompileActionpoints that checks whether
+**       a compiled actionpoint equation only uses valid watchpoint and
+**       actionpoint numbers and operators, never pops an empty stack or
+**       pushes past #LC_MAX_RPN_STACK_DEPTH and ends with exactly one
+**       result on the stack at #LC_RPN_EQUAL
+**
+**  \par Assumptions, External Events, and Notes:
+**       Verified equations are evaluated by #LC_EvaluateVerifiedRPN
+**       and may be grouped by #LC_CreateAPGroups
+**
+**  \param [in]   APNumber     The actionpoint number to check (zero
+**                             based actionpoint definition table index)
+**
+**  \returns
+**  \retstmt Returns true if the equation needs no runtime checks \endcode
+**  \retstmt Returns false if it is left to #LC_EvaluateRPN        \endcode
+**  \endreturns
+**
+*************************************************************************/
+bool LC_VerifyRPN(uint16 APNumber);
+
+/************************************************************************/
+/** \brief Compare RPN equation shapes
+**
+**  \par Description
+**       Support function for #LC_CreateAPGroups that orders two
+**       actionpoint equations by length and then by their words,
+**       treating every watchpoint number as the same word
+**
+**  \par Assumptions, External Events, and Notes:
+**       None
+**
+**  \param [in]   APNumber1    The first actionpoint number
+**
+**  \param [in]   APNumber2    The second actionpoint number
+**
+**  \returns
+**  \retstmt Returns -1, 0 or 1 as the first equation's shape sorts
+**           before, the same as or after the second's \endcode
+**  \endreturns
+**
+*************************************************************************/
+int32 LC_CompareRPNShapes(uint16 APNumber1, uint16 APNumber2);
+
+/************************************************************************/
+/** \brief Evaluate actionpoint groups
+**
+**  \par Description
+**       Evaluates every actionpoint group that has a member about to
+**       be sampled that needs its equation evaluated, and leaves the
+**       result in each such member's sampling record for
+**       #LC_SampleSingleAP to pick up
+**
+**  \par Assumptions, External Events, and Notes:
+**       If any watch result is not TRUE, FALSE, ERROR or STALE no
+**       group is evaluated and all equations are left to
+**       #LC_EvaluateRPN
+**
+**  \param [in]   StartIndex   The first actionpoint to be sampled
+**
+**  \param [in]   EndIndex     The last actionpoint to be sampled
+**
+*************************************************************************/
+void LC_EvaluateAPGroups(uint16 StartIndex, uint16 EndIndex);
+
+/************************************************************************/
+/** \brief Build watch result bit planes
+**
+**  \par Description
+**       Splits the watch results into a valid plane, set for TRUE and
+**       FALSE, and a value plane, set for TRUE and ERROR, with one bit
+**       per watchpoint
+**
+**  \par Assumptions, External Events, and Notes:
+**       None
+**
+**  \returns
+**  \retstmt Returns true if every watch result could be represented \endcode
+**  \retstmt Returns false if a custom function made up a result     \endcode
+**  \endreturns
+**
+*************************************************************************/
+bool LC_BuildWatchPlanes(void);
+
+/************************************************************************/
+/** \brief Evaluate an actionpoint group
+**
+**  \par Description
+**       Runs the equation shape of a group once over words holding one
+**       bit per actionpoint, gathering each actionpoint's watchpoint
+**       results from the bit planes
+**
+**  \par Assumptions, External Events, and Notes:
+**       The watch result bit planes must be up to date
+**
+**  \param [in]   Group         The actionpoint group to evaluate
+**
+**  \param [out]  *ValidBitsPtr Lanes whose result is PASS or FAIL
+**
+**  \param [out]  *ValueBitsPtr Lanes whose result is FAIL, or ERROR
+**                              when not valid
+**
+*************************************************************************/
+void LC_EvaluateAPGroup(const LC_APGroup_t *Group, uint32 *ValidBitsPtr,
+                        uint32 *ValueBitsPtr);
+
+/************************************************************************/
+/** \brief Synchronize actionpoint results table
+**
+**  \par Description
+**       Copies the working current state, last result and consecutive
+**       fail count of each actionpoint into the actionpoint results
+**       table (ART) image
+**
+**  \par Assumptions, External Events, and Notes:
+**       Called before the ART is dumped or saved to the CDS
+**
+**  \sa #LC_LoadActionResults
+**
+*************************************************************************/
+void LC_SyncART(void);
+
+/************************************************************************/
+/** \brief Load actionpoint results
+**
+**  \par Description
+**       Copies the current state, last result and consecutive fail
+**       count of each actionpoint from the actionpoint results table
+**       (ART) image into the working copy used for sampling
+**
+**  \par Assumptions, External Events, and Notes:
+**       Called after the ART has been restored from the CDS
+**
+**  \sa #LC_SyncART
+**
+*************************************************************************/
+void LC_LoadActionResults(void);
+
+/************************************************************************/
+/** \brief Create shared RPN subexpressions
+**
+**  \par Description
+**       Support function for #LC_CompileActionpoints that finds the
+**       subexpressions that occur more than once in the verified
+**       equations that are not grouped and packs the RPN pool again,
+**       bracketing each occurrence with #LC_RPN_SHARED_BEGIN and
+**       #LC_RPN_SHARED_END so the subexpression is evaluated at most
+**       once per sample
+**
+**  \par Assumptions, External Events, and Notes:
+**       Must run after #LC_CreateAPDependencies and #LC_CreateAPGroups,
+**       which read the unbracketed pool. Not used when #LC_CHECKED_RPN
+**       is defined.
+**
+*************************************************************************/
+void LC_CreateSharedRPN(void);
+
+/************************************************************************/
+/** \brief Hash RPN subtrees
+**
+**  \par Description
+**       Support function for #LC_CreateSharedRPN that finds every
+**       subexpression of 3 or more words in the verified equations
+**       that are not grouped, in one pass over each equation, and
+**       counts the occurrences of each by hash, confirming a match by
+**       comparing the words
+**
+**  \par Assumptions, External Events, and Notes:
+**       The equations are read from the ADT. The subtrees are kept in
+**       RPNSubtrees until the next table load. Subtrees past
+**       #LC_MAX_RPN_SUBTREES are left out, so they are never shared.
+**
+*************************************************************************/
+void LC_HashRPNSubtrees(void);
+
+/************************************************************************/
+/** \brief Find shared RPN subexpression
+**
+**  \par Description
+**       Support function for #LC_CreateSharedRPN that looks for the
+**       longest shared subexpression starting at a word of an
+**       actionpoint equation
+**
+**  \par Assumptions, External Events, and Notes:
+**       #LC_HashRPNSubtrees must have found the subtrees of the
+**       equation
+**
+**  \param [in]   APNumber     The actionpoint number (zero based
+**                             actionpoint definition table index)
+**
+**  \param [in]   RPNIndex     The word the subexpression starts at
+**
+**  \param [in]   AddNew       Whether a subexpression that occurs
+**                             more than once in the equations may be
+**                             added to the shared subexpressions
+**
+**  \returns
+**  \retstmt Returns a pointer to the shared subexpression  \endcode
+**  \retstmt Returns NULL if none starts at RPNIndex        \endcode
+**  \endreturns
+**
+*************************************************************************/
+LC_SharedRPN_t *LC_FindSharedRPN(uint16 APNumber, uint16 RPNIndex,
+                                 bool AddNew);
+
+/************************************************************************/
+/** \brief Evaluate K of N vote
+**
+**  \par Description
+**       Support function for actionpoint processing that evaluates a
+**       #LC_RPN_VOTE operator over its N operands
+**
+**  \par Assumptions, External Events, and Notes:
+**       None
+**
+**  \param [in]   VoteWord     The #LC_RPN_VOTE operator word
+**
+**  \param [in]   Operands     Pointer to the first of the N operands
+**
+**  \returns
+**  \retcode #LC_WATCH_TRUE   \retdesc \copydoc LC_WATCH_TRUE  \endcode
+**  \retcode #LC_WATCH_FALSE  \retdesc \copydoc LC_WATCH_FALSE \endcode
+**  \retcode #LC_WATCH_ERROR  \retdesc \copydoc LC_WATCH_ERROR \endcode
+**  \retcode #LC_WATCH_STALE  \retdesc \copydoc LC_WATCH_STALE \endcode
+**  \endreturns
+**
+*************************************************************************/
+uint16 LC_EvaluateVote(uint16 VoteWord, const uint16 *Operands);
+
+/************************************************************************/
+/** \brief Evaluate K of N vote for a group
+**
+**  \par Description
+**       Support function for #LC_EvaluateAPGroup that evaluates a
+**       #LC_RPN_VOTE operator for every lane of a group by keeping,
+**       for each count up to K, the lanes with at least that many
+**       TRUE operands, and likewise for FALSE operands
+**
+**  \par Assumptions, External Events, and Notes:
+**       K must be no more than N
+**
+**  \param [in]   VoteWord     The #LC_RPN_VOTE operator word
+**
+**  \param [in]   ValidBits    Pointer to the valid bits of the first of
+**                             the N operands
+**
+**  \param [in]   ValueBits    Pointer to the value bits of the first of
+**                             the N operands
+**
+**  \param [out]  *ValidBits   The valid bits of the result replace the
+**                             first operand's
+**
+**  \param [out]  *ValueBits   The value bits of the result replace the
+**                             first operand's
+**
+*************************************************************************/
+void LC_EvaluateVoteGroup(uint16 VoteWord, uint32 *ValidBits,
+                          uint32 *ValueBits);
+
+/************************************************************************/
+/** \brief Order actionpoints by reference
+**
+**  \par Description
+**       Support function for #LC_ValidateADT and #LC_CompileActionpoints
+**       that lists the actionpoints so each comes after every
+**       actionpoint whose result its equation uses (#LC_RPN_AP).
+**       Actionpoints without references keep their table order
+**
+**  \par Assumptions, External Events, and Notes:
+**       Actionpoints that are in a reference cycle, or that use one, are
+**       listed last in table order
+**
+**  \param [in]   Table        Pointer to the actionpoint definition table
+**
+**  \param [in]   APOrder      Pointer to a list with room for
+**                             #LC_MAX_ACTIONPOINTS entries
+**
+**  \param [out]  *APOrder     Every actionpoint number in sample order
+**
+**  \returns
+**  \retstmt Returns the number of actionpoints at the start of APOrder
+**           that follow every actionpoint they reference, less than
+**           #LC_MAX_ACTIONPOINTS when there is a cycle \endcode
+**  \endreturns
+**
+*************************************************************************/
+uint16 LC_OrderActionpoints(const LC_ADT_t *Table, uint16 *APOrder);
+
+/************************************************************************/
+/** \brief Check for actionpoint result operands
+**
+**  \par Description
+**       Support function for #LC_CompileActionpoints that checks whether
+**       a compiled actionpoint equation uses the result of any
+**       actionpoint (#LC_RPN_AP)
+**
+**  \par Assumptions, External Events, and Notes:
+**       None
+**
+**  \param [in]   APNumber     The actionpoint number to check (zero
+**                             based actionpoint definition table index)
+**
+**  \returns
+**  \retstmt Returns true if the equation uses an actionpoint result \endcode
+**  \retstmt Returns false if it only uses watchpoint results        \endcode
+**  \endreturns
+**
+*************************************************************************/
+bool LC_RPNReferencesAP(uint16 APNumber);
+
+/************************************************************************/
+/** \brief Get actionpoint equation
+**
+**  \par Description
+**       Support function for actionpoint processing that finds the
+**       reverse polish equation an actionpoint definition selects
+**       in the RPN pool of the actionpoint definition table
+**
+**  \par Assumptions, External Events, and Notes:
+**       The length is limited to the end of the pool, so an entry
+**       that has not been validated can't reach outside the table
+**
+**  \param [in]   Table         Pointer to the actionpoint definition table
+**
+**  \param [in]   APNumber      The actionpoint number (zero based
+**                              actionpoint definition table index)
+**
+**  \param [in]   RPNLengthPtr  A pointer where to store the number of
+**                              words the equation may use, or NULL
+**
+**  \param [out]  *RPNLengthPtr Number of words the equation may use, the
+**                              equation ends at the first #LC_RPN_EQUAL
+**
+**  \returns
+**  \retstmt Returns a pointer to the first word of the equation \endcode
+**  \endreturns
+**
+*************************************************************************/
+const uint16 *LC_GetADTEquation(const LC_ADT_t *Table, uint16 APNumber,
+                                uint16 *RPNLengthPtr);
+
+/************************************************************************/
+/** \brief Index live actionpoints
+**
+**  \par Description
+**       Lists the actionpoints whose current state is active or passive
+**       in the order they are sampled, so a sample of a range of
+**       actionpoints doesn't visit the entries that are not used,
+**       disabled or permanently off
+**
+**  \par Assumptions, External Events, and Notes:
+**       Called after anything but a sample changes the current state
+**       of an actionpoint. A sample only moves actionpoints from active
+**       to passive, which doesn't change the index
+**
+*************************************************************************/
+void LC_IndexLiveAPs(void);
 
 #endif /* _lc_action_ */
 
@@ -264,6 +264,12 @@ int32 LC_SbInit(void) {
     CFE_SB_InitMsg(&LC_OperData.HkPacket, LC_HK_TLM_MID, sizeof(LC_HkPacket_t),
                    false);
 
+    /*
+    ** Initialize MessageID statistics packet...
+    */
+    CFE_SB_InitMsg(&LC_OperData.MIDStatsPacket, LC_MID_STATS_TLM_MID,
+                   sizeof(LC_MIDStatsPkt_t), false);
+
     /*
     ** Create Software Bus message pipe...
     */
@@ -417,6 +423,12 @@ int32 LC_TableInit(void) {
          LC_ADT_TBL_RESTORED)) {
         LC_OperData.TableResults |= LC_CDS_RESTORED;
 
+        /*
+        ** Evaluation uses the working copy of the restored results
+        */
+        LC_LoadWatchResults();
+        LC_LoadActionResults();
+
         /*
         ** Get a pointer to the watchpoint definition table data...
         */
@@ -442,6 +454,8 @@ int32 LC_TableInit(void) {
                               (unsigned int)Result);
             return (Result);
         }
+
+        LC_CompileActionpoints();
     } else {
         if ((Result = LC_LoadDefaultTables()) != CFE_SUCCESS) {
             return (Result);
@@ -617,7 +631,7 @@ int32 LC_CreateDefinitionTables(void) {
     /*
     ** Register the Actionpoint Definition Table (ADT)
     */
-    DataSize = LC_MAX_ACTIONPOINTS * sizeof(LC_ADTEntry_t);
+    DataSize = sizeof(LC_ADT_t);
     Result   = CFE_TBL_Register(&LC_OperData.ADTHandle, LC_ADT_TABLENAME,
                               DataSize, OptionFlags, LC_ValidateADT);
 
@@ -885,6 +899,8 @@ int32 LC_LoadDefaultTables(void) {
         return (Result);
     }
 
+    LC_CompileActionpoints();
+
     /*
     ** Initialize the watchpoint and actionpoint result table data
     */
@@ -88,18 +88,275 @@
 #define LC_ADT_NOT_CRITICAL 0x00800000
 /** \} */
 
-/**  \name Hash table definitions - presumes MessageID as hash function input */
-#define LC_HASH_TABLE_ENTRIES 256
-#define LC_HASH_TABLE_MASK    0x00FF
+/**  \name Hash table definitions - presumes MessageID as hash function input
+**
+**  The hash table has at least twice as many entries as there can be
+**  watched MessageID's, so the perfect hash slots grow linearly with
+**  #LC_MAX_WATCHPOINTS, see #LC_CreatePerfectHash */
+/** \{ */
+#if LC_MAX_WATCHPOINTS <= 128
+#define LC_HASH_TABLE_BITS 8
+#elif LC_MAX_WATCHPOINTS <= 256
+#define LC_HASH_TABLE_BITS 9
+#elif LC_MAX_WATCHPOINTS <= 512
+#define LC_HASH_TABLE_BITS 10
+#elif LC_MAX_WATCHPOINTS <= 1024
+#define LC_HASH_TABLE_BITS 11
+#elif LC_MAX_WATCHPOINTS <= 2048
+#define LC_HASH_TABLE_BITS 12
+#elif LC_MAX_WATCHPOINTS <= 4096
+#define LC_HASH_TABLE_BITS 13
+#elif LC_MAX_WATCHPOINTS <= 8192
+#define LC_HASH_TABLE_BITS 14
+#elif LC_MAX_WATCHPOINTS <= 16384
+#define LC_HASH_TABLE_BITS 15
+#elif LC_MAX_WATCHPOINTS <= 32768
+#define LC_HASH_TABLE_BITS 16
+#else
+#define LC_HASH_TABLE_BITS 17
+#endif
+#define LC_HASH_TABLE_ENTRIES (1 << LC_HASH_TABLE_BITS)
+/** \} */
+
+/**
+** \name Watch result stale countdown timer wheel */
+/** \{ */
+#define LC_STALE_WHEEL_SIZE                                 \
+    128 /**< \brief Timer wheel slots, must be a power of \
+                    two                                   */
+#define LC_STALE_WHEEL_MASK (LC_STALE_WHEEL_SIZE - 1)
+/** \} */
+
+/**
+** \name Watchpoint MessageID perfect hash */
+/** \{ */
+#define LC_HASH_SLOT_ENTRIES                                    \
+    (8 * LC_MAX_WATCHPOINTS) /**< \brief Lookup slots, enough for the \
+                                         second level tables of any   \
+                                         set of watched MessageID's,  \
+                                         see #LC_CreatePerfectHash    */
+#define LC_HASH_MULTIPLIER_COUNT                       \
+    0x80000000 /**< \brief Odd 32 bit hash multipliers, \
+                           see #LC_GetHashMultiplier   */
+/** \} */
+
+/**
+** \name Compiled watchpoint comparison types */
+/** \{ */
+#define LC_EVAL_UNDEFINED 0 /**< \brief DataType could not be decoded */
+#define LC_EVAL_SIGNED    1 /**< \brief Signed integer comparison    */
+#define LC_EVAL_UNSIGNED  2 /**< \brief Unsigned integer comparison  */
+#define LC_EVAL_FLOAT     3 /**< \brief Floating point comparison    */
+/** \} */
+
+/**
+** \name Compiled watchpoint operator accept mask bits */
+/** \{ */
+#define LC_ACCEPT_LT   0x01 /**< \brief True when value < comparison  */
+#define LC_ACCEPT_EQ   0x02 /**< \brief True when value == comparison */
+#define LC_ACCEPT_GT   0x04 /**< \brief True when value > comparison  */
+#define LC_ACCEPT_NEAR 0x08 /**< \brief Floats within tolerance are equal */
+/** \} */
+
+/**
+** \name Compiled watchpoint batches */
+/** \{ */
+#define LC_BATCH_LANES                                      \
+    8 /**< \brief Most watchpoints compared as one batch, \
+                   sets the size of the lane buffers      */
+
+/** \brief Comparison type of a batch key, see #LC_GetBatchKey */
+#define LC_BATCH_KEY_TYPE(BatchKey) ((BatchKey) & 0x03)
+/** \} */
+
+/**
+** \name Compiled watchpoint extraction kernels */
+/** \{ */
+#define LC_EXTRACT_UINT8     0 /**< \brief One byte                    */
+#define LC_EXTRACT_NATIVE16  1 /**< \brief Two bytes in host order     */
+#define LC_EXTRACT_NATIVE32  2 /**< \brief Four bytes in host order    */
+#define LC_EXTRACT_SWAPPED16 3 /**< \brief Two bytes, swapped          */
+#define LC_EXTRACT_SWAPPED32 4 /**< \brief Four bytes, swapped         */
+/** \} */
+
+/**
+** \name Compiled watchpoint threshold ladders */
+/** \{ */
+#define LC_LADDER_MIN_RUNGS                                 \
+    3 /**< \brief Fewest watchpoints on one datum that are \
+                   evaluated as a threshold ladder          */
+#define LC_LADDER_MAX_RUNGS                                 \
+    255 /**< \brief Most watchpoints in one ladder, longer \
+                     ladders are split                     */
+/** \} */
+
+/**
+** \name Compiled watchpoint flag banks */
+/** \{ */
+#define LC_FLAG_BANK_MIN_FLAGS                                \
+    2 /**< \brief Fewest single bit watchpoints on one word \
+                   that are evaluated as a flag bank         */
+/** \} */
+
+/**
+** \name Actionpoint dependencies */
+/** \{ */
+#define LC_AP_DEPEND_INDEX(APNumber)                                  \
+    (LC_MAX_WATCHPOINTS + (APNumber)) /**< \brief Entry in APDependStart \
+                                                  for the actionpoints   \
+                                                  that use an            \
+                                                  actionpoint's result   */
+/** \} */
+
+/**
+** \name Actionpoint equation groups */
+/** \{ */
+#define LC_AP_GROUP_MIN_LANES                                  \
+    4 /**< \brief Fewest actionpoints with the same equation \
+                   shape that are evaluated as groups         */
+#define LC_AP_GROUP_MAX_LANES                                   \
+    32 /**< \brief Most actionpoints in one group, one per bit \
+                    of a plane word                             */
+#define LC_WATCH_PLANE_WORDS                                 \
+    ((LC_MAX_WATCHPOINTS + 31) / 32) /**< \brief Words in each \
+                                                 watch result   \
+                                                 bit plane      */
+/** \} */
+
+/**
+** \name Shared RPN subexpressions */
+/** \{ */
+#define LC_MAX_SHARED_RPN                                     \
+    LC_MAX_ACTIONPOINTS /**< \brief Most distinct subexpressions \
+                                    shared by actionpoint      \
+                                    equations                  */
+#define LC_RPN_SHARED_BEGIN                                    \
+    0xFFF6 /**< \brief Compiled RPN word that starts a shared \
+                       subexpression, followed by its index   \
+                       in SharedRPN and then its words        */
+#define LC_RPN_SHARED_END                                    \
+    0xFFF7 /**< \brief Compiled RPN word that ends a shared \
+                       subexpression                        */
+#define LC_RPN_SUBTREE_HASH_BITS                              \
+    10 /**< \brief log2 of the buckets in the RPN subtree hash \
+                    table                                      */
+#define LC_RPN_NO_SUBTREE                                      \
+    0xFFFF /**< \brief End of an RPN subtree hash bucket, and \
+                       SharedIndex of a subtree not shared    */
+/** \} */
+
+/**
+** \name Compiled array watchpoints */
+/** \{ */
+#define LC_NO_ELEMENT_RESULTS                            \
+    0xFFFF /**< \brief ElementResultStart of an array \
+                       watchpoint with no result bits  */
+/** \} */
 
-/**  \brief Linked list of Watchpoints that reference the same MessageID */
-typedef struct LC_WListTag {
-    struct LC_WListTag *Next; /**< \brief Next linked list element */
+/**
+** \name Message fingerprints */
+/** \{ */
+#define LC_SPAN_MERGE_GAP                                   \
+    8 /**< \brief Largest gap in bytes between two watched \
+                   byte ranges compared as one span       */
+/** \} */
+
+/**
+**  \brief Watchpoint datum extraction kernel
+**
+**  Loads a datum of the size and byte order it was selected for from a
+**  possibly misaligned message address and returns it zero extended
+*/
+typedef uint32 (*LC_ExtractFunc_t)(const uint8 *WPDataPtr);
+
+/**
+**  \brief Compiled watchpoint evaluation record
+**
+**  Built from a watchpoint definition table (WDT) entry when the
+**  table is loaded, so the per-message code path never has to decode
+**  the data type, byte order or comparison value again.
+*/
+typedef struct {
+    uint16 WatchIndex; /**< \brief Watchpoint table index             */
+    uint8 DataType;    /**< \brief WDT data type (for transitions)    */
+    uint8 OperatorID;  /**< \brief WDT operator                       */
+
+    uint8 DataSize;    /**< \brief Size of the datum in bytes         */
+    uint8 CompareType; /**< \brief Comparison family, see
+                                    #LC_EVAL_SIGNED and friends        */
+    uint8 AcceptMask;  /**< \brief Operator as #LC_ACCEPT_LT etc. bits,
+                                    zero if not a relational operator */
+    uint8 BatchCount;  /**< \brief Records from this one that are
+                                    compared as a batch, 1 if the
+                                    watchpoint is evaluated alone      */
+
+    uint32 WatchpointOffset;   /**< \brief Byte offset into the message  */
+    uint32 BitMask;            /**< \brief WDT bitmask                   */
+    uint32 WidthMask;          /**< \brief Mask of the datum width bits  */
+    uint32 SignBit;            /**< \brief Sign bit of the datum, or zero
+                                           for unsigned and float types  */
+    uint32 ResultAgeWhenStale; /**< \brief WDT stale age                 */
+    uint32 DataExtent;         /**< \brief Bytes from WatchpointOffset to
+                                           the end of the last element   */
+
+    uint16 ElementCount;       /**< \brief Array elements, or zero for a
+                                           single value watchpoint       */
+    uint16 ElementStride;      /**< \brief Bytes between array elements  */
+    uint16 RequiredCount;      /**< \brief True elements needed for a
+                                           true array result             */
+    uint16 ElementResultStart; /**< \brief First word of the element
+                                           results in ElementResults, or
+                                           #LC_NO_ELEMENT_RESULTS         */
+
+    uint16 DatumIndex; /**< \brief Slot in DatumValues holding the masked
+                                   datum this record compares           */
+    bool ReuseDatum;   /**< \brief Datum was already extracted for an
+                                   earlier record of the same messageID,
+                                   offset, data type and bitmask        */
+    uint8 RungCount;   /**< \brief Records from this one that are rungs
+                                   of the same threshold ladder, zero
+                                   if not part of a ladder              */
+
+    uint8 FlagCount;    /**< \brief Records from this one that are flags
+                                    of the same flag bank, zero if not
+                                    part of a bank                      */
+    uint8 ExtractKind;  /**< \brief Datum size and byte order as
+                                    #LC_EXTRACT_UINT8 etc, the same for
+                                    every record of a batch             */
+    uint8 FlagSpare[2]; /**< \brief Structure alignment pad             */
+
+    LC_MultiType_t SwapMap; /**< \brief Byte map used to extract the datum
+                                        into native byte order          */
+    LC_MultiType_t
+        ComparisonValue; /**< \brief Comparison value widened to 32 bits
+                                     (sign extended for signed types)   */
+
+    LC_ExtractFunc_t ExtractFunc; /**< \brief Kernel that loads the datum,
+                                              NULL to use SwapMap        */
+
+} LC_WatchEval_t;
+
+/**
+**  \brief Watched byte range of a message fingerprint
+*/
+typedef struct {
+    uint32 Offset; /**< \brief Byte offset into the message  */
+    uint32 Length; /**< \brief Bytes in the range            */
+
+} LC_WatchSpan_t;
 
-    uint16 WatchIndex; /**< \brief Watchpoint table index   */
-    uint16 Spare;      /**< \brief Structure alignment pad  */
+/**
+**  \brief Second level of the MessageID perfect hash for the MessageID's
+**  of one hash table entry
+*/
+typedef struct {
+    uint32 Multiplier; /**< \brief Odd hash multiplier that sends each
+                                   MessageID of the entry to its own slot */
+    uint32 SlotStart;  /**< \brief First slot of the entry in HashSlots   */
+    uint8 SlotBits;    /**< \brief The entry has 2^SlotBits slots, 0 when
+                                   it has one MessageID or none           */
 
-} LC_WatchPtList_t;
+} LC_HashBucket_t;
 
 /**  \brief Linked list of MessageID's with same hash function result */
 typedef struct LC_MListTag {
@@ -108,11 +365,176 @@ typedef struct LC_MListTag {
     CFE_SB_MsgId_t MessageID; /**< \brief MessageID for this link  */
     uint16 Spare;             /**< \brief Structure alignment pad  */
 
-    LC_WatchPtList_t
-        *WatchPtList; /**< \brief Watchpoint list for this MessageID */
+    uint16 EvalStart; /**< \brief First compiled watchpoint for this
+                                  MessageID (index into WatchEvals)   */
+    uint16 EvalCount; /**< \brief Number of compiled watchpoints for
+                                  this MessageID                      */
+    uint32 MaxExtent; /**< \brief Message length needed to hold the
+                                  data of every compiled watchpoint   */
+
+    uint32 MessagePeriod; /**< \brief Shortest WDT MessagePeriod of the
+                                      watchpoints for this MessageID,
+                                      0 when the results don't go stale
+                                      by time                          */
+    CFE_TIME_SysTime_t StaleAge; /**< \brief MessagePeriod as a time     */
+    CFE_TIME_SysTime_t StaleTime; /**< \brief Time after which the results
+                                              go stale unless the message
+                                              arrives again              */
+    bool StaleTimed; /**< \brief StaleTime is set, cleared once the
+                                 results have gone stale             */
+
+    bool EveryMessage; /**< \brief Some watchpoint for this MessageID
+                                   uses #LC_MONITOR_EVERY or a custom
+                                   function                           */
+    bool SnapshotPending; /**< \brief The snapshot holds a message that
+                                      hasn't been evaluated yet       */
+    uint32 SnapshotStart; /**< \brief First word in SnapshotPool of the
+                                      copy of the latest message      */
+    uint32 SnapshotSize;  /**< \brief Bytes kept of the latest message,
+                                      0 when each message is evaluated
+                                      as it arrives                   */
+    CFE_TIME_SysTime_t SnapshotTime; /**< \brief Time stamp of the
+                                                 latest message       */
+
+    uint16 SpanStart;        /**< \brief First byte range of the
+                                         fingerprint in WatchSpans    */
+    uint16 SpanCount;        /**< \brief Byte ranges in the fingerprint,
+                                         0 when every message is
+                                         evaluated in full            */
+    uint32 FingerprintStart; /**< \brief First word in FingerprintPool of
+                                         the watched bytes of the last
+                                         message                      */
+    bool FingerprintValid;   /**< \brief The fingerprint holds the
+                                         watched bytes the current
+                                         results came from            */
+
+    uint16 MessageDecimation;   /**< \brief Smallest non-zero WDT
+                                            MessageDecimation of the
+                                            watchpoints for this
+                                            MessageID, 1 if none      */
+    uint16 DecimationCountdown; /**< \brief Messages still to be passed
+                                            over before the next one
+                                            is evaluated              */
+    uint32 MessageCount;        /**< \brief Messages received           */
+    uint32 DecimatedCount;      /**< \brief Messages passed over because
+                                            of the decimation         */
 
 } LC_MessageList_t;
 
+/**
+**  \brief Flag bank of compiled watchpoints
+*/
+typedef struct {
+    uint32 CareMask; /**< \brief Bit of each flag from this record to
+                                 the end of the bank                   */
+    uint32 Expected; /**< \brief Value of each of those bits that makes
+                                 its watchpoint true                   */
+
+} LC_FlagBank_t;
+
+/**
+**  \brief Actionpoint sampling record
+**
+**  Everything #LC_SampleSingleAP needs on every sample.  The event
+**  text and cumulative statistics stay in the ADT and ART entries and
+**  are only touched when the actionpoint changes result or fails.
+*/
+typedef struct {
+    uint8 CurrentState; /**< \brief Working copy of the ART CurrentState */
+    uint8 ActionResult; /**< \brief Working copy of the ART ActionResult */
+    uint16 RPNLength;   /**< \brief Words of the compiled equation in
+                                    RPNPool, through the first
+                                    #LC_RPN_EQUAL                     */
+
+    uint16 RTSId;             /**< \brief ADT RTS to request           */
+    uint16 MaxFailsBeforeRTS; /**< \brief ADT consecutive failure limit */
+    uint32 RPNStart;          /**< \brief First word of the equation in
+                                          RPNPool                      */
+
+    uint8 GroupResult;    /**< \brief Result from the evaluation of the
+                                      actionpoint's group              */
+    bool HaveGroupResult; /**< \brief GroupResult is for the sample in
+                                      progress and not yet used        */
+    bool Verified;        /**< \brief The equation was proven to never
+                                      under or overflow the stack and
+                                      to only use valid watchpoints    */
+    bool Grouped;         /**< \brief The actionpoint is in one of the
+                                      APGroups                         */
+    bool Dirty;           /**< \brief A watchpoint in the equation has
+                                      changed result since the equation
+                                      was last evaluated              */
+    uint8 Spare[3];       /**< \brief Structure alignment pad          */
+
+    uint32 ConsecutiveFailCount; /**< \brief Working copy of the ART
+                                             ConsecutiveFailCount     */
+
+} LC_APSample_t;
+
+/**
+**  \brief Group of actionpoints with the same equation shape
+**
+**  The equations of a group differ only in their watchpoint numbers,
+**  so they are evaluated together, one actionpoint per bit of each
+**  watch result bit plane word.
+*/
+typedef struct {
+    uint16 OrderStart; /**< \brief First actionpoint of the group in
+                                   APOrder                           */
+    uint16 LaneCount;  /**< \brief Actionpoints in the group          */
+
+} LC_APGroup_t;
+
+/**
+**  \brief Subexpression shared by actionpoint equations
+**
+**  Every occurrence of the subexpression in a compiled equation is
+**  bracketed by #LC_RPN_SHARED_BEGIN and #LC_RPN_SHARED_END, so it is
+**  evaluated by the first equation that needs it in a sample and its
+**  result is reused by the rest.
+*/
+typedef struct {
+    uint16 APNumber; /**< \brief Actionpoint whose ADT equation holds
+                                 the subexpression                 */
+    uint16 Offset;   /**< \brief First word of the subexpression in
+                                 that equation                     */
+    uint16 Length;   /**< \brief Words in the subexpression         */
+    uint16 Uses;     /**< \brief Occurrences marked in the compiled
+                                 equations                         */
+    uint16 Result;   /**< \brief Result in the sample in progress   */
+    bool Valid;      /**< \brief Result has been evaluated in the
+                                 sample in progress                */
+    uint8 Spare;     /**< \brief Structure alignment pad            */
+
+} LC_SharedRPN_t;
+
+/**
+**  \brief Subtree of an actionpoint equation
+**
+**  One for every subexpression of 3 or more words in the equations
+**  that may share, in equation order and within each equation in the
+**  order of their last word. The first occurrence of some words is
+**  kept in a hash bucket and counts the occurrences, the others refer
+**  to it.
+*/
+typedef struct {
+    uint32 Hash;        /**< \brief Hash of the subtree words          */
+    uint16 APNumber;    /**< \brief Actionpoint whose ADT equation
+                                    holds the subtree                 */
+    uint16 Offset;      /**< \brief First word of the subtree in that
+                                    equation                          */
+    uint16 Length;      /**< \brief Words in the subtree               */
+    uint16 Match;       /**< \brief First subtree with the same words,
+                                    itself if it is the first         */
+    uint16 Next;        /**< \brief Next first subtree in the same hash
+                                    bucket, or #LC_RPN_NO_SUBTREE      */
+    uint16 Count;       /**< \brief Occurrences of the words, counted
+                                    in the first subtree              */
+    uint16 SharedIndex; /**< \brief Entry in SharedRPN for the words,
+                                    or #LC_RPN_NO_SUBTREE              */
+    uint16 Spare;       /**< \brief Structure alignment pad            */
+
+} LC_RPNSubtree_t;
+
 /************************************************************************
 ** Type Definitions
 *************************************************************************/
@@ -128,7 +550,8 @@ typedef struct {
     CFE_SB_PipeId_t CmdPipe; /**< \brief Command pipe ID                      */
 
     LC_WDTEntry_t *WDTPtr; /**< \brief Watchpoint  Definition Table Pointer */
-    LC_ADTEntry_t *ADTPtr; /**< \brief Actionpoint Definition Table Pointer */
+    LC_ADTEntry_t *ADTPtr; /**< \brief Actionpoint Definition Table Pointer,
+                                       to the entries of an #LC_ADT_t    */
 
     LC_WRTEntry_t *WRTPtr; /**< \brief Watchpoint  Results Table Pointer    */
     LC_ARTEntry_t *ARTPtr; /**< \brief Actionpoint Results Table Pointer    */
@@ -157,8 +580,17 @@ typedef struct {
     uint16 MessageIDsCount; /**< \brief Count of unique MessageIDs referenced
                                         in the Watchpoint Definition Table   */
 
+    bool HaveMessagePeriods; /**< \brief Some MessageID has a MessagePeriod,
+                                         see #LC_CheckMessageAges         */
+
+    bool HaveSnapshots; /**< \brief Some MessageID keeps its latest
+                                    message, see #LC_EvaluateSnapshots  */
+
     LC_HkPacket_t HkPacket; /**< \brief Housekeeping telemetry packet        */
 
+    LC_MIDStatsPkt_t
+        MIDStatsPacket; /**< \brief MessageID statistics telemetry packet */
+
     uint32 TableResults; /**< \brief Table and CDS initialization results */
 
     LC_MessageList_t
@@ -168,10 +600,182 @@ typedef struct {
                                                       that the hash function
                                                       converts to each index  */
 
+    uint32 HashMultiplier; /**< \brief Odd multiplier that converts a
+                                       MessageID to a hash table index  */
+
+    LC_HashBucket_t
+        HashBuckets[LC_HASH_TABLE_ENTRIES]; /**< \brief Second level perfect
+                                                        hash of each hash
+                                                        table entry        */
+    LC_MessageList_t
+        *HashSlots[LC_HASH_SLOT_ENTRIES]; /**< \brief Perfect hash lookup,
+                                                      one MessageID per slot */
+
     LC_MessageList_t
         MessageLinks[LC_MAX_WATCHPOINTS]; /** \brief Linked list elements    */
-    LC_WatchPtList_t
-        WatchPtLinks[LC_MAX_WATCHPOINTS]; /** \brief Linked list elements    */
+    LC_WatchEval_t
+        WatchEvals[LC_MAX_WATCHPOINTS]; /** \brief Compiled watchpoints,
+                                                   contiguous per MessageID */
+
+    uint32 DatumValues
+        [LC_MAX_WATCHPOINTS]; /**< \brief Masked data extracted from the
+                                          current message, shared by
+                                          records that read the same
+                                          bytes                          */
+
+    uint8 WatchResults
+        [LC_MAX_WATCHPOINTS]; /**< \brief Result of the last evaluation of
+                                          each watchpoint, the working copy
+                                          of the WatchResult of each WRT
+                                          entry                          */
+
+    uint32 StaleDeadlines
+        [LC_MAX_WATCHPOINTS]; /**< \brief AgeTick at which each timed
+                                          watch result goes stale, the
+                                          working copy of the
+                                          CountdownToStale of each WRT
+                                          entry is the difference      */
+
+    uint16 StaleNext
+        [LC_MAX_WATCHPOINTS]; /**< \brief Next watchpoint number plus one
+                                          in the same StaleWheel slot,
+                                          zero ends the list           */
+
+    uint16 StalePrev
+        [LC_MAX_WATCHPOINTS]; /**< \brief Previous watchpoint number plus
+                                          one in the same StaleWheel
+                                          slot, zero at the head       */
+
+    bool StaleTimed[LC_MAX_WATCHPOINTS]; /**< \brief The watch result has
+                                                     a stale countdown
+                                                     running            */
+
+    uint16 StaleWheel
+        [LC_STALE_WHEEL_SIZE]; /**< \brief First watchpoint number plus one
+                                           whose stale deadline falls in
+                                           each slot, by deadline modulo
+                                           #LC_STALE_WHEEL_SIZE          */
+
+    uint32 AgeTick; /**< \brief Number of actionpoint samples that aged
+                                the watch results, modulo 2^32       */
+
+    LC_MultiType_t LadderThresholds
+        [LC_MAX_WATCHPOINTS]; /**< \brief Comparison values of the threshold
+                                          ladder rungs in ascending order,
+                                          indexed like WatchEvals        */
+
+    LC_FlagBank_t
+        FlagBanks[LC_MAX_WATCHPOINTS]; /**< \brief Flag bank masks of each
+                                                   flag bank record, indexed
+                                                   like WatchEvals          */
+
+    LC_APSample_t
+        APSamples[LC_MAX_ACTIONPOINTS]; /**< \brief Sampling record of each
+                                                 actionpoint              */
+
+    uint16 RPNPool
+        [LC_MAX_RPN_POOL_SIZE +
+         LC_SHARED_RPN_POOL_WORDS]; /**< \brief RPN equations of all
+                                                actionpoints. The ADT RPN
+                                                pool, then the equations
+                                                with bracketed shared
+                                                subexpressions         */
+
+    uint32 APDependStart
+        [LC_MAX_WATCHPOINTS + LC_MAX_ACTIONPOINTS +
+         1]; /**< \brief First entry in APDependents for each watchpoint
+                         and then each actionpoint, see
+                         #LC_AP_DEPEND_INDEX. The last entry is the
+                         total                                         */
+
+    uint16 APDependents
+        [LC_MAX_RPN_POOL_SIZE]; /**< \brief Actionpoints whose equation
+                                            uses each watchpoint or
+                                            actionpoint result          */
+
+    bool APDependOverflow; /**< \brief APDependents was too small for the
+                                       table, so every actionpoint is
+                                       marked by #LC_MarkAPsDirty      */
+
+    uint16 APSampleOrder[LC_MAX_ACTIONPOINTS]; /**< \brief Actionpoints in
+                                                           the order they
+                                                           are sampled,
+                                                           each after the
+                                                           actionpoints it
+                                                           references     */
+
+    bool HaveAPReferences; /**< \brief Some equation uses the result of
+                                       another actionpoint, so sampling
+                                       follows APSampleOrder           */
+
+    uint16 LiveAPs[LC_MAX_ACTIONPOINTS]; /**< \brief Actionpoints that are
+                                                     active or passive, in
+                                                     sample order, see
+                                                     #LC_IndexLiveAPs    */
+
+    uint16 LiveAPCount; /**< \brief Entries in use in LiveAPs         */
+
+    uint16 APOrder[LC_MAX_ACTIONPOINTS]; /**< \brief Actionpoints sorted by
+                                                     equation shape      */
+
+    LC_APGroup_t
+        APGroups[LC_MAX_ACTIONPOINTS]; /**< \brief Actionpoint groups    */
+
+    uint16 APGroupCount; /**< \brief Entries in use in APGroups       */
+
+    LC_SharedRPN_t SharedRPN[LC_MAX_SHARED_RPN]; /**< \brief Subexpressions
+                                                         shared by
+                                                         actionpoint
+                                                         equations      */
+
+    uint16 SharedRPNCount; /**< \brief Entries in use in SharedRPN     */
+
+    LC_RPNSubtree_t RPNSubtrees
+        [LC_MAX_RPN_SUBTREES]; /**< \brief Subtrees of the equations that
+                                           may share, see
+                                           #LC_HashRPNSubtrees          */
+
+    uint16 RPNSubtreeBuckets
+        [1 << LC_RPN_SUBTREE_HASH_BITS]; /**< \brief First subtree in each
+                                                     hash bucket         */
+
+    uint16 APSubtreeStart
+        [LC_MAX_ACTIONPOINTS + 1]; /**< \brief First entry in RPNSubtrees
+                                               of each actionpoint, the
+                                               last entry is the total   */
+
+    uint32 WatchValidBits
+        [LC_WATCH_PLANE_WORDS]; /**< \brief Watch results that are TRUE
+                                            or FALSE, one bit each     */
+    uint32 WatchValueBits
+        [LC_WATCH_PLANE_WORDS]; /**< \brief Watch results that are TRUE
+                                            or ERROR, one bit each     */
+
+    uint32 ElementResults
+        [LC_MAX_ELEMENT_RESULT_WORDS]; /**< \brief Last result of each array
+                                                   watchpoint element, one
+                                                   bit per element         */
+
+    uint32 SnapshotPool
+        [LC_SNAPSHOT_POOL_WORDS]; /**< \brief Copies of the latest message
+                                              of the MessageIDs that use
+                                              #LC_MONITOR_LATEST          */
+
+    LC_WatchSpan_t
+        WatchSpans[LC_MAX_WATCHPOINTS]; /**< \brief Watched byte ranges of
+                                                   each MessageID, sorted
+                                                   by offset             */
+
+    uint16 WatchSpanCount; /**< \brief Entries in use in WatchSpans     */
+
+    uint32 FingerprintWordsUsed; /**< \brief Words in use in
+                                             FingerprintPool          */
+
+    uint32 FingerprintPool
+        [LC_FINGERPRINT_POOL_WORDS]; /**< \brief Watched bytes of the last
+                                                 message of each
+                                                 MessageID, see
+                                                 #LC_MatchFingerprint   */
 
     bool HaveActiveCDS; /**< \brief Critical Data Store in use flag      */
 
@@ -92,6 +92,10 @@ int32 LC_AppPipe(CFE_SB_MsgPtr_t MessagePtr) {
                     LC_ResetWPStatsCmd(MessagePtr);
                     break;
 
+                case LC_SEND_MID_STATS_CC:
+                    LC_SendMIDStatsCmd(MessagePtr);
+                    break;
+
                 default:
                     CFE_EVS_SendEvent(
                         LC_CC_ERR_EID, CFE_EVS_EventType_ERROR,
@@ -126,7 +130,8 @@ int32 LC_AppPipe(CFE_SB_MsgPtr_t MessagePtr) {
 void LC_SampleAPReq(CFE_SB_MsgPtr_t MessagePtr) {
     LC_SampleAP_t *LC_SampleAP = (LC_SampleAP_t *)MessagePtr;
     uint16 ExpectedLength      = sizeof(LC_SampleAP_t);
-    uint16 WatchIndex;
+    uint16 StartIndex          = 0;
+    uint16 EndIndex            = 0;
     bool ValidSampleCmd = false;
 
     /*
@@ -145,14 +150,16 @@ void LC_SampleAPReq(CFE_SB_MsgPtr_t MessagePtr) {
                 /*
                 ** Allow special "sample all" heritage values
                 */
-                LC_SampleAPs(0, LC_MAX_ACTIONPOINTS - 1);
+                StartIndex     = 0;
+                EndIndex       = LC_MAX_ACTIONPOINTS - 1;
                 ValidSampleCmd = true;
             } else if ((LC_SampleAP->StartIndex <= LC_SampleAP->EndIndex) &&
                        (LC_SampleAP->EndIndex < LC_MAX_ACTIONPOINTS)) {
                 /*
                 ** Start is less or equal to end, and end is within the array
                 */
-                LC_SampleAPs(LC_SampleAP->StartIndex, LC_SampleAP->EndIndex);
+                StartIndex     = LC_SampleAP->StartIndex;
+                EndIndex       = LC_SampleAP->EndIndex;
                 ValidSampleCmd = true;
             } else {
                 /*
@@ -165,20 +172,32 @@ void LC_SampleAPReq(CFE_SB_MsgPtr_t MessagePtr) {
             }
 
             /*
-            ** Optionally update the age of watchpoint results
+            ** A rejected request changes nothing
             */
-            if ((LC_SampleAP->UpdateAge != 0) && (ValidSampleCmd)) {
-                for (WatchIndex = 0; WatchIndex < LC_MAX_WATCHPOINTS;
-                     WatchIndex++) {
-                    if (LC_OperData.WRTPtr[WatchIndex].CountdownToStale != 0) {
-                        LC_OperData.WRTPtr[WatchIndex].CountdownToStale--;
-
-                        if (LC_OperData.WRTPtr[WatchIndex].CountdownToStale ==
-                            0) {
-                            LC_OperData.WRTPtr[WatchIndex].WatchResult =
-                                LC_WATCH_STALE;
-                        }
-                    }
+            if (ValidSampleCmd) {
+                /*
+                ** Messages that are only evaluated at sample time are
+                ** evaluated now
+                */
+                if (LC_OperData.HaveSnapshots == true) {
+                    LC_EvaluateSnapshots();
+                }
+
+                /*
+                ** Results of messages that stopped arriving go stale
+                ** before the actionpoints use them
+                */
+                if (LC_OperData.HaveMessagePeriods == true) {
+                    LC_CheckMessageAges(CFE_TIME_GetTime());
+                }
+
+                LC_SampleAPs(StartIndex, EndIndex);
+
+                /*
+                ** Optionally update the age of watchpoint results
+                */
+                if (LC_SampleAP->UpdateAge != 0) {
+                    LC_AgeWatchResults();
                 }
             }
         }
@@ -224,7 +243,7 @@ int32 LC_HousekeepingReq(CFE_SB_MsgPtr_t MessagePtr) {
         LC_OperData.HkPacket.ActiveAPs = 0;
 
         /*
-        ** Update packed watch results
+        ** Update packed watch results from the working copy
         ** (4 watch results in one 8-bit byte)
         */
         for (TableIndex = 0; TableIndex < LC_MAX_WATCHPOINTS; TableIndex += 4) {
@@ -233,7 +252,7 @@ int32 LC_HousekeepingReq(CFE_SB_MsgPtr_t MessagePtr) {
             /*
             ** Pack in first result
             */
-            switch (LC_OperData.WRTPtr[TableIndex + 3].WatchResult) {
+            switch (LC_OperData.WatchResults[TableIndex + 3]) {
                 case LC_WATCH_STALE:
                     ByteData = LC_HKWR_STALE << 6;
                     break;
@@ -259,7 +278,7 @@ int32 LC_HousekeepingReq(CFE_SB_MsgPtr_t MessagePtr) {
             /*
             ** Pack in second result
             */
-            switch (LC_OperData.WRTPtr[TableIndex + 2].WatchResult) {
+            switch (LC_OperData.WatchResults[TableIndex + 2]) {
                 case LC_WATCH_STALE:
                     ByteData = (ByteData | (LC_HKWR_STALE << 4));
                     break;
@@ -281,7 +300,7 @@ int32 LC_HousekeepingReq(CFE_SB_MsgPtr_t MessagePtr) {
             /*
             ** Pack in third result
             */
-            switch (LC_OperData.WRTPtr[TableIndex + 1].WatchResult) {
+            switch (LC_OperData.WatchResults[TableIndex + 1]) {
                 case LC_WATCH_STALE:
                     ByteData = (ByteData | (LC_HKWR_STALE << 2));
                     break;
@@ -303,7 +322,7 @@ int32 LC_HousekeepingReq(CFE_SB_MsgPtr_t MessagePtr) {
             /*
             ** Pack in fourth and last result
             */
-            switch (LC_OperData.WRTPtr[TableIndex].WatchResult) {
+            switch (LC_OperData.WatchResults[TableIndex]) {
                 case LC_WATCH_STALE:
                     ByteData = (ByteData | LC_HKWR_STALE);
                     break;
@@ -340,7 +359,7 @@ int32 LC_HousekeepingReq(CFE_SB_MsgPtr_t MessagePtr) {
             /*
             ** Pack in first actionpoint, current state
             */
-            switch (LC_OperData.ARTPtr[TableIndex + 1].CurrentState) {
+            switch (LC_OperData.APSamples[TableIndex + 1].CurrentState) {
                 case LC_ACTION_NOT_USED:
                     ByteData = LC_HKAR_STATE_NOT_USED << 6;
                     break;
@@ -372,7 +391,7 @@ int32 LC_HousekeepingReq(CFE_SB_MsgPtr_t MessagePtr) {
             /*
             ** Pack in first actionpoint, action result
             */
-            switch (LC_OperData.ARTPtr[TableIndex + 1].ActionResult) {
+            switch (LC_OperData.APSamples[TableIndex + 1].ActionResult) {
                 case LC_ACTION_STALE:
                     ByteData = (ByteData | (LC_HKAR_STALE << 4));
                     break;
@@ -398,7 +417,7 @@ int32 LC_HousekeepingReq(CFE_SB_MsgPtr_t MessagePtr) {
             /*
             ** Pack in second actionpoint, current state
             */
-            switch (LC_OperData.ARTPtr[TableIndex].CurrentState) {
+            switch (LC_OperData.APSamples[TableIndex].CurrentState) {
                 case LC_ACTION_NOT_USED:
                     ByteData = (ByteData | (LC_HKAR_STATE_NOT_USED << 2));
                     break;
@@ -425,7 +444,7 @@ int32 LC_HousekeepingReq(CFE_SB_MsgPtr_t MessagePtr) {
             /*
             ** Pack in second actionpoint, action result
             */
-            switch (LC_OperData.ARTPtr[TableIndex].ActionResult) {
+            switch (LC_OperData.APSamples[TableIndex].ActionResult) {
                 case LC_ACTION_STALE:
                     ByteData = (ByteData | LC_HKAR_STALE);
                     break;
@@ -542,6 +561,8 @@ void LC_ResetCmd(CFE_SB_MsgPtr_t MessagePtr) {
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 void LC_ResetCounters(void) {
+    uint16 MessageLinkIndex;
+
     LC_AppData.CmdCount    = 0;
     LC_AppData.CmdErrCount = 0;
 
@@ -550,6 +571,15 @@ void LC_ResetCounters(void) {
     LC_AppData.RTSExecCount        = 0;
     LC_AppData.PassiveRTSExecCount = 0;
 
+    /*
+    ** MessageID statistics
+    */
+    for (MessageLinkIndex = 0; MessageLinkIndex < LC_OperData.MessageIDsCount;
+         MessageLinkIndex++) {
+        LC_OperData.MessageLinks[MessageLinkIndex].MessageCount   = 0;
+        LC_OperData.MessageLinks[MessageLinkIndex].DecimatedCount = 0;
+    }
+
     return;
 
 } /* end LC_ResetCounters */
@@ -648,11 +678,11 @@ void LC_SetAPStateCmd(CFE_SB_MsgPtr_t MessagePtr) {
                 for (TableIndex = 0; TableIndex < LC_MAX_ACTIONPOINTS;
                      TableIndex++) {
                     CurrentAPState =
-                        LC_OperData.ARTPtr[TableIndex].CurrentState;
+                        LC_OperData.APSamples[TableIndex].CurrentState;
 
                     if ((CurrentAPState != LC_ACTION_NOT_USED) &&
                         (CurrentAPState != LC_APSTATE_PERMOFF)) {
-                        LC_OperData.ARTPtr[TableIndex].CurrentState =
+                        LC_OperData.APSamples[TableIndex].CurrentState =
                             CmdPtr->NewAPState;
                     }
                 }
@@ -665,14 +695,14 @@ void LC_SetAPStateCmd(CFE_SB_MsgPtr_t MessagePtr) {
                 if ((CmdPtr->APNumber) < LC_MAX_ACTIONPOINTS) {
                     TableIndex = CmdPtr->APNumber;
                     CurrentAPState =
-                        LC_OperData.ARTPtr[TableIndex].CurrentState;
+                        LC_OperData.APSamples[TableIndex].CurrentState;
 
                     if ((CurrentAPState != LC_ACTION_NOT_USED) &&
                         (CurrentAPState != LC_APSTATE_PERMOFF)) {
                         /*
                         ** Update state for single actionpoint specified
                         */
-                        LC_OperData.ARTPtr[TableIndex].CurrentState =
+                        LC_OperData.APSamples[TableIndex].CurrentState =
                             CmdPtr->NewAPState;
 
                         CmdSuccess = true;
@@ -708,6 +738,8 @@ void LC_SetAPStateCmd(CFE_SB_MsgPtr_t MessagePtr) {
             ** executed
             */
             if (CmdSuccess == true) {
+                LC_IndexLiveAPs();
+
                 LC_AppData.CmdCount++;
 
                 CFE_EVS_SendEvent(
@@ -755,7 +787,7 @@ void LC_SetAPPermOffCmd(CFE_SB_MsgPtr_t MessagePtr) {
 
         } else {
             TableIndex     = CmdPtr->APNumber;
-            CurrentAPState = LC_OperData.ARTPtr[TableIndex].CurrentState;
+            CurrentAPState = LC_OperData.APSamples[TableIndex].CurrentState;
 
             if (CurrentAPState != LC_APSTATE_DISABLED) {
                 /*
@@ -771,9 +803,10 @@ void LC_SetAPPermOffCmd(CFE_SB_MsgPtr_t MessagePtr) {
                 LC_AppData.CmdErrCount++;
             } else {
                 /*
-                ** Update state for actionpoint specified
+                ** Update state for actionpoint specified, disabled
+                ** actionpoints aren't in the live index so it stays as is
                 */
-                LC_OperData.ARTPtr[TableIndex].CurrentState =
+                LC_OperData.APSamples[TableIndex].CurrentState =
                     LC_APSTATE_PERMOFF;
 
                 LC_AppData.CmdCount++;
@@ -849,6 +882,12 @@ void LC_ResetResultsAP(uint32 StartIndex, uint32 EndIndex, bool ResetStatsCmd) {
             LC_OperData.ARTPtr[TableIndex].ActionResult = LC_ACTION_STALE;
             LC_OperData.ARTPtr[TableIndex].CurrentState =
                 LC_OperData.ADTPtr[TableIndex].DefaultState;
+
+            LC_OperData.APSamples[TableIndex].ActionResult = LC_ACTION_STALE;
+            LC_OperData.APSamples[TableIndex].CurrentState =
+                LC_OperData.ADTPtr[TableIndex].DefaultState;
+            LC_OperData.APSamples[TableIndex].Dirty = true;
+            LC_MarkAPsDirty(LC_AP_DEPEND_INDEX(TableIndex));
         }
 
         LC_OperData.ARTPtr[TableIndex].PassiveAPCount  = 0;
@@ -859,6 +898,12 @@ void LC_ResetResultsAP(uint32 StartIndex, uint32 EndIndex, bool ResetStatsCmd) {
         LC_OperData.ARTPtr[TableIndex].CumulativeFailCount     = 0;
         LC_OperData.ARTPtr[TableIndex].CumulativeRTSExecCount  = 0;
         LC_OperData.ARTPtr[TableIndex].CumulativeEventMsgsSent = 0;
+
+        LC_OperData.APSamples[TableIndex].ConsecutiveFailCount = 0;
+    }
+
+    if (!ResetStatsCmd) {
+        LC_IndexLiveAPs();
     }
 
     return;
@@ -906,6 +951,66 @@ void LC_ResetWPStatsCmd(CFE_SB_MsgPtr_t MessagePtr) {
 
 } /* end LC_ResetWPStatsCmd */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Send MessageID statistics command                               */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_SendMIDStatsCmd(CFE_SB_MsgPtr_t MessagePtr) {
+    uint16 ExpectedLength       = sizeof(LC_NoArgsCmd_t);
+    LC_MIDStatsPkt_t *PacketPtr = &LC_OperData.MIDStatsPacket;
+    LC_MessageList_t *MessageLink;
+    LC_MIDStats_t *EntryPtr;
+    uint16 MessageLinkIndex = 0;
+    uint16 PacketCount      = 0;
+
+    /*
+    ** Verify message packet length
+    */
+    if (LC_VerifyMsgLength(MessagePtr, ExpectedLength)) {
+        /*
+        ** Fill and send as many packets as it takes, at least one so
+        ** an empty WDT is reported too
+        */
+        while ((PacketCount == 0) ||
+               (MessageLinkIndex < LC_OperData.MessageIDsCount)) {
+            CFE_PSP_MemSet(PacketPtr->Entries, 0, sizeof(PacketPtr->Entries));
+
+            PacketPtr->MessageIDsCount = LC_OperData.MessageIDsCount;
+            PacketPtr->StartIndex      = MessageLinkIndex;
+            PacketPtr->EntryCount      = 0;
+
+            while ((MessageLinkIndex < LC_OperData.MessageIDsCount) &&
+                   (PacketPtr->EntryCount < LC_MID_STATS_PER_PKT)) {
+                MessageLink = &LC_OperData.MessageLinks[MessageLinkIndex];
+                EntryPtr    = &PacketPtr->Entries[PacketPtr->EntryCount];
+
+                EntryPtr->MessageID         = (uint32)MessageLink->MessageID;
+                EntryPtr->MessageDecimation = MessageLink->MessageDecimation;
+                EntryPtr->MessageCount      = MessageLink->MessageCount;
+                EntryPtr->DecimatedCount    = MessageLink->DecimatedCount;
+
+                PacketPtr->EntryCount++;
+                MessageLinkIndex++;
+            }
+
+            CFE_SB_TimeStampMsg((CFE_SB_Msg_t *)PacketPtr);
+            CFE_SB_SendMsg((CFE_SB_Msg_t *)PacketPtr);
+
+            PacketCount++;
+        }
+
+        LC_AppData.CmdCount++;
+
+        CFE_EVS_SendEvent(LC_MID_STATS_INF_EID, CFE_EVS_EventType_INFORMATION,
+                          "Send MID stats command: MIDs = %d, Packets = %d",
+                          LC_OperData.MessageIDsCount, PacketCount);
+    }
+
+    return;
+
+} /* end LC_SendMIDStatsCmd */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Reset selected WP statistics (utility function)                 */
@@ -920,6 +1025,10 @@ void LC_ResetResultsWP(uint32 StartIndex, uint32 EndIndex, bool ResetStatsCmd) {
             /* reset WP stats command does not modify most recent test result */
             LC_OperData.WRTPtr[TableIndex].WatchResult      = LC_WATCH_STALE;
             LC_OperData.WRTPtr[TableIndex].CountdownToStale = 0;
+
+            LC_OperData.WatchResults[TableIndex] = LC_WATCH_STALE;
+            LC_SetStaleCountdown(TableIndex, 0);
+            LC_MarkAPsDirty(TableIndex);
         }
 
         LC_OperData.WRTPtr[TableIndex].EvaluationCount      = 0;
@@ -1006,6 +1115,13 @@ bool LC_VerifyMsgLength(CFE_SB_MsgPtr_t msg, uint16 ExpectedLength) {
 int32 LC_ManageTables(void) {
     int32 Result;
 
+    /*
+    ** Bring the watch and action results in the WRT and ART images up
+    **  to date so a dump shows the same results as the working copies
+    */
+    LC_SyncWRT();
+    LC_SyncART();
+
     /*
     ** It is not necessary to release dump only table pointers before
     **  calling cFE Table Services to manage the table
@@ -1050,6 +1166,11 @@ int32 LC_ManageTables(void) {
         CFE_TBL_GetAddress((void *)&LC_OperData.ADTPtr, LC_OperData.ADTHandle);
 
     if (Result == CFE_TBL_INFO_UPDATED) {
+        /*
+        ** Rebuild the sampling records from the new table
+        */
+        LC_CompileActionpoints();
+
         /*
         ** Clear actionpoint results for previous table
         */
@@ -1075,8 +1196,11 @@ int32 LC_UpdateTaskCDS(void) {
     int32 Result;
 
     /*
-    ** Copy the watchpoint results table (WRT) data to CDS
+    ** Copy the watchpoint results table (WRT) data to CDS, with the
+    ** latest watch results
     */
+    LC_SyncWRT();
+
     Result = CFE_ES_CopyToCDS(LC_OperData.WRTDataCDSHandle, LC_OperData.WRTPtr);
 
     if (Result != CFE_SUCCESS) {
@@ -1088,8 +1212,11 @@ int32 LC_UpdateTaskCDS(void) {
     }
 
     /*
-    ** Copy the actionpoint results table (ART) data to CDS
+    ** Copy the actionpoint results table (ART) data to CDS, with the
+    ** latest action results
     */
+    LC_SyncART();
+
     Result = CFE_ES_CopyToCDS(LC_OperData.ARTDataCDSHandle, LC_OperData.ARTPtr);
 
     if (Result != CFE_SUCCESS) {
@@ -58,7 +58,8 @@ int32 LC_AppPipe(CFE_SB_MsgPtr_t MessagePtr);
 /** \brief Reset HK counters
 **
 **  \par Description
-**       Utility function that resets housekeeping counters to zero
+**       Utility function that resets housekeeping counters, and the
+**       statistics of each MessageID, to zero
 **
 **  \par Assumptions, External Events, and Notes:
 **       None
@@ -286,6 +287,24 @@ void LC_ResetAPStatsCmd(CFE_SB_MsgPtr_t MessagePtr);
 *************************************************************************/
 void LC_ResetWPStatsCmd(CFE_SB_MsgPtr_t MessagePtr);
 
+/************************************************************************/
+/** \brief Send MessageID statistics command
+**
+**  \par Description
+**       Processes a send MessageID statistics ground command.
+**
+**  \par Assumptions, External Events, and Notes:
+**       The statistics restart when a new watchpoint definition table
+**       is loaded, and when the housekeeping counters are reset.
+**
+**  \param [in]   MessagePtr   A #CFE_SB_MsgPtr_t pointer that
+**                             references the software bus message
+**
+**  \sa #LC_SEND_MID_STATS_CC
+**
+*************************************************************************/
+void LC_SendMIDStatsCmd(CFE_SB_MsgPtr_t MessagePtr);
+
 /************************************************************************/
 /** \brief Verify message length
 **
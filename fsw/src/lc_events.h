@@ -934,9 +934,9 @@
 #define LC_WDTVAL_FPERR_EID 54
 
 /** \brief <tt> 'WDT verify err: WP = \%d, Err = \%d, DType = \%d, Oper = \%d,
- *MID = \%d' </tt>
+ *MID = \%u' </tt>
  **  \event <tt> 'WDT verify err: WP = \%d, Err = \%d, DType = \%d, Oper = \%d,
- *MID = \%d' </tt>
+ *MID = \%u' </tt>
  **
  **  \par Type: ERROR
  **
@@ -1153,6 +1153,98 @@
 */
 #define LC_CFCALL_ERR_EID 67
 
+/** \brief <tt> 'WP data extractions merged: Merged = \%d, WPs = \%d' </tt>
+**  \event <tt> 'WP data extractions merged: Merged = \%d, WPs = \%d' </tt>
+**
+**  \par Type: INFORMATION
+**
+**  \par Cause:
+**
+**  This event message is issued when a new watchpoint definition table
+**  (WDT) has been loaded and some watchpoints read the same data as an
+**  earlier watchpoint (same message ID, offset, data type and bitmask).
+**  That data is extracted once per message and shared.
+**
+**  The \c Merged field is the number of extractions saved per message,
+**  the \c WPs field is the number of watchpoints in use
+*/
+#define LC_WP_SHARED_DATA_INF_EID 69
+
+/** \brief <tt> 'Shared AP subexpressions: Count = \%d, Saved = \%d/\%d' </tt>
+**  \event <tt> 'Shared AP subexpressions: Count = \%d, Saved = \%d/\%d' </tt>
+**
+**  \par Type: INFORMATION
+**
+**  \par Cause:
+**
+**  This event message is issued when a new actionpoint definition
+**  table (ADT) has been loaded and the same subexpression appears more
+**  than once in the actionpoint equations. Each such subexpression is
+**  evaluated once per sample and its result is shared.
+**
+**  The \c Count field is the number of shared subexpressions. The
+**  \c Saved field is the number of RPN operators that no longer need
+**  to be evaluated when every actionpoint is sampled, out of the RPN
+**  operators in the equations that can share subexpressions
+*/
+#define LC_AP_SHARED_RPN_INF_EID 70
+
+/** \brief <tt> 'ADT verify AP reference cycle: AP = \%d, Unordered = \%d'
+ *</tt>
+ **  \event <tt> 'ADT verify AP reference cycle: AP = \%d, Unordered = \%d'
+ *</tt>
+ **
+ **  \par Type: ERROR
+ **
+ **  \par Cause:
+ **
+ **  This event message is issued when a table validation fails for an
+ **  actionpoint definition table (ADT) load because RPN equations use
+ **  actionpoint results that lead back to themselves, so there is no
+ **  order to sample them in.
+ **
+ **  The \c AP field is the first actionpoint that can't be ordered, the
+ **  \c Unordered field is the number of actionpoints in or depending on
+ **  a reference cycle.
+ */
+#define LC_ADTVAL_APCYCLE_ERR_EID 71
+
+/** \brief <tt> 'ADT verify RPN pool err: AP = \%d, Offset = \%d, Length =
+ *\%d' </tt>
+ **  \event <tt> 'ADT verify RPN pool err: AP = \%d, Offset = \%d, Length =
+ *\%d' </tt>
+ **
+ **  \par Type: ERROR
+ **
+ **  \par Cause:
+ **
+ **  This event message is issued on the first error when a table
+ **  validation fails for an actionpoint definition table (ADT) load and
+ **  the error is an RPN equation that is empty or reaches past the end of
+ **  the table's RPN pool.
+ **
+ **  The \c AP field is the actionpoint number, the \c Offset and
+ **  \c Length fields are the pool words its definition table entry
+ **  selects for the equation.
+ */
+#define LC_ADTVAL_RPNPOOL_ERR_EID 72
+
+/** \brief <tt> 'Send MID stats command: MIDs = \%d, Packets = \%d' </tt>
+**  \event <tt> 'Send MID stats command: MIDs = \%d, Packets = \%d' </tt>
+**
+**  \par Type: INFORMATION
+**
+**  \par Cause:
+**
+**  This event message is issued when the #LC_SEND_MID_STATS_CC command
+**  has been successfully executed
+**
+**  The \c MIDs field is the number of MessageIDs referenced in the
+**  watchpoint definition table, the \c Packets field is the number of
+**  #LC_MIDStatsPkt_t packets sent to report them
+*/
+#define LC_MID_STATS_INF_EID 73
+
 /** \brief <tt> 'Base event ID for events defined in the Actionpoint Definition
  *Table' </tt>
  **
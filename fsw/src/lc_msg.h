@@ -38,7 +38,8 @@
 *************************************************************************/
 /**
 **  \brief No Arguments Command
-**  For command details see #LC_NOOP_CC, #LC_RESET_CC
+**  For command details see #LC_NOOP_CC, #LC_RESET_CC,
+**  #LC_SEND_MID_STATS_CC
 **  Also see #LC_SEND_HK_MID
 */
 typedef struct {
@@ -168,6 +169,39 @@ typedef struct {
                                           initiated                            */
 } LC_HkPacket_t;
 
+/**
+**  \brief Statistics of one MessageID
+*/
+typedef struct {
+    uint32 MessageID;         /**< \brief MessageID referenced in the WDT,
+                                          32 bits to hold wide cFE
+                                          message ID's                   */
+    uint16 MessageDecimation; /**< \brief Messages per evaluation, 1 if
+                                          every message is evaluated     */
+    uint16 Padding;           /**< \brief Structure padding              */
+    uint32 MessageCount;      /**< \brief Messages received              */
+    uint32 DecimatedCount;    /**< \brief Messages received that were not
+                                          evaluated because of the
+                                          decimation                     */
+} LC_MIDStats_t;
+
+/**
+**  \lctlm MessageID Statistics Packet Structure
+**  Sent in response to #LC_SEND_MID_STATS_CC
+*/
+typedef struct {
+    CFE_SB_TlmHdr_t TlmHeader; /**< \brief cFE SB Tlm Msg Hdr */
+
+    uint16 MessageIDsCount; /**< \brief MessageIDs referenced in the WDT  */
+    uint16 StartIndex;      /**< \brief Number of the MessageID in the
+                                        first entry (zero based)         */
+    uint16 EntryCount;      /**< \brief Entries in use in this packet    */
+    uint16 Padding;         /**< \brief Structure padding                */
+
+    LC_MIDStats_t Entries[LC_MID_STATS_PER_PKT]; /**< \brief Statistics of
+                                                            each MessageID */
+} LC_MIDStatsPkt_t;
+
 #endif /* _lc_msg_ */
 
 /************************/
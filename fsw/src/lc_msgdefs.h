@@ -108,6 +108,14 @@
                     array on longword boundary   */
 /** \} */
 
+/**
+** \name MessageID Statistics Packet Size */
+/** \{ */
+#define LC_MID_STATS_PER_PKT                        \
+    32 /**< \brief MessageIDs reported in each \
+                    #LC_MIDStatsPkt_t           */
+/** \} */
+
 /** \lccmd Noop
 **
 **  \par Description
@@ -356,6 +364,40 @@
 */
 #define LC_RESET_WP_STATS_CC 6
 
+/** \lccmd Send MessageID Statistics
+**
+**  \par Description
+**       Sends the statistics of every MessageID referenced in the
+**       watchpoint definition table, #LC_MID_STATS_PER_PKT MessageIDs
+**       to each #LC_MIDStatsPkt_t
+**
+**  \lccmdmnemonic \LC_SENDMIDSTATS
+**
+**  \par Command Structure
+**       #LC_NoArgsCmd_t
+**
+**  \par Command Verification
+**       Successful execution of this command may be verified with
+**       the following telemetry:
+**       - \b \c \LC_CMDPC - command counter will increment
+**       - The #LC_MID_STATS_INF_EID informational event message will
+**         be generated when the command is executed
+**
+**  \par Error Conditions
+**       This command may fail for the following reason(s):
+**       - Command packet length not as expected
+**
+**  \par Evidence of failure may be found in the following telemetry:
+**       - \b \c \LC_CMDEC - command error counter will increment
+**       - Error specific event message #LC_LEN_ERR_EID
+**
+**  \par Criticality
+**       None
+**
+**  \sa #LC_RESET_CC
+*/
+#define LC_SEND_MID_STATS_CC 7
+
 #endif /* _lc_msgdefs_ */
 
 /************************/
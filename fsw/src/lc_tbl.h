@@ -62,8 +62,10 @@ typedef union {
 typedef struct {
     uint8 DataType;   /**< \brief Watchpoint Data Type (enumerated)     */
     uint8 OperatorID; /**< \brief Comparison type (enumerated)          */
-    uint16 MessageID; /**< \brief Message ID for the message containing
-                                  the watchpoint                        */
+    CFE_SB_MsgId_t MessageID; /**< \brief Message ID for the message
+                                          containing the watchpoint, as
+                                          wide as the cFE build's message
+                                          ID's                          */
     uint32 WatchpointOffset; /**< \brief Byte offset from the beginning of
                                          the message (including any headers)
                                          to the watchpoint */
@@ -78,6 +80,31 @@ typedef struct {
     uint32 CustomFuncArgument; /**< \brief Data passed to the custom function
                                            when Operator_ID is set to
                                            #LC_OPER_CUSTOM */
+    uint16 ElementCount;       /**< \brief Number of array elements watched
+                                           when AggregateType is not
+                                           #LC_AGGR_NONE                    */
+    uint16 ElementStride;      /**< \brief Byte distance from one array
+                                           element to the next              */
+    uint8 AggregateType;       /**< \brief How the element results combine
+                                           into the watchpoint result
+                                           (enumerated)                     */
+    uint8 MonitorMode;         /**< \brief When the watchpoint is evaluated
+                                           (enumerated)                     */
+    uint16 AggregateCount;     /**< \brief True elements needed for a true
+                                           result with #LC_AGGR_COUNT       */
+    uint32 MessagePeriod;      /**< \brief Milliseconds, from when LC
+                                           receives it, that MessageID may go
+                                           without arriving before the
+                                           results of all its watchpoints
+                                           go stale, 0 for no limit. The
+                                           shortest given for a MessageID
+                                           is used                          */
+    uint16 MessageDecimation;  /**< \brief Evaluate only every Nth message
+                                           with MessageID, 0 or 1 to
+                                           evaluate every message. The
+                                           smallest non-zero value given
+                                           for a MessageID is used          */
+    uint16 Padding;            /**< \brief Structure padding              */
 } LC_WDTEntry_t;
 
 /**
@@ -99,9 +126,13 @@ typedef struct {
     uint16 MaxFailsBeforeRTS; /**< \brief How may consecutive failures before
                                           an RTS request is issued */
 
-    uint16 RPNEquation[LC_MAX_RPN_EQU_SIZE]; /**< \brief Reverse Polish Equation
-                                                that specifies when this
-                                                actionpoint should fail */
+    uint16 RPNOffset; /**< \brief Index in the table's RPN pool of the
+                                  first word of the Reverse Polish Equation
+                                  that specifies when this actionpoint
+                                  should fail                               */
+    uint16 RPNLength; /**< \brief Number of RPN pool words the equation
+                                  may use, it ends at the first
+                                  #LC_RPN_EQUAL among them                  */
 
     uint16 EventType; /**< \brief Event type used for event msg if AP fails:
                                   #CFE_EVS_INFORMATION, #CFE_EVS_DEBUG,
@@ -114,6 +145,17 @@ typedef struct {
                                            when this AP fails */
 } LC_ADTEntry_t;
 
+/**
+**  \brief Actionpoint Definition Table (ADT)
+*/
+typedef struct {
+    LC_ADTEntry_t Entries[LC_MAX_ACTIONPOINTS]; /**< \brief Actionpoint
+                                                            definitions   */
+    uint16 RPNPool[LC_MAX_RPN_POOL_SIZE]; /**< \brief Reverse Polish Equation
+                                                      words of every
+                                                      actionpoint           */
+} LC_ADT_t;
+
 /**
 **  \brief Watchpoint Transition Structure
 */
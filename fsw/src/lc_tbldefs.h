@@ -101,6 +101,27 @@
 #define LC_OPER_CUSTOM 7    /**< \brief Use custom function           */
 /** \} */
 
+/**
+** \name Watchpoint Definition Table (WDT) AggregateType Enumerated Types */
+/** \{ */
+#define LC_AGGR_NONE 0 /**< \brief Single value watchpoint            */
+#define LC_AGGR_ANY  1 /**< \brief True if any element is true        */
+#define LC_AGGR_ALL  2 /**< \brief True if every element is true      */
+#define LC_AGGR_COUNT                                    \
+    3 /**< \brief True if at least AggregateCount of the \
+                  elements are true                      */
+/** \} */
+
+/**
+** \name Watchpoint Definition Table (WDT) MonitorMode Enumerated Types */
+/** \{ */
+#define LC_MONITOR_EVERY                                   \
+    0 /**< \brief Evaluate each message as it arrives     */
+#define LC_MONITOR_LATEST                                  \
+    1 /**< \brief Keep the latest message and evaluate it \
+                  when the actionpoints are sampled      */
+/** \} */
+
 /**
 ** \name Watchpoint Definition Table (WDT) BitMask Enumerated Types */
 /** \{ */
@@ -115,6 +136,51 @@
 #define LC_RPN_XOR   0xFFF3
 #define LC_RPN_NOT   0xFFF4
 #define LC_RPN_EQUAL 0xFFF5
+#define LC_RPN_VOTE_BASE                                    \
+    0xF800 /**< \brief First K of N vote operator word, see \
+                       #LC_RPN_VOTE                         */
+#define LC_RPN_AP_BASE                                             \
+    0xFC00 /**< \brief First actionpoint result operand word, see \
+                       #LC_RPN_AP                                  */
+/** \} */
+
+/**
+**  \brief K of N vote operator
+**
+**  Pops N operands and pushes TRUE when at least K of them are TRUE or
+**  FALSE when too few can be TRUE. Otherwise ERROR and STALE operands
+**  decide the result as they do for #LC_RPN_AND and #LC_RPN_OR. K and N
+**  may be 1 to 32, with K no more than N.
+*/
+#define LC_RPN_VOTE(K, N) \
+    (LC_RPN_VOTE_BASE | ((((K) - 1) & 0x1F) << 5) | (((N) - 1) & 0x1F))
+
+/**
+**  \name K of N vote operator fields */
+/** \{ */
+#define LC_RPN_IS_VOTE(Word) (((Word) & 0xFC00) == LC_RPN_VOTE_BASE)
+#define LC_RPN_VOTE_K(Word)  ((((Word) >> 5) & 0x1F) + 1)
+#define LC_RPN_VOTE_N(Word)  (((Word) & 0x1F) + 1)
+/** \} */
+
+/**
+**  \brief Actionpoint result operand
+**
+**  Pushes the result of actionpoint N: TRUE when it fails, FALSE when
+**  it passes, otherwise ERROR or STALE. Actionpoints are sampled after
+**  the actionpoints they reference, so this is the result from the
+**  same sample whenever N is sampled too. References may not form a
+**  cycle.
+*/
+#define LC_RPN_AP(N) (LC_RPN_AP_BASE + (N))
+
+/**
+**  \name Actionpoint result operand fields */
+/** \{ */
+#define LC_RPN_AP_END 0xFFF0 /**< \brief First word after the operands */
+#define LC_RPN_IS_AP(Word) \
+    (((Word) >= LC_RPN_AP_BASE) && ((Word) < LC_RPN_AP_END))
+#define LC_RPN_AP_NUMBER(Word) ((Word) - LC_RPN_AP_BASE)
 /** \} */
 
 /**
@@ -149,6 +215,8 @@
 #define LC_WDTVAL_ERR_MID   3 /**< \brief Invalid MessageID                 */
 #define LC_WDTVAL_ERR_FPNAN 4 /**< \brief ComparisonValue is NAN float      */
 #define LC_WDTVAL_ERR_FPINF 5 /**< \brief ComparisonValue is infinite float */
+#define LC_WDTVAL_ERR_ARRAY 6 /**< \brief Invalid array element settings    */
+#define LC_WDTVAL_ERR_MODE  7 /**< \brief Invalid MonitorMode               */
 /** \} */
 
 /**
@@ -161,6 +229,10 @@
 #define LC_ADTVAL_ERR_FAILCNT 3 /**< \brief MaxFailsBeforeRTS is zero */
 #define LC_ADTVAL_ERR_EVTTYPE 4 /**< \brief Invalid EventType */
 #define LC_ADTVAL_ERR_RPN     5 /**< \brief Invalid Reverse Polish Expression */
+#define LC_ADTVAL_ERR_APCYCLE                                              \
+    6 /**< \brief Actionpoints reference each other's results in a cycle */
+#define LC_ADTVAL_ERR_RPNPOOL                                              \
+    7 /**< \brief Reverse Polish Expression doesn't fit in the RPN pool */
 /** \} */
 
 #endif /*_lc_tbldefs_*/
@@ -77,8 +77,8 @@
 #error LC_MAX_WATCHPOINTS must be defined!
 #elif LC_MAX_WATCHPOINTS < 1
 #error LC_MAX_WATCHPOINTS must not be less than 1
-#elif LC_MAX_WATCHPOINTS > 65520
-#error LC_MAX_WATCHPOINTS must not exceed 65520 (OxFFF0)
+#elif LC_MAX_WATCHPOINTS > 63488
+#error LC_MAX_WATCHPOINTS must not exceed 63488 (OxF800)
 #elif LC_MAX_WATCHPOINTS % 4 != 0
 #error LC_MAX_WATCHPOINTS must be a multiple of 4
 #endif
@@ -90,8 +90,8 @@
 #error LC_MAX_ACTIONPOINTS must be defined!
 #elif LC_MAX_ACTIONPOINTS < 1
 #error LC_MAX_ACTIONPOINTS must not be less than 1
-#elif LC_MAX_ACTIONPOINTS > 65535
-#error LC_MAX_ACTIONPOINTS must not exceed 65535
+#elif LC_MAX_ACTIONPOINTS > 1008
+#error LC_MAX_ACTIONPOINTS must not exceed 1008
 #elif LC_MAX_ACTIONPOINTS % 2 != 0
 #error LC_MAX_ACTIONPOINTS must be a multiple of 2
 #endif
@@ -134,14 +134,47 @@
 #endif
 
 /*
-** RPN equation buffer size (in 16 bit words)
+** RPN equation stack depth
 */
-#ifndef LC_MAX_RPN_EQU_SIZE
-#error LC_MAX_RPN_EQU_SIZE must be defined!
-#elif LC_MAX_RPN_EQU_SIZE < 2
-#error LC_MAX_RPN_EQU_SIZE must not be less than 2
-#elif LC_MAX_RPN_EQU_SIZE > 32
-#error LC_MAX_RPN_EQU_SIZE must not exceed 32
+#ifndef LC_MAX_RPN_STACK_DEPTH
+#error LC_MAX_RPN_STACK_DEPTH must be defined!
+#elif LC_MAX_RPN_STACK_DEPTH < 2
+#error LC_MAX_RPN_STACK_DEPTH must not be less than 2
+#elif LC_MAX_RPN_STACK_DEPTH > 127
+#error LC_MAX_RPN_STACK_DEPTH must not exceed 127
+#endif
+
+/*
+** ADT RPN pool size (in 16 bit words)
+*/
+#ifndef LC_MAX_RPN_POOL_SIZE
+#error LC_MAX_RPN_POOL_SIZE must be defined!
+#elif LC_MAX_RPN_POOL_SIZE < 2
+#error LC_MAX_RPN_POOL_SIZE must not be less than 2
+#elif LC_MAX_RPN_POOL_SIZE > 65535
+#error LC_MAX_RPN_POOL_SIZE must not exceed 65535
+#endif
+
+/*
+** RPN subtrees considered for sharing
+*/
+#ifndef LC_MAX_RPN_SUBTREES
+#error LC_MAX_RPN_SUBTREES must be defined!
+#elif LC_MAX_RPN_SUBTREES < 1
+#error LC_MAX_RPN_SUBTREES must not be less than 1
+#elif LC_MAX_RPN_SUBTREES > 65534
+#error LC_MAX_RPN_SUBTREES must not exceed 65534
+#endif
+
+/*
+** Shared RPN equation words (in 16 bit words)
+*/
+#ifndef LC_SHARED_RPN_POOL_WORDS
+#error LC_SHARED_RPN_POOL_WORDS must be defined!
+#elif LC_SHARED_RPN_POOL_WORDS < 1
+#error LC_SHARED_RPN_POOL_WORDS must not be less than 1
+#elif LC_SHARED_RPN_POOL_WORDS > 65535
+#error LC_SHARED_RPN_POOL_WORDS must not exceed 65535
 #endif
 
 /*
@@ -180,6 +213,50 @@
 #error LC_MAX_VALID_ADT_RTSID must not exceed 65535
 #endif
 
+/*
+** Maximum watchpoint array elements
+*/
+#ifndef LC_MAX_WP_ELEMENTS
+#error LC_MAX_WP_ELEMENTS must be defined!
+#elif LC_MAX_WP_ELEMENTS < 1
+#error LC_MAX_WP_ELEMENTS must not be less than 1
+#elif LC_MAX_WP_ELEMENTS > 65535
+#error LC_MAX_WP_ELEMENTS must not exceed 65535
+#endif
+
+/*
+** Watchpoint array element result words
+*/
+#ifndef LC_MAX_ELEMENT_RESULT_WORDS
+#error LC_MAX_ELEMENT_RESULT_WORDS must be defined!
+#elif LC_MAX_ELEMENT_RESULT_WORDS < 1
+#error LC_MAX_ELEMENT_RESULT_WORDS must not be less than 1
+#elif LC_MAX_ELEMENT_RESULT_WORDS > 65534
+#error LC_MAX_ELEMENT_RESULT_WORDS must not exceed 65534
+#endif
+
+/*
+** Latest message snapshot words
+*/
+#ifndef LC_SNAPSHOT_POOL_WORDS
+#error LC_SNAPSHOT_POOL_WORDS must be defined!
+#elif LC_SNAPSHOT_POOL_WORDS < 1
+#error LC_SNAPSHOT_POOL_WORDS must not be less than 1
+#elif LC_SNAPSHOT_POOL_WORDS > 1048576
+#error LC_SNAPSHOT_POOL_WORDS must not exceed 1048576
+#endif
+
+/*
+** Message fingerprint words
+*/
+#ifndef LC_FINGERPRINT_POOL_WORDS
+#error LC_FINGERPRINT_POOL_WORDS must be defined!
+#elif LC_FINGERPRINT_POOL_WORDS < 1
+#error LC_FINGERPRINT_POOL_WORDS must not be less than 1
+#elif LC_FINGERPRINT_POOL_WORDS > 1048576
+#error LC_FINGERPRINT_POOL_WORDS must not exceed 1048576
+#endif
+
 /*
 ** Application name
 */
@@ -22,12 +22,62 @@
 *************************************************************************/
 #include "lc_watch.h"
 
+#include <string.h>
+
+#if defined(LC_HAVE_SSE2)
+#include <emmintrin.h>
+#elif defined(LC_HAVE_NEON)
+#include <arm_neon.h>
+#endif
+
 #include "cfe_platform_cfg.h"
+#include "lc_action.h"
 #include "lc_app.h"
 #include "lc_custom.h"
 #include "lc_events.h"
 #include "lc_perfids.h"
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* LC_HashMessageID() - multiply-shift hash of a messageID         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 LC_HashMessageID(CFE_SB_MsgId_t MessageID, uint32 Multiplier,
+                        uint8 Bits) {
+    uint32 Hash = 0;
+
+    /*
+    **   The top Bits bits of the product depend on every bit of the
+    ** MessageID (all 32 of them if the cFE build uses wide MessageID's).
+    ** For an odd multiplier picked at random, two different MessageID's
+    ** get the same hash with a probability of at most 2 / 2^Bits.
+    */
+    if (Bits > 0) {
+        Hash = (((uint32)MessageID) * Multiplier) >> (32 - Bits);
+    }
+
+    return (Hash);
+
+} /* End of LC_HashMessageID() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* LC_GetHashMultiplier() - enumerate the odd hash multipliers     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 LC_GetHashMultiplier(uint32 Try) {
+    /*
+    ** Multiplying by an odd constant modulo 2^31 reorders 0 through
+    ** 2^31 - 1, so the first LC_HASH_MULTIPLIER_COUNT tries give every
+    ** odd multiplier exactly once, but not in the (poorly mixing)
+    ** counting order
+    */
+    return ((((Try * 0x9E3779B9) & 0x7FFFFFFF) << 1) | 1);
+
+} /* End of LC_GetHashMultiplier() */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* LC_GetHashTableIndex() - convert messageID to hash table index  */
@@ -36,28 +86,33 @@
 
 uint32 LC_GetHashTableIndex(CFE_SB_MsgId_t MessageID) {
     /*
-    **   The purpose of a hash function is to take the input value
-    ** and convert it to an index into the hash table. Assume that
-    ** the range of input values is much different (larger) than
-    ** the number of entries in the hash table. Then multiple input
-    ** values must resolve to the same output table index. This is ok
-    ** because each entry in the hash table is a linked list of all
-    ** the inputs with the same hash function result.
-    **
-    **   This particular hash function takes advantage of knowledge
-    ** regarding the format of the input values (cFE MessageID). By
-    ** ignoring the bits that define version number, packet type and
-    ** secondary header (high 5 bits of 16) we are left with the bits
-    ** (mask = 0x7FF) that can identify 2048 unique input telemetry
-    ** packets. Also, by using a fixed hash table size of 256 entries
-    ** and using only the lower 8 bits of the bitmask as the result
-    ** of the hash function, no single hash table entry will have more
-    ** than 8 elements in its linked list.
+    **   The hash table index selects the group of MessageID's that
+    ** share a second level table in the perfect hash (see
+    ** LC_GetHashSlotIndex). Each hash table entry is also a linked
+    ** list of the MessageID's in that group, which is only used while
+    ** the tables are being built.
     */
-    return ((uint32)(MessageID & LC_HASH_TABLE_MASK));
+    return (LC_HashMessageID(MessageID, LC_OperData.HashMultiplier,
+                             LC_HASH_TABLE_BITS));
 
 } /* End of LC_GetHashTableIndex() */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* LC_GetHashSlotIndex() - convert messageID to perfect hash slot  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+uint32 LC_GetHashSlotIndex(CFE_SB_MsgId_t MessageID) {
+    const LC_HashBucket_t *Bucket;
+
+    Bucket = &LC_OperData.HashBuckets[LC_GetHashTableIndex(MessageID)];
+
+    return (Bucket->SlotStart + LC_HashMessageID(MessageID, Bucket->Multiplier,
+                                                 Bucket->SlotBits));
+
+} /* End of LC_GetHashSlotIndex() */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* LC_CreateHashTable() - create watchpoint hash table             */
@@ -65,11 +120,20 @@ uint32 LC_GetHashTableIndex(CFE_SB_MsgId_t MessageID) {
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
 void LC_CreateHashTable(void) {
-    LC_WatchPtList_t *WatchPtLink;
-    CFE_SB_MsgId_t LastMessageID;
+    LC_MessageList_t *MessageLink;
+    LC_WatchEval_t *EvalPtr;
     CFE_SB_MsgId_t MessageID;
     int32 MessageLinkIndex;
     int32 WatchPtTblIndex;
+    uint16 EvalIndex;
+    uint16 ElementWords;
+    uint16 ElementWordsUsed;
+    uint16 SharedDatumCount;
+    uint32 MessagePeriod;
+    uint16 MessageDecimation;
+    uint32 SnapshotWords;
+    uint32 SnapshotSize;
+    uint32 SnapshotWordsUsed;
     int32 Result;
 
     /* Un-subscribe to any MessageID's referenced in previous Watchpoint
@@ -92,42 +156,205 @@ void LC_CreateHashTable(void) {
                    (LC_HASH_TABLE_ENTRIES * sizeof(LC_MessageList_t *)));
     CFE_PSP_MemSet(LC_OperData.MessageLinks, 0,
                    (LC_MAX_WATCHPOINTS * sizeof(LC_MessageList_t)));
-    CFE_PSP_MemSet(LC_OperData.WatchPtLinks, 0,
-                   (LC_MAX_WATCHPOINTS * sizeof(LC_WatchPtList_t)));
+    CFE_PSP_MemSet(LC_OperData.WatchEvals, 0,
+                   (LC_MAX_WATCHPOINTS * sizeof(LC_WatchEval_t)));
+    CFE_PSP_MemSet(LC_OperData.ElementResults, 0,
+                   (LC_MAX_ELEMENT_RESULT_WORDS * sizeof(uint32)));
+
+    LC_OperData.MessageIDsCount    = 0;
+    LC_OperData.WatchpointCount    = 0;
+    LC_OperData.HaveMessagePeriods = false;
+    LC_OperData.HaveSnapshots      = false;
+
+    LC_OperData.WatchSpanCount       = 0;
+    LC_OperData.FingerprintWordsUsed = 0;
 
-    LC_OperData.MessageIDsCount = 0;
-    LC_OperData.WatchpointCount = 0;
+    ElementWordsUsed  = 0;
+    SnapshotWordsUsed = 0;
 
-    LastMessageID = 0xFFFF;
-    WatchPtLink   = (LC_WatchPtList_t *)NULL;
+    /* Any multiplier will do for the lists, see LC_CreatePerfectHash */
+    LC_OperData.HashMultiplier = LC_GetHashMultiplier(0);
 
-    /* Process each entry in the Watchpoint Definition Table */
+    /*
+    ** First pass: create a link (and subscription) for each MessageID
+    ** and count the watchpoints that reference it
+    */
     for (WatchPtTblIndex = 0; WatchPtTblIndex < LC_MAX_WATCHPOINTS;
          WatchPtTblIndex++) {
         /* Skip unused watchpoint table entries */
         if (LC_OperData.WDTPtr[WatchPtTblIndex].DataType != LC_WATCH_NOT_USED) {
-            MessageID = LC_OperData.WDTPtr[WatchPtTblIndex].MessageID;
-
-            /* Use optimized code path if same MessageID as last watchpoint */
-            if ((LastMessageID == MessageID) &&
-                (WatchPtLink != (LC_WatchPtList_t *)NULL)) {
-                /* WatchPtLink points to last link in list for this Message ID
-                 */
-                WatchPtLink->Next =
-                    &LC_OperData.WatchPtLinks[LC_OperData.WatchpointCount++];
-
-                /* Add new link to end of list, point to new last link */
-                WatchPtLink = WatchPtLink->Next;
-            } else {
-                /* May add message list link and subscribe to MessageID */
-                WatchPtLink = LC_AddWatchpoint(MessageID);
+            MessageLink =
+                LC_AddWatchpoint(LC_OperData.WDTPtr[WatchPtTblIndex].MessageID);
+            MessageLink->EvalCount++;
+        }
+    }
+
+    /* Replace the hash table list search with a single probe */
+    LC_CreatePerfectHash();
+
+    /*
+    ** Give each MessageID a contiguous range of evaluation records
+    */
+    EvalIndex = 0;
+    for (MessageLinkIndex = 0; MessageLinkIndex < LC_OperData.MessageIDsCount;
+         MessageLinkIndex++) {
+        MessageLink            = &LC_OperData.MessageLinks[MessageLinkIndex];
+        MessageLink->EvalStart = EvalIndex;
+        EvalIndex += MessageLink->EvalCount;
+
+        /* Count is rebuilt as the records are filled in */
+        MessageLink->EvalCount = 0;
+    }
+
+    /*
+    ** Second pass: compile each watchpoint into the next record of the
+    ** range that belongs to its MessageID
+    */
+    for (WatchPtTblIndex = 0; WatchPtTblIndex < LC_MAX_WATCHPOINTS;
+         WatchPtTblIndex++) {
+        if (LC_OperData.WDTPtr[WatchPtTblIndex].DataType != LC_WATCH_NOT_USED) {
+            MessageLink = LC_FindMessageLink(
+                LC_OperData.WDTPtr[WatchPtTblIndex].MessageID);
+
+            EvalIndex = MessageLink->EvalStart + MessageLink->EvalCount++;
+            EvalPtr   = &LC_OperData.WatchEvals[EvalIndex];
+
+            LC_CompileWatchpoint(WatchPtTblIndex, EvalPtr);
+
+            /*
+            ** Track the longest message any watchpoint needs. An
+            ** undefined data type forces the per watchpoint checks
+            ** so it is reported for every message.
+            */
+            if (EvalPtr->CompareType == LC_EVAL_UNDEFINED) {
+                MessageLink->MaxExtent = 0xFFFFFFFF;
+            } else if ((EvalPtr->WatchpointOffset + EvalPtr->DataExtent) >
+                       MessageLink->MaxExtent) {
+                MessageLink->MaxExtent =
+                    EvalPtr->WatchpointOffset + EvalPtr->DataExtent;
+            }
+
+            /*
+            ** The results of the MessageID go stale at the shortest
+            ** period any of its watchpoints allows
+            */
+            MessagePeriod = LC_OperData.WDTPtr[WatchPtTblIndex].MessagePeriod;
+
+            if ((MessagePeriod != 0) &&
+                ((MessageLink->MessagePeriod == 0) ||
+                 (MessagePeriod < MessageLink->MessagePeriod))) {
+                MessageLink->MessagePeriod = MessagePeriod;
+            }
+
+            /*
+            ** The MessageID is evaluated as often as the smallest
+            ** decimation any of its watchpoints allows
+            */
+            MessageDecimation =
+                LC_OperData.WDTPtr[WatchPtTblIndex].MessageDecimation;
+
+            if ((MessageDecimation != 0) &&
+                ((MessageLink->MessageDecimation == 0) ||
+                 (MessageDecimation < MessageLink->MessageDecimation))) {
+                MessageLink->MessageDecimation = MessageDecimation;
+            }
+
+            /*
+            ** One watchpoint that needs every message decides for all.
+            ** A custom function may read any part of the message, so
+            ** it always gets the message itself and not a snapshot
+            */
+            if ((LC_OperData.WDTPtr[WatchPtTblIndex].MonitorMode !=
+                 LC_MONITOR_LATEST) ||
+                (EvalPtr->OperatorID == LC_OPER_CUSTOM)) {
+                MessageLink->EveryMessage = true;
+            }
+
+            /*
+            ** Keep the element results of array watchpoints for as
+            ** long as there are words left to hold them
+            */
+            if (EvalPtr->ElementCount > 0) {
+                ElementWords = (EvalPtr->ElementCount + 31) / 32;
+
+                if (ElementWords <=
+                    (LC_MAX_ELEMENT_RESULT_WORDS - ElementWordsUsed)) {
+                    EvalPtr->ElementResultStart = ElementWordsUsed;
+                    ElementWordsUsed += ElementWords;
+                }
             }
 
-            /* Set watchpoint table index for this entry in list */
-            WatchPtLink->WatchIndex = WatchPtTblIndex;
+            LC_OperData.WatchpointCount++;
+        }
+    }
+
+    /*
+    ** Group the records of each MessageID into same-type batches, then
+    ** find the records that can share one data extraction
+    */
+    SharedDatumCount = 0;
+
+    for (MessageLinkIndex = 0; MessageLinkIndex < LC_OperData.MessageIDsCount;
+         MessageLinkIndex++) {
+        MessageLink = &LC_OperData.MessageLinks[MessageLinkIndex];
+
+        LC_CreateBatches(MessageLink);
+
+        if (MessageLink->MessageDecimation == 0) {
+            MessageLink->MessageDecimation = 1;
+        }
+
+        SharedDatumCount += LC_ShareDatums(MessageLink);
+
+        /*
+        ** A timed MessageID that doesn't arrive at all after the table
+        ** load goes stale as well
+        */
+        if (MessageLink->MessagePeriod != 0) {
+            MessageLink->StaleAge.Seconds = MessageLink->MessagePeriod / 1000;
+            MessageLink->StaleAge.Subseconds = CFE_TIME_Micro2SubSecs(
+                (MessageLink->MessagePeriod % 1000) * 1000);
+
+            MessageLink->StaleTime =
+                CFE_TIME_Add(CFE_TIME_GetTime(), MessageLink->StaleAge);
+            MessageLink->StaleTimed = true;
 
-            LastMessageID = MessageID;
+            LC_OperData.HaveMessagePeriods = true;
         }
+
+        /*
+        ** Keep a copy of the latest message of a MessageID that is only
+        ** evaluated at sample time for as long as there are words left.
+        ** The copy always holds the whole primary header, so the message
+        ** length can still be read from it
+        */
+        SnapshotSize = MessageLink->MaxExtent;
+
+        if (SnapshotSize < sizeof(CCSDS_PriHdr_t)) {
+            SnapshotSize = sizeof(CCSDS_PriHdr_t);
+        }
+
+        if ((MessageLink->EveryMessage == false) &&
+            (SnapshotSize <= (LC_SNAPSHOT_POOL_WORDS * 4))) {
+            SnapshotWords = (SnapshotSize + 3) / 4;
+
+            if (SnapshotWords <= (LC_SNAPSHOT_POOL_WORDS - SnapshotWordsUsed)) {
+                MessageLink->SnapshotStart = SnapshotWordsUsed;
+                MessageLink->SnapshotSize  = SnapshotSize;
+                SnapshotWordsUsed += SnapshotWords;
+
+                LC_OperData.HaveSnapshots = true;
+            }
+        }
+
+        LC_CreateFingerprint(MessageLink);
+    }
+
+    if (SharedDatumCount > 0) {
+        CFE_EVS_SendEvent(
+            LC_WP_SHARED_DATA_INF_EID, CFE_EVS_EventType_INFORMATION,
+            "WP data extractions merged: Merged = %d, WPs = %d",
+            SharedDatumCount, LC_OperData.WatchpointCount);
     }
 
     return;
@@ -140,9 +367,8 @@ void LC_CreateHashTable(void) {
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 
-LC_WatchPtList_t *LC_AddWatchpoint(CFE_SB_MsgId_t MessageID) {
+LC_MessageList_t *LC_AddWatchpoint(CFE_SB_MsgId_t MessageID) {
     LC_MessageList_t *MessageLink;
-    LC_WatchPtList_t *WatchPtLink;
     bool NeedSubscription;
     int32 HashTableIndex;
     int32 Result;
@@ -203,437 +429,1893 @@ LC_WatchPtList_t *LC_AddWatchpoint(CFE_SB_MsgId_t MessageID) {
         }
     }
 
-    /* MessageLink points to the link for this MessageID */
-    if (MessageLink->WatchPtList == (LC_WatchPtList_t *)NULL) {
-        /* Get next unused watchpoint linked list entry */
-        WatchPtLink = &LC_OperData.WatchPtLinks[LC_OperData.WatchpointCount++];
-
-        /* Set the start (and only) link in the watchpoint link list */
-        MessageLink->WatchPtList = WatchPtLink;
-    } else {
-        /* Find the end of the watchpoint linked list */
-        WatchPtLink = MessageLink->WatchPtList;
-
-        while (WatchPtLink->Next != (LC_WatchPtList_t *)NULL) {
-            WatchPtLink = WatchPtLink->Next;
-        }
-
-        /* Add the new watchpoint link to the end of the list */
-        WatchPtLink->Next =
-            &LC_OperData.WatchPtLinks[LC_OperData.WatchpointCount++];
-        WatchPtLink = WatchPtLink->Next;
-    }
-
-    /* Return pointer to last link in watchpoint linked list */
-    return (WatchPtLink);
+    /* Return pointer to the link for this MessageID */
+    return (MessageLink);
 
 } /* End of LC_AddWatchpoint() */
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Handle a message with possible watchpoints                      */
+/* LC_CreatePerfectHash() - one probe messageID lookup             */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void LC_CheckMsgForWPs(CFE_SB_MsgId_t MessageID, CFE_SB_MsgPtr_t MessagePtr) {
-    CFE_TIME_SysTime_t Timestamp;
-    LC_MessageList_t *MessageList;
-    LC_WatchPtList_t *WatchPtList;
-    bool WatchPtFound = false;
 
-    /* Do nothing if disabled at the application level */
-    if (LC_AppData.CurrentLCState != LC_STATE_DISABLED) {
-        /* Use message timestamp - if none, use current time */
-        Timestamp = CFE_SB_GetMsgTime(MessagePtr);
+void LC_CreatePerfectHash(void) {
+    LC_MessageList_t *MessageLink;
+    LC_MessageList_t *PlacedLink;
+    LC_HashBucket_t *Bucket;
+    uint32 MessageIDsCount;
+    uint32 MessageLinkIndex;
+    uint32 HashTableIndex;
+    uint32 ListLength;
+    uint32 SlotIndex;
+    uint32 SlotStart;
+    uint32 SquaresLimit;
+    uint32 Squares;
+    uint32 Try;
+
+    CFE_PSP_MemSet(LC_OperData.HashSlots, 0,
+                   (LC_HASH_SLOT_ENTRIES * sizeof(LC_MessageList_t *)));
+
+    MessageIDsCount = LC_OperData.MessageIDsCount;
 
-        if ((Timestamp.Seconds == 0) && (Timestamp.Subseconds == 0)) {
-            Timestamp = CFE_TIME_GetTime();
+    /*
+    **   Pick the hash table multiplier. Two MessageID's share an entry
+    ** for at most 2 in LC_HASH_TABLE_ENTRIES of the odd multipliers, so
+    ** over all of them the average sum of squared list lengths is at
+    ** most n + 2n(n - 1)/LC_HASH_TABLE_ENTRIES for n MessageID's. Some
+    ** multiplier is no worse than the average, so trying every odd
+    ** multiplier in turn is sure to stop. Most are well below it since
+    ** the table has at least 2n entries, so in practice it stops after
+    ** one or two tries. The list lengths are counted in the SlotStart
+    ** of each entry until the slots are handed out.
+    */
+    SquaresLimit = MessageIDsCount +
+                   ((MessageIDsCount * (MessageIDsCount - 1)) >>
+                    (LC_HASH_TABLE_BITS - 1));
+
+    for (Try = 0; Try < LC_HASH_MULTIPLIER_COUNT; Try++) {
+        LC_OperData.HashMultiplier = LC_GetHashMultiplier(Try);
+
+        CFE_PSP_MemSet(LC_OperData.HashBuckets, 0,
+                       (LC_HASH_TABLE_ENTRIES * sizeof(LC_HashBucket_t)));
+
+        Squares = 0;
+        for (MessageLinkIndex = 0; MessageLinkIndex < MessageIDsCount;
+             MessageLinkIndex++) {
+            Bucket = &LC_OperData.HashBuckets[LC_GetHashTableIndex(
+                LC_OperData.MessageLinks[MessageLinkIndex].MessageID)];
+
+            /* (k + 1)^2 - k^2 = 2k + 1 */
+            Squares += (2 * Bucket->SlotStart) + 1;
+            Bucket->SlotStart++;
         }
 
-        /* Performance Log (start time counter) */
-        CFE_ES_PerfLogEntry(LC_WDT_SEARCH_PERF_ID);
+        if (Squares <= SquaresLimit) {
+            break;
+        }
+    }
 
-        /* Get start of linked list (all MID's with same hash result) */
-        MessageList = LC_OperData.HashTable[LC_GetHashTableIndex(MessageID)];
+    /* Rebuild the hash table lists for the multiplier picked */
+    CFE_PSP_MemSet(LC_OperData.HashTable, 0,
+                   (LC_HASH_TABLE_ENTRIES * sizeof(LC_MessageList_t *)));
 
-        /* NULL when list is empty or end of list */
-        while (MessageList != (LC_MessageList_t *)NULL) {
-            /* Compare this linked list entry for matching MessageID */
-            if (MessageList->MessageID == MessageID) {
-                /* Stop the search - we found it */
-                break;
-            }
+    for (MessageLinkIndex = MessageIDsCount; MessageLinkIndex > 0;
+         MessageLinkIndex--) {
+        MessageLink    = &LC_OperData.MessageLinks[MessageLinkIndex - 1];
+        HashTableIndex = LC_GetHashTableIndex(MessageLink->MessageID);
+
+        MessageLink->Next = LC_OperData.HashTable[HashTableIndex];
+        LC_OperData.HashTable[HashTableIndex] = MessageLink;
+    }
+
+    /*
+    **   Give each list of k MessageID's a second level table of at
+    ** least 2k^2 slots. A random odd multiplier then sends two of them
+    ** to the same slot with an expected count of less than one half,
+    ** so at least half of the multipliers place the whole list without
+    ** a collision and the search again is sure to stop. Each table has
+    ** fewer than 4k^2 slots. With the limit above and n no more than
+    ** half of LC_HASH_TABLE_ENTRIES, that is fewer than 4(2n - 1) in
+    ** all, which fits in LC_HASH_SLOT_ENTRIES.
+    */
+    SlotStart = 0;
+
+    for (HashTableIndex = 0; HashTableIndex < LC_HASH_TABLE_ENTRIES;
+         HashTableIndex++) {
+        Bucket     = &LC_OperData.HashBuckets[HashTableIndex];
+        ListLength = Bucket->SlotStart;
 
-            /* Max of 8 links per design */
-            MessageList = MessageList->Next;
+        if (ListLength == 0) {
+            continue;
         }
 
-        /* Should be true - else wouldn't subscribe to MessageID */
-        if (MessageList != (LC_MessageList_t *)NULL) {
-            /* Get linked list of WP's that reference MessageID */
-            WatchPtList = MessageList->WatchPtList;
-
-            /* NULL when list is empty or end of list */
-            while (WatchPtList != (LC_WatchPtList_t *)NULL) {
-                WatchPtFound = true;
-
-                /* Verify that WP packet offset is within actual packet */
-                if (LC_WPOffsetValid(WatchPtList->WatchIndex, MessagePtr) ==
-                    true) {
-                    LC_ProcessWP(WatchPtList->WatchIndex, MessagePtr,
-                                 Timestamp);
+        Bucket->SlotStart = SlotStart;
+        Bucket->SlotBits  = 0;
+
+        while ((ListLength > 1) &&
+               ((1UL << Bucket->SlotBits) <
+                (2UL * ListLength * ListLength))) {
+            Bucket->SlotBits++;
+        }
+
+        for (Try = 0; Try < LC_HASH_MULTIPLIER_COUNT; Try++) {
+            Bucket->Multiplier = LC_GetHashMultiplier(Try);
+
+            MessageLink = LC_OperData.HashTable[HashTableIndex];
+            while (MessageLink != (LC_MessageList_t *)NULL) {
+                SlotIndex = LC_GetHashSlotIndex(MessageLink->MessageID);
+
+                if (LC_OperData.HashSlots[SlotIndex] !=
+                    (LC_MessageList_t *)NULL) {
+                    break;
                 }
 
-                /* No limit to how many WP's can reference one MessageID */
-                WatchPtList = WatchPtList->Next;
+                LC_OperData.HashSlots[SlotIndex] = MessageLink;
+                MessageLink                      = MessageLink->Next;
             }
-        }
 
-        /* Performance Log (stop time counter) */
-        CFE_ES_PerfLogExit(LC_WDT_SEARCH_PERF_ID);
+            if (MessageLink == (LC_MessageList_t *)NULL) {
+                /* Every MessageID in the list has its own slot */
+                break;
+            }
 
-        if (WatchPtFound == true) {
-            LC_AppData.MonitoredMsgCount++;
-        } else {
-            /* MessageID with no defined watchpoints */
-            CFE_EVS_SendEvent(
-                LC_MID_INF_EID, CFE_EVS_EventType_INFORMATION,
-                "Msg with unreferenced message ID rcvd: ID = 0x%04X",
-                MessageID);
+            /* Collision - undo the slots claimed with this multiplier */
+            PlacedLink = LC_OperData.HashTable[HashTableIndex];
+            while (PlacedLink != MessageLink) {
+                LC_OperData.HashSlots[LC_GetHashSlotIndex(
+                    PlacedLink->MessageID)] = (LC_MessageList_t *)NULL;
+                PlacedLink = PlacedLink->Next;
+            }
         }
+
+        SlotStart += (1UL << Bucket->SlotBits);
     }
 
     return;
 
-} /* end LC_CheckMsgForWPs */
+} /* End of LC_CreatePerfectHash() */
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Process a single watchpoint                                     */
+/* LC_CreateBatches() - group compiled WP's for batch evaluation   */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-void LC_ProcessWP(uint16 WatchIndex, CFE_SB_MsgPtr_t MessagePtr,
-                  CFE_TIME_SysTime_t Timestamp) {
-    uint8 *WPDataPtr;
-    uint8 PreviousResult;
-    uint8 WPEvalResult;
-    uint32 SizedWPData;
-    uint32 MaskedWPData;
-    uint32 StaleCounter;
-    bool SizedDataValid;
+void LC_CreateBatches(LC_MessageList_t *MessageLink) {
+    LC_WatchEval_t *EvalList;
+    uint16 EvalIndex;
+    uint16 RunLength;
+    uint8 BatchKey;
+
+    EvalList = &LC_OperData.WatchEvals[MessageLink->EvalStart];
 
     /*
-    ** Setup the pointer and get the massaged data
+    ** Group the records of each comparison type, then pull the integer
+    ** watchpoints on one datum into threshold ladders and the single
+    ** bit checks of one word into flag banks. Grouping again after
+    ** each step moves the new ladders and banks out of the batchable
+    ** runs.
     */
-    WPDataPtr =
-        ((uint8 *)MessagePtr) + LC_OperData.WDTPtr[WatchIndex].WatchpointOffset;
+    LC_SortByBatchKey(MessageLink);
 
-    SizedDataValid = LC_GetSizedWPData(WatchIndex, WPDataPtr, &SizedWPData);
-    if (SizedDataValid == true) {
-        /*
-        ** Get the last evalution result for this watchpoint
-        */
-        PreviousResult = LC_OperData.WRTPtr[WatchIndex].WatchResult;
+    LC_CreateLadders(MessageLink);
 
-        /*
-        ** Apply the defined bitmask for this watchpoint and then
-        ** call the mission defined custom function or do our own
-        ** relational comparison.
-        */
-        MaskedWPData = SizedWPData & LC_OperData.WDTPtr[WatchIndex].BitMask;
+    LC_SortByBatchKey(MessageLink);
 
-        if (LC_OperData.WDTPtr[WatchIndex].OperatorID == LC_OPER_CUSTOM) {
-            WPEvalResult = LC_CustomFunction(
-                WatchIndex, MaskedWPData, MessagePtr,
-                LC_OperData.WDTPtr[WatchIndex].CustomFuncArgument);
+    LC_CreateFlagBanks(MessageLink);
+
+    LC_SortByBatchKey(MessageLink);
+
+    /*
+    ** Walk back from the end counting how many records of the same
+    ** batch key follow each one. A run longer than LC_BATCH_LANES is
+    ** split, and each record ends up with the size of the batch it
+    ** would start. Only the first record of a batch is ever read.
+    */
+    RunLength = 0;
+
+    for (EvalIndex = MessageLink->EvalCount; EvalIndex > 0; EvalIndex--) {
+        BatchKey = LC_GetBatchKey(&EvalList[EvalIndex - 1]);
+
+        if ((BatchKey != LC_EVAL_UNDEFINED) &&
+            (EvalIndex < MessageLink->EvalCount) &&
+            (LC_GetBatchKey(&EvalList[EvalIndex]) == BatchKey)) {
+            RunLength++;
+        } else {
+            RunLength = 1;
+        }
+
+        if (RunLength > LC_BATCH_LANES) {
+            EvalList[EvalIndex - 1].BatchCount = LC_BATCH_LANES;
         } else {
-            WPEvalResult = LC_OperatorCompare(WatchIndex, MaskedWPData);
+            EvalList[EvalIndex - 1].BatchCount = (uint8)RunLength;
         }
 
         /*
-        ** Update the watch result
+        ** The ladders are in their final place, so the comparison
+        ** values of their rungs can be copied to the compact array
+        ** that is searched for each packet
         */
-        LC_OperData.WRTPtr[WatchIndex].WatchResult = WPEvalResult;
+        if (EvalList[EvalIndex - 1].RungCount > 0) {
+            LC_OperData.LadderThresholds[MessageLink->EvalStart + EvalIndex -
+                                         1] =
+                EvalList[EvalIndex - 1].ComparisonValue;
+        }
 
         /*
-        ** Update the watchpoint statistics based on the evaluation
-        ** result
+        ** Likewise the bits of each flag are merged into the masks of
+        ** its bank, from the end of the bank back to its first flag
         */
-        LC_OperData.WRTPtr[WatchIndex].EvaluationCount++;
+        if (EvalList[EvalIndex - 1].FlagCount > 0) {
+            LC_SetFlagBank(&EvalList[EvalIndex - 1],
+                           MessageLink->EvalStart + EvalIndex - 1);
+        }
+    }
 
-        if (WPEvalResult == LC_WATCH_TRUE) {
-            LC_OperData.WRTPtr[WatchIndex].CumulativeTrueCount++;
-            LC_OperData.WRTPtr[WatchIndex].ConsecutiveTrueCount++;
-            StaleCounter = LC_OperData.WDTPtr[WatchIndex].ResultAgeWhenStale;
-            LC_OperData.WRTPtr[WatchIndex].CountdownToStale = StaleCounter;
+    return;
+
+} /* End of LC_CreateBatches() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* LC_SortByBatchKey() - put compiled WP's of one key together     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_SortByBatchKey(LC_MessageList_t *MessageLink) {
+    LC_WatchEval_t *EvalList;
+    LC_WatchEval_t EvalRecord;
+    uint16 EvalIndex;
+    uint16 InsertIndex;
+    uint8 BatchKey;
+
+    EvalList = &LC_OperData.WatchEvals[MessageLink->EvalStart];
+
+    /*
+    ** Stable insertion sort on the batch key so the records of each
+    ** comparison type are adjacent and keep their relative order.
+    ** The lists are short and this only runs when the WDT is loaded.
+    */
+    for (EvalIndex = 1; EvalIndex < MessageLink->EvalCount; EvalIndex++) {
+        EvalRecord  = EvalList[EvalIndex];
+        BatchKey    = LC_GetBatchKey(&EvalRecord);
+        InsertIndex = EvalIndex;
+
+        while ((InsertIndex > 0) &&
+               (LC_GetBatchKey(&EvalList[InsertIndex - 1]) > BatchKey)) {
+            EvalList[InsertIndex] = EvalList[InsertIndex - 1];
+            InsertIndex--;
+        }
 
-            if ((PreviousResult == LC_WATCH_FALSE) ||
-                (PreviousResult == LC_WATCH_STALE)) {
-                LC_OperData.WRTPtr[WatchIndex].LastFalseToTrue.DataType =
-                    LC_OperData.WDTPtr[WatchIndex].DataType;
+        EvalList[InsertIndex] = EvalRecord;
+    }
 
-                LC_OperData.WRTPtr[WatchIndex].FalseToTrueCount++;
+    return;
 
-                LC_OperData.WRTPtr[WatchIndex].LastFalseToTrue.Value =
-                    MaskedWPData;
+} /* End of LC_SortByBatchKey() */
 
-                LC_OperData.WRTPtr[WatchIndex]
-                    .LastFalseToTrue.Timestamp.Seconds = Timestamp.Seconds;
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* LC_CreateLadders() - find ordered limits on one integer datum   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_CreateLadders(LC_MessageList_t *MessageLink) {
+    LC_WatchEval_t *EvalList;
+    LC_WatchEval_t EvalRecord;
+    uint16 EvalIndex;
+    uint16 InsertIndex;
+    uint16 RunStart;
+    uint16 RunLength;
+    uint16 Rung;
+    uint8 BatchKey;
+
+    EvalList = &LC_OperData.WatchEvals[MessageLink->EvalStart];
 
-                LC_OperData.WRTPtr[WatchIndex]
-                    .LastFalseToTrue.Timestamp.Subseconds =
-                    Timestamp.Subseconds;
-            }
-        } else if (WPEvalResult == LC_WATCH_FALSE) {
-            LC_OperData.WRTPtr[WatchIndex].ConsecutiveTrueCount = 0;
-            StaleCounter = LC_OperData.WDTPtr[WatchIndex].ResultAgeWhenStale;
-            LC_OperData.WRTPtr[WatchIndex].CountdownToStale = StaleCounter;
+    /*
+    ** Stable insertion sort that orders the integer records of each
+    ** comparison type by datum and then by comparison value. The
+    ** records are already grouped by batch key, so the groups stay
+    ** where they are.
+    */
+    for (EvalIndex = 1; EvalIndex < MessageLink->EvalCount; EvalIndex++) {
+        EvalRecord  = EvalList[EvalIndex];
+        InsertIndex = EvalIndex;
+
+        while ((InsertIndex > 0) &&
+               (LC_CompareRungs(&EvalList[InsertIndex - 1], &EvalRecord) >
+                0)) {
+            EvalList[InsertIndex] = EvalList[InsertIndex - 1];
+            InsertIndex--;
+        }
+
+        EvalList[InsertIndex] = EvalRecord;
+    }
 
-            if ((PreviousResult == LC_WATCH_TRUE) ||
-                (PreviousResult == LC_WATCH_STALE)) {
-                LC_OperData.WRTPtr[WatchIndex].LastTrueToFalse.DataType =
-                    LC_OperData.WDTPtr[WatchIndex].DataType;
+    /*
+    ** Each run of records on one datum that is long enough becomes a
+    ** ladder. Like BatchCount, every rung gets the number of rungs
+    ** from it to the end of its ladder.
+    */
+    RunStart = 0;
+
+    for (EvalIndex = 1; EvalIndex <= MessageLink->EvalCount; EvalIndex++) {
+        if ((EvalIndex < MessageLink->EvalCount) &&
+            (LC_GetBatchKey(&EvalList[RunStart]) ==
+             LC_GetBatchKey(&EvalList[EvalIndex])) &&
+            (LC_SameDatum(&EvalList[RunStart], &EvalList[EvalIndex]) ==
+             true) &&
+            ((EvalIndex - RunStart) < LC_LADDER_MAX_RUNGS)) {
+            continue;
+        }
 
-                LC_OperData.WRTPtr[WatchIndex].LastTrueToFalse.Value =
-                    MaskedWPData;
+        RunLength = EvalIndex - RunStart;
 
-                LC_OperData.WRTPtr[WatchIndex]
-                    .LastTrueToFalse.Timestamp.Seconds = Timestamp.Seconds;
+        BatchKey = LC_GetBatchKey(&EvalList[RunStart]);
 
-                LC_OperData.WRTPtr[WatchIndex]
-                    .LastTrueToFalse.Timestamp.Subseconds =
-                    Timestamp.Subseconds;
+        if ((RunLength >= LC_LADDER_MIN_RUNGS) &&
+            ((LC_BATCH_KEY_TYPE(BatchKey) == LC_EVAL_SIGNED) ||
+             (LC_BATCH_KEY_TYPE(BatchKey) == LC_EVAL_UNSIGNED))) {
+            for (Rung = 0; Rung < RunLength; Rung++) {
+                EvalList[RunStart + Rung].RungCount =
+                    (uint8)(RunLength - Rung);
             }
-        } else {
-            /*
-            ** WPEvalResult is STALE or ERROR
-            */
-            LC_OperData.WRTPtr[WatchIndex].CountdownToStale = 0;
         }
 
-    } /* end SizedDataValid if */
+        RunStart = EvalIndex;
+    }
 
     return;
 
-} /* end LC_ProcessWP */
+} /* End of LC_CreateLadders() */
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Perform a watchpoint relational comparison                      */
+/* LC_CompareRungs() - ladder order of two compiled WP's           */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-uint8 LC_OperatorCompare(uint16 WatchIndex, uint32 ProcessedWPData) {
-    uint8 EvalResult;
-    LC_MultiType_t WatchpointValue;
-    LC_MultiType_t ComparisonValue;
+int32 LC_CompareRungs(const LC_WatchEval_t *FirstPtr,
+                      const LC_WatchEval_t *SecondPtr) {
+    uint8 BatchKey = LC_GetBatchKey(FirstPtr);
+    int32 Order    = 0;
+
+    /* Records of other batch keys are never on one ladder */
+    if ((BatchKey != LC_GetBatchKey(SecondPtr)) ||
+        ((LC_BATCH_KEY_TYPE(BatchKey) != LC_EVAL_SIGNED) &&
+         (LC_BATCH_KEY_TYPE(BatchKey) != LC_EVAL_UNSIGNED))) {
+        Order = 0;
+    } else if (FirstPtr->WatchpointOffset != SecondPtr->WatchpointOffset) {
+        Order =
+            (FirstPtr->WatchpointOffset > SecondPtr->WatchpointOffset) ? 1
+                                                                       : -1;
+    } else if (FirstPtr->DataType != SecondPtr->DataType) {
+        Order = (FirstPtr->DataType > SecondPtr->DataType) ? 1 : -1;
+    } else if (FirstPtr->BitMask != SecondPtr->BitMask) {
+        Order = (FirstPtr->BitMask > SecondPtr->BitMask) ? 1 : -1;
+    } else if (LC_BATCH_KEY_TYPE(BatchKey) == LC_EVAL_SIGNED) {
+        Order = (int32)(FirstPtr->ComparisonValue.Signed32 >
+                        SecondPtr->ComparisonValue.Signed32) -
+                (int32)(FirstPtr->ComparisonValue.Signed32 <
+                        SecondPtr->ComparisonValue.Signed32);
+    } else {
+        Order = (int32)(FirstPtr->ComparisonValue.Unsigned32 >
+                        SecondPtr->ComparisonValue.Unsigned32) -
+                (int32)(FirstPtr->ComparisonValue.Unsigned32 <
+                        SecondPtr->ComparisonValue.Unsigned32);
+    }
 
-    /*
-     * The "ProcessedWPData" has been already normalized to be
-     * 32 bits wide and in the native CPU byte order.  For actual
-     * comparison, it needs to be truncated back down to the same
-     * size as the reference value.
-     */
-    switch (LC_OperData.WDTPtr[WatchIndex].DataType) {
-        case LC_DATA_UBYTE:
-        case LC_DATA_BYTE:
-            WatchpointValue.Unsigned8 = ProcessedWPData & 0xFF;
-            break;
+    return (Order);
 
-        case LC_DATA_WORD_BE:
-        case LC_DATA_WORD_LE:
-        case LC_DATA_UWORD_BE:
-        case LC_DATA_UWORD_LE:
-            WatchpointValue.Unsigned16 = ProcessedWPData & 0xFFFF;
-            break;
+} /* End of LC_CompareRungs() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* LC_CreateFlagBanks() - find single bit checks on one word       */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_CreateFlagBanks(LC_MessageList_t *MessageLink) {
+    LC_WatchEval_t *EvalList;
+    LC_WatchEval_t EvalRecord;
+    uint16 EvalIndex;
+    uint16 InsertIndex;
+    uint16 RunStart;
+    uint16 RunLength;
+    uint16 Flag;
+
+    EvalList = &LC_OperData.WatchEvals[MessageLink->EvalStart];
+
+    /*
+    ** Stable insertion sort that moves the flag checks of each
+    ** comparison type ahead of the other records and orders them by
+    ** word and then by bit
+    */
+    for (EvalIndex = 1; EvalIndex < MessageLink->EvalCount; EvalIndex++) {
+        EvalRecord  = EvalList[EvalIndex];
+        InsertIndex = EvalIndex;
+
+        while ((InsertIndex > 0) &&
+               (LC_CompareFlags(&EvalList[InsertIndex - 1], &EvalRecord) >
+                0)) {
+            EvalList[InsertIndex] = EvalList[InsertIndex - 1];
+            InsertIndex--;
+        }
+
+        EvalList[InsertIndex] = EvalRecord;
+    }
+
+    /*
+    ** Each run of flag checks on one word with a different bit each
+    ** becomes a bank if it is long enough. A second check of the same
+    ** bit starts a new run.
+    */
+    RunStart = 0;
+
+    for (EvalIndex = 1; EvalIndex <= MessageLink->EvalCount; EvalIndex++) {
+        if ((EvalIndex < MessageLink->EvalCount) &&
+            (LC_IsFlagCheck(&EvalList[RunStart]) == true) &&
+            (LC_IsFlagCheck(&EvalList[EvalIndex]) == true) &&
+            (EvalList[RunStart].WatchpointOffset ==
+             EvalList[EvalIndex].WatchpointOffset) &&
+            (EvalList[RunStart].DataType == EvalList[EvalIndex].DataType) &&
+            (EvalList[EvalIndex - 1].BitMask != EvalList[EvalIndex].BitMask)) {
+            continue;
+        }
+
+        RunLength = EvalIndex - RunStart;
+
+        if ((RunLength >= LC_FLAG_BANK_MIN_FLAGS) &&
+            (LC_IsFlagCheck(&EvalList[RunStart]) == true)) {
+            for (Flag = 0; Flag < RunLength; Flag++) {
+                EvalList[RunStart + Flag].FlagCount =
+                    (uint8)(RunLength - Flag);
+            }
+        }
+
+        RunStart = EvalIndex;
+    }
+
+    return;
+
+} /* End of LC_CreateFlagBanks() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* LC_CompareFlags() - flag bank order of two compiled WP's        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+int32 LC_CompareFlags(const LC_WatchEval_t *FirstPtr,
+                      const LC_WatchEval_t *SecondPtr) {
+    bool FirstIsFlag  = LC_IsFlagCheck(FirstPtr);
+    bool SecondIsFlag = LC_IsFlagCheck(SecondPtr);
+    int32 Order       = 0;
+
+    /* Records of other batch keys are never in one bank */
+    if (LC_GetBatchKey(FirstPtr) != LC_GetBatchKey(SecondPtr)) {
+        Order = 0;
+    } else if (FirstIsFlag != SecondIsFlag) {
+        Order = (FirstIsFlag == true) ? -1 : 1;
+    } else if (FirstIsFlag == false) {
+        Order = 0;
+    } else if (FirstPtr->WatchpointOffset != SecondPtr->WatchpointOffset) {
+        Order =
+            (FirstPtr->WatchpointOffset > SecondPtr->WatchpointOffset) ? 1
+                                                                       : -1;
+    } else if (FirstPtr->DataType != SecondPtr->DataType) {
+        Order = (FirstPtr->DataType > SecondPtr->DataType) ? 1 : -1;
+    } else {
+        Order = (int32)(FirstPtr->BitMask > SecondPtr->BitMask) -
+                (int32)(FirstPtr->BitMask < SecondPtr->BitMask);
+    }
+
+    return (Order);
+
+} /* End of LC_CompareFlags() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* LC_IsFlagCheck() - check if a compiled WP tests a single bit    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool LC_IsFlagCheck(const LC_WatchEval_t *EvalPtr) {
+    uint8 BatchKey = LC_GetBatchKey(EvalPtr);
+    uint32 CompareBits;
+    bool IsFlagCheck = false;
+
+    /*
+    ** An equal or not equal check of one bit within the data width,
+    ** against a comparison value that is either that bit or zero, is
+    ** true or false on that bit alone
+    */
+    if (((LC_BATCH_KEY_TYPE(BatchKey) == LC_EVAL_SIGNED) ||
+         (LC_BATCH_KEY_TYPE(BatchKey) == LC_EVAL_UNSIGNED)) &&
+        ((EvalPtr->OperatorID == LC_OPER_EQ) ||
+         (EvalPtr->OperatorID == LC_OPER_NE)) &&
+        (EvalPtr->BitMask != 0) &&
+        ((EvalPtr->BitMask & (EvalPtr->BitMask - 1)) == 0) &&
+        ((EvalPtr->BitMask & ~EvalPtr->WidthMask) == 0)) {
+        CompareBits = EvalPtr->ComparisonValue.Unsigned32 & EvalPtr->WidthMask;
+
+        IsFlagCheck = ((CompareBits == 0) || (CompareBits == EvalPtr->BitMask));
+    }
+
+    return (IsFlagCheck);
+
+} /* End of LC_IsFlagCheck() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* LC_SetFlagBank() - set the bank masks of one flag record        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_SetFlagBank(const LC_WatchEval_t *EvalPtr, uint16 EvalIndex) {
+    LC_FlagBank_t *BankPtr = &LC_OperData.FlagBanks[EvalIndex];
+    uint32 ExpectedBit;
+
+    /* The rest of the bank follows this record */
+    if (EvalPtr->FlagCount > 1) {
+        *BankPtr = LC_OperData.FlagBanks[EvalIndex + 1];
+    } else {
+        BankPtr->CareMask = 0;
+        BankPtr->Expected = 0;
+    }
+
+    /*
+    ** Equal is true when the bit matches the comparison value and
+    ** not equal when it matches the opposite value
+    */
+    ExpectedBit = EvalPtr->ComparisonValue.Unsigned32 & EvalPtr->BitMask;
+
+    if (EvalPtr->OperatorID == LC_OPER_NE) {
+        ExpectedBit ^= EvalPtr->BitMask;
+    }
+
+    BankPtr->CareMask |= EvalPtr->BitMask;
+    BankPtr->Expected |= ExpectedBit;
+
+    return;
+
+} /* End of LC_SetFlagBank() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* LC_ShareDatums() - find compiled WP's that read the same data   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint16 LC_ShareDatums(LC_MessageList_t *MessageLink) {
+    LC_WatchEval_t *EvalPtr;
+    LC_WatchEval_t *OwnerPtr;
+    uint16 EvalIndex;
+    uint16 OwnerIndex;
+    uint16 SharedCount = 0;
+
+    /*
+    ** The records of a MessageID are evaluated in order, so the first
+    ** record that reads a datum extracts it into its own slot and any
+    ** later record reading the same bytes takes it from there
+    */
+    for (EvalIndex = MessageLink->EvalStart;
+         EvalIndex < (MessageLink->EvalStart + MessageLink->EvalCount);
+         EvalIndex++) {
+        EvalPtr             = &LC_OperData.WatchEvals[EvalIndex];
+        EvalPtr->DatumIndex = EvalIndex;
+        EvalPtr->ReuseDatum = false;
+
+        /*
+        ** Undefined types are never extracted, arrays hold many data
+        ** and flag banks load their word without a bitmask
+        */
+        if ((EvalPtr->CompareType == LC_EVAL_UNDEFINED) ||
+            (EvalPtr->ElementCount > 0) || (EvalPtr->FlagCount > 0)) {
+            continue;
+        }
+
+        for (OwnerIndex = MessageLink->EvalStart; OwnerIndex < EvalIndex;
+             OwnerIndex++) {
+            OwnerPtr = &LC_OperData.WatchEvals[OwnerIndex];
+
+            if ((OwnerPtr->ReuseDatum == false) &&
+                (OwnerPtr->CompareType != LC_EVAL_UNDEFINED) &&
+                (OwnerPtr->ElementCount == 0) && (OwnerPtr->FlagCount == 0) &&
+                (LC_SameDatum(OwnerPtr, EvalPtr) == true)) {
+                EvalPtr->DatumIndex = OwnerIndex;
+                EvalPtr->ReuseDatum = true;
+                SharedCount++;
+                break;
+            }
+        }
+    }
+
+    return (SharedCount);
+
+} /* End of LC_ShareDatums() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* LC_SameDatum() - check if two compiled WP's read the same data  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool LC_SameDatum(const LC_WatchEval_t *FirstPtr,
+                  const LC_WatchEval_t *SecondPtr) {
+    return ((FirstPtr->WatchpointOffset == SecondPtr->WatchpointOffset) &&
+            (FirstPtr->DataType == SecondPtr->DataType) &&
+            (FirstPtr->BitMask == SecondPtr->BitMask));
+
+} /* End of LC_SameDatum() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* LC_GetBatchKey() - which batches a compiled WP can join         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint8 LC_GetBatchKey(const LC_WatchEval_t *EvalPtr) {
+    uint8 BatchKey;
+
+    /*
+    ** A batch shares one comparison type and one extraction kernel,
+    ** so its data can be gathered with one typed loop
+    */
+    BatchKey = (uint8)((EvalPtr->ExtractKind << 2) | EvalPtr->CompareType);
+
+    /*
+    ** Custom functions and invalid operators have no accept mask and
+    ** are always evaluated alone
+    */
+    if (EvalPtr->AcceptMask == 0) {
+        BatchKey = LC_EVAL_UNDEFINED;
+    }
+
+    /* Array watchpoints are already evaluated in batches */
+    if (EvalPtr->ElementCount > 0) {
+        BatchKey = LC_EVAL_UNDEFINED;
+    }
+
+    /* Ladder rungs are evaluated together by one search */
+    if (EvalPtr->RungCount > 0) {
+        BatchKey = LC_EVAL_UNDEFINED;
+    }
+
+    /* Flags are evaluated together from one word */
+    if (EvalPtr->FlagCount > 0) {
+        BatchKey = LC_EVAL_UNDEFINED;
+    }
+
+    return (BatchKey);
+
+} /* End of LC_GetBatchKey() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* LC_CreateFingerprint() - find the bytes a MessageID's WPs read  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_CreateFingerprint(LC_MessageList_t *MessageLink) {
+    const LC_WatchEval_t *EvalPtr;
+    LC_WatchSpan_t *Spans;
+    LC_WatchSpan_t NewSpan;
+    uint16 EvalCount;
+    uint16 SpanCount;
+    uint16 SpanIndex;
+    uint16 MergedCount;
+    uint32 SpanEnd;
+    uint32 FingerprintBytes;
+    uint32 FingerprintWords;
+
+    /* Ranges are gathered after those of the earlier MessageIDs */
+    Spans     = &LC_OperData.WatchSpans[LC_OperData.WatchSpanCount];
+    SpanCount = 0;
+
+    EvalPtr   = &LC_OperData.WatchEvals[MessageLink->EvalStart];
+    EvalCount = MessageLink->EvalCount;
+
+    while (EvalCount > 0) {
+        /*
+        ** A custom function may keep state between messages, so it
+        ** must see every one of them
+        */
+        if ((EvalPtr->OperatorID == LC_OPER_CUSTOM) ||
+            (EvalPtr->CompareType == LC_EVAL_UNDEFINED)) {
+            return;
+        }
+
+        NewSpan.Offset = EvalPtr->WatchpointOffset;
+        NewSpan.Length = EvalPtr->DataExtent;
+
+        /* Insert in offset order */
+        SpanIndex = SpanCount;
+
+        while ((SpanIndex > 0) &&
+               (Spans[SpanIndex - 1].Offset > NewSpan.Offset)) {
+            Spans[SpanIndex] = Spans[SpanIndex - 1];
+            SpanIndex--;
+        }
+
+        Spans[SpanIndex] = NewSpan;
+        SpanCount++;
+
+        EvalPtr++;
+        EvalCount--;
+    }
+
+    /*
+    ** Merge ranges that overlap, or are close enough that comparing
+    ** the bytes between them is cheaper than another compare
+    */
+    MergedCount      = 0;
+    FingerprintBytes = 0;
+
+    for (SpanIndex = 0; SpanIndex < SpanCount; SpanIndex++) {
+        if ((MergedCount > 0) &&
+            (Spans[SpanIndex].Offset <=
+             (Spans[MergedCount - 1].Offset + Spans[MergedCount - 1].Length +
+              LC_SPAN_MERGE_GAP))) {
+            SpanEnd = Spans[SpanIndex].Offset + Spans[SpanIndex].Length;
+
+            if (SpanEnd > (Spans[MergedCount - 1].Offset +
+                           Spans[MergedCount - 1].Length)) {
+                FingerprintBytes -= Spans[MergedCount - 1].Length;
+
+                Spans[MergedCount - 1].Length =
+                    SpanEnd - Spans[MergedCount - 1].Offset;
+
+                FingerprintBytes += Spans[MergedCount - 1].Length;
+            }
+        } else {
+            Spans[MergedCount] = Spans[SpanIndex];
+            FingerprintBytes += Spans[MergedCount].Length;
+            MergedCount++;
+        }
+    }
+
+    /* Keep the watched bytes for as long as there are words left */
+    FingerprintWords = (FingerprintBytes + 3) / 4;
+
+    if (FingerprintWords <=
+        (LC_FINGERPRINT_POOL_WORDS - LC_OperData.FingerprintWordsUsed)) {
+        MessageLink->SpanStart        = LC_OperData.WatchSpanCount;
+        MessageLink->SpanCount        = MergedCount;
+        MessageLink->FingerprintStart = LC_OperData.FingerprintWordsUsed;
+
+        LC_OperData.WatchSpanCount += MergedCount;
+        LC_OperData.FingerprintWordsUsed += FingerprintWords;
+    }
+
+    return;
+
+} /* End of LC_CreateFingerprint() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* LC_FindMessageLink() - find the hash table link for a MessageID */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+LC_MessageList_t *LC_FindMessageLink(CFE_SB_MsgId_t MessageID) {
+    LC_MessageList_t *MessageList;
+
+    /* One probe - the slot holds this MessageID or nothing does */
+    MessageList = LC_OperData.HashSlots[LC_GetHashSlotIndex(MessageID)];
+
+    if ((MessageList != (LC_MessageList_t *)NULL) &&
+        (MessageList->MessageID != MessageID)) {
+        MessageList = (LC_MessageList_t *)NULL;
+    }
+
+    return (MessageList);
+
+} /* End of LC_FindMessageLink() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* LC_CompileWatchpoint() - decode one WDT entry for evaluation    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+
+void LC_CompileWatchpoint(uint16 WatchIndex, LC_WatchEval_t *EvalPtr) {
+    LC_WDTEntry_t *WDTEntry = &LC_OperData.WDTPtr[WatchIndex];
+    uint32 CompareValue;
+
+    EvalPtr->WatchIndex         = WatchIndex;
+    EvalPtr->DataType           = WDTEntry->DataType;
+    EvalPtr->OperatorID         = WDTEntry->OperatorID;
+    EvalPtr->WatchpointOffset   = WDTEntry->WatchpointOffset;
+    EvalPtr->BitMask            = WDTEntry->BitMask;
+    EvalPtr->ResultAgeWhenStale = WDTEntry->ResultAgeWhenStale;
+    EvalPtr->SignBit            = 0;
+    EvalPtr->SwapMap.Unsigned32 = 0;
+    EvalPtr->ExtractFunc        = (LC_ExtractFunc_t)NULL;
+    EvalPtr->ExtractKind        = LC_EXTRACT_UINT8;
+
+    /*
+    ** Decode the size, byte order and signedness of the data type.
+    ** The byte maps are assigned as native integers so they come out
+    ** right on either host byte order (see LC_CopyBytesWithSwap).
+    */
+    switch (WDTEntry->DataType) {
+        case LC_DATA_BYTE:
+            EvalPtr->DataSize    = sizeof(int8);
+            EvalPtr->CompareType = LC_EVAL_SIGNED;
+            break;
+
+        case LC_DATA_UBYTE:
+            EvalPtr->DataSize    = sizeof(uint8);
+            EvalPtr->CompareType = LC_EVAL_UNSIGNED;
+            break;
+
+        case LC_DATA_WORD_BE:
+            EvalPtr->DataSize           = sizeof(int16);
+            EvalPtr->CompareType        = LC_EVAL_SIGNED;
+            EvalPtr->SwapMap.Unsigned16 = 0x0001;
+            break;
+
+        case LC_DATA_WORD_LE:
+            EvalPtr->DataSize           = sizeof(int16);
+            EvalPtr->CompareType        = LC_EVAL_SIGNED;
+            EvalPtr->SwapMap.Unsigned16 = 0x0100;
+            break;
+
+        case LC_DATA_UWORD_BE:
+            EvalPtr->DataSize           = sizeof(uint16);
+            EvalPtr->CompareType        = LC_EVAL_UNSIGNED;
+            EvalPtr->SwapMap.Unsigned16 = 0x0001;
+            break;
+
+        case LC_DATA_UWORD_LE:
+            EvalPtr->DataSize           = sizeof(uint16);
+            EvalPtr->CompareType        = LC_EVAL_UNSIGNED;
+            EvalPtr->SwapMap.Unsigned16 = 0x0100;
+            break;
+
+        case LC_DATA_DWORD_BE:
+            EvalPtr->DataSize           = sizeof(int32);
+            EvalPtr->CompareType        = LC_EVAL_SIGNED;
+            EvalPtr->SwapMap.Unsigned32 = 0x00010203;
+            break;
+
+        case LC_DATA_DWORD_LE:
+            EvalPtr->DataSize           = sizeof(int32);
+            EvalPtr->CompareType        = LC_EVAL_SIGNED;
+            EvalPtr->SwapMap.Unsigned32 = 0x03020100;
+            break;
 
-        case LC_DATA_DWORD_BE:
-        case LC_DATA_DWORD_LE:
         case LC_DATA_UDWORD_BE:
+            EvalPtr->DataSize           = sizeof(uint32);
+            EvalPtr->CompareType        = LC_EVAL_UNSIGNED;
+            EvalPtr->SwapMap.Unsigned32 = 0x00010203;
+            break;
+
         case LC_DATA_UDWORD_LE:
+            EvalPtr->DataSize           = sizeof(uint32);
+            EvalPtr->CompareType        = LC_EVAL_UNSIGNED;
+            EvalPtr->SwapMap.Unsigned32 = 0x03020100;
+            break;
+
         case LC_DATA_FLOAT_BE:
+            EvalPtr->DataSize           = sizeof(float);
+            EvalPtr->CompareType        = LC_EVAL_FLOAT;
+            EvalPtr->SwapMap.Unsigned32 = 0x00010203;
+            break;
+
         case LC_DATA_FLOAT_LE:
+            EvalPtr->DataSize           = sizeof(float);
+            EvalPtr->CompareType        = LC_EVAL_FLOAT;
+            EvalPtr->SwapMap.Unsigned32 = 0x03020100;
+            break;
+
+        default:
+            /*
+            ** Table validation rejects these, the record is kept so
+            ** the error is reported when the watchpoint is evaluated
+            */
+            EvalPtr->DataSize    = 0;
+            EvalPtr->CompareType = LC_EVAL_UNDEFINED;
+            break;
+    }
+
+    /*
+    ** Encode the relational operator as the set of three-way
+    ** comparison outcomes that make the watchpoint true
+    */
+    switch (WDTEntry->OperatorID) {
+        case LC_OPER_LT:
+            EvalPtr->AcceptMask = LC_ACCEPT_LT;
+            break;
+
+        case LC_OPER_LE:
+            EvalPtr->AcceptMask = LC_ACCEPT_LT | LC_ACCEPT_EQ;
+            break;
+
+        case LC_OPER_NE:
+            EvalPtr->AcceptMask = LC_ACCEPT_LT | LC_ACCEPT_GT | LC_ACCEPT_NEAR;
+            break;
+
+        case LC_OPER_EQ:
+            EvalPtr->AcceptMask = LC_ACCEPT_EQ | LC_ACCEPT_NEAR;
+            break;
+
+        case LC_OPER_GE:
+            EvalPtr->AcceptMask = LC_ACCEPT_EQ | LC_ACCEPT_GT;
+            break;
+
+        case LC_OPER_GT:
+            EvalPtr->AcceptMask = LC_ACCEPT_GT;
+            break;
+
         default:
-            WatchpointValue.Unsigned32 = ProcessedWPData;
+            /* Custom function, or reported as an invalid operator */
+            EvalPtr->AcceptMask = 0;
             break;
     }
-    ComparisonValue = LC_OperData.WDTPtr[WatchIndex].ComparisonValue;
 
     /*
-    ** Handle the comparison appropriately depending on the data type
-    ** Any endian difference was handled when the watchpoint
-    ** data was extracted from the SB message
+    ** Select the extraction kernel. A byte map that starts with byte
+    ** zero is the identity, so that datum is already in host order.
+    */
+    if (EvalPtr->CompareType == LC_EVAL_UNDEFINED) {
+        /* Never extracted, LC_WPOffsetValid reports it instead */
+    } else if (EvalPtr->DataSize == sizeof(uint8)) {
+        EvalPtr->ExtractFunc = LC_ExtractUint8;
+        EvalPtr->ExtractKind = LC_EXTRACT_UINT8;
+    } else if (EvalPtr->SwapMap.RawByte[0] == 0) {
+        EvalPtr->ExtractFunc = (EvalPtr->DataSize == sizeof(uint16))
+                                   ? LC_ExtractNative16
+                                   : LC_ExtractNative32;
+        EvalPtr->ExtractKind = (EvalPtr->DataSize == sizeof(uint16))
+                                   ? LC_EXTRACT_NATIVE16
+                                   : LC_EXTRACT_NATIVE32;
+    } else {
+        EvalPtr->ExtractKind = (EvalPtr->DataSize == sizeof(uint16))
+                                   ? LC_EXTRACT_SWAPPED16
+                                   : LC_EXTRACT_SWAPPED32;
+#ifdef LC_HAVE_BSWAP_BUILTINS
+        EvalPtr->ExtractFunc = (EvalPtr->DataSize == sizeof(uint16))
+                                   ? LC_ExtractSwapped16
+                                   : LC_ExtractSwapped32;
+#else
+        EvalPtr->ExtractFunc = (LC_ExtractFunc_t)NULL;
+#endif
+    }
+
+    /*
+    ** Truncate the comparison value to the datum width and widen it
+    ** back to 32 bits, sign extending it for signed types
+    */
+    if (EvalPtr->DataSize == sizeof(uint8)) {
+        EvalPtr->WidthMask = 0x000000FF;
+        CompareValue       = WDTEntry->ComparisonValue.Unsigned8;
+    } else if (EvalPtr->DataSize == sizeof(uint16)) {
+        EvalPtr->WidthMask = 0x0000FFFF;
+        CompareValue       = WDTEntry->ComparisonValue.Unsigned16;
+    } else {
+        EvalPtr->WidthMask = 0xFFFFFFFF;
+        CompareValue       = WDTEntry->ComparisonValue.Unsigned32;
+    }
+
+    if (EvalPtr->CompareType == LC_EVAL_SIGNED) {
+        EvalPtr->SignBit = (EvalPtr->WidthMask >> 1) + 1;
+    }
+
+    EvalPtr->ComparisonValue.Unsigned32 =
+        (CompareValue ^ EvalPtr->SignBit) - EvalPtr->SignBit;
+
+    /*
+    ** An array watchpoint covers ElementCount data of the same type,
+    ** ElementStride bytes apart, and reduces them to one result by
+    ** requiring a number of them to be true
+    */
+    EvalPtr->DataExtent         = EvalPtr->DataSize;
+    EvalPtr->ElementCount       = 0;
+    EvalPtr->ElementStride      = 0;
+    EvalPtr->RequiredCount      = 0;
+    EvalPtr->ElementResultStart = LC_NO_ELEMENT_RESULTS;
+
+    /* LC_ShareDatums assigns the datum slot once the record is placed */
+    EvalPtr->DatumIndex = 0;
+    EvalPtr->ReuseDatum = false;
+
+    /* The rungs and flags are picked once the records are grouped */
+    EvalPtr->RungCount = 0;
+    EvalPtr->FlagCount = 0;
+
+    if ((WDTEntry->AggregateType != LC_AGGR_NONE) &&
+        (WDTEntry->ElementCount > 0)) {
+        EvalPtr->ElementCount  = WDTEntry->ElementCount;
+        EvalPtr->ElementStride = WDTEntry->ElementStride;
+        EvalPtr->DataExtent += (uint32)(WDTEntry->ElementCount - 1) *
+                               WDTEntry->ElementStride;
+
+        switch (WDTEntry->AggregateType) {
+            case LC_AGGR_ALL:
+                EvalPtr->RequiredCount = WDTEntry->ElementCount;
+                break;
+
+            case LC_AGGR_COUNT:
+                EvalPtr->RequiredCount = WDTEntry->AggregateCount;
+                break;
+
+            default:
+                /* LC_AGGR_ANY, table validation rejects anything else */
+                EvalPtr->RequiredCount = 1;
+                break;
+        }
+    }
+
+    return;
+
+} /* End of LC_CompileWatchpoint() */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Handle a message with possible watchpoints                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_CheckMsgForWPs(CFE_SB_MsgId_t MessageID, CFE_SB_MsgPtr_t MessagePtr) {
+    CFE_TIME_SysTime_t Timestamp;
+    LC_MessageList_t *MessageList;
+    uint32 CopyLength;
+    bool WatchPtFound = false;
+
+    /* Do nothing if disabled at the application level */
+    if (LC_AppData.CurrentLCState != LC_STATE_DISABLED) {
+        /* Use message timestamp - if none, use current time */
+        Timestamp = CFE_SB_GetMsgTime(MessagePtr);
+
+        if ((Timestamp.Seconds == 0) && (Timestamp.Subseconds == 0)) {
+            Timestamp = CFE_TIME_GetTime();
+        }
+
+        /* Performance Log (start time counter) */
+        CFE_ES_PerfLogEntry(LC_WDT_SEARCH_PERF_ID);
+
+        MessageList = LC_FindMessageLink(MessageID);
+
+        /* Should be true - else wouldn't subscribe to MessageID */
+        if (MessageList != (LC_MessageList_t *)NULL) {
+            WatchPtFound = (MessageList->EvalCount > 0);
+
+            MessageList->MessageCount++;
+
+            if (MessageList->DecimationCountdown > 0) {
+                /*
+                ** A message passed over by the decimation still shows
+                ** that the watched data is current
+                */
+                MessageList->DecimationCountdown--;
+                MessageList->DecimatedCount++;
+
+                LC_RefreshWPAges(MessageList);
+            } else {
+                /* Pass over the next MessageDecimation - 1 messages */
+                if (MessageList->MessageDecimation > 1) {
+                    MessageList->DecimationCountdown =
+                        MessageList->MessageDecimation - 1;
+                }
+
+                if (MessageList->SnapshotSize != 0) {
+                    /*
+                    ** Only the latest message is evaluated, when the
+                    ** actionpoints are sampled, so just keep the bytes
+                    ** the watchpoints read
+                    */
+                    CopyLength = CFE_SB_GetTotalMsgLength(MessagePtr);
+
+                    if (CopyLength > MessageList->SnapshotSize) {
+                        CopyLength = MessageList->SnapshotSize;
+                    }
+
+                    CFE_PSP_MemCpy(
+                        &LC_OperData.SnapshotPool[MessageList->SnapshotStart],
+                        MessagePtr, CopyLength);
+
+                    MessageList->SnapshotTime    = Timestamp;
+                    MessageList->SnapshotPending = true;
+                } else {
+                    LC_EvaluateMessage(MessageList, MessagePtr, Timestamp);
+                }
+            }
+
+            /*
+            ** Results of a timed MessageID stay fresh for another
+            ** period. The deadline is checked against the LC clock, so
+            ** it runs from when the message is received, not from its
+            ** time stamp
+            */
+            if (MessageList->MessagePeriod != 0) {
+                MessageList->StaleTime = CFE_TIME_Add(
+                    CFE_TIME_GetTime(), MessageList->StaleAge);
+                MessageList->StaleTimed = true;
+            }
+        }
+
+        /* Performance Log (stop time counter) */
+        CFE_ES_PerfLogExit(LC_WDT_SEARCH_PERF_ID);
+
+        if (WatchPtFound == true) {
+            LC_AppData.MonitoredMsgCount++;
+        } else {
+            /* MessageID with no defined watchpoints */
+            CFE_EVS_SendEvent(
+                LC_MID_INF_EID, CFE_EVS_EventType_INFORMATION,
+                "Msg with unreferenced message ID rcvd: ID = 0x%04X",
+                MessageID);
+        }
+    }
+
+    return;
+
+} /* end LC_CheckMsgForWPs */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Evaluate the watchpoints of a MessageID                         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_EvaluateMessage(LC_MessageList_t *MessageList,
+                        CFE_SB_MsgPtr_t MessagePtr,
+                        CFE_TIME_SysTime_t Timestamp) {
+    const LC_WatchEval_t *EvalPtr;
+    uint16 EvalCount;
+    uint8 BatchCount;
+    uint16 MsgLength;
+    bool MsgIsShort;
+
+    /* Compiled WP's that reference MessageID are contiguous */
+    EvalPtr   = &LC_OperData.WatchEvals[MessageList->EvalStart];
+    EvalCount = MessageList->EvalCount;
+
+    /*
+    ** One length check covers every WP when the packet is long
+    ** enough for all of them, which is the normal case
+    */
+    MsgLength  = CFE_SB_GetTotalMsgLength(MessagePtr);
+    MsgIsShort = (MsgLength < MessageList->MaxExtent);
+
+    /*
+    ** Watched bytes that repeat those of the last message give the
+    ** same results, so only the statistics need updating
+    */
+    if (MessageList->SpanCount > 0) {
+        if (MsgIsShort == true) {
+            MessageList->FingerprintValid = false;
+        } else if ((LC_MatchFingerprint(MessageList, MessagePtr) == true) &&
+                   (LC_RepeatWPResults(MessageList) == true)) {
+            return;
+        }
+    }
+
+    /* No limit to how many WP's can reference one MessageID */
+    while (EvalCount > 0) {
+        if ((MsgIsShort == false) && (EvalPtr->RungCount > 0)) {
+            /* Ordered limits on one datum take one search */
+            BatchCount = EvalPtr->RungCount;
+
+            LC_ProcessWPLadder(EvalPtr, BatchCount, MessagePtr, Timestamp);
+        } else if ((MsgIsShort == false) && (EvalPtr->FlagCount > 0)) {
+            /* Single bit checks of one word take one load */
+            BatchCount = EvalPtr->FlagCount;
+
+            LC_ProcessWPFlagBank(EvalPtr, BatchCount, MessagePtr, Timestamp);
+        } else if ((MsgIsShort == false) && (EvalPtr->BatchCount > 1)) {
+            /* Same-type WP's are compared together */
+            BatchCount = EvalPtr->BatchCount;
+
+            LC_ProcessWPBatch(EvalPtr, BatchCount, MessagePtr, Timestamp);
+        } else {
+            BatchCount = 1;
+
+            /* Verify that WP packet offset is within actual packet */
+            if ((MsgIsShort == false) ||
+                (LC_WPOffsetValid(EvalPtr, MessagePtr, MsgLength) == true)) {
+                LC_ProcessWP(EvalPtr, MessagePtr, Timestamp);
+            }
+        }
+
+        EvalPtr += BatchCount;
+        EvalCount -= BatchCount;
+    }
+
+    return;
+
+} /* end LC_EvaluateMessage */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Match the watched bytes of a message with the last ones         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool LC_MatchFingerprint(LC_MessageList_t *MessageList,
+                         CFE_SB_MsgPtr_t MessagePtr) {
+    const LC_WatchSpan_t *SpanPtr;
+    const uint8 *MsgBytes;
+    uint8 *FingerprintPtr;
+    uint16 SpanCount;
+    bool Match;
+
+    SpanPtr   = &LC_OperData.WatchSpans[MessageList->SpanStart];
+    SpanCount = MessageList->SpanCount;
+    MsgBytes  = (const uint8 *)MessagePtr;
+
+    FingerprintPtr =
+        (uint8 *)&LC_OperData.FingerprintPool[MessageList->FingerprintStart];
+
+    Match = MessageList->FingerprintValid;
+
+    while (SpanCount > 0) {
+        /* Once one range differs the rest are only copied */
+        if ((Match == false) ||
+            (memcmp(FingerprintPtr, &MsgBytes[SpanPtr->Offset],
+                    SpanPtr->Length) != 0)) {
+            Match = false;
+
+            CFE_PSP_MemCpy(FingerprintPtr, &MsgBytes[SpanPtr->Offset],
+                           SpanPtr->Length);
+        }
+
+        FingerprintPtr += SpanPtr->Length;
+        SpanPtr++;
+        SpanCount--;
+    }
+
+    MessageList->FingerprintValid = true;
+
+    return (Match);
+
+} /* end LC_MatchFingerprint */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Repeat the watchpoint results of an unchanged message           */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool LC_RepeatWPResults(const LC_MessageList_t *MessageList) {
+    const LC_WatchEval_t *EvalPtr;
+    uint16 EvalCount;
+    uint16 WatchIndex;
+    uint8 WatchResult;
+
+    /*
+    ** A result that went stale since, or an error that has to be
+    ** reported again, needs a full evaluation
+    */
+    EvalPtr   = &LC_OperData.WatchEvals[MessageList->EvalStart];
+    EvalCount = MessageList->EvalCount;
+
+    while (EvalCount > 0) {
+        WatchResult = LC_OperData.WatchResults[EvalPtr->WatchIndex];
+
+        if ((WatchResult != LC_WATCH_TRUE) && (WatchResult != LC_WATCH_FALSE)) {
+            return (false);
+        }
+
+        EvalPtr++;
+        EvalCount--;
+    }
+
+    /*
+    ** Same statistics as LC_UpdateWPResult for a result that didn't
+    ** change, there can't be a transition
+    */
+    EvalPtr   = &LC_OperData.WatchEvals[MessageList->EvalStart];
+    EvalCount = MessageList->EvalCount;
+
+    while (EvalCount > 0) {
+        WatchIndex = EvalPtr->WatchIndex;
+
+        LC_OperData.WRTPtr[WatchIndex].EvaluationCount++;
+
+        if (LC_OperData.WatchResults[WatchIndex] == LC_WATCH_TRUE) {
+            LC_OperData.WRTPtr[WatchIndex].CumulativeTrueCount++;
+            LC_OperData.WRTPtr[WatchIndex].ConsecutiveTrueCount++;
+        } else {
+            LC_OperData.WRTPtr[WatchIndex].ConsecutiveTrueCount = 0;
+        }
+
+        LC_SetStaleCountdown(WatchIndex, EvalPtr->ResultAgeWhenStale);
+
+        EvalPtr++;
+        EvalCount--;
+    }
+
+    return (true);
+
+} /* end LC_RepeatWPResults */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Restart the stale countdowns of a MessageID's watch results     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_RefreshWPAges(const LC_MessageList_t *MessageList) {
+    const LC_WatchEval_t *EvalPtr;
+    uint16 EvalCount;
+    uint8 WatchResult;
+
+    EvalPtr   = &LC_OperData.WatchEvals[MessageList->EvalStart];
+    EvalCount = MessageList->EvalCount;
+
+    while (EvalCount > 0) {
+        WatchResult = LC_OperData.WatchResults[EvalPtr->WatchIndex];
+
+        /* Stale and error results have no countdown running */
+        if ((WatchResult == LC_WATCH_TRUE) || (WatchResult == LC_WATCH_FALSE)) {
+            LC_SetStaleCountdown(EvalPtr->WatchIndex,
+                                 EvalPtr->ResultAgeWhenStale);
+        }
+
+        EvalPtr++;
+        EvalCount--;
+    }
+
+    return;
+
+} /* end LC_RefreshWPAges */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Process a single watchpoint                                     */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_ProcessWP(const LC_WatchEval_t *EvalPtr, CFE_SB_MsgPtr_t MessagePtr,
+                  CFE_TIME_SysTime_t Timestamp) {
+    uint16 WatchIndex = EvalPtr->WatchIndex;
+    uint8 *WPDataPtr;
+    uint8 WPEvalResult;
+    uint32 MaskedWPData;
+
+    if (EvalPtr->ElementCount > 0) {
+        WPDataPtr = ((uint8 *)MessagePtr) + EvalPtr->WatchpointOffset;
+
+        /*
+        ** An array watchpoint saves the number of true elements
+        ** with a transition, in place of the data value
+        */
+        WPEvalResult = LC_ProcessWPArray(EvalPtr, WPDataPtr, &MaskedWPData);
+    } else {
+        /*
+        ** Get the data with the defined bitmask for this watchpoint
+        ** applied and then call the mission defined custom function
+        ** or do our own relational comparison.
+        */
+        MaskedWPData = LC_GetMaskedWPData(EvalPtr, MessagePtr);
+
+        if (EvalPtr->OperatorID == LC_OPER_CUSTOM) {
+            WPEvalResult = LC_CustomFunction(
+                WatchIndex, MaskedWPData, MessagePtr,
+                LC_OperData.WDTPtr[WatchIndex].CustomFuncArgument);
+        } else {
+            WPEvalResult = LC_OperatorCompare(EvalPtr, MaskedWPData);
+        }
+    }
+
+    LC_UpdateWPResult(EvalPtr, WPEvalResult, MaskedWPData, Timestamp);
+
+    return;
+
+} /* end LC_ProcessWP */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Get the masked data of a watchpoint                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 LC_GetMaskedWPData(const LC_WatchEval_t *EvalPtr,
+                          CFE_SB_MsgPtr_t MessagePtr) {
+    uint8 *WPDataPtr;
+    uint32 MaskedWPData;
+
+    if (EvalPtr->ReuseDatum == true) {
+        MaskedWPData = LC_OperData.DatumValues[EvalPtr->DatumIndex];
+    } else {
+        WPDataPtr = ((uint8 *)MessagePtr) + EvalPtr->WatchpointOffset;
+
+        MaskedWPData =
+            LC_GetSizedWPData(EvalPtr, WPDataPtr) & EvalPtr->BitMask;
+
+        LC_OperData.DatumValues[EvalPtr->DatumIndex] = MaskedWPData;
+    }
+
+    return (MaskedWPData);
+
+} /* end LC_GetMaskedWPData */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Process a batch of same-type watchpoints                        */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_ProcessWPBatch(const LC_WatchEval_t *EvalPtr, uint8 BatchCount,
+                       CFE_SB_MsgPtr_t MessagePtr,
+                       CFE_TIME_SysTime_t Timestamp) {
+    LC_MultiType_t WPValues[LC_BATCH_LANES];
+    LC_MultiType_t CompareValues[LC_BATCH_LANES];
+    uint32 Offsets[LC_BATCH_LANES];
+    uint32 RawData[LC_BATCH_LANES];
+    uint32 MaskedWPData[LC_BATCH_LANES];
+    uint8 AcceptMasks[LC_BATCH_LANES];
+    uint8 WPEvalResults[LC_BATCH_LANES];
+    const LC_WatchEval_t *LanePtr;
+    uint32 Lane;
+
+    /*
+    ** Every record in a batch has the same extraction kernel, so the
+    ** data is gathered by one typed loop. A record that reuses a datum
+    ** reads the same bytes again, which is cheaper than taking it out
+    ** of the loop, and stores the same value.
+    */
+    for (Lane = 0; Lane < BatchCount; Lane++) {
+        Offsets[Lane] = EvalPtr[Lane].WatchpointOffset;
+    }
+
+    LC_GatherWPData(EvalPtr, (const uint8 *)MessagePtr, Offsets, RawData,
+                    BatchCount);
+
+    /*
+    ** Normalize the data into lanes the same way as for
+    ** LC_OperatorCompare
+    */
+    for (Lane = 0; Lane < BatchCount; Lane++) {
+        LanePtr = &EvalPtr[Lane];
+
+        MaskedWPData[Lane] =
+            ((RawData[Lane] ^ LanePtr->SignBit) - LanePtr->SignBit) &
+            LanePtr->BitMask;
+
+        LC_OperData.DatumValues[LanePtr->DatumIndex] = MaskedWPData[Lane];
+
+        WPValues[Lane].Unsigned32 =
+            ((MaskedWPData[Lane] & LanePtr->WidthMask) ^ LanePtr->SignBit) -
+            LanePtr->SignBit;
+
+        CompareValues[Lane] = LanePtr->ComparisonValue;
+        AcceptMasks[Lane]   = LanePtr->AcceptMask;
+    }
+
+    /*
+    ** Every record in a batch has the same comparison type
+    */
+    switch (EvalPtr->CompareType) {
+        case LC_EVAL_SIGNED:
+            LC_SignedCompareBatch(WPValues, CompareValues, AcceptMasks,
+                                  WPEvalResults, BatchCount);
+            break;
+
+        case LC_EVAL_UNSIGNED:
+            LC_UnsignedCompareBatch(WPValues, CompareValues, AcceptMasks,
+                                    WPEvalResults, BatchCount);
+            break;
+
+        default:
+            LC_FloatCompareBatch(WPValues, CompareValues, AcceptMasks,
+                                 WPEvalResults, BatchCount);
+            break;
+    }
+
+    /*
+    ** Scatter the results back to the watchpoint results table
+    */
+    for (Lane = 0; Lane < BatchCount; Lane++) {
+        if (WPEvalResults[Lane] == LC_WATCH_ERROR) {
+            /* Compare this one again alone so the error is reported */
+            WPEvalResults[Lane] =
+                LC_OperatorCompare(&EvalPtr[Lane], MaskedWPData[Lane]);
+        }
+
+        LC_UpdateWPResult(&EvalPtr[Lane], WPEvalResults[Lane],
+                          MaskedWPData[Lane], Timestamp);
+    }
+
+    return;
+
+} /* end LC_ProcessWPBatch */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Process the watchpoints of a threshold ladder                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_ProcessWPLadder(const LC_WatchEval_t *EvalPtr, uint8 RungCount,
+                        CFE_SB_MsgPtr_t MessagePtr,
+                        CFE_TIME_SysTime_t Timestamp) {
+    const LC_MultiType_t *Thresholds;
+    LC_MultiType_t WPValue;
+    uint32 MaskedWPData;
+    uint32 CompareClass;
+    uint8 WPEvalResult;
+    uint8 LowerBound;
+    uint8 UpperBound;
+    uint8 Rung;
+
+    Thresholds =
+        &LC_OperData.LadderThresholds[EvalPtr - LC_OperData.WatchEvals];
+
+    /*
+    ** Every rung reads the same datum, so it is extracted and
+    ** normalized once
+    */
+    MaskedWPData = LC_GetMaskedWPData(EvalPtr, MessagePtr);
+
+    WPValue.Unsigned32 =
+        ((MaskedWPData & EvalPtr->WidthMask) ^ EvalPtr->SignBit) -
+        EvalPtr->SignBit;
+
+    /*
+    ** The rungs below LowerBound have a comparison value less than the
+    ** datum and those from UpperBound on have a greater one. Any rungs
+    ** in between are equal to the datum.
+    */
+    LowerBound = LC_GetLadderBound(Thresholds, RungCount,
+                                   EvalPtr->CompareType, WPValue, false);
+    UpperBound = LC_GetLadderBound(Thresholds, RungCount,
+                                   EvalPtr->CompareType, WPValue, true);
+
+    for (Rung = 0; Rung < RungCount; Rung++) {
+        if (Rung < LowerBound) {
+            CompareClass = LC_ACCEPT_GT;
+        } else if (Rung < UpperBound) {
+            CompareClass = LC_ACCEPT_EQ;
+        } else {
+            CompareClass = LC_ACCEPT_LT;
+        }
+
+        WPEvalResult =
+            (uint8)((CompareClass & EvalPtr[Rung].AcceptMask) != 0);
+
+        LC_UpdateWPResult(&EvalPtr[Rung], WPEvalResult, MaskedWPData,
+                          Timestamp);
+    }
+
+    return;
+
+} /* end LC_ProcessWPLadder */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Binary search of the comparison values of a threshold ladder    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint8 LC_GetLadderBound(const LC_MultiType_t *Thresholds, uint8 RungCount,
+                        uint8 CompareType, LC_MultiType_t WPValue,
+                        bool IncludeEqual) {
+    uint8 Low  = 0;
+    uint8 High = RungCount;
+    uint8 Middle;
+    bool IsBelow;
+
+    while (Low < High) {
+        Middle = Low + ((High - Low) / 2);
+
+        if (CompareType == LC_EVAL_SIGNED) {
+            IsBelow =
+                (Thresholds[Middle].Signed32 < WPValue.Signed32) ||
+                (IncludeEqual &&
+                 (Thresholds[Middle].Signed32 == WPValue.Signed32));
+        } else {
+            IsBelow =
+                (Thresholds[Middle].Unsigned32 < WPValue.Unsigned32) ||
+                (IncludeEqual &&
+                 (Thresholds[Middle].Unsigned32 == WPValue.Unsigned32));
+        }
+
+        if (IsBelow) {
+            Low = Middle + 1;
+        } else {
+            High = Middle;
+        }
+    }
+
+    return (Low);
+
+} /* end LC_GetLadderBound */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Process the watchpoints of a flag bank                          */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_ProcessWPFlagBank(const LC_WatchEval_t *EvalPtr, uint8 FlagCount,
+                          CFE_SB_MsgPtr_t MessagePtr,
+                          CFE_TIME_SysTime_t Timestamp) {
+    const LC_FlagBank_t *BankPtr;
+    uint8 *WPDataPtr;
+    uint32 StatusWord;
+    uint32 TrueFlags;
+    uint8 WPEvalResult;
+    uint8 Flag;
+
+    BankPtr = &LC_OperData.FlagBanks[EvalPtr - LC_OperData.WatchEvals];
+
+    /*
+    ** Load the word once and find every true flag at the same time,
+    ** a flag is true when its bit has the expected value
+    */
+    WPDataPtr  = ((uint8 *)MessagePtr) + EvalPtr->WatchpointOffset;
+    StatusWord = LC_GetSizedWPData(EvalPtr, WPDataPtr);
+
+    TrueFlags = ~(StatusWord ^ BankPtr->Expected) & BankPtr->CareMask;
+
+    for (Flag = 0; Flag < FlagCount; Flag++) {
+        WPEvalResult = (uint8)((TrueFlags & EvalPtr[Flag].BitMask) != 0);
+
+        LC_UpdateWPResult(&EvalPtr[Flag], WPEvalResult,
+                          StatusWord & EvalPtr[Flag].BitMask, Timestamp);
+    }
+
+    return;
+
+} /* end LC_ProcessWPFlagBank */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Evaluate the elements of an array watchpoint                    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint8 LC_ProcessWPArray(const LC_WatchEval_t *EvalPtr, const uint8 *WPDataPtr,
+                        uint32 *TrueCountPtr) {
+    LC_MultiType_t WPValues[LC_BATCH_LANES];
+    LC_MultiType_t CompareValues[LC_BATCH_LANES];
+    uint32 Offsets[LC_BATCH_LANES];
+    uint32 RawData[LC_BATCH_LANES];
+    uint32 MaskedWPData[LC_BATCH_LANES];
+    uint8 AcceptMasks[LC_BATCH_LANES];
+    uint8 WPEvalResults[LC_BATCH_LANES];
+    uint32 *ElementResults = (uint32 *)NULL;
+    uint32 ElementIndex;
+    uint32 LaneCount;
+    uint32 Lane;
+    uint32 TrueCount = 0;
+    uint8 EvalResult;
+
+    *TrueCountPtr = 0;
+
+    if (EvalPtr->AcceptMask == 0) {
+        return (LC_OperatorIDError(EvalPtr));
+    }
+
+    if (EvalPtr->ElementResultStart != LC_NO_ELEMENT_RESULTS) {
+        ElementResults =
+            &LC_OperData.ElementResults[EvalPtr->ElementResultStart];
+
+        CFE_PSP_MemSet(ElementResults, 0,
+                       ((EvalPtr->ElementCount + 31) / 32) * sizeof(uint32));
+    }
+
+    /* Every element has the same comparison value and operator */
+    for (Lane = 0; Lane < LC_BATCH_LANES; Lane++) {
+        CompareValues[Lane] = EvalPtr->ComparisonValue;
+        AcceptMasks[Lane]   = EvalPtr->AcceptMask;
+    }
+
+    /*
+    ** Scan the array one batch of lanes at a time
     */
-    switch (LC_OperData.WDTPtr[WatchIndex].DataType) {
-        /*
-        ** Signed integer types will get sign extended
-        */
-        case LC_DATA_BYTE:
-            EvalResult = LC_SignedCompare(WatchIndex, WatchpointValue.Signed8,
-                                          ComparisonValue.Signed8);
-            break;
+    for (ElementIndex = 0; ElementIndex < EvalPtr->ElementCount;
+         ElementIndex += LaneCount) {
+        LaneCount = EvalPtr->ElementCount - ElementIndex;
 
-        case LC_DATA_WORD_BE:
-        case LC_DATA_WORD_LE:
-            EvalResult = LC_SignedCompare(WatchIndex, WatchpointValue.Signed16,
-                                          ComparisonValue.Signed16);
-            break;
+        if (LaneCount > LC_BATCH_LANES) {
+            LaneCount = LC_BATCH_LANES;
+        }
 
-        case LC_DATA_DWORD_BE:
-        case LC_DATA_DWORD_LE:
-            EvalResult = LC_SignedCompare(WatchIndex, WatchpointValue.Signed32,
-                                          ComparisonValue.Signed32);
-            break;
+        for (Lane = 0; Lane < LaneCount; Lane++) {
+            Offsets[Lane] = (ElementIndex + Lane) * EvalPtr->ElementStride;
+        }
 
-        /*
-        ** Unsigned integer types will get zero extended
-        */
-        case LC_DATA_UBYTE:
-            EvalResult =
-                LC_UnsignedCompare(WatchIndex, WatchpointValue.Unsigned8,
-                                   ComparisonValue.Unsigned8);
-            break;
+        LC_GatherWPData(EvalPtr, WPDataPtr, Offsets, RawData, LaneCount);
 
-        case LC_DATA_UWORD_BE:
-        case LC_DATA_UWORD_LE:
-            EvalResult =
-                LC_UnsignedCompare(WatchIndex, WatchpointValue.Unsigned16,
-                                   ComparisonValue.Unsigned16);
-            break;
+        for (Lane = 0; Lane < LaneCount; Lane++) {
+            MaskedWPData[Lane] =
+                ((RawData[Lane] ^ EvalPtr->SignBit) - EvalPtr->SignBit) &
+                EvalPtr->BitMask;
 
-        case LC_DATA_UDWORD_BE:
-        case LC_DATA_UDWORD_LE:
-            EvalResult =
-                LC_UnsignedCompare(WatchIndex, WatchpointValue.Unsigned32,
-                                   ComparisonValue.Unsigned32);
-            break;
+            WPValues[Lane].Unsigned32 =
+                ((MaskedWPData[Lane] & EvalPtr->WidthMask) ^
+                 EvalPtr->SignBit) -
+                EvalPtr->SignBit;
+        }
 
-        /*
-        ** Floating point values are handled separately
-        */
-        case LC_DATA_FLOAT_BE:
-        case LC_DATA_FLOAT_LE:
-            EvalResult =
-                LC_FloatCompare(WatchIndex, WatchpointValue, ComparisonValue);
-            break;
+        switch (EvalPtr->CompareType) {
+            case LC_EVAL_SIGNED:
+                LC_SignedCompareBatch(WPValues, CompareValues, AcceptMasks,
+                                      WPEvalResults, LaneCount);
+                break;
 
-        default:
-            /*
-            ** This should have been caught before now, but we'll
-            ** handle it just in case we ever get here.
-            */
-            CFE_EVS_SendEvent(
-                LC_WP_DATATYPE_ERR_EID, CFE_EVS_EventType_ERROR,
-                "WP has undefined data type: WP = %d, DataType = %d",
-                WatchIndex, LC_OperData.WDTPtr[WatchIndex].DataType);
+            case LC_EVAL_UNSIGNED:
+                LC_UnsignedCompareBatch(WPValues, CompareValues, AcceptMasks,
+                                        WPEvalResults, LaneCount);
+                break;
 
-            EvalResult = LC_WATCH_ERROR;
-            break;
+            default:
+                LC_FloatCompareBatch(WPValues, CompareValues, AcceptMasks,
+                                     WPEvalResults, LaneCount);
+                break;
+        }
+
+        for (Lane = 0; Lane < LaneCount; Lane++) {
+            if (WPEvalResults[Lane] == LC_WATCH_ERROR) {
+                /*
+                ** One bad element makes the whole watchpoint an error,
+                ** compare it again alone so the error is reported
+                */
+                *TrueCountPtr = TrueCount;
+
+                return (LC_OperatorCompare(EvalPtr, MaskedWPData[Lane]));
+            }
+
+            TrueCount += WPEvalResults[Lane];
+
+            if (ElementResults != (uint32 *)NULL) {
+                ElementResults[(ElementIndex + Lane) / 32] |=
+                    (uint32)WPEvalResults[Lane] << ((ElementIndex + Lane) % 32);
+            }
+        }
     }
 
+    *TrueCountPtr = TrueCount;
+
+    EvalResult = (uint8)(TrueCount >= EvalPtr->RequiredCount);
+
     return (EvalResult);
 
-} /* end LC_OperatorCompare */
+} /* end LC_ProcessWPArray */
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Perform a watchpoint signed integer comparison                  */
+/* Update the results table entry of a watchpoint                  */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-uint8 LC_SignedCompare(uint16 WatchIndex, int32 WPValue, int32 CompareValue) {
-    uint8 EvalResult;
-    uint8 OperatorID;
+void LC_UpdateWPResult(const LC_WatchEval_t *EvalPtr, uint8 WPEvalResult,
+                       uint32 MaskedWPData, CFE_TIME_SysTime_t Timestamp) {
+    uint16 WatchIndex = EvalPtr->WatchIndex;
+    uint8 PreviousResult;
 
-    OperatorID = LC_OperData.WDTPtr[WatchIndex].OperatorID;
+    /*
+    ** Get the last evalution result for this watchpoint
+    */
+    PreviousResult = LC_OperData.WatchResults[WatchIndex];
 
-    switch (OperatorID) {
-        case LC_OPER_LE:
-            EvalResult =
-                (WPValue <= CompareValue) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
-            break;
+    /*
+    ** Update the watch result
+    */
+    LC_OperData.WatchResults[WatchIndex] = WPEvalResult;
 
-        case LC_OPER_LT:
-            EvalResult =
-                (WPValue < CompareValue) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
-            break;
+    if (WPEvalResult != PreviousResult) {
+        LC_MarkAPsDirty(WatchIndex);
+    }
 
-        case LC_OPER_EQ:
-            EvalResult =
-                (WPValue == CompareValue) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
-            break;
+    /*
+    ** Update the watchpoint statistics based on the evaluation
+    ** result
+    */
+    LC_OperData.WRTPtr[WatchIndex].EvaluationCount++;
 
-        case LC_OPER_NE:
-            EvalResult =
-                (WPValue != CompareValue) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
-            break;
+    if (WPEvalResult == LC_WATCH_TRUE) {
+        LC_OperData.WRTPtr[WatchIndex].CumulativeTrueCount++;
+        LC_OperData.WRTPtr[WatchIndex].ConsecutiveTrueCount++;
+        LC_SetStaleCountdown(WatchIndex, EvalPtr->ResultAgeWhenStale);
 
-        case LC_OPER_GT:
-            EvalResult =
-                (WPValue > CompareValue) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
-            break;
+        if ((PreviousResult == LC_WATCH_FALSE) ||
+            (PreviousResult == LC_WATCH_STALE)) {
+            LC_OperData.WRTPtr[WatchIndex].LastFalseToTrue.DataType =
+                EvalPtr->DataType;
 
-        case LC_OPER_GE:
-            EvalResult =
-                (WPValue >= CompareValue) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
-            break;
+            LC_OperData.WRTPtr[WatchIndex].FalseToTrueCount++;
 
-        default:
-            /*
-            ** This should have been caught before now, but we'll
-            ** handle it just in case we ever get here.
-            */
-            CFE_EVS_SendEvent(
-                LC_WP_OPERID_ERR_EID, CFE_EVS_EventType_ERROR,
-                "WP has invalid operator ID: WP = %d, OperID = %d", WatchIndex,
-                OperatorID);
+            LC_OperData.WRTPtr[WatchIndex].LastFalseToTrue.Value = MaskedWPData;
 
-            EvalResult = LC_WATCH_ERROR;
-            break;
+            LC_OperData.WRTPtr[WatchIndex].LastFalseToTrue.Timestamp.Seconds =
+                Timestamp.Seconds;
+
+            LC_OperData.WRTPtr[WatchIndex]
+                .LastFalseToTrue.Timestamp.Subseconds = Timestamp.Subseconds;
+        }
+    } else if (WPEvalResult == LC_WATCH_FALSE) {
+        LC_OperData.WRTPtr[WatchIndex].ConsecutiveTrueCount = 0;
+        LC_SetStaleCountdown(WatchIndex, EvalPtr->ResultAgeWhenStale);
+
+        if ((PreviousResult == LC_WATCH_TRUE) ||
+            (PreviousResult == LC_WATCH_STALE)) {
+            LC_OperData.WRTPtr[WatchIndex].LastTrueToFalse.DataType =
+                EvalPtr->DataType;
+
+            LC_OperData.WRTPtr[WatchIndex].LastTrueToFalse.Value = MaskedWPData;
+
+            LC_OperData.WRTPtr[WatchIndex].LastTrueToFalse.Timestamp.Seconds =
+                Timestamp.Seconds;
+
+            LC_OperData.WRTPtr[WatchIndex]
+                .LastTrueToFalse.Timestamp.Subseconds = Timestamp.Subseconds;
+        }
+    } else {
+        /*
+        ** WPEvalResult is STALE or ERROR
+        */
+        LC_SetStaleCountdown(WatchIndex, 0);
     }
 
-    return (EvalResult);
+    return;
 
-} /* end LC_SignedCompare */
+} /* end LC_UpdateWPResult */
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
-/* Perform a watchpoint unsigned integer comparison                */
+/* Copy the working watch results to the WRT image                 */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-uint8 LC_UnsignedCompare(uint16 WatchIndex, uint32 WPValue,
-                         uint32 CompareValue) {
-    uint8 EvalResult;
-    uint8 OperatorID;
+void LC_SyncWRT(void) {
+    uint32 WatchIndex;
+
+    for (WatchIndex = 0; WatchIndex < LC_MAX_WATCHPOINTS; WatchIndex++) {
+        LC_OperData.WRTPtr[WatchIndex].WatchResult =
+            LC_OperData.WatchResults[WatchIndex];
+        LC_OperData.WRTPtr[WatchIndex].CountdownToStale =
+            LC_GetStaleCountdown(WatchIndex);
+    }
 
-    OperatorID = LC_OperData.WDTPtr[WatchIndex].OperatorID;
+    return;
 
-    switch (OperatorID) {
-        case LC_OPER_LE:
-            EvalResult =
-                (WPValue <= CompareValue) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
-            break;
+} /* end LC_SyncWRT */
 
-        case LC_OPER_LT:
-            EvalResult =
-                (WPValue < CompareValue) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
-            break;
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Copy the WRT image watch results to the working copy            */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_LoadWatchResults(void) {
+    uint32 WatchIndex;
+
+    for (WatchIndex = 0; WatchIndex < LC_MAX_WATCHPOINTS; WatchIndex++) {
+        LC_OperData.WatchResults[WatchIndex] =
+            LC_OperData.WRTPtr[WatchIndex].WatchResult;
+        LC_SetStaleCountdown(WatchIndex,
+                             LC_OperData.WRTPtr[WatchIndex].CountdownToStale);
+    }
 
-        case LC_OPER_EQ:
-            EvalResult =
-                (WPValue == CompareValue) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
-            break;
+    return;
 
-        case LC_OPER_NE:
+} /* end LC_LoadWatchResults */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Perform a watchpoint relational comparison                      */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint8 LC_OperatorCompare(const LC_WatchEval_t *EvalPtr,
+                         uint32 ProcessedWPData) {
+    uint8 EvalResult;
+    LC_MultiType_t WatchpointValue;
+
+    /*
+     * The "ProcessedWPData" has been already normalized to be
+     * 32 bits wide and in the native CPU byte order.  For actual
+     * comparison, it is truncated back down to the width of the
+     * datum and widened again the same way the comparison value
+     * was when the watchpoint was compiled.
+     */
+    WatchpointValue.Unsigned32 =
+        ((ProcessedWPData & EvalPtr->WidthMask) ^ EvalPtr->SignBit) -
+        EvalPtr->SignBit;
+
+    /*
+    ** Handle the comparison appropriately depending on the data type
+    ** Any endian difference was handled when the watchpoint
+    ** data was extracted from the SB message
+    */
+    switch (EvalPtr->CompareType) {
+        case LC_EVAL_SIGNED:
             EvalResult =
-                (WPValue != CompareValue) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
+                LC_SignedCompare(EvalPtr, WatchpointValue.Signed32,
+                                 EvalPtr->ComparisonValue.Signed32);
             break;
 
-        case LC_OPER_GT:
+        case LC_EVAL_UNSIGNED:
             EvalResult =
-                (WPValue > CompareValue) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
+                LC_UnsignedCompare(EvalPtr, WatchpointValue.Unsigned32,
+                                   EvalPtr->ComparisonValue.Unsigned32);
             break;
 
-        case LC_OPER_GE:
-            EvalResult =
-                (WPValue >= CompareValue) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
+        /*
+        ** Floating point values are handled separately
+        */
+        case LC_EVAL_FLOAT:
+            EvalResult = LC_FloatCompare(EvalPtr, WatchpointValue,
+                                         EvalPtr->ComparisonValue);
             break;
 
         default:
@@ -642,9 +2324,9 @@ uint8 LC_UnsignedCompare(uint16 WatchIndex, uint32 WPValue,
             ** handle it just in case we ever get here.
             */
             CFE_EVS_SendEvent(
-                LC_WP_OPERID_ERR_EID, CFE_EVS_EventType_ERROR,
-                "WP has invalid operator ID: WP = %d, OperID = %d", WatchIndex,
-                OperatorID);
+                LC_WP_DATATYPE_ERR_EID, CFE_EVS_EventType_ERROR,
+                "WP has undefined data type: WP = %d, DataType = %d",
+                EvalPtr->WatchIndex, EvalPtr->DataType);
 
             EvalResult = LC_WATCH_ERROR;
             break;
@@ -652,6 +2334,53 @@ uint8 LC_UnsignedCompare(uint16 WatchIndex, uint32 WPValue,
 
     return (EvalResult);
 
+} /* end LC_OperatorCompare */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Perform a watchpoint signed integer comparison                  */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint8 LC_SignedCompare(const LC_WatchEval_t *EvalPtr, int32 WPValue,
+                       int32 CompareValue) {
+    uint32 CompareClass;
+
+    if (EvalPtr->AcceptMask == 0) {
+        return (LC_OperatorIDError(EvalPtr));
+    }
+
+    /*
+    ** One three-way comparison, then test the class bit against the
+    ** operator accept mask. LC_WATCH_FALSE and LC_WATCH_TRUE are
+    ** defined as 0 and 1 so the test result is the watch result.
+    */
+    CompareClass = (uint32)(WPValue < CompareValue) |
+                   ((uint32)(WPValue == CompareValue) << 1) |
+                   ((uint32)(WPValue > CompareValue) << 2);
+
+    return ((uint8)((CompareClass & EvalPtr->AcceptMask) != 0));
+
+} /* end LC_SignedCompare */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Perform a watchpoint unsigned integer comparison                */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint8 LC_UnsignedCompare(const LC_WatchEval_t *EvalPtr, uint32 WPValue,
+                         uint32 CompareValue) {
+    uint32 CompareClass;
+
+    if (EvalPtr->AcceptMask == 0) {
+        return (LC_OperatorIDError(EvalPtr));
+    }
+
+    CompareClass = (uint32)(WPValue < CompareValue) |
+                   ((uint32)(WPValue == CompareValue) << 1) |
+                   ((uint32)(WPValue > CompareValue) << 2);
+
+    return ((uint8)((CompareClass & EvalPtr->AcceptMask) != 0));
+
 } /* end LC_UnsignedCompare */
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
@@ -659,16 +2388,16 @@ uint8 LC_UnsignedCompare(uint16 WatchIndex, uint32 WPValue,
 /* Perform a floating point number comparison                      */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-uint8 LC_FloatCompare(uint16 WatchIndex, LC_MultiType_t WPMultiType,
+uint8 LC_FloatCompare(const LC_WatchEval_t *EvalPtr,
+                      LC_MultiType_t WPMultiType,
                       LC_MultiType_t CompareMultiType) {
     uint8 EvalResult;
-    uint8 OperatorID;
+    uint32 CompareClass;
+    uint32 NearMask;
     float WPFloat;
     float CompareFloat;
     float Diff;
 
-    OperatorID = LC_OperData.WDTPtr[WatchIndex].OperatorID;
-
     /*
     ** Before we do any comparison, check the watchpoint value for
     ** a floating point NAN (not-a-number). NAN comparisons don't
@@ -682,74 +2411,485 @@ uint8 LC_FloatCompare(uint16 WatchIndex, LC_MultiType_t WPMultiType,
     ** during table validation.
     */
     if (LC_Uint32IsNAN(WPMultiType.Unsigned32) == false) {
+        if (EvalPtr->AcceptMask == 0) {
+            return (LC_OperatorIDError(EvalPtr));
+        }
+
         WPFloat      = WPMultiType.Float32;
         CompareFloat = CompareMultiType.Float32;
 
-        switch (OperatorID) {
-            case LC_OPER_LE:
-                EvalResult =
-                    (WPFloat <= CompareFloat) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
-                break;
+        CompareClass = (uint32)(WPFloat < CompareFloat) |
+                       ((uint32)(WPFloat == CompareFloat) << 1) |
+                       ((uint32)(WPFloat > CompareFloat) << 2);
+
+        /*
+        ** EQ and NE treat values within the tolerance as equal, the
+        ** other operators compare exactly
+        */
+        Diff = (WPFloat > CompareFloat) ? (WPFloat - CompareFloat)
+                                        : (CompareFloat - WPFloat);
+
+        NearMask = 0 - ((uint32)(Diff <= (float)LC_FLOAT_TOLERANCE) &
+                        ((uint32)EvalPtr->AcceptMask >> 3));
+
+        CompareClass = (CompareClass & ~NearMask) | (LC_ACCEPT_EQ & NearMask);
+
+        EvalResult = (uint8)((CompareClass & EvalPtr->AcceptMask &
+                              (LC_ACCEPT_LT | LC_ACCEPT_EQ | LC_ACCEPT_GT)) !=
+                             0);
+
+    } /* end LC_WPIsNAN if */
+    else {
+        CFE_EVS_SendEvent(
+            LC_WP_NAN_ERR_EID, CFE_EVS_EventType_ERROR,
+            "WP data value is a float NAN: WP = %d, Value = 0x%08X",
+            EvalPtr->WatchIndex, (unsigned int)WPMultiType.Unsigned32);
+
+        EvalResult = LC_WATCH_ERROR;
+    }
+
+    return (EvalResult);
+
+} /* end LC_FloatCompare */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Report a watchpoint that has no relational operator             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint8 LC_OperatorIDError(const LC_WatchEval_t *EvalPtr) {
+    /*
+    ** This should have been caught before now, but we'll
+    ** handle it just in case we ever get here.
+    */
+    CFE_EVS_SendEvent(LC_WP_OPERID_ERR_EID, CFE_EVS_EventType_ERROR,
+                      "WP has invalid operator ID: WP = %d, OperID = %d",
+                      EvalPtr->WatchIndex, EvalPtr->OperatorID);
+
+    return (LC_WATCH_ERROR);
+
+} /* end LC_OperatorIDError */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Compare a batch of signed integer watchpoints                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_SignedCompareBatch(const LC_MultiType_t *WPValues,
+                           const LC_MultiType_t *CompareValues,
+                           const uint8 *AcceptMasks, uint8 *WPEvalResults,
+                           uint32 BatchCount) {
+#if defined(LC_HAVE_SSE2)
+    __m128i WPVector;
+    __m128i CompareVector;
+    __m128i ClassVector;
+    __m128i MaskVector;
+    __m128i ResultVector;
+    int32 PackedMasks;
+    int32 PackedResults;
+#elif defined(LC_HAVE_NEON)
+    int32x4_t WPVector;
+    int32x4_t CompareVector;
+    uint32x4_t ClassVector;
+    uint32x4_t MaskVector;
+    uint32x4_t ResultVector;
+    uint16x4_t NarrowVector;
+    uint32 PackedMasks;
+    uint32 PackedResults;
+#endif
+    uint32 CompareClass;
+    uint32 Lane = 0;
+
+#if defined(LC_HAVE_SSE2)
+    /*
+    ** Four lanes at a time. Each compare sets every bit of the lanes
+    ** where it holds, which selects the class bit of that relation.
+    ** The accept masks are widened from bytes to 32 bit lanes and the
+    ** results narrowed back.
+    */
+    for (; (Lane + 4) <= BatchCount; Lane += 4) {
+        WPVector = _mm_loadu_si128((const __m128i *)&WPValues[Lane]);
+        CompareVector =
+            _mm_loadu_si128((const __m128i *)&CompareValues[Lane]);
+
+        ClassVector = _mm_or_si128(
+            _mm_and_si128(_mm_cmplt_epi32(WPVector, CompareVector),
+                          _mm_set1_epi32(LC_ACCEPT_LT)),
+            _mm_or_si128(
+                _mm_and_si128(_mm_cmpeq_epi32(WPVector, CompareVector),
+                              _mm_set1_epi32(LC_ACCEPT_EQ)),
+                _mm_and_si128(_mm_cmpgt_epi32(WPVector, CompareVector),
+                              _mm_set1_epi32(LC_ACCEPT_GT))));
+
+        memcpy(&PackedMasks, &AcceptMasks[Lane], sizeof(PackedMasks));
+        MaskVector = _mm_unpacklo_epi16(
+            _mm_unpacklo_epi8(_mm_cvtsi32_si128(PackedMasks),
+                              _mm_setzero_si128()),
+            _mm_setzero_si128());
+
+        ResultVector = _mm_andnot_si128(
+            _mm_cmpeq_epi32(_mm_and_si128(ClassVector, MaskVector),
+                            _mm_setzero_si128()),
+            _mm_set1_epi32(1));
+
+        ResultVector  = _mm_packs_epi32(ResultVector, ResultVector);
+        ResultVector  = _mm_packus_epi16(ResultVector, ResultVector);
+        PackedResults = _mm_cvtsi128_si32(ResultVector);
+        memcpy(&WPEvalResults[Lane], &PackedResults, sizeof(PackedResults));
+    }
+#elif defined(LC_HAVE_NEON)
+    /* Four lanes at a time, as for SSE2 */
+    for (; (Lane + 4) <= BatchCount; Lane += 4) {
+        WPVector      = vld1q_s32((const int32_t *)&WPValues[Lane]);
+        CompareVector = vld1q_s32((const int32_t *)&CompareValues[Lane]);
+
+        ClassVector = vorrq_u32(
+            vandq_u32(vcltq_s32(WPVector, CompareVector),
+                      vdupq_n_u32(LC_ACCEPT_LT)),
+            vorrq_u32(vandq_u32(vceqq_s32(WPVector, CompareVector),
+                                vdupq_n_u32(LC_ACCEPT_EQ)),
+                      vandq_u32(vcgtq_s32(WPVector, CompareVector),
+                                vdupq_n_u32(LC_ACCEPT_GT))));
+
+        memcpy(&PackedMasks, &AcceptMasks[Lane], sizeof(PackedMasks));
+        MaskVector = vmovl_u16(vget_low_u16(
+            vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(PackedMasks)))));
+
+        ResultVector = vandq_u32(vtstq_u32(ClassVector, MaskVector),
+                                 vdupq_n_u32(1));
+
+        NarrowVector  = vmovn_u32(ResultVector);
+        PackedResults = vget_lane_u32(
+            vreinterpret_u32_u8(
+                vmovn_u16(vcombine_u16(NarrowVector, NarrowVector))),
+            0);
+        memcpy(&WPEvalResults[Lane], &PackedResults, sizeof(PackedResults));
+    }
+#endif
+
+    /*
+    ** The lanes left over, or every lane without a SIMD unit. There
+    ** are no branches or calls in the loop body.
+    */
+    for (; Lane < BatchCount; Lane++) {
+        CompareClass =
+            (uint32)(WPValues[Lane].Signed32 < CompareValues[Lane].Signed32) |
+            ((uint32)(WPValues[Lane].Signed32 ==
+                      CompareValues[Lane].Signed32)
+             << 1) |
+            ((uint32)(WPValues[Lane].Signed32 > CompareValues[Lane].Signed32)
+             << 2);
+
+        WPEvalResults[Lane] =
+            (uint8)((CompareClass & AcceptMasks[Lane]) != 0);
+    }
+
+    return;
+
+} /* end LC_SignedCompareBatch */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Compare a batch of unsigned integer watchpoints                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_UnsignedCompareBatch(const LC_MultiType_t *WPValues,
+                             const LC_MultiType_t *CompareValues,
+                             const uint8 *AcceptMasks, uint8 *WPEvalResults,
+                             uint32 BatchCount) {
+#if defined(LC_HAVE_SSE2)
+    __m128i WPVector;
+    __m128i CompareVector;
+    __m128i ClassVector;
+    __m128i MaskVector;
+    __m128i ResultVector;
+    int32 PackedMasks;
+    int32 PackedResults;
+#elif defined(LC_HAVE_NEON)
+    uint32x4_t WPVector;
+    uint32x4_t CompareVector;
+    uint32x4_t ClassVector;
+    uint32x4_t MaskVector;
+    uint32x4_t ResultVector;
+    uint16x4_t NarrowVector;
+    uint32 PackedMasks;
+    uint32 PackedResults;
+#endif
+    uint32 CompareClass;
+    uint32 Lane = 0;
+
+#if defined(LC_HAVE_SSE2)
+    /*
+    ** SSE2 only has signed compares, flipping the top bit of both
+    ** sides gives the unsigned order
+    */
+    for (; (Lane + 4) <= BatchCount; Lane += 4) {
+        WPVector = _mm_xor_si128(
+            _mm_loadu_si128((const __m128i *)&WPValues[Lane]),
+            _mm_set1_epi32((int32)0x80000000));
+        CompareVector = _mm_xor_si128(
+            _mm_loadu_si128((const __m128i *)&CompareValues[Lane]),
+            _mm_set1_epi32((int32)0x80000000));
+
+        ClassVector = _mm_or_si128(
+            _mm_and_si128(_mm_cmplt_epi32(WPVector, CompareVector),
+                          _mm_set1_epi32(LC_ACCEPT_LT)),
+            _mm_or_si128(
+                _mm_and_si128(_mm_cmpeq_epi32(WPVector, CompareVector),
+                              _mm_set1_epi32(LC_ACCEPT_EQ)),
+                _mm_and_si128(_mm_cmpgt_epi32(WPVector, CompareVector),
+                              _mm_set1_epi32(LC_ACCEPT_GT))));
+
+        memcpy(&PackedMasks, &AcceptMasks[Lane], sizeof(PackedMasks));
+        MaskVector = _mm_unpacklo_epi16(
+            _mm_unpacklo_epi8(_mm_cvtsi32_si128(PackedMasks),
+                              _mm_setzero_si128()),
+            _mm_setzero_si128());
+
+        ResultVector = _mm_andnot_si128(
+            _mm_cmpeq_epi32(_mm_and_si128(ClassVector, MaskVector),
+                            _mm_setzero_si128()),
+            _mm_set1_epi32(1));
+
+        ResultVector  = _mm_packs_epi32(ResultVector, ResultVector);
+        ResultVector  = _mm_packus_epi16(ResultVector, ResultVector);
+        PackedResults = _mm_cvtsi128_si32(ResultVector);
+        memcpy(&WPEvalResults[Lane], &PackedResults, sizeof(PackedResults));
+    }
+#elif defined(LC_HAVE_NEON)
+    for (; (Lane + 4) <= BatchCount; Lane += 4) {
+        WPVector      = vld1q_u32((const uint32_t *)&WPValues[Lane]);
+        CompareVector = vld1q_u32((const uint32_t *)&CompareValues[Lane]);
+
+        ClassVector = vorrq_u32(
+            vandq_u32(vcltq_u32(WPVector, CompareVector),
+                      vdupq_n_u32(LC_ACCEPT_LT)),
+            vorrq_u32(vandq_u32(vceqq_u32(WPVector, CompareVector),
+                                vdupq_n_u32(LC_ACCEPT_EQ)),
+                      vandq_u32(vcgtq_u32(WPVector, CompareVector),
+                                vdupq_n_u32(LC_ACCEPT_GT))));
+
+        memcpy(&PackedMasks, &AcceptMasks[Lane], sizeof(PackedMasks));
+        MaskVector = vmovl_u16(vget_low_u16(
+            vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(PackedMasks)))));
+
+        ResultVector = vandq_u32(vtstq_u32(ClassVector, MaskVector),
+                                 vdupq_n_u32(1));
+
+        NarrowVector  = vmovn_u32(ResultVector);
+        PackedResults = vget_lane_u32(
+            vreinterpret_u32_u8(
+                vmovn_u16(vcombine_u16(NarrowVector, NarrowVector))),
+            0);
+        memcpy(&WPEvalResults[Lane], &PackedResults, sizeof(PackedResults));
+    }
+#endif
+
+    for (; Lane < BatchCount; Lane++) {
+        CompareClass = (uint32)(WPValues[Lane].Unsigned32 <
+                                CompareValues[Lane].Unsigned32) |
+                       ((uint32)(WPValues[Lane].Unsigned32 ==
+                                 CompareValues[Lane].Unsigned32)
+                        << 1) |
+                       ((uint32)(WPValues[Lane].Unsigned32 >
+                                 CompareValues[Lane].Unsigned32)
+                        << 2);
+
+        WPEvalResults[Lane] =
+            (uint8)((CompareClass & AcceptMasks[Lane]) != 0);
+    }
+
+    return;
 
-            case LC_OPER_LT:
-                EvalResult =
-                    (WPFloat < CompareFloat) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
-                break;
+} /* end LC_UnsignedCompareBatch */
 
-            case LC_OPER_EQ:
-                Diff       = (WPFloat > CompareFloat) ? (WPFloat - CompareFloat)
-                                                      : (CompareFloat - WPFloat);
-                EvalResult = (Diff <= (float)LC_FLOAT_TOLERANCE)
-                                 ? LC_WATCH_TRUE
-                                 : LC_WATCH_FALSE;
-                break;
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Compare a batch of floating point watchpoints                   */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_FloatCompareBatch(const LC_MultiType_t *WPValues,
+                          const LC_MultiType_t *CompareValues,
+                          const uint8 *AcceptMasks, uint8 *WPEvalResults,
+                          uint32 BatchCount) {
+#if defined(LC_HAVE_SSE2)
+    __m128i WPVector;
+    __m128i NANVector;
+    __m128i ClassVector;
+    __m128i NearVector;
+    __m128i MaskVector;
+    __m128i ResultVector;
+    __m128 WPFloats;
+    __m128 CompareFloats;
+    __m128 DiffFloats;
+    int32 PackedMasks;
+    int32 PackedResults;
+#elif defined(LC_HAVE_NEON) && defined(__aarch64__)
+    uint32x4_t WPVector;
+    uint32x4_t NANVector;
+    uint32x4_t ClassVector;
+    uint32x4_t NearVector;
+    uint32x4_t MaskVector;
+    uint32x4_t ResultVector;
+    uint16x4_t NarrowVector;
+    float32x4_t WPFloats;
+    float32x4_t CompareFloats;
+    uint32 PackedMasks;
+    uint32 PackedResults;
+#endif
+    LC_MultiType_t WPValue;
+    uint32 CompareClass;
+    uint32 NearMask;
+    uint32 IsNAN;
+    uint32 Result;
+    uint32 Lane = 0;
+    float CompareFloat;
+    float Diff;
 
-            case LC_OPER_NE:
-                Diff       = (WPFloat > CompareFloat) ? (WPFloat - CompareFloat)
-                                                      : (CompareFloat - WPFloat);
-                EvalResult = (Diff > (float)LC_FLOAT_TOLERANCE)
-                                 ? LC_WATCH_TRUE
-                                 : LC_WATCH_FALSE;
-                break;
+#if defined(LC_HAVE_SSE2)
+    /*
+    ** Four lanes at a time, the same steps as the loop below. NAN
+    ** lanes are zeroed before any floating point compare.
+    */
+    for (; (Lane + 4) <= BatchCount; Lane += 4) {
+        WPVector  = _mm_loadu_si128((const __m128i *)&WPValues[Lane]);
+        NANVector = _mm_cmpgt_epi32(
+            _mm_and_si128(WPVector, _mm_set1_epi32(0x7FFFFFFF)),
+            _mm_set1_epi32(0x7F800000));
+        WPFloats = _mm_castsi128_ps(_mm_andnot_si128(NANVector, WPVector));
+        CompareFloats = _mm_loadu_ps(&CompareValues[Lane].Float32);
+
+        ClassVector = _mm_or_si128(
+            _mm_and_si128(
+                _mm_castps_si128(_mm_cmplt_ps(WPFloats, CompareFloats)),
+                _mm_set1_epi32(LC_ACCEPT_LT)),
+            _mm_or_si128(
+                _mm_and_si128(
+                    _mm_castps_si128(_mm_cmpeq_ps(WPFloats, CompareFloats)),
+                    _mm_set1_epi32(LC_ACCEPT_EQ)),
+                _mm_and_si128(
+                    _mm_castps_si128(_mm_cmpgt_ps(WPFloats, CompareFloats)),
+                    _mm_set1_epi32(LC_ACCEPT_GT))));
+
+        memcpy(&PackedMasks, &AcceptMasks[Lane], sizeof(PackedMasks));
+        MaskVector = _mm_unpacklo_epi16(
+            _mm_unpacklo_epi8(_mm_cvtsi32_si128(PackedMasks),
+                              _mm_setzero_si128()),
+            _mm_setzero_si128());
+
+        /* Clearing the sign bit of the difference gives its magnitude */
+        DiffFloats = _mm_andnot_ps(_mm_set1_ps(-0.0f),
+                                   _mm_sub_ps(WPFloats, CompareFloats));
+
+        NearVector = _mm_and_si128(
+            _mm_castps_si128(_mm_cmple_ps(
+                DiffFloats, _mm_set1_ps((float)LC_FLOAT_TOLERANCE))),
+            _mm_cmpeq_epi32(
+                _mm_and_si128(MaskVector, _mm_set1_epi32(LC_ACCEPT_NEAR)),
+                _mm_set1_epi32(LC_ACCEPT_NEAR)));
+
+        ClassVector = _mm_or_si128(
+            _mm_andnot_si128(NearVector, ClassVector),
+            _mm_and_si128(NearVector, _mm_set1_epi32(LC_ACCEPT_EQ)));
+
+        ResultVector = _mm_andnot_si128(
+            _mm_cmpeq_epi32(
+                _mm_and_si128(
+                    _mm_and_si128(ClassVector, MaskVector),
+                    _mm_set1_epi32(LC_ACCEPT_LT | LC_ACCEPT_EQ |
+                                   LC_ACCEPT_GT)),
+                _mm_setzero_si128()),
+            _mm_set1_epi32(1));
+
+        ResultVector = _mm_or_si128(
+            _mm_andnot_si128(NANVector, ResultVector),
+            _mm_and_si128(NANVector, _mm_set1_epi32(LC_WATCH_ERROR)));
+
+        ResultVector  = _mm_packs_epi32(ResultVector, ResultVector);
+        ResultVector  = _mm_packus_epi16(ResultVector, ResultVector);
+        PackedResults = _mm_cvtsi128_si32(ResultVector);
+        memcpy(&WPEvalResults[Lane], &PackedResults, sizeof(PackedResults));
+    }
+#elif defined(LC_HAVE_NEON) && defined(__aarch64__)
+    for (; (Lane + 4) <= BatchCount; Lane += 4) {
+        WPVector  = vld1q_u32((const uint32_t *)&WPValues[Lane]);
+        NANVector = vcgtq_u32(vandq_u32(WPVector, vdupq_n_u32(0x7FFFFFFF)),
+                              vdupq_n_u32(0x7F800000));
+        WPFloats  = vreinterpretq_f32_u32(vbicq_u32(WPVector, NANVector));
+        CompareFloats = vld1q_f32(&CompareValues[Lane].Float32);
+
+        ClassVector = vorrq_u32(
+            vandq_u32(vcltq_f32(WPFloats, CompareFloats),
+                      vdupq_n_u32(LC_ACCEPT_LT)),
+            vorrq_u32(vandq_u32(vceqq_f32(WPFloats, CompareFloats),
+                                vdupq_n_u32(LC_ACCEPT_EQ)),
+                      vandq_u32(vcgtq_f32(WPFloats, CompareFloats),
+                                vdupq_n_u32(LC_ACCEPT_GT))));
+
+        memcpy(&PackedMasks, &AcceptMasks[Lane], sizeof(PackedMasks));
+        MaskVector = vmovl_u16(vget_low_u16(
+            vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(PackedMasks)))));
+
+        NearVector = vandq_u32(
+            vcleq_f32(vabdq_f32(WPFloats, CompareFloats),
+                      vdupq_n_f32((float)LC_FLOAT_TOLERANCE)),
+            vtstq_u32(MaskVector, vdupq_n_u32(LC_ACCEPT_NEAR)));
+
+        ClassVector =
+            vbslq_u32(NearVector, vdupq_n_u32(LC_ACCEPT_EQ), ClassVector);
+
+        ResultVector = vandq_u32(
+            vtstq_u32(ClassVector,
+                      vandq_u32(MaskVector,
+                                vdupq_n_u32(LC_ACCEPT_LT | LC_ACCEPT_EQ |
+                                            LC_ACCEPT_GT))),
+            vdupq_n_u32(1));
+
+        ResultVector =
+            vbslq_u32(NANVector, vdupq_n_u32(LC_WATCH_ERROR), ResultVector);
+
+        NarrowVector  = vmovn_u32(ResultVector);
+        PackedResults = vget_lane_u32(
+            vreinterpret_u32_u8(
+                vmovn_u16(vcombine_u16(NarrowVector, NarrowVector))),
+            0);
+        memcpy(&WPEvalResults[Lane], &PackedResults, sizeof(PackedResults));
+    }
+#endif
 
-            case LC_OPER_GT:
-                EvalResult =
-                    (WPFloat > CompareFloat) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
-                break;
+    for (; Lane < BatchCount; Lane++) {
+        /*
+        ** A NAN lane is compared as zero, so no floating point
+        ** exception is raised, and then marked as an error
+        */
+        IsNAN = (uint32)((WPValues[Lane].Unsigned32 & 0x7FFFFFFF) >
+                         0x7F800000);
+        WPValue.Unsigned32 = WPValues[Lane].Unsigned32 & (IsNAN - 1);
+        CompareFloat       = CompareValues[Lane].Float32;
 
-            case LC_OPER_GE:
-                EvalResult =
-                    (WPFloat >= CompareFloat) ? LC_WATCH_TRUE : LC_WATCH_FALSE;
-                break;
+        CompareClass = (uint32)(WPValue.Float32 < CompareFloat) |
+                       ((uint32)(WPValue.Float32 == CompareFloat) << 1) |
+                       ((uint32)(WPValue.Float32 > CompareFloat) << 2);
 
-            default:
-                /*
-                ** This should have been caught before now, but we'll
-                ** handle it just in case we ever get here.
-                */
-                CFE_EVS_SendEvent(
-                    LC_WP_OPERID_ERR_EID, CFE_EVS_EventType_ERROR,
-                    "WP has invalid operator ID: WP = %d, OperID = %d",
-                    WatchIndex, OperatorID);
+        Diff = (WPValue.Float32 > CompareFloat)
+                   ? (WPValue.Float32 - CompareFloat)
+                   : (CompareFloat - WPValue.Float32);
 
-                EvalResult = LC_WATCH_ERROR;
-                break;
+        NearMask = 0 - ((uint32)(Diff <= (float)LC_FLOAT_TOLERANCE) &
+                        ((uint32)AcceptMasks[Lane] >> 3));
 
-        } /*  end of switch  */
+        CompareClass = (CompareClass & ~NearMask) | (LC_ACCEPT_EQ & NearMask);
 
-    } /* end LC_WPIsNAN if */
-    else {
-        CFE_EVS_SendEvent(
-            LC_WP_NAN_ERR_EID, CFE_EVS_EventType_ERROR,
-            "WP data value is a float NAN: WP = %d, Value = 0x%08X", WatchIndex,
-            (unsigned int)WPMultiType.Unsigned32);
+        Result = (uint32)((CompareClass & AcceptMasks[Lane] &
+                           (LC_ACCEPT_LT | LC_ACCEPT_EQ | LC_ACCEPT_GT)) != 0);
 
-        EvalResult = LC_WATCH_ERROR;
+        WPEvalResults[Lane] =
+            (uint8)(Result + ((LC_WATCH_ERROR - Result) & (0 - IsNAN)));
     }
 
-    return (EvalResult);
+    return;
 
-} /* end LC_FloatCompare */
+} /* end LC_FloatCompareBatch */
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
@@ -757,64 +2897,39 @@ uint8 LC_FloatCompare(uint16 WatchIndex, LC_MultiType_t WPMultiType,
 /* end of the received message                                     */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-bool LC_WPOffsetValid(uint16 WatchIndex, CFE_SB_MsgPtr_t MessagePtr) {
-    uint16 MsgLength;
+bool LC_WPOffsetValid(const LC_WatchEval_t *EvalPtr,
+                      CFE_SB_MsgPtr_t MessagePtr, uint16 MsgLength) {
+    uint16 WatchIndex = EvalPtr->WatchIndex;
     uint32 Offset;
-    uint32 NumOfDataBytes    = 0;
+    uint32 NumOfDataBytes;
     bool OffsetValid         = true;
     CFE_SB_MsgId_t MessageID = 0;
 
-    /*
-    ** Check the message length against the watchpoint
-    ** offset and data type to make sure we won't
-    ** try to read past it.
-    */
-    switch (LC_OperData.WDTPtr[WatchIndex].DataType) {
-        case LC_DATA_BYTE:
-        case LC_DATA_UBYTE:
-            NumOfDataBytes = sizeof(uint8);
-            break;
-
-        case LC_DATA_WORD_BE:
-        case LC_DATA_WORD_LE:
-        case LC_DATA_UWORD_BE:
-        case LC_DATA_UWORD_LE:
-            NumOfDataBytes = sizeof(uint16);
-            break;
-
-        case LC_DATA_DWORD_BE:
-        case LC_DATA_DWORD_LE:
-        case LC_DATA_UDWORD_BE:
-        case LC_DATA_UDWORD_LE:
-            NumOfDataBytes = sizeof(uint32);
-            break;
-
-        case LC_DATA_FLOAT_BE:
-        case LC_DATA_FLOAT_LE:
-            NumOfDataBytes = sizeof(float);
-            break;
-
-        default:
-            /*
-            ** This should have been caught before now, but we'll
-            ** handle it just in case we ever get here.
-            */
-            CFE_EVS_SendEvent(
-                LC_WP_DATATYPE_ERR_EID, CFE_EVS_EventType_ERROR,
-                "WP has undefined data type: WP = %d, DataType = %d",
-                WatchIndex, LC_OperData.WDTPtr[WatchIndex].DataType);
-
-            LC_OperData.WRTPtr[WatchIndex].WatchResult      = LC_WATCH_ERROR;
-            LC_OperData.WRTPtr[WatchIndex].CountdownToStale = 0;
+    if (EvalPtr->CompareType == LC_EVAL_UNDEFINED) {
+        /*
+        ** This should have been caught before now, but we'll
+        ** handle it just in case we ever get here.
+        */
+        CFE_EVS_SendEvent(LC_WP_DATATYPE_ERR_EID, CFE_EVS_EventType_ERROR,
+                          "WP has undefined data type: WP = %d, DataType = %d",
+                          WatchIndex, EvalPtr->DataType);
 
-            return (false);
-            break;
+        LC_OperData.WatchResults[WatchIndex] = LC_WATCH_ERROR;
+        LC_SetStaleCountdown(WatchIndex, 0);
+        LC_MarkAPsDirty(WatchIndex);
 
-    } /* end switch */
+        return (false);
+    }
 
-    MsgLength = CFE_SB_GetTotalMsgLength(MessagePtr);
+    /*
+    ** Check the message length against the watchpoint
+    ** offset and data size (all elements of an array
+    ** watchpoint) to make sure we won't try to read
+    ** past it.
+    */
+    NumOfDataBytes = EvalPtr->DataExtent;
 
-    Offset = LC_OperData.WDTPtr[WatchIndex].WatchpointOffset;
+    Offset = EvalPtr->WatchpointOffset;
 
     if ((Offset + NumOfDataBytes) > MsgLength) {
         OffsetValid = false;
@@ -827,8 +2942,9 @@ bool LC_WPOffsetValid(uint16 WatchIndex, CFE_SB_MsgPtr_t MessagePtr) {
                           MessageID, WatchIndex, (int)Offset,
                           (int)NumOfDataBytes, MsgLength);
 
-        LC_OperData.WRTPtr[WatchIndex].WatchResult      = LC_WATCH_ERROR;
-        LC_OperData.WRTPtr[WatchIndex].CountdownToStale = 0;
+        LC_OperData.WatchResults[WatchIndex] = LC_WATCH_ERROR;
+        LC_SetStaleCountdown(WatchIndex, 0);
+        LC_MarkAPsDirty(WatchIndex);
     }
 
     return (OffsetValid);
@@ -848,122 +2964,169 @@ void LC_CopyBytesWithSwap(LC_MultiType_t *DestBuffer, const uint8 *SrcPtr,
     }
 }
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Watchpoint datum extraction kernels                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 LC_ExtractUint8(const uint8 *WPDataPtr) {
+    return (*WPDataPtr);
+
+} /* end LC_ExtractUint8 */
+
+uint32 LC_ExtractNative16(const uint8 *WPDataPtr) {
+    uint16 Data;
+
+    /* Compilers turn this into one load where misalignment is allowed */
+    memcpy(&Data, WPDataPtr, sizeof(Data));
+
+    return (Data);
+
+} /* end LC_ExtractNative16 */
+
+uint32 LC_ExtractNative32(const uint8 *WPDataPtr) {
+    uint32 Data;
+
+    memcpy(&Data, WPDataPtr, sizeof(Data));
+
+    return (Data);
+
+} /* end LC_ExtractNative32 */
+
+#ifdef LC_HAVE_BSWAP_BUILTINS
+uint32 LC_ExtractSwapped16(const uint8 *WPDataPtr) {
+    uint16 Data;
+
+    memcpy(&Data, WPDataPtr, sizeof(Data));
+
+    return (__builtin_bswap16(Data));
+
+} /* end LC_ExtractSwapped16 */
+
+uint32 LC_ExtractSwapped32(const uint8 *WPDataPtr) {
+    uint32 Data;
+
+    memcpy(&Data, WPDataPtr, sizeof(Data));
+
+    return (__builtin_bswap32(Data));
+
+} /* end LC_ExtractSwapped32 */
+#endif
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Get sized watchpoint data                                       */
 /*                                                                 */
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
-bool LC_GetSizedWPData(uint16 WatchIndex, uint8 *WPDataPtr,
-                       uint32 *SizedDataPtr) {
-    bool Success = true;
-    LC_MultiType_t ConvBuffer;
+uint32 LC_GetSizedWPData(const LC_WatchEval_t *EvalPtr,
+                         const uint8 *WPDataPtr) {
     LC_MultiType_t TempBuffer;
-
-    ConvBuffer.Unsigned32 = 0;
-    TempBuffer.Unsigned32 = 0;
+    uint32 RawData;
 
     /*
     ** Get the watchpoint data value (which may be on a misaligned
-    ** address boundary) and put it into an unsigned 32 properly
-    ** handling endian and sign extension issues
+    ** address boundary) in native byte order, using the kernel
+    ** selected when the watchpoint was compiled
     */
-    switch (LC_OperData.WDTPtr[WatchIndex].DataType) {
-        case LC_DATA_BYTE:
-            TempBuffer.Unsigned8 = *WPDataPtr;
-            ConvBuffer.Signed32 =
-                TempBuffer.Signed8; /* Extend signed 8 bit value to 32 bits */
-            break;
+    if (EvalPtr->ExtractFunc != (LC_ExtractFunc_t)NULL) {
+        RawData = EvalPtr->ExtractFunc(WPDataPtr);
+    } else {
+        /* Portable fallback - swap with the byte map */
+        TempBuffer.Unsigned32 = 0;
 
-        case LC_DATA_UBYTE:
-            ConvBuffer.Unsigned32 =
-                *WPDataPtr; /* Extend unsigned 8 bit value to 32 bits */
-            break;
+        LC_CopyBytesWithSwap(&TempBuffer, WPDataPtr, EvalPtr->SwapMap,
+                             EvalPtr->DataSize);
 
-        case LC_DATA_WORD_BE:
-            ConvBuffer.Unsigned16 = 0x0001;
-            LC_CopyBytesWithSwap(&TempBuffer, WPDataPtr, ConvBuffer,
-                                 sizeof(int16));
-            ConvBuffer.Signed32 =
-                TempBuffer.Signed16; /* Extend signed 16 bit value to 32 bits */
-            break;
+        if (EvalPtr->DataSize == sizeof(uint8)) {
+            RawData = TempBuffer.Unsigned8;
+        } else if (EvalPtr->DataSize == sizeof(uint16)) {
+            RawData = TempBuffer.Unsigned16;
+        } else {
+            RawData = TempBuffer.Unsigned32;
+        }
+    }
 
-        case LC_DATA_WORD_LE:
-            ConvBuffer.Unsigned16 = 0x0100;
-            LC_CopyBytesWithSwap(&TempBuffer, WPDataPtr, ConvBuffer,
-                                 sizeof(int16));
-            ConvBuffer.Signed32 =
-                TempBuffer.Signed16; /* Extend signed 16 bit value to 32 bits */
+    /*
+    ** Extend to 32 bits - the sign bit is zero for unsigned and
+    ** full width types so this is a straight copy for those
+    */
+    return ((RawData ^ EvalPtr->SignBit) - EvalPtr->SignBit);
+
+} /* end LC_GetSizedWPData */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Gather the data of a batch of lanes                             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_GatherWPData(const LC_WatchEval_t *EvalPtr, const uint8 *BasePtr,
+                     const uint32 *Offsets, uint32 *RawData,
+                     uint32 LaneCount) {
+    LC_MultiType_t TempBuffer;
+    uint16 Data16;
+    uint32 Data32;
+    uint32 Lane;
+
+    /*
+    ** One loop per kernel, with the load written out, so there is no
+    ** call per lane. The loads may be misaligned, compilers turn the
+    ** memcpy into one load where that is allowed.
+    */
+    switch (EvalPtr->ExtractKind) {
+        case LC_EXTRACT_UINT8:
+            for (Lane = 0; Lane < LaneCount; Lane++) {
+                RawData[Lane] = BasePtr[Offsets[Lane]];
+            }
             break;
 
-        case LC_DATA_UWORD_BE:
-            ConvBuffer.Unsigned16 = 0x0001;
-            LC_CopyBytesWithSwap(&TempBuffer, WPDataPtr, ConvBuffer,
-                                 sizeof(uint16));
-            ConvBuffer.Unsigned32 =
-                TempBuffer
-                    .Unsigned16; /* Extend unsigned 16 bit value to 32 bits */
+        case LC_EXTRACT_NATIVE16:
+            for (Lane = 0; Lane < LaneCount; Lane++) {
+                memcpy(&Data16, &BasePtr[Offsets[Lane]], sizeof(Data16));
+                RawData[Lane] = Data16;
+            }
             break;
 
-        case LC_DATA_UWORD_LE:
-            ConvBuffer.Unsigned16 = 0x0100;
-            LC_CopyBytesWithSwap(&TempBuffer, WPDataPtr, ConvBuffer,
-                                 sizeof(uint16));
-            ConvBuffer.Unsigned32 =
-                TempBuffer
-                    .Unsigned16; /* Extend unsigned 16 bit value to 32 bits */
+        case LC_EXTRACT_NATIVE32:
+            for (Lane = 0; Lane < LaneCount; Lane++) {
+                memcpy(&Data32, &BasePtr[Offsets[Lane]], sizeof(Data32));
+                RawData[Lane] = Data32;
+            }
             break;
 
-        case LC_DATA_DWORD_BE:
-        case LC_DATA_UDWORD_BE:
-        case LC_DATA_FLOAT_BE:
-            ConvBuffer.Unsigned32 = 0x00010203;
-            LC_CopyBytesWithSwap(&TempBuffer, WPDataPtr, ConvBuffer,
-                                 sizeof(uint32));
-            ConvBuffer.Unsigned32 =
-                TempBuffer.Unsigned32; /* Straight copy - no extension (signed
-                                          or unsigned) */
+#ifdef LC_HAVE_BSWAP_BUILTINS
+        case LC_EXTRACT_SWAPPED16:
+            for (Lane = 0; Lane < LaneCount; Lane++) {
+                memcpy(&Data16, &BasePtr[Offsets[Lane]], sizeof(Data16));
+                RawData[Lane] = __builtin_bswap16(Data16);
+            }
             break;
 
-        case LC_DATA_DWORD_LE:
-        case LC_DATA_UDWORD_LE:
-        case LC_DATA_FLOAT_LE:
-            ConvBuffer.Unsigned32 = 0x03020100;
-            LC_CopyBytesWithSwap(&TempBuffer, WPDataPtr, ConvBuffer,
-                                 sizeof(uint32));
-            ConvBuffer.Unsigned32 =
-                TempBuffer.Unsigned32; /* Straight copy - no extension (signed
-                                          or unsigned) */
+        case LC_EXTRACT_SWAPPED32:
+            for (Lane = 0; Lane < LaneCount; Lane++) {
+                memcpy(&Data32, &BasePtr[Offsets[Lane]], sizeof(Data32));
+                RawData[Lane] = __builtin_bswap32(Data32);
+            }
             break;
+#endif
 
         default:
-            /*
-            ** This should have been caught before now, but we'll
-            ** handle it just in case we ever get here.
-            */
-            CFE_EVS_SendEvent(
-                LC_WP_DATATYPE_ERR_EID, CFE_EVS_EventType_ERROR,
-                "WP has undefined data type: WP = %d, DataType = %d",
-                WatchIndex, LC_OperData.WDTPtr[WatchIndex].DataType);
+            /* Portable fallback - swap with the byte map */
+            for (Lane = 0; Lane < LaneCount; Lane++) {
+                TempBuffer.Unsigned32 = 0;
 
-            LC_OperData.WRTPtr[WatchIndex].WatchResult      = LC_WATCH_ERROR;
-            LC_OperData.WRTPtr[WatchIndex].CountdownToStale = 0;
+                LC_CopyBytesWithSwap(&TempBuffer, &BasePtr[Offsets[Lane]],
+                                     EvalPtr->SwapMap, EvalPtr->DataSize);
 
-            Success = false;
+                RawData[Lane] = (EvalPtr->DataSize == sizeof(uint16))
+                                    ? TempBuffer.Unsigned16
+                                    : TempBuffer.Unsigned32;
+            }
             break;
+    }
 
-    } /* end switch */
-
-    /*
-    ** Set result value
-    */
-    *SizedDataPtr = ConvBuffer.Unsigned32;
-
-    /*
-    ** Return success flag
-    */
-    return (Success);
+    return;
 
-} /* end LC_GetSizedWPData */
+} /* end LC_GatherWPData */
 
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
@@ -979,7 +3142,7 @@ int32 LC_ValidateWDT(void *TableData) {
 
     uint8 DataType;
     uint8 OperatorID;
-    uint16 MessageID;
+    CFE_SB_MsgId_t MessageID;
     uint32 CompareValue;
 
     int32 GoodCount   = 0;
@@ -1034,6 +3197,19 @@ int32 LC_ValidateWDT(void *TableData) {
             */
             BadCount++;
             EntryResult = LC_WDTVAL_ERR_MID;
+        } else if (LC_WDTArrayIsValid(&TableArray[TableIndex]) == false) {
+            /*
+            ** Bad array watchpoint element settings
+            */
+            BadCount++;
+            EntryResult = LC_WDTVAL_ERR_ARRAY;
+        } else if ((TableArray[TableIndex].MonitorMode != LC_MONITOR_EVERY) &&
+                   (TableArray[TableIndex].MonitorMode != LC_MONITOR_LATEST)) {
+            /*
+            ** Invalid monitor mode
+            */
+            BadCount++;
+            EntryResult = LC_WDTVAL_ERR_MODE;
         } else if ((DataType == LC_DATA_FLOAT_BE) ||
                    (DataType == LC_DATA_FLOAT_LE)) {
             /*
@@ -1073,9 +3249,9 @@ int32 LC_ValidateWDT(void *TableData) {
             } else {
                 CFE_EVS_SendEvent(LC_WDTVAL_ERR_EID, CFE_EVS_EventType_ERROR,
                                   "WDT verify err: WP = %d, Err = %d, DType = "
-                                  "%d, Oper = %d, MID = %d",
+                                  "%d, Oper = %d, MID = %u",
                                   (int)TableIndex, (int)EntryResult, DataType,
-                                  OperatorID, MessageID);
+                                  OperatorID, (unsigned int)MessageID);
             }
 
             TableResult = EntryResult;
@@ -1094,6 +3270,39 @@ int32 LC_ValidateWDT(void *TableData) {
 
 } /* end LC_ValidateWDT */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Check the array element settings of a WDT entry                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+bool LC_WDTArrayIsValid(const LC_WDTEntry_t *WDTEntry) {
+    bool ArrayIsValid = true;
+
+    if (WDTEntry->AggregateType == LC_AGGR_NONE) {
+        /* Single value watchpoint, the element settings are unused */
+    } else if ((WDTEntry->AggregateType != LC_AGGR_ANY) &&
+               (WDTEntry->AggregateType != LC_AGGR_ALL) &&
+               (WDTEntry->AggregateType != LC_AGGR_COUNT)) {
+        ArrayIsValid = false;
+    } else if (WDTEntry->OperatorID == LC_OPER_CUSTOM) {
+        /* The custom function is only given a single value */
+        ArrayIsValid = false;
+    } else if ((WDTEntry->ElementCount == 0) ||
+               (WDTEntry->ElementCount > LC_MAX_WP_ELEMENTS)) {
+        ArrayIsValid = false;
+    } else if ((WDTEntry->ElementCount > 1) &&
+               (WDTEntry->ElementStride == 0)) {
+        ArrayIsValid = false;
+    } else if ((WDTEntry->AggregateType == LC_AGGR_COUNT) &&
+               ((WDTEntry->AggregateCount == 0) ||
+                (WDTEntry->AggregateCount > WDTEntry->ElementCount))) {
+        ArrayIsValid = false;
+    }
+
+    return (ArrayIsValid);
+
+} /* end LC_WDTArrayIsValid */
+
 /* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
 /*                                                                 */
 /* Test if a 32 bit integer's value would be a floating point      */
@@ -1159,6 +3368,186 @@ bool LC_Uint32IsInfinite(uint32 Data) {
 
 } /* end LC_Uint32IsInfinite */
 
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Start, restart or stop the stale countdown of a watch result    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_SetStaleCountdown(uint16 WatchIndex, uint32 Countdown) {
+    uint16 NextEntry;
+    uint16 PrevEntry;
+    uint32 Deadline;
+    uint32 Slot;
+
+    /*
+    ** Take the watchpoint out of the slot of its old deadline
+    */
+    if (LC_OperData.StaleTimed[WatchIndex] == true) {
+        NextEntry = LC_OperData.StaleNext[WatchIndex];
+        PrevEntry = LC_OperData.StalePrev[WatchIndex];
+
+        if (PrevEntry != 0) {
+            LC_OperData.StaleNext[PrevEntry - 1] = NextEntry;
+        } else {
+            Slot = LC_OperData.StaleDeadlines[WatchIndex] & LC_STALE_WHEEL_MASK;
+            LC_OperData.StaleWheel[Slot] = NextEntry;
+        }
+
+        if (NextEntry != 0) {
+            LC_OperData.StalePrev[NextEntry - 1] = PrevEntry;
+        }
+
+        LC_OperData.StaleTimed[WatchIndex] = false;
+    }
+
+    /*
+    ** A countdown of zero means the result never goes stale
+    */
+    if (Countdown != 0) {
+        Deadline = LC_OperData.AgeTick + Countdown;
+        Slot     = Deadline & LC_STALE_WHEEL_MASK;
+
+        LC_OperData.StaleDeadlines[WatchIndex] = Deadline;
+        LC_OperData.StalePrev[WatchIndex]      = 0;
+        LC_OperData.StaleNext[WatchIndex]      = LC_OperData.StaleWheel[Slot];
+
+        if (LC_OperData.StaleWheel[Slot] != 0) {
+            LC_OperData.StalePrev[LC_OperData.StaleWheel[Slot] - 1] =
+                WatchIndex + 1;
+        }
+
+        LC_OperData.StaleWheel[Slot]       = WatchIndex + 1;
+        LC_OperData.StaleTimed[WatchIndex] = true;
+    }
+
+    return;
+
+} /* end LC_SetStaleCountdown */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Get the remaining stale countdown of a watch result             */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+uint32 LC_GetStaleCountdown(uint16 WatchIndex) {
+    uint32 Countdown = 0;
+
+    if (LC_OperData.StaleTimed[WatchIndex] == true) {
+        Countdown = LC_OperData.StaleDeadlines[WatchIndex] -
+                    LC_OperData.AgeTick;
+    }
+
+    return (Countdown);
+
+} /* end LC_GetStaleCountdown */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Age the watch results by one actionpoint sample                 */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_AgeWatchResults(void) {
+    uint16 WatchIndex;
+    uint16 Entry;
+
+    LC_OperData.AgeTick++;
+
+    /*
+    ** Only the watchpoints in this tick's slot can expire now, the
+    ** others in the slot are due a later turn of the wheel
+    */
+    Entry = LC_OperData.StaleWheel[LC_OperData.AgeTick & LC_STALE_WHEEL_MASK];
+
+    while (Entry != 0) {
+        WatchIndex = Entry - 1;
+        Entry      = LC_OperData.StaleNext[WatchIndex];
+
+        if (LC_OperData.StaleDeadlines[WatchIndex] == LC_OperData.AgeTick) {
+            LC_SetStaleCountdown(WatchIndex, 0);
+
+            LC_OperData.WatchResults[WatchIndex] = LC_WATCH_STALE;
+            LC_MarkAPsDirty(WatchIndex);
+        }
+    }
+
+    return;
+
+} /* end LC_AgeWatchResults */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Evaluate the latest messages kept since the last sample         */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_EvaluateSnapshots(void) {
+    LC_MessageList_t *MessageLink;
+    CFE_SB_MsgPtr_t MessagePtr;
+    int32 MessageLinkIndex;
+
+    for (MessageLinkIndex = 0; MessageLinkIndex < LC_OperData.MessageIDsCount;
+         MessageLinkIndex++) {
+        MessageLink = &LC_OperData.MessageLinks[MessageLinkIndex];
+
+        if (MessageLink->SnapshotPending == true) {
+            MessagePtr = (CFE_SB_MsgPtr_t)&LC_OperData
+                             .SnapshotPool[MessageLink->SnapshotStart];
+
+            LC_EvaluateMessage(MessageLink, MessagePtr,
+                               MessageLink->SnapshotTime);
+
+            MessageLink->SnapshotPending = false;
+        }
+    }
+
+    return;
+
+} /* end LC_EvaluateSnapshots */
+
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                 */
+/* Set the results of MessageIDs that stopped arriving to stale    */
+/*                                                                 */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+void LC_CheckMessageAges(CFE_TIME_SysTime_t CurrentTime) {
+    LC_MessageList_t *MessageLink;
+    const LC_WatchEval_t *EvalPtr;
+    int32 MessageLinkIndex;
+    uint16 EvalCount;
+    uint16 WatchIndex;
+
+    for (MessageLinkIndex = 0; MessageLinkIndex < LC_OperData.MessageIDsCount;
+         MessageLinkIndex++) {
+        MessageLink = &LC_OperData.MessageLinks[MessageLinkIndex];
+
+        if ((MessageLink->StaleTimed == true) &&
+            (CFE_TIME_Compare(CurrentTime, MessageLink->StaleTime) ==
+             CFE_TIME_A_GT_B)) {
+            /*
+            ** All the watchpoints of a MessageID have contiguous
+            ** records, they go stale together
+            */
+            EvalPtr = &LC_OperData.WatchEvals[MessageLink->EvalStart];
+
+            for (EvalCount = 0; EvalCount < MessageLink->EvalCount;
+                 EvalCount++) {
+                WatchIndex = EvalPtr[EvalCount].WatchIndex;
+
+                LC_SetStaleCountdown(WatchIndex, 0);
+
+                if (LC_OperData.WatchResults[WatchIndex] != LC_WATCH_STALE) {
+                    LC_OperData.WatchResults[WatchIndex] = LC_WATCH_STALE;
+                    LC_MarkAPsDirty(WatchIndex);
+                }
+            }
+
+            MessageLink->StaleTimed = false;
+        }
+    }
+
+    return;
+
+} /* end LC_CheckMessageAges */
+
 /************************/
 /*  End of File Comment */
 /************************/
@@ -28,6 +28,29 @@
 #include "cfe.h"
 #include "lc_app.h"
 
+/*************************************************************************
+** Macro Definitions
+*************************************************************************/
+/*
+** Compilers known to provide __builtin_bswap16 and __builtin_bswap32.
+** Without them, data in the other byte order is extracted with
+** #LC_CopyBytesWithSwap.
+*/
+#if defined(__clang__) || \
+    (defined(__GNUC__) && ((__GNUC__ * 100 + __GNUC_MINOR__) >= 408))
+#define LC_HAVE_BSWAP_BUILTINS
+#endif
+
+/*
+** SIMD units the batch compare kernels have intrinsic versions for.
+** Define LC_NO_SIMD to build only the scalar loops.
+*/
+#if !defined(LC_NO_SIMD) && defined(__SSE2__)
+#define LC_HAVE_SSE2
+#elif !defined(LC_NO_SIMD) && defined(__ARM_NEON)
+#define LC_HAVE_NEON
+#endif
+
 /*************************************************************************
 ** Exported Functions
 *************************************************************************/
@@ -79,6 +102,10 @@ void LC_CheckMsgForWPs(CFE_SB_MsgId_t MessageID, CFE_SB_MsgPtr_t MessagePtr);
 *\endcode
 **  \retcode #LC_WDTVAL_ERR_FPINF    \retdesc \copydoc LC_WDTVAL_ERR_FPINF
 *\endcode
+**  \retcode #LC_WDTVAL_ERR_ARRAY    \retdesc \copydoc LC_WDTVAL_ERR_ARRAY
+*\endcode
+**  \retcode #LC_WDTVAL_ERR_MODE     \retdesc \copydoc LC_WDTVAL_ERR_MODE
+*\endcode
 **  \endreturns
 **
 **  \sa #LC_ValidateADT
@@ -86,6 +113,30 @@ void LC_CheckMsgForWPs(CFE_SB_MsgId_t MessageID, CFE_SB_MsgPtr_t MessagePtr);
 *************************************************************************/
 int32 LC_ValidateWDT(void *TableData);
 
+/************************************************************************/
+/** \brief Validate the array settings of a WDT entry
+**
+**  \par Description
+**       Support function for watchpoint definition table validation
+**       that checks the AggregateType, ElementCount, ElementStride and
+**       AggregateCount of an entry
+**
+**  \par Assumptions, External Events, and Notes:
+**       An entry with an AggregateType of #LC_AGGR_NONE is a single
+**       value watchpoint and always passes
+**
+**  \param [in]   WDTEntry   Pointer to the table entry to check
+**
+**  \returns
+**  \retstmt Returns true if the array settings are valid  \endcode
+**  \retstmt Returns false if the array settings are not valid \endcode
+**  \endreturns
+**
+**  \sa #LC_ValidateWDT
+**
+*************************************************************************/
+bool LC_WDTArrayIsValid(const LC_WDTEntry_t *WDTEntry);
+
 /************************************************************************/
 /** \brief Create watchpoint hash table
 **
@@ -93,11 +144,16 @@ int32 LC_ValidateWDT(void *TableData);
 **       Creates a hash table to optimize the process of getting direct
 **       access to all the watchpoint table entries that reference a
 **       particular MessageID without having to search the entire table.
+**       Each watchpoint is also compiled into an evaluation record and
+**       the records for each MessageID are stored contiguously, grouped
+**       into same-type batches, so a received message is processed by
+**       walking one flat array.
 **
 **  \par Assumptions, External Events, and Notes:
 **       None
 **
-**  \sa #LC_GetHashTableIndex, #LC_AddWatchpoint
+**  \sa #LC_GetHashTableIndex, #LC_AddWatchpoint, #LC_CompileWatchpoint,
+**      #LC_CreateBatches
 **
 *************************************************************************/
 void LC_CreateHashTable(void);
@@ -112,8 +168,8 @@ void LC_CreateHashTable(void);
 **  \par Assumptions, External Events, and Notes:
 **       None
 **
-**  \param [in]   WatchIndex  The watchpoint number to evaluate (zero
-**                            based watchpoint definition table index)
+**  \param [in]   EvalPtr     Pointer to the compiled evaluation record
+**                            of the watchpoint to evaluate
 **
 **  \param [in]   MessagePtr  A #CFE_SB_MsgPtr_t pointer that
 **                            references the software bus message that
@@ -124,22 +180,290 @@ void LC_CreateHashTable(void);
 **                            if a state transition is detected
 **
 *************************************************************************/
-void LC_ProcessWP(uint16 WatchIndex, CFE_SB_MsgPtr_t MessagePtr,
+void LC_ProcessWP(const LC_WatchEval_t *EvalPtr, CFE_SB_MsgPtr_t MessagePtr,
                   CFE_TIME_SysTime_t Timestamp);
 
+/************************************************************************/
+/** \brief Get masked watchpoint data
+**
+**  \par Description
+**       Support function for watchpoint processing that returns the
+**       watchpoint data after sizing, endian fixing and bit-masking.
+**       The data is extracted from the message and saved in the
+**       record's DatumValues slot, or, for a record that reuses the
+**       datum of an earlier record, read back from that slot.
+**
+**  \par Assumptions, External Events, and Notes:
+**       The records of a messageID must be evaluated in order so a
+**       shared datum is always extracted before it is reused
+**
+**  \param [in]   EvalPtr     Pointer to the compiled evaluation record
+**
+**  \param [in]   MessagePtr  A #CFE_SB_MsgPtr_t pointer that
+**                            references the software bus message that
+**                            contains the watchpoint data
+**
+**  \returns
+**  \retstmt The masked watchpoint data \endcode
+**  \endreturns
+**
+**  \sa #LC_ShareDatums
+**
+*************************************************************************/
+uint32 LC_GetMaskedWPData(const LC_WatchEval_t *EvalPtr,
+                          CFE_SB_MsgPtr_t MessagePtr);
+
+/************************************************************************/
+/** \brief Process a batch of watchpoints
+**
+**  \par Description
+**       Support function for watchpoint processing that will evaluate
+**       a batch of adjacent compiled watchpoints of the same comparison
+**       type and extraction kernel. The data of every watchpoint is
+**       gathered into lanes by #LC_GatherWPData, compared by one batch
+**       kernel and the results are then written back to the watchpoint
+**       results table.
+**
+**  \par Assumptions, External Events, and Notes:
+**       The message must be long enough to hold the data of every
+**       watchpoint in the batch. A lane that reports #LC_WATCH_ERROR
+**       is compared again by #LC_OperatorCompare to send the event.
+**
+**  \param [in]   EvalPtr     Pointer to the first compiled evaluation
+**                            record of the batch
+**
+**  \param [in]   BatchCount  Number of records in the batch, at most
+**                            #LC_BATCH_LANES
+**
+**  \param [in]   MessagePtr  A #CFE_SB_MsgPtr_t pointer that
+**                            references the software bus message that
+**                            contains the watchpoint data
+**
+**  \param [in]   Timestamp   A #CFE_TIME_SysTime_t timestamp to use
+**                            to update the watchpoint results data
+**                            if a state transition is detected
+**
+**  \sa #LC_CreateBatches
+**
+*************************************************************************/
+void LC_ProcessWPBatch(const LC_WatchEval_t *EvalPtr, uint8 BatchCount,
+                       CFE_SB_MsgPtr_t MessagePtr,
+                       CFE_TIME_SysTime_t Timestamp);
+
+/************************************************************************/
+/** \brief Process the watchpoints of a threshold ladder
+**
+**  \par Description
+**       Support function for watchpoint processing that will evaluate
+**       the rungs of a threshold ladder, adjacent compiled watchpoints
+**       that compare one integer datum against ascending comparison
+**       values. The datum is extracted once, two binary searches find
+**       the rungs it is above and below, and the result of each rung
+**       is then written to the watchpoint results table.
+**
+**  \par Assumptions, External Events, and Notes:
+**       The message must be long enough to hold the datum
+**
+**  \param [in]   EvalPtr     Pointer to the first compiled evaluation
+**                            record of the ladder
+**
+**  \param [in]   RungCount   Number of records in the ladder, at most
+**                            #LC_LADDER_MAX_RUNGS
+**
+**  \param [in]   MessagePtr  A #CFE_SB_MsgPtr_t pointer that
+**                            references the software bus message that
+**                            contains the watchpoint data
+**
+**  \param [in]   Timestamp   A #CFE_TIME_SysTime_t timestamp to use
+**                            to update the watchpoint results data
+**                            if a state transition is detected
+**
+**  \sa #LC_CreateLadders, #LC_GetLadderBound
+**
+*************************************************************************/
+void LC_ProcessWPLadder(const LC_WatchEval_t *EvalPtr, uint8 RungCount,
+                        CFE_SB_MsgPtr_t MessagePtr,
+                        CFE_TIME_SysTime_t Timestamp);
+
+/************************************************************************/
+/** \brief Search a threshold ladder
+**
+**  \par Description
+**       Support function for threshold ladder processing that returns
+**       how many of the ascending comparison values of a ladder are
+**       below the watchpoint datum, optionally counting those equal
+**       to it as well
+**
+**  \par Assumptions, External Events, and Notes:
+**       None
+**
+**  \param [in]  Thresholds    Ladder comparison values in ascending
+**                             order for the comparison type
+**
+**  \param [in]  RungCount     Number of comparison values
+**
+**  \param [in]  CompareType   #LC_EVAL_SIGNED or #LC_EVAL_UNSIGNED
+**
+**  \param [in]  WPValue       Normalized watchpoint data
+**
+**  \param [in]  IncludeEqual  Also count the values equal to the data
+**
+**  \returns
+**  \retstmt Index of the first comparison value that is greater than
+**           the data (or not less, if IncludeEqual is false) \endcode
+**  \endreturns
+**
+**  \sa #LC_ProcessWPLadder
+**
+*************************************************************************/
+uint8 LC_GetLadderBound(const LC_MultiType_t *Thresholds, uint8 RungCount,
+                        uint8 CompareType, LC_MultiType_t WPValue,
+                        bool IncludeEqual);
+
+/************************************************************************/
+/** \brief Process the watchpoints of a flag bank
+**
+**  \par Description
+**       Support function for watchpoint processing that will evaluate
+**       a flag bank, adjacent compiled watchpoints that each check one
+**       bit of the same word for equal or not equal. The word is loaded
+**       once, one XOR against the expected pattern and one AND with the
+**       care mask give every flag result, and the result of each flag
+**       is then written to the watchpoint results table.
+**
+**  \par Assumptions, External Events, and Notes:
+**       The message must be long enough to hold the word
+**
+**  \param [in]   EvalPtr     Pointer to the first compiled evaluation
+**                            record of the bank
+**
+**  \param [in]   FlagCount   Number of records in the bank
+**
+**  \param [in]   MessagePtr  A #CFE_SB_MsgPtr_t pointer that
+**                            references the software bus message that
+**                            contains the watchpoint data
+**
+**  \param [in]   Timestamp   A #CFE_TIME_SysTime_t timestamp to use
+**                            to update the watchpoint results data
+**                            if a state transition is detected
+**
+**  \sa #LC_CreateFlagBanks
+**
+*************************************************************************/
+void LC_ProcessWPFlagBank(const LC_WatchEval_t *EvalPtr, uint8 FlagCount,
+                          CFE_SB_MsgPtr_t MessagePtr,
+                          CFE_TIME_SysTime_t Timestamp);
+
+/************************************************************************/
+/** \brief Process an array watchpoint
+**
+**  \par Description
+**       Support function for watchpoint processing that will evaluate
+**       every element of an array watchpoint with the batch kernels,
+**       a lane buffer at a time, and reduce the element results to the
+**       watchpoint result. The result is true when at least the
+**       RequiredCount of the compiled record are true. When the record
+**       has element result words, the result of each element is also
+**       kept there, one bit per element.
+**
+**  \par Assumptions, External Events, and Notes:
+**       The message must be long enough to hold every element. If
+**       any element gives #LC_WATCH_ERROR the scan stops, that element
+**       is compared again by #LC_OperatorCompare to send the event and
+**       the watchpoint result is an error.
+**
+**  \param [in]   EvalPtr       Pointer to the compiled evaluation record
+**                              of the array watchpoint
+**
+**  \param [in]   WPDataPtr     Pointer to the first element in the
+**                              message
+**
+**  \param [out]  TrueCountPtr  Number of elements found true
+**
+**  \returns
+**  \retcode #LC_WATCH_TRUE  \retdesc \copydoc LC_WATCH_TRUE  \endcode
+**  \retcode #LC_WATCH_FALSE \retdesc \copydoc LC_WATCH_FALSE \endcode
+**  \retcode #LC_WATCH_ERROR \retdesc \copydoc LC_WATCH_ERROR \endcode
+**  \endreturns
+**
+*************************************************************************/
+uint8 LC_ProcessWPArray(const LC_WatchEval_t *EvalPtr, const uint8 *WPDataPtr,
+                        uint32 *TrueCountPtr);
+
+/************************************************************************/
+/** \brief Update watchpoint results
+**
+**  \par Description
+**       Support function for watchpoint processing that stores a new
+**       evaluation result in the watchpoint results table and updates
+**       the statistics and transition data of the watchpoint
+**
+**  \par Assumptions, External Events, and Notes:
+**       None
+**
+**  \param [in]   EvalPtr       Pointer to the compiled evaluation record
+**                              of the evaluated watchpoint
+**
+**  \param [in]   WPEvalResult  The evaluation result
+**
+**  \param [in]   MaskedWPData  The watchpoint data after sizing and
+**                              bit-masking, saved on a transition
+**
+**  \param [in]   Timestamp     A #CFE_TIME_SysTime_t timestamp to use
+**                              to update the watchpoint results data
+**                              if a state transition is detected
+**
+*************************************************************************/
+void LC_UpdateWPResult(const LC_WatchEval_t *EvalPtr, uint8 WPEvalResult,
+                       uint32 MaskedWPData, CFE_TIME_SysTime_t Timestamp);
+
+/************************************************************************/
+/** \brief Update the watch results in the WRT image
+**
+**  \par Description
+**       Copies the working watch result and stale countdown of every
+**       watchpoint into the watchpoint results table image, so a table
+**       dump or the critical data store sees the current results
+**
+**  \par Assumptions, External Events, and Notes:
+**       Evaluation only updates the working copy in LC_OperData. This
+**       is called at housekeeping time, before the WRT can be dumped,
+**       and before the WRT is saved to the critical data store.
+**
+**  \sa #LC_LoadWatchResults
+**
+*************************************************************************/
+void LC_SyncWRT(void);
+
+/************************************************************************/
+/** \brief Load the working watch results from the WRT image
+**
+**  \par Description
+**       Copies the watch result and stale countdown of every entry of
+**       the watchpoint results table image into the working copy that
+**       is used for evaluation
+**
+**  \par Assumptions, External Events, and Notes:
+**       Called after the WRT is restored from the critical data store
+**
+**  \sa #LC_SyncWRT
+**
+*************************************************************************/
+void LC_LoadWatchResults(void);
+
 /************************************************************************/
 /** \brief Operator comparison
 **
 **  \par Description
 **       Support function for watchpoint processing that will perform
 **       the watchpoint data comparison based upon the operator and
-**       data type specified in the watchpoint definition table
+**       comparison type decoded when the watchpoint was compiled
 **
 **  \par Assumptions, External Events, and Notes:
 **       None
 **
-**  \param [in] WatchIndex         The watchpoint number to compare (zero
-**                                 based watchpoint definition table index)
+**  \param [in] EvalPtr            Pointer to the compiled evaluation
+**                                 record of the watchpoint to compare
 **
 **  \param [in] ProcessedWPData    The watchpoint data extracted from
 **                                 the message that it was contained
@@ -156,7 +480,7 @@ void LC_ProcessWP(uint16 WatchIndex, CFE_SB_MsgPtr_t MessagePtr,
 **  \endreturns
 **
 *************************************************************************/
-uint8 LC_OperatorCompare(uint16 WatchIndex, uint32 ProcessedWPData);
+uint8 LC_OperatorCompare(const LC_WatchEval_t *EvalPtr, uint32 ProcessedWPData);
 
 /************************************************************************/
 /** \brief Signed comparison
@@ -167,10 +491,12 @@ uint8 LC_OperatorCompare(uint16 WatchIndex, uint32 ProcessedWPData);
 **       specified in the watchpoint definition table
 **
 **  \par Assumptions, External Events, and Notes:
-**       None
+**       The operator is tested as the AcceptMask that
+**       #LC_CompileWatchpoint built from it, against a single
+**       three-way comparison of the two values
 **
-**  \param [in] WatchIndex    The watchpoint number to compare (zero
-**                            based watchpoint definition table index)
+**  \param [in] EvalPtr       Pointer to the compiled evaluation
+**                            record of the watchpoint to compare
 **
 **  \param [in] WPValue       The watchpoint data extracted from
 **                            the message that it was contained
@@ -190,7 +516,8 @@ uint8 LC_OperatorCompare(uint16 WatchIndex, uint32 ProcessedWPData);
 **  \endreturns
 **
 *************************************************************************/
-uint8 LC_SignedCompare(uint16 WatchIndex, int32 WPValue, int32 CompareValue);
+uint8 LC_SignedCompare(const LC_WatchEval_t *EvalPtr, int32 WPValue,
+                       int32 CompareValue);
 
 /************************************************************************/
 /** \brief Unsigned comparison
@@ -201,10 +528,12 @@ uint8 LC_SignedCompare(uint16 WatchIndex, int32 WPValue, int32 CompareValue);
 **       specified in the watchpoint definition table
 **
 **  \par Assumptions, External Events, and Notes:
-**       None
+**       The operator is tested as the AcceptMask that
+**       #LC_CompileWatchpoint built from it, against a single
+**       three-way comparison of the two values
 **
-**  \param [in] WatchIndex    The watchpoint number to compare (zero
-**                            based watchpoint definition table index)
+**  \param [in] EvalPtr       Pointer to the compiled evaluation
+**                            record of the watchpoint to compare
 **
 **  \param [in] WPValue       The watchpoint data extracted from
 **                            the message that it was contained
@@ -224,7 +553,7 @@ uint8 LC_SignedCompare(uint16 WatchIndex, int32 WPValue, int32 CompareValue);
 **  \endreturns
 **
 *************************************************************************/
-uint8 LC_UnsignedCompare(uint16 WatchIndex, uint32 WPValue,
+uint8 LC_UnsignedCompare(const LC_WatchEval_t *EvalPtr, uint32 WPValue,
                          uint32 CompareValue);
 
 /************************************************************************/
@@ -236,10 +565,13 @@ uint8 LC_UnsignedCompare(uint16 WatchIndex, uint32 WPValue,
 **       specified in the watchpoint definition table
 **
 **  \par Assumptions, External Events, and Notes:
-**       None
+**       The operator is tested as the AcceptMask that
+**       #LC_CompileWatchpoint built from it. Values within
+**       #LC_FLOAT_TOLERANCE compare as equal for the EQ and NE
+**       operators only, the other operators compare exactly
 **
-**  \param [in] WatchIndex        The watchpoint number to compare (zero
-**                                based watchpoint definition table index)
+**  \param [in] EvalPtr           Pointer to the compiled evaluation
+**                                record of the watchpoint to compare
 **
 **  \param [in] WPMultiType       The watchpoint data extracted from
 **                                the message that it was contained
@@ -262,9 +594,132 @@ uint8 LC_UnsignedCompare(uint16 WatchIndex, uint32 WPValue,
 **  \endreturns
 **
 *************************************************************************/
-uint8 LC_FloatCompare(uint16 WatchIndex, LC_MultiType_t WPMultiType,
+uint8 LC_FloatCompare(const LC_WatchEval_t *EvalPtr,
+                      LC_MultiType_t WPMultiType,
                       LC_MultiType_t CompareMultiType);
 
+/************************************************************************/
+/** \brief Operator ID error
+**
+**  \par Description
+**       Support function for the comparison kernels that reports a
+**       watchpoint whose operator has no accept mask
+**
+**  \par Assumptions, External Events, and Notes:
+**       Table validation rejects such operators, so this is only
+**       reached if a table entry changes behind the compiled record
+**
+**  \param [in] EvalPtr       Pointer to the compiled evaluation
+**                            record of the watchpoint
+**
+**  \returns
+**  \retcode #LC_WATCH_ERROR \retdesc \copydoc LC_WATCH_ERROR \endcode
+**  \endreturns
+**
+**  \sa #LC_CompileWatchpoint
+**
+*************************************************************************/
+uint8 LC_OperatorIDError(const LC_WatchEval_t *EvalPtr);
+
+/************************************************************************/
+/** \brief Signed batch comparison
+**
+**  \par Description
+**       Support function for batch watchpoint processing that will
+**       compare each lane of signed integer watchpoint data against its
+**       comparison value and operator accept mask
+**
+**  \par Assumptions, External Events, and Notes:
+**       Four lanes at a time are compared with SSE2 or NEON intrinsics
+**       where #LC_HAVE_SSE2 or #LC_HAVE_NEON is defined. The other
+**       lanes, or all of them without a SIMD unit, are compared by a
+**       loop with no branches. Every accept mask must be non-zero.
+**
+**  \param [in]  WPValues       Normalized watchpoint data, one per lane
+**
+**  \param [in]  CompareValues  Widened comparison values, one per lane
+**
+**  \param [in]  AcceptMasks    Operator accept masks, one per lane
+**
+**  \param [out] WPEvalResults  Evaluation results, one per lane
+**
+**  \param [in]  BatchCount     Number of lanes in use
+**
+**  \sa #LC_ProcessWPBatch
+**
+*************************************************************************/
+void LC_SignedCompareBatch(const LC_MultiType_t *WPValues,
+                           const LC_MultiType_t *CompareValues,
+                           const uint8 *AcceptMasks, uint8 *WPEvalResults,
+                           uint32 BatchCount);
+
+/************************************************************************/
+/** \brief Unsigned batch comparison
+**
+**  \par Description
+**       Support function for batch watchpoint processing that will
+**       compare each lane of unsigned integer watchpoint data against its
+**       comparison value and operator accept mask
+**
+**  \par Assumptions, External Events, and Notes:
+**       Four lanes at a time are compared with SSE2 or NEON intrinsics
+**       where #LC_HAVE_SSE2 or #LC_HAVE_NEON is defined. The other
+**       lanes, or all of them without a SIMD unit, are compared by a
+**       loop with no branches. Every accept mask must be non-zero.
+**
+**  \param [in]  WPValues       Normalized watchpoint data, one per lane
+**
+**  \param [in]  CompareValues  Widened comparison values, one per lane
+**
+**  \param [in]  AcceptMasks    Operator accept masks, one per lane
+**
+**  \param [out] WPEvalResults  Evaluation results, one per lane
+**
+**  \param [in]  BatchCount     Number of lanes in use
+**
+**  \sa #LC_ProcessWPBatch
+**
+*************************************************************************/
+void LC_UnsignedCompareBatch(const LC_MultiType_t *WPValues,
+                             const LC_MultiType_t *CompareValues,
+                             const uint8 *AcceptMasks, uint8 *WPEvalResults,
+                             uint32 BatchCount);
+
+/************************************************************************/
+/** \brief Float batch comparison
+**
+**  \par Description
+**       Support function for batch watchpoint processing that will
+**       compare each lane of floating point watchpoint data against its
+**       comparison value and operator accept mask
+**
+**  \par Assumptions, External Events, and Notes:
+**       Matches #LC_FloatCompare, except that a NAN lane is only
+**       given a result of #LC_WATCH_ERROR and no event is sent
+**
+**       Four lanes at a time are compared with SSE2 intrinsics where
+**       #LC_HAVE_SSE2 is defined, or with NEON intrinsics on 64-bit ARM.
+**       32-bit ARM NEON flushes denormals to zero, so there the lanes
+**       are compared by the scalar loop like on targets without SIMD.
+**
+**  \param [in]  WPValues       Normalized watchpoint data, one per lane
+**
+**  \param [in]  CompareValues  Widened comparison values, one per lane
+**
+**  \param [in]  AcceptMasks    Operator accept masks, one per lane
+**
+**  \param [out] WPEvalResults  Evaluation results, one per lane
+**
+**  \param [in]  BatchCount     Number of lanes in use
+**
+**  \sa #LC_ProcessWPBatch
+**
+*************************************************************************/
+void LC_FloatCompareBatch(const LC_MultiType_t *WPValues,
+                          const LC_MultiType_t *CompareValues,
+                          const uint8 *AcceptMasks, uint8 *WPEvalResults,
+                          uint32 BatchCount);
+
 /************************************************************************/
 /** \brief Watchpoint offset valid
 **
@@ -274,129 +729,360 @@ uint8 LC_FloatCompare(uint16 WatchIndex, LC_MultiType_t WPMultiType,
 **       extend past the message that contains the watchpoint data
 **
 **  \par Assumptions, External Events, and Notes:
-**       None
+**       #LC_CheckMsgForWPs only calls this when the message is shorter
+**       than the MaxExtent of its messageID link, so a message of the
+**       expected length is checked once rather than once per watchpoint
 **
-**  \param [in]   WatchIndex  The watchpoint number to check (zero
-**                            based watchpoint definition table index)
+**  \param [in]   EvalPtr     Pointer to the compiled evaluation record
+**                            of the watchpoint to check
 **
 **  \param [in]   MessagePtr  A #CFE_SB_MsgPtr_t pointer that
 **                            references the software bus message that
 **                            contains the watchpoint data
 **
+**  \param [in]   MsgLength   Total length of the message in bytes
+**
 **  \returns
 **  \retstmt Returns TRUE if the offset is within the message size \endcode
 **  \retstmt Returns FALSE if the offset extends past message end  \endcode
 **  \endreturns
 **
 *************************************************************************/
-bool LC_WPOffsetValid(uint16 WatchIndex, CFE_SB_MsgPtr_t MessagePtr);
+bool LC_WPOffsetValid(const LC_WatchEval_t *EvalPtr,
+                      CFE_SB_MsgPtr_t MessagePtr, uint16 MsgLength);
 
 /************************************************************************/
 /** \brief Get sized data
 **
 **  \par Description
 **       Support function for watchpoint processing that will extract
-**       the watchpoint data from a software bus message based upon the
-**       data type specified in the watchpoint definition table and
-**       store it in a uint32. If there are any endian differences between
-**       LC and the watchpoint data, this is where it will get fixed up.
+**       the watchpoint data from a software bus message using the
+**       kernel (or byte map) and sign bit selected when the watchpoint
+**       was compiled and return it in a uint32. If there are any endian
+**       differences between LC and the watchpoint data, this is where
+**       it will get fixed up.
 **
 **  \par Assumptions, External Events, and Notes:
 **       None
 **
-**  \param [in]  WatchIndex     The watchpoint number to extract (zero
-**                              based watchpoint definition table index)
+**  \param [in]  EvalPtr        Pointer to the compiled evaluation record
+**                              of the watchpoint to extract
 **
 **  \param [in]  WPDataPtr      A pointer to the first byte of the
 **                              watchpoint data as it exists in the
 **                              software bus message it was received in
 **
-**  \param [in]  SizedDataPtr   A pointer to where the extracted watchpoint
-*                               data should be stored
-**
-**  \param [out] *SizedDataPtr  Contains the extracted watchpoint data.
-**                              This will be set to zero on error
-**
 **  \returns
-**  \retstmt Returns TRUE if no error           \endcode
-**  \retstmt Returns FALSE if an error occurred \endcode
+**  \retstmt Returns the watchpoint data, sign extended to 32 bits for
+**           signed data types \endcode
 **  \endreturns
 **
 *************************************************************************/
-bool LC_GetSizedWPData(uint16 WatchIndex, uint8 *WPDataPtr,
-                       uint32 *SizedDataPtr);
+uint32 LC_GetSizedWPData(const LC_WatchEval_t *EvalPtr,
+                         const uint8 *WPDataPtr);
 
 /************************************************************************/
-/** \brief Check uint32 for float NAN
+/** \brief Gather batch data
 **
 **  \par Description
-**       Utility function for watchpoint processing that will test if
-**       a uint32 value would result in a NAN (not-a-number) value if
-**       it was interpreted as a float.
+**       Support function for batch watchpoint processing that will
+**       extract one datum per lane from a software bus message, using
+**       one loop for the extraction kernel of the batch
 **
 **  \par Assumptions, External Events, and Notes:
-**       None
+**       Every lane must have the same extraction kernel as EvalPtr (see
+**       #LC_GetBatchKey). The data is zero extended, the caller applies
+**       the sign bit and bitmask of each lane.
 **
-**  \param [in]  Data     The uint32 value to check
+**  \param [in]  EvalPtr        Pointer to the compiled evaluation record
+**                              of the first lane
 **
-**  \returns
-**  \retstmt Returns TRUE if value is a float NAN      \endcode
-**  \retstmt Returns FALSE if value is not a float NAN \endcode
-**  \endreturns
+**  \param [in]  BasePtr        Pointer the lane offsets are added to
+**
+**  \param [in]  Offsets        Byte offset of each lane datum
+**
+**  \param [out] RawData        Extracted data, one per lane
+**
+**  \param [in]  LaneCount      Number of lanes in use
+**
+**  \sa #LC_ProcessWPBatch, #LC_ProcessWPArray
 **
 *************************************************************************/
-bool LC_Uint32IsNAN(uint32 Data);
+void LC_GatherWPData(const LC_WatchEval_t *EvalPtr, const uint8 *BasePtr,
+                     const uint32 *Offsets, uint32 *RawData,
+                     uint32 LaneCount);
 
 /************************************************************************/
-/** \brief Check uint32 for float infinite
+/** \brief Extract an 8 bit datum
 **
 **  \par Description
-**       Utility function for watchpoint processing that will test if
-**       a uint32 value would result in an infinite value if
-**       it was interpreted as a float.
+**       Extraction kernel for byte sized watchpoint data
 **
 **  \par Assumptions, External Events, and Notes:
 **       None
 **
-**  \param [in]  Data     The uint32 value to check
+**  \param [in]  WPDataPtr      A pointer to the watchpoint data in the
+**                              software bus message
 **
 **  \returns
-**  \retstmt Returns TRUE if value is an inifinite float      \endcode
-**  \retstmt Returns FALSE if value is not an inifinite float \endcode
+**  \retstmt Returns the datum zero extended to 32 bits \endcode
 **  \endreturns
 **
+**  \sa #LC_CompileWatchpoint
+**
 *************************************************************************/
-bool LC_Uint32IsInfinite(uint32 Data);
+uint32 LC_ExtractUint8(const uint8 *WPDataPtr);
 
 /************************************************************************/
-/** \brief Convert messageID into hash table index
+/** \brief Extract a 16 bit datum in host byte order
 **
 **  \par Description
-**       Utility function for watchpoint processing that converts a
-**       messageID into an index into the watchpoint hash table.
+**       Extraction kernel for 16 bit watchpoint data that is in the
+**       same byte order as the host. This is a single (possibly
+**       misaligned) load.
 **
-**       The following code supports use of the watchpoint hash table:
+**  \par Assumptions, External Events, and Notes:
+**       None
 **
-**       1) #LC_GetHashTableIndex - convert messageID to hash table index
-**       2) #LC_CreateHashTable   - after load Watchpoint Definition Table
-**       3) #LC_AddWatchpoint     - add one watchpoint to hash table
-**       4) #LC_CheckMsgForWPs    - process all WP's that reference messageID
+**  \param [in]  WPDataPtr      A pointer to the watchpoint data in the
+**                              software bus message
+**
+**  \returns
+**  \retstmt Returns the datum zero extended to 32 bits \endcode
+**  \endreturns
+**
+**  \sa #LC_CompileWatchpoint
+**
+*************************************************************************/
+uint32 LC_ExtractNative16(const uint8 *WPDataPtr);
+
+/************************************************************************/
+/** \brief Extract a 32 bit datum in host byte order
+**
+**  \par Description
+**       Extraction kernel for 32 bit watchpoint data that is in the
+**       same byte order as the host. This is a single (possibly
+**       misaligned) load.
+**
+**  \par Assumptions, External Events, and Notes:
+**       None
+**
+**  \param [in]  WPDataPtr      A pointer to the watchpoint data in the
+**                              software bus message
+**
+**  \returns
+**  \retstmt Returns the datum \endcode
+**  \endreturns
+**
+**  \sa #LC_CompileWatchpoint
+**
+*************************************************************************/
+uint32 LC_ExtractNative32(const uint8 *WPDataPtr);
+
+#ifdef LC_HAVE_BSWAP_BUILTINS
+/************************************************************************/
+/** \brief Extract a 16 bit datum in the other byte order
+**
+**  \par Description
+**       Extraction kernel for 16 bit watchpoint data that is in the
+**       opposite byte order to the host. This is a load followed by
+**       the compiler byte swap builtin.
+**
+**  \par Assumptions, External Events, and Notes:
+**       Only available when #LC_HAVE_BSWAP_BUILTINS is defined
+**
+**  \param [in]  WPDataPtr      A pointer to the watchpoint data in the
+**                              software bus message
+**
+**  \returns
+**  \retstmt Returns the datum zero extended to 32 bits \endcode
+**  \endreturns
+**
+**  \sa #LC_CompileWatchpoint
+**
+*************************************************************************/
+uint32 LC_ExtractSwapped16(const uint8 *WPDataPtr);
+
+/************************************************************************/
+/** \brief Extract a 32 bit datum in the other byte order
+**
+**  \par Description
+**       Extraction kernel for 32 bit watchpoint data that is in the
+**       opposite byte order to the host. This is a load followed by
+**       the compiler byte swap builtin.
+**
+**  \par Assumptions, External Events, and Notes:
+**       Only available when #LC_HAVE_BSWAP_BUILTINS is defined
+**
+**  \param [in]  WPDataPtr      A pointer to the watchpoint data in the
+**                              software bus message
+**
+**  \returns
+**  \retstmt Returns the datum \endcode
+**  \endreturns
+**
+**  \sa #LC_CompileWatchpoint
+**
+*************************************************************************/
+uint32 LC_ExtractSwapped32(const uint8 *WPDataPtr);
+#endif
+
+/************************************************************************/
+/** \brief Compile a watchpoint
+**
+**  \par Description
+**       Utility function for hash table creation that decodes one
+**       watchpoint definition table entry into an evaluation record:
+**       the datum size, the kernel (or byte map) used to extract it,
+**       its sign bit and width mask, the comparison family and the
+**       comparison value widened to 32 bits. This is done once per
+**       table load so none of it has to be repeated for every
+**       received message.
+**
+**  \par Assumptions, External Events, and Notes:
+**       An undefined data type leaves the record with a comparison
+**       type of #LC_EVAL_UNDEFINED, which #LC_OperatorCompare reports
+**       as an error
+**
+**  \param [in]  WatchIndex     The watchpoint number to compile (zero
+**                              based watchpoint definition table index)
+**
+**  \param [in]  EvalPtr        Pointer to the evaluation record to fill
+**
+**  \sa #LC_CreateHashTable
+**
+*************************************************************************/
+void LC_CompileWatchpoint(uint16 WatchIndex, LC_WatchEval_t *EvalPtr);
+
+/************************************************************************/
+/** \brief Check uint32 for float NAN
+**
+**  \par Description
+**       Utility function for watchpoint processing that will test if
+**       a uint32 value would result in a NAN (not-a-number) value if
+**       it was interpreted as a float.
+**
+**  \par Assumptions, External Events, and Notes:
+**       None
+**
+**  \param [in]  Data     The uint32 value to check
+**
+**  \returns
+**  \retstmt Returns TRUE if value is a float NAN      \endcode
+**  \retstmt Returns FALSE if value is not a float NAN \endcode
+**  \endreturns
+**
+*************************************************************************/
+bool LC_Uint32IsNAN(uint32 Data);
+
+/************************************************************************/
+/** \brief Check uint32 for float infinite
+**
+**  \par Description
+**       Utility function for watchpoint processing that will test if
+**       a uint32 value would result in an infinite value if
+**       it was interpreted as a float.
+**
+**  \par Assumptions, External Events, and Notes:
+**       None
+**
+**  \param [in]  Data     The uint32 value to check
+**
+**  \returns
+**  \retstmt Returns TRUE if value is an inifinite float      \endcode
+**  \retstmt Returns FALSE if value is not an inifinite float \endcode
+**  \endreturns
+**
+*************************************************************************/
+bool LC_Uint32IsInfinite(uint32 Data);
+
+/************************************************************************/
+/** \brief Hash a messageID
+**
+**  \par Description
+**       Utility function for watchpoint processing that multiplies a
+**       messageID by an odd multiplier and keeps the top bits of the
+**       32 bit product. Each multiplier gives a different hash
+**       function.
+**
+**  \par Assumptions, External Events, and Notes:
+**       None
+**
+**  \param [in]  MessageID   SoftwareBus packet message ID
+**
+**  \param [in]  Multiplier  Odd hash multiplier
+**
+**  \param [in]  Bits        Number of hash bits wanted, 0 to 32
+**
+**  \returns
+**  \retstmt Returns the hash value, 0 when Bits is 0 \endcode
+**  \endreturns
+**
+**  \sa #LC_GetHashTableIndex, #LC_GetHashSlotIndex
+**
+*************************************************************************/
+uint32 LC_HashMessageID(CFE_SB_MsgId_t MessageID, uint32 Multiplier,
+                        uint8 Bits);
+
+/************************************************************************/
+/** \brief Get a hash multiplier
+**
+**  \par Description
+**       Utility function for perfect hash creation that returns the
+**       odd multiplier to use on a given try. The tries below
+**       #LC_HASH_MULTIPLIER_COUNT give every odd 32 bit value once.
+**
+**  \par Assumptions, External Events, and Notes:
+**       None
+**
+**  \param [in]  Try         Number of the try, starting at 0
+**
+**  \returns
+**  \retstmt Returns the odd hash multiplier \endcode
+**  \endreturns
+**
+**  \sa #LC_CreatePerfectHash
+**
+*************************************************************************/
+uint32 LC_GetHashMultiplier(uint32 Try);
+
+/************************************************************************/
+/** \brief Convert messageID into hash table index
+**
+**  \par Description
+**       Utility function for watchpoint processing that converts a
+**       messageID into an index into the watchpoint hash table, using
+**       the multiplier picked by #LC_CreatePerfectHash. All bits of the
+**       messageID are used, so this also works for cFE builds with 32
+**       bit messageID's.
+**
+**       The following code supports use of the watchpoint hash table:
+**
+**       1) #LC_GetHashTableIndex - convert messageID to hash table index
+**       2) #LC_CreateHashTable   - after load Watchpoint Definition Table
+**       3) #LC_AddWatchpoint     - add one watchpoint to hash table
+**       4) #LC_CreatePerfectHash - build a second level table per entry
+**       5) #LC_CheckMsgForWPs    - process all WP's that reference messageID
 **
 **       The following data structures support the hash table:
 **
-**       1) Hash table (256 entries)
-**       2) Array of links for messageID linked lists (LC_MAX_WATCHPOINTS)
-**       3) Array of links for watchpoint linked lists (LC_MAX_WATCHPOINTS)
+**       1) Hash table (#LC_HASH_TABLE_ENTRIES entries) and a second
+**          level table for each
+**       2) Perfect hash slots (#LC_HASH_SLOT_ENTRIES)
+**       3) Array of links for messageID linked lists (LC_MAX_WATCHPOINTS)
+**       4) Array of compiled watchpoints, contiguous per messageID
+**          (LC_MAX_WATCHPOINTS)
 **
 **       Rather than search the entire Watchpoint Definition Table to find
 **       the watchpoints that reference a particular messageID, LC does
 **       the following:
 **
 **       1) Call hash table function (convert messageID to hash table index)
-**       2) Get messageID linked list from indexed hash table entry
-**       3) Search messageID list (max 8) for matching messageID
-**       4) Get watchpoint linked list from matching messageID link
-**       5) Done - only watchpoints that reference messageID are in list
+**       2) Hash messageID again with the multiplier of that entry's
+**          second level table
+**       3) Compare the messageID in the one slot this selects
+**       4) Get compiled watchpoint range from matching messageID link
+**       5) Done - only watchpoints that reference messageID are in range
 **
 **  \par Assumptions, External Events, and Notes:
 **       None
@@ -411,38 +1097,342 @@ bool LC_Uint32IsInfinite(uint32 Data);
 uint32 LC_GetHashTableIndex(CFE_SB_MsgId_t MessageID);
 
 /************************************************************************/
-/** \brief Add one watchpoint linked list entry during creation of hash table
+/** \brief Convert messageID into perfect hash slot index
+**
+**  \par Description
+**       Utility function for watchpoint processing that converts a
+**       messageID into an index into the perfect hash slots, using the
+**       second level table built for its hash table entry by
+**       #LC_CreatePerfectHash
+**
+**  \par Assumptions, External Events, and Notes:
+**       None
+**
+**  \param [in]  MessageID   SoftwareBus packet message ID
+**
+**  \returns
+**  \retstmt Returns index into the perfect hash slots \endcode
+**  \endreturns
+**
+*************************************************************************/
+uint32 LC_GetHashSlotIndex(CFE_SB_MsgId_t MessageID);
+
+/************************************************************************/
+/** \brief Create the perfect hash for the watched messageID's
+**
+**  \par Description
+**       Utility function for hash table creation that builds a two
+**       level perfect hash of the watched messageID's. A hash table
+**       multiplier is picked that keeps the sum of the squared list
+**       lengths small, and the lists are rebuilt for it. Each list of
+**       k messageID's then gets its own range of at least 2k^2 perfect
+**       hash slots and a multiplier that sends every messageID in the
+**       list to a different one of them. After this a messageID lookup
+**       is a single slot compare no matter how the watched messageID's
+**       are clustered.
+**
+**  \par Assumptions, External Events, and Notes:
+**       Some odd multiplier meets the first requirement and at least
+**       half meet the second, so both searches always succeed, normally
+**       on the first or second try. The hash table has at least twice
+**       as many entries as there can be messageID's, so the slots used
+**       never exceed #LC_HASH_SLOT_ENTRIES
+**
+**  \sa #LC_CreateHashTable, #LC_FindMessageLink
+**
+*************************************************************************/
+void LC_CreatePerfectHash(void);
+
+/************************************************************************/
+/** \brief Group the compiled watchpoints of a messageID into batches
+**
+**  \par Description
+**       Utility function for hash table creation that reorders the
+**       compiled watchpoints of one messageID so those with the same
+**       batch key are adjacent, finds the threshold ladders among them
+**       and then sets the BatchCount of every record. Runs longer than
+**       #LC_BATCH_LANES are split into several batches. The comparison
+**       values of the ladder rungs are copied to LadderThresholds.
+**
+**  \par Assumptions, External Events, and Notes:
+**       Records that can't be batched get a BatchCount of 1 and are
+**       evaluated by #LC_ProcessWP as before
+**
+**  \param [in]  MessageLink   Pointer to the messageID link whose
+**                             records are grouped
+**
+**  \sa #LC_GetBatchKey, #LC_ProcessWPBatch, #LC_CreateLadders
+**
+*************************************************************************/
+void LC_CreateBatches(LC_MessageList_t *MessageLink);
+
+/************************************************************************/
+/** \brief Sort compiled watchpoints by batch key
+**
+**  \par Description
+**       Utility function for hash table creation that reorders the
+**       compiled watchpoints of one messageID so those with the same
+**       batch key are adjacent
+**
+**  \par Assumptions, External Events, and Notes:
+**       The sort is stable, records with the same key keep their order
+**
+**  \param [in]  MessageLink   Pointer to the messageID link whose
+**                             records are sorted
+**
+**  \sa #LC_CreateBatches
+**
+*************************************************************************/
+void LC_SortByBatchKey(LC_MessageList_t *MessageLink);
+
+/************************************************************************/
+/** \brief Find the threshold ladders of a messageID
+**
+**  \par Description
+**       Utility function for hash table creation that orders the
+**       signed and unsigned integer watchpoints of one messageID by
+**       datum and comparison value. Every run of at least
+**       #LC_LADDER_MIN_RUNGS watchpoints on the same datum becomes a
+**       threshold ladder, and each rung gets its RungCount.
+**
+**  \par Assumptions, External Events, and Notes:
+**       The records must already be sorted by batch key. Rungs get a
+**       batch key of #LC_EVAL_UNDEFINED, so the records must be sorted
+**       by key again before batches are counted.
+**
+**  \param [in]  MessageLink   Pointer to the messageID link whose
+**                             records are checked
+**
+**  \sa #LC_CreateBatches, #LC_ProcessWPLadder
+**
+*************************************************************************/
+void LC_CreateLadders(LC_MessageList_t *MessageLink);
+
+/************************************************************************/
+/** \brief Compare the ladder order of two compiled watchpoints
+**
+**  \par Description
+**       Utility function for threshold ladder creation that orders two
+**       integer watchpoints of the same batch key by offset, data type,
+**       bitmask and then comparison value
+**
+**  \par Assumptions, External Events, and Notes:
+**       Watchpoints of different batch keys, or of a key that can't be
+**       a ladder, compare as equal so a stable sort leaves them alone
+**
+**  \param [in]  FirstPtr    Pointer to the first evaluation record
+**
+**  \param [in]  SecondPtr   Pointer to the second evaluation record
+**
+**  \returns
+**  \retstmt Less than, equal to or greater than zero as the first
+**           record is ordered before, with or after the second \endcode
+**  \endreturns
+**
+*************************************************************************/
+int32 LC_CompareRungs(const LC_WatchEval_t *FirstPtr,
+                      const LC_WatchEval_t *SecondPtr);
+
+/************************************************************************/
+/** \brief Find the flag banks of a messageID
+**
+**  \par Description
+**       Utility function for hash table creation that moves the single
+**       bit checks of one messageID ahead of the other records of their
+**       comparison type and orders them by word and bit. Every run of
+**       at least #LC_FLAG_BANK_MIN_FLAGS checks of different bits of the
+**       same word becomes a flag bank, and each flag gets its FlagCount.
+**
+**  \par Assumptions, External Events, and Notes:
+**       The records must already be sorted by batch key. Flags get a
+**       batch key of #LC_EVAL_UNDEFINED, so the records must be sorted
+**       by key again before batches are counted.
+**
+**  \param [in]  MessageLink   Pointer to the messageID link whose
+**                             records are checked
+**
+**  \sa #LC_CreateBatches, #LC_IsFlagCheck, #LC_ProcessWPFlagBank
+**
+*************************************************************************/
+void LC_CreateFlagBanks(LC_MessageList_t *MessageLink);
+
+/************************************************************************/
+/** \brief Compare the flag bank order of two compiled watchpoints
+**
+**  \par Description
+**       Utility function for flag bank creation that orders the single
+**       bit checks of a batch key ahead of its other watchpoints, and
+**       orders the checks by offset, data type and then bitmask
+**
+**  \par Assumptions, External Events, and Notes:
+**       Watchpoints of different batch keys, or two that are not single
+**       bit checks, compare as equal so a stable sort leaves them alone
+**
+**  \param [in]  FirstPtr    Pointer to the first evaluation record
+**
+**  \param [in]  SecondPtr   Pointer to the second evaluation record
+**
+**  \returns
+**  \retstmt Less than, equal to or greater than zero as the first
+**           record is ordered before, with or after the second \endcode
+**  \endreturns
+**
+*************************************************************************/
+int32 LC_CompareFlags(const LC_WatchEval_t *FirstPtr,
+                      const LC_WatchEval_t *SecondPtr);
+
+/************************************************************************/
+/** \brief Check if a compiled watchpoint is a single bit check
+**
+**  \par Description
+**       Utility function that checks whether an integer watchpoint
+**       compares one bit of its data for equal or not equal, so its
+**       result depends on that bit alone
+**
+**  \par Assumptions, External Events, and Notes:
+**       The comparison value must be zero or the bit itself
+**
+**  \param [in]  EvalPtr   Pointer to the compiled evaluation record
+**
+**  \returns
+**  \retstmt Returns true if the watchpoint checks a single bit  \endcode
+**  \retstmt Returns false if it does not                        \endcode
+**  \endreturns
+**
+*************************************************************************/
+bool LC_IsFlagCheck(const LC_WatchEval_t *EvalPtr);
+
+/************************************************************************/
+/** \brief Set the flag bank masks of a compiled watchpoint
+**
+**  \par Description
+**       Utility function for flag bank creation that merges the bit of
+**       one flag into the care mask and expected pattern of the flags
+**       that follow it in the bank
+**
+**  \par Assumptions, External Events, and Notes:
+**       The flags of a bank must be set from the last one back to the
+**       first
+**
+**  \param [in]  EvalPtr     Pointer to the compiled evaluation record
+**
+**  \param [in]  EvalIndex   Index of the record in WatchEvals
+**
+**  \sa #LC_CreateBatches
+**
+*************************************************************************/
+void LC_SetFlagBank(const LC_WatchEval_t *EvalPtr, uint16 EvalIndex);
+
+/************************************************************************/
+/** \brief Get the batch key of a compiled watchpoint
+**
+**  \par Description
+**       Utility function that returns the key used to group compiled
+**       watchpoints into batches. Watchpoints with the same key can be
+**       gathered by one typed loop and compared together by one batch
+**       kernel.
+**
+**  \par Assumptions, External Events, and Notes:
+**       None
+**
+**  \param [in]  EvalPtr   Pointer to the compiled evaluation record
+**
+**  \returns
+**  \retstmt The extraction kernel and comparison type of the watchpoint
+**           (see #LC_BATCH_KEY_TYPE), or #LC_EVAL_UNDEFINED if it has a
+**           custom function or an invalid operator \endcode
+**  \endreturns
+**
+*************************************************************************/
+uint8 LC_GetBatchKey(const LC_WatchEval_t *EvalPtr);
+
+/************************************************************************/
+/** \brief Share data extractions between compiled watchpoints
 **
 **  \par Description
-**       Utility function that adds another link to the watchpoint linked list
-**       for the specified messageID. The function will also add a messageID
+**       Utility function for hash table creation that gives every
+**       compiled watchpoint of one messageID a slot in DatumValues.
+**       A watchpoint that reads the same offset, data type and bitmask
+**       as an earlier watchpoint of the messageID is set to reuse that
+**       watchpoint's slot instead of extracting the data again.
+**
+**  \par Assumptions, External Events, and Notes:
+**       Must be called after #LC_CreateBatches, since the slots are
+**       the final positions of the records in WatchEvals
+**
+**  \param [in]  MessageLink   Pointer to the messageID link whose
+**                             records are checked
+**
+**  \returns
+**  \retstmt The number of watchpoints that reuse extracted data \endcode
+**  \endreturns
+**
+**  \sa #LC_GetMaskedWPData
+**
+*************************************************************************/
+uint16 LC_ShareDatums(LC_MessageList_t *MessageLink);
+
+/************************************************************************/
+/** \brief Check if two compiled watchpoints read the same datum
+**
+**  \par Description
+**       Utility function that checks whether two compiled watchpoints
+**       have the same offset, data type and bitmask
+**
+**  \par Assumptions, External Events, and Notes:
+**       The messageID is not checked
+**
+**  \param [in]  FirstPtr    Pointer to the first evaluation record
+**
+**  \param [in]  SecondPtr   Pointer to the second evaluation record
+**
+**  \returns
+**  \retstmt Returns true if both read the same datum   \endcode
+**  \retstmt Returns false if they read different data  \endcode
+**  \endreturns
+**
+*************************************************************************/
+bool LC_SameDatum(const LC_WatchEval_t *FirstPtr,
+                  const LC_WatchEval_t *SecondPtr);
+
+/************************************************************************/
+/** \brief Add one watchpoint reference during creation of hash table
+**
+**  \par Description
+**       Utility function that counts one more watchpoint reference for
+**       the specified messageID. The function will also add a messageID
 **       linked list entry to the hash table if this is the first reference
 **       to that messageID. The function will also subscribe to the messageID
 **       if this is the first reference to that messageID. The function will
-**       return a pointer to the watchpoint linked list entry just added.
+**       return a pointer to the messageID linked list entry.
 **
 **       The following code supports use of the watchpoint hash table:
 **
 **       1) #LC_GetHashTableIndex - convert messageID to hash table index
 **       2) #LC_CreateHashTable   - after load Watchpoint Definition Table
 **       3) #LC_AddWatchpoint     - add one watchpoint to hash table
-**       4) #LC_CheckMsgForWPs    - process all WP's that reference messageID
+**       4) #LC_CreatePerfectHash - build a second level table per entry
+**       5) #LC_CheckMsgForWPs    - process all WP's that reference messageID
 **
 **       The following data structures support the hash table:
 **
-**       1) Hash table (256 entries)
-**       2) Array of links for messageID linked lists (LC_MAX_WATCHPOINTS)
-**       3) Array of links for watchpoint linked lists (LC_MAX_WATCHPOINTS)
+**       1) Hash table (#LC_HASH_TABLE_ENTRIES entries) and a second
+**          level table for each
+**       2) Perfect hash slots (#LC_HASH_SLOT_ENTRIES)
+**       3) Array of links for messageID linked lists (LC_MAX_WATCHPOINTS)
+**       4) Array of compiled watchpoints, contiguous per messageID
+**          (LC_MAX_WATCHPOINTS)
 **
 **       Rather than search the entire Watchpoint Definition Table to find
 **       the watchpoints that reference a particular messageID, LC does
 **       the following:
 **
 **       1) Call hash table function (convert messageID to hash table index)
-**       2) Get messageID linked list from indexed hash table entry
-**       3) Search messageID list (max 8) for matching messageID
-**       4) Get watchpoint linked list from matching messageID link
-**       5) Done - only watchpoints that reference messageID are in list
+**       2) Hash messageID again with the multiplier of that entry's
+**          second level table
+**       3) Compare the messageID in the one slot this selects
+**       4) Get compiled watchpoint range from matching messageID link
+**       5) Done - only watchpoints that reference messageID are in range
 **
 **  \par Assumptions, External Events, and Notes:
 **       None
@@ -450,12 +1440,255 @@ uint32 LC_GetHashTableIndex(CFE_SB_MsgId_t MessageID);
 **  \param [in]  MessageID   SoftwareBus packet message ID
 **
 **  \returns
-**  \retstmt Returns pointer to the watchpoint linked list entry just added
-*\endcode
+**  \retstmt Returns pointer to the messageID linked list entry \endcode
+**  \endreturns
+**
+*************************************************************************/
+LC_MessageList_t *LC_AddWatchpoint(CFE_SB_MsgId_t MessageID);
+
+/************************************************************************/
+/** \brief Find the hash table link for a messageID
+**
+**  \par Description
+**       Utility function that finds the messageID linked list entry
+**       created by #LC_AddWatchpoint with a single probe of the perfect
+**       hash slots.
+**
+**  \par Assumptions, External Events, and Notes:
+**       None
+**
+**  \param [in]  MessageID   SoftwareBus packet message ID
+**
+**  \returns
+**  \retstmt Returns pointer to the messageID linked list entry or NULL
+**           if no watchpoint references the messageID \endcode
 **  \endreturns
 **
+**  \sa #LC_AddWatchpoint, #LC_CheckMsgForWPs
+**
+*************************************************************************/
+LC_MessageList_t *LC_FindMessageLink(CFE_SB_MsgId_t MessageID);
+
+/************************************************************************/
+/** \brief Set the stale countdown of a watch result
+**
+**  \par Description
+**       Starts, restarts or stops the countdown to when a watch result
+**       goes stale by filing the watchpoint in the slot of the stale
+**       timer wheel its deadline falls in
+**
+**  \par Assumptions, External Events, and Notes:
+**       A countdown of zero stops the countdown
+**
+**  \param [in]  WatchIndex   The watchpoint number (zero based
+**                            watchpoint definition table index)
+**
+**  \param [in]  Countdown    Number of actionpoint samples that age the
+**                            watch results before it goes stale
+**
+**  \sa #LC_GetStaleCountdown, #LC_AgeWatchResults
+**
+*************************************************************************/
+void LC_SetStaleCountdown(uint16 WatchIndex, uint32 Countdown);
+
+/************************************************************************/
+/** \brief Get the stale countdown of a watch result
+**
+**  \par Description
+**       Returns the number of actionpoint samples that age the watch
+**       results before the watch result goes stale
+**
+**  \par Assumptions, External Events, and Notes:
+**       None
+**
+**  \param [in]  WatchIndex   The watchpoint number (zero based
+**                            watchpoint definition table index)
+**
+**  \returns
+**  \retstmt Returns the remaining countdown, zero if none \endcode
+**  \endreturns
+**
+**  \sa #LC_SetStaleCountdown
+**
+*************************************************************************/
+uint32 LC_GetStaleCountdown(uint16 WatchIndex);
+
+/************************************************************************/
+/** \brief Age the watch results
+**
+**  \par Description
+**       Advances the stale timer wheel by one tick and sets the watch
+**       results whose countdown runs out on this tick to stale
+**
+**  \par Assumptions, External Events, and Notes:
+**       Called for actionpoint sample requests that ask for the watch
+**       results to be aged. Only the watchpoints filed in the slot of
+**       the new tick are visited, so the cost doesn't depend on the
+**       number of watchpoints
+**
+**  \sa #LC_SetStaleCountdown
+**
+*************************************************************************/
+void LC_AgeWatchResults(void);
+
+/************************************************************************/
+/** \brief Evaluate the watchpoints of a message
+**
+**  \par Description
+**       Evaluates every watchpoint of a MessageID against a message
+**       with that MessageID and updates their results
+**
+**  \par Assumptions, External Events, and Notes:
+**       Called by #LC_CheckMsgForWPs as a message arrives, or by
+**       #LC_EvaluateSnapshots with the copy kept of the latest message.
+**       When the watched bytes match those of the message the results
+**       came from, only the statistics are updated.
+**
+**  \param [in]  MessageList  Pointer to the link for the MessageID
+**
+**  \param [in]  MessagePtr   A #CFE_SB_MsgPtr_t pointer that
+**                            references the message
+**
+**  \param [in]  Timestamp    Time stamp of the message
+**
+*************************************************************************/
+void LC_EvaluateMessage(LC_MessageList_t *MessageList,
+                        CFE_SB_MsgPtr_t MessagePtr,
+                        CFE_TIME_SysTime_t Timestamp);
+
+/************************************************************************/
+/** \brief Evaluate latest messages
+**
+**  \par Description
+**       Evaluates the watchpoints of each MessageID that uses
+**       #LC_MONITOR_LATEST against the latest message kept for it,
+**       if one has arrived since the last time
+**
+**  \par Assumptions, External Events, and Notes:
+**       Called for actionpoint sample requests before the actionpoints
+**       are sampled. The results and statistics are those of the one
+**       message, those that arrived before it are never evaluated.
+**
+**  \sa #LC_CheckMsgForWPs
+**
+*************************************************************************/
+void LC_EvaluateSnapshots(void);
+
+/************************************************************************/
+/** \brief Check the age of timed messages
+**
+**  \par Description
+**       Sets the results of every watchpoint on a MessageID with a
+**       #LC_WDTEntry_t MessagePeriod to stale when no message with the
+**       MessageID has arrived for longer than the period
+**
+**  \par Assumptions, External Events, and Notes:
+**       Called for actionpoint sample requests before the actionpoints
+**       are sampled. The period runs from when LC received the last
+**       message, by the same clock as CurrentTime, or from the table
+**       load when none has arrived since.
+**       Once the results are stale they aren't checked again until the
+**       next message arrives.
+**
+**  \param [in]  CurrentTime  The current spacecraft time
+**
+**  \sa #LC_CheckMsgForWPs
+**
+*************************************************************************/
+void LC_CheckMessageAges(CFE_TIME_SysTime_t CurrentTime);
+
+/************************************************************************/
+/** \brief Create a message fingerprint
+**
+**  \par Description
+**       Utility function for hash table creation that gathers the byte
+**       ranges read by the compiled watchpoints of one messageID,
+**       sorted by offset with overlapping and nearby ranges merged, and
+**       sets aside words in FingerprintPool to keep those bytes
+**
+**  \par Assumptions, External Events, and Notes:
+**       A messageID with a custom function watchpoint, or one with an
+**       invalid data type, gets no fingerprint since it has to be
+**       evaluated in full on every message. Neither does one that
+**       doesn't fit in the words left.
+**
+**  \param [in]  MessageLink   Pointer to the messageID link whose
+**                             records are checked
+**
+**  \sa #LC_MatchFingerprint
+**
+*************************************************************************/
+void LC_CreateFingerprint(LC_MessageList_t *MessageLink);
+
+/************************************************************************/
+/** \brief Match a message fingerprint
+**
+**  \par Description
+**       Compares the watched bytes of a message with those kept from
+**       the last message of the MessageID, and keeps the new bytes
+**       in their place
+**
+**  \par Assumptions, External Events, and Notes:
+**       The message must be long enough to hold the data of every
+**       watchpoint of the MessageID
+**
+**  \param [in]  MessageList  Pointer to the link for the MessageID
+**
+**  \param [in]  MessagePtr   A #CFE_SB_MsgPtr_t pointer that
+**                            references the message
+**
+**  \returns
+**  \retstmt Returns true if every watched byte is unchanged \endcode
+**  \endreturns
+**
+**  \sa #LC_CreateFingerprint
+**
+*************************************************************************/
+bool LC_MatchFingerprint(LC_MessageList_t *MessageList,
+                         CFE_SB_MsgPtr_t MessagePtr);
+
+/************************************************************************/
+/** \brief Repeat the results of a message
+**
+**  \par Description
+**       Updates the evaluation count, the true counts and the stale
+**       countdown of every watchpoint of a MessageID as if the last
+**       message had arrived again
+**
+**  \par Assumptions, External Events, and Notes:
+**       Nothing is changed unless every result is true or false. A
+**       result that went stale, or was an error, has to be evaluated
+**       again.
+**
+**  \param [in]  MessageList  Pointer to the link for the MessageID
+**
+**  \returns
+**  \retstmt Returns true if the results were repeated \endcode
+**  \endreturns
+**
+**  \sa #LC_UpdateWPResult
+**
+*************************************************************************/
+bool LC_RepeatWPResults(const LC_MessageList_t *MessageList);
+
+/************************************************************************/
+/** \brief Refresh the watch result ages of a message
+**
+**  \par Description
+**       Restarts the stale countdown of every true or false watch
+**       result of a MessageID, without evaluating the watchpoints
+**
+**  \par Assumptions, External Events, and Notes:
+**       Called for the messages passed over because of the WDT
+**       MessageDecimation, so that the results don't go stale while
+**       the MessageID is still arriving
+**
+**  \param [in]  MessageList  Pointer to the link for the MessageID
+**
+**  \sa #LC_SetStaleCountdown
+**
 *************************************************************************/
-LC_WatchPtList_t *LC_AddWatchpoint(CFE_SB_MsgId_t MessageID);
+void LC_RefreshWPAges(const LC_MessageList_t *MessageList);
 
 #endif /* _lc_watch_ */
 
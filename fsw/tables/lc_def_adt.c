@@ -52,6 +52,12 @@
 ** Examples
 ** (note that comment delimiters have been changed to '**')
 **
+** Each actionpoint selects its Reverse Polish Notation equation from the
+** RPN pool that follows the table entries, by the offset of its first
+** word and the number of words it may use. The equation ends at the
+** first LC_RPN_EQUAL. Actionpoints with the same equation can select
+** the same words, as the unused entries below all do.
+**
 ** Actions that trigger off a single watchpoint:
 ** (see lc_def_wdt.c for companion watchpoint definitions)
 **
@@ -66,10 +72,8 @@
 **        .EventType           = CFE_EVS_EventType_INFORMATION,
 **        .EventID             = LC_BASE_AP_EID + 100,
 **        .EventText           = { "Diviner: low input volt (1)" },
-**        .RPNEquation         = { ** (WP_112) **
-**                                 112,
-**                                 LC_RPN_EQUAL
-**                               }
+**        .RPNOffset           = 2,  ** (WP_112) **
+**        .RPNLength           = 2
 **    },
 **
 **    ** #101 **
@@ -83,10 +87,8 @@
 **        .EventType           = CFE_EVS_EventType_INFORMATION,
 **        .EventID             = LC_BASE_AP_EID + 101,
 **        .EventText           = { "Diviner: low input volt (2)" },
-**        .RPNEquation         = { ** (WP_113) **
-**                                 113,
-**                                 LC_RPN_EQUAL
-**                               }
+**        .RPNOffset           = 4,  ** (WP_113) **
+**        .RPNLength           = 2
 **    },
 **
 ** Examples of more complex Reverse Polish Notation expressions:
@@ -102,23 +104,8 @@
 **        .EventType           = CFE_EVS_EventType_INFORMATION,
 **        .EventID             = LC_BASE_AP_EID + 43,
 **        .EventText           = { "GNC: delta-V sys attitude" },
-**        .RPNEquation         = { ** (WP_26 && !WP_61 && !WP_64 && !WP_45 &&
-*WP_46 && WP_47) **
-**                                 26, 61,
-**                                 LC_RPN_NOT,
-**                                 LC_RPN_AND,
-**                                 64,
-**                                 LC_RPN_NOT,
-**                                 LC_RPN_AND,
-**                                 45,
-**                                 LC_RPN_NOT,
-**                                 LC_RPN_AND,
-**                                 46,
-**                                 LC_RPN_AND,
-**                                 47,
-**                                 LC_RPN_AND,
-**                                 LC_RPN_EQUAL
-**                               }
+**        .RPNOffset           = 6,
+**        .RPNLength           = 15
 **    },
 **
 **    ** #47 **
@@ -132,17 +119,8 @@
 **        .EventType           = CFE_EVS_EventType_INFORMATION,
 **        .EventID             = LC_BASE_AP_EID + 47,
 **        .EventText           = { "GNC: wheel on, attached" },
-**        .RPNEquation         = { ** (!WP_80 && (WP_48 || WP_49 || WP_50 ||
-*WP_51))) **
-**                                 80,
-**                                 LC_RPN_NOT,
-**                                 48, 49, 50, 51,
-**                                 LC_RPN_OR,
-**                                 LC_RPN_OR,
-**                                 LC_RPN_OR,
-**                                 LC_RPN_AND,
-**                                 LC_RPN_EQUAL
-**                               }
+**        .RPNOffset           = 21,
+**        .RPNLength           = 11
 **    },
 **
 **    ** #142 **
@@ -156,20 +134,92 @@
 **        .EventType           = CFE_EVS_EventType_INFORMATION,
 **        .EventID             = LC_BASE_AP_EID + 142,
 **        .EventText           = { "LEND: comp over temp #1" },
-**        .RPNEquation         = { ** (WP_142 && WP_143) || (WP_144 && WP_145)
-*|| (WP_146 && WP_147) **
-**                                 142, 143,
-**                                 LC_RPN_AND,
-**                                 144, 145,
-**                                 LC_RPN_AND,
-**                                 146, 147,
-**                                 LC_RPN_AND,
-**                                 LC_RPN_OR,
-**                                 LC_RPN_OR,
-**                                 LC_RPN_EQUAL
-**                               }
+**        .RPNOffset           = 32,
+**        .RPNLength           = 12
 **    },
 **
+** An actionpoint can use the result of other actionpoints, which are
+** then sampled first. Here actionpoint 150 fails when actionpoint 142
+** fails and actionpoint 47 does not:
+**
+**    ** #150 **
+**    {
+**        .DefaultState        = LC_APSTATE_ENABLED,
+**        .MaxPassiveEvents    = 2,
+**        .MaxPassFailEvents   = 2,
+**        .MaxFailPassEvents   = 2,
+**        .RTSId               = RTS_ID_LEND_POWER_OFF,
+**        .MaxFailsBeforeRTS   = 10,
+**        .EventType           = CFE_EVS_EventType_INFORMATION,
+**        .EventID             = LC_BASE_AP_EID + 150,
+**        .EventText           = { "LEND: over temp, wheels off" },
+**        .RPNOffset           = 44,  ** (AP_142 && !AP_47) **
+**        .RPNLength           = 5
+**    },
+**
+** The RPN pool holding the equations of these examples:
+**
+**    .RPNPool =
+**    {
+**        ** 0: unused entries (WP_0) **
+**        0,
+**        LC_RPN_EQUAL,
+**
+**        ** 2: #100 (WP_112) **
+**        112,
+**        LC_RPN_EQUAL,
+**
+**        ** 4: #101 (WP_113) **
+**        113,
+**        LC_RPN_EQUAL,
+**
+**        ** 6: #43 (WP_26 && !WP_61 && !WP_64 && !WP_45 && WP_46 &&
+**           WP_47) **
+**        26, 61,
+**        LC_RPN_NOT,
+**        LC_RPN_AND,
+**        64,
+**        LC_RPN_NOT,
+**        LC_RPN_AND,
+**        45,
+**        LC_RPN_NOT,
+**        LC_RPN_AND,
+**        46,
+**        LC_RPN_AND,
+**        47,
+**        LC_RPN_AND,
+**        LC_RPN_EQUAL,
+**
+**        ** 21: #47 (!WP_80 && (WP_48 || WP_49 || WP_50 || WP_51)) **
+**        80,
+**        LC_RPN_NOT,
+**        48, 49, 50, 51,
+**        LC_RPN_OR,
+**        LC_RPN_OR,
+**        LC_RPN_OR,
+**        LC_RPN_AND,
+**        LC_RPN_EQUAL,
+**
+**        ** 32: #142 (WP_142 && WP_143) || (WP_144 && WP_145) ||
+**           (WP_146 && WP_147) **
+**        142, 143,
+**        LC_RPN_AND,
+**        144, 145,
+**        LC_RPN_AND,
+**        146, 147,
+**        LC_RPN_AND,
+**        LC_RPN_OR,
+**        LC_RPN_OR,
+**        LC_RPN_EQUAL,
+**
+**        ** 44: #150 (AP_142 && !AP_47) **
+**        LC_RPN_AP(142),
+**        LC_RPN_AP(47),
+**        LC_RPN_NOT,
+**        LC_RPN_AND,
+**        LC_RPN_EQUAL
+**    }
+**
 *************************************************************************/
 
 /*************************************************************************
@@ -181,2474 +231,2304 @@
 static CFE_TBL_FileDef_t CFE_TBL_FileDef __attribute__((__used__)) = {
     "LC_DefaultADT", LC_APP_NAME "." LC_ADT_TABLENAME,
     "LC actionpoint definition table", "lc_def_adt.tbl",
-    (sizeof(LC_ADTEntry_t) * LC_MAX_ACTIONPOINTS)};
+    sizeof(LC_ADT_t)};
 
 /*
 ** Default actionpoint definition table (ADT) data
 */
-LC_ADTEntry_t LC_DefaultADT[LC_MAX_ACTIONPOINTS] = {
-    /* #0 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #1 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #2 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #3 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #4 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #5 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #6 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #7 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #8 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #9 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #10 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #11 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #12 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #13 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #14 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #15 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #16 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #17 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #18 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #19 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #20 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #21 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #22 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #23 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #24 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #25 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #26 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #27 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #28 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #29 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #30 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #31 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #32 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #33 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #34 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #35 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #36 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #37 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #38 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #39 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #40 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #41 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #42 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #43 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #44 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #45 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #46 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #47 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #48 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #49 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #50 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #51 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #52 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #53 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #54 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #55 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #56 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #57 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #58 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #59 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #60 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #61 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #62 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #63 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #64 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #65 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #66 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #67 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #68 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #69 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #70 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #71 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #72 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #73 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #74 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #75 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #76 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #77 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #78 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #79 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #80 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #81 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #82 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #83 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #84 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #85 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #86 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #87 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #88 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #89 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #90 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #91 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #92 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #93 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #94 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #95 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #96 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #97 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #98 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #99 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #100 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #101 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #102 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #103 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #104 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #105 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #106 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #107 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #108 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #109 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #110 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #111 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #112 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #113 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #114 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #115 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #116 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #117 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #118 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #119 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #120 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #121 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #122 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #123 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #124 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #125 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #126 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #127 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #128 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #129 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #130 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #131 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #132 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #133 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #134 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #135 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #136 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #137 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #138 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #139 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #140 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #141 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #142 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #143 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #144 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #145 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #146 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #147 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #148 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #149 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #150 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #151 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #152 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #153 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #154 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #155 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #156 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #157 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #158 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #159 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #160 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #161 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #162 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #163 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #164 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #165 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #166 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #167 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #168 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #169 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #170 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #171 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #172 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #173 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #174 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation =
-         {/* (WP_0) */
-          0, LC_RPN_EQUAL}},
-
-    /* #175 (unused) */
-    {.DefaultState      = LC_ACTION_NOT_USED,
-     .MaxPassiveEvents  = 0,
-     .MaxPassFailEvents = 0,
-     .MaxFailPassEvents = 0,
-     .RTSId             = 0,
-     .MaxFailsBeforeRTS = 0,
-     .EventType         = CFE_EVS_EventType_INFORMATION,
-     .EventID           = 0,
-     .EventText         = {" "},
-     .RPNEquation       = {              /* (WP_0) */
-                     0, LC_RPN_EQUAL}}}; /* end LC_DefaultADT */
+LC_ADT_t LC_DefaultADT = {
+    .Entries =
+        {
+            /* #0 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #1 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #2 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #3 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #4 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #5 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #6 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #7 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #8 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #9 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #10 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #11 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #12 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #13 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #14 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #15 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #16 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #17 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #18 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #19 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #20 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #21 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #22 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #23 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #24 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #25 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #26 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #27 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #28 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #29 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #30 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #31 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #32 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #33 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #34 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #35 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #36 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #37 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #38 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #39 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #40 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #41 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #42 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #43 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #44 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #45 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #46 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #47 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #48 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #49 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #50 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #51 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #52 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #53 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #54 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #55 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #56 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #57 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #58 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #59 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #60 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #61 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #62 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #63 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #64 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #65 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #66 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #67 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #68 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #69 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #70 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #71 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #72 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #73 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #74 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #75 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #76 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #77 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #78 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #79 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #80 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #81 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #82 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #83 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #84 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #85 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #86 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #87 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #88 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #89 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #90 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #91 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #92 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #93 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #94 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #95 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #96 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #97 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #98 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #99 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #100 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #101 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #102 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #103 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #104 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #105 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #106 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #107 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #108 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #109 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #110 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #111 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #112 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #113 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #114 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #115 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #116 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #117 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #118 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #119 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #120 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #121 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #122 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #123 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #124 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #125 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #126 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #127 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #128 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #129 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #130 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #131 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #132 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #133 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #134 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #135 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #136 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #137 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #138 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #139 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #140 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #141 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #142 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #143 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #144 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #145 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #146 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #147 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #148 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #149 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #150 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #151 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #152 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #153 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #154 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #155 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #156 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #157 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #158 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #159 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #160 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #161 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #162 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #163 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #164 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #165 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #166 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #167 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #168 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #169 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #170 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #171 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #172 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #173 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #174 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2},
+
+            /* #175 (unused) */
+            {.DefaultState      = LC_ACTION_NOT_USED,
+             .MaxPassiveEvents  = 0,
+             .MaxPassFailEvents = 0,
+             .MaxFailPassEvents = 0,
+             .RTSId             = 0,
+             .MaxFailsBeforeRTS = 0,
+             .EventType         = CFE_EVS_EventType_INFORMATION,
+             .EventID           = 0,
+             .EventText         = {" "},
+             .RPNOffset         = 0,
+             .RPNLength         = 2}},
+
+    .RPNPool = {/* (WP_0) */
+                0, LC_RPN_EQUAL}}; /* end LC_DefaultADT */
 
 /************************/
 /*  End of File Comment */
@@ -88,6 +88,71 @@
 **        .ComparisonValue.Unsigned32 = 1050000,
 **    },
 **
+** One watchpoint over an array of values:
+**
+**    ** #160 (Battery - any of 128 cell voltages low) **
+**    {
+**        .DataType                   = LC_DATA_UWORD_BE,
+**        .OperatorID                 = LC_OPER_LT,
+**        .MessageID                  = BAT_CELL_TLM_MID,
+**        .WatchpointOffset           = 12,
+**        .BitMask                    = LC_NO_BITMASK,
+**        .CustomFuncArgument         = 0,
+**        .ResultAgeWhenStale         = 0,
+**        .ComparisonValue.Unsigned16in32.Unsigned16 = 3100,
+**        .AggregateType              = LC_AGGR_ANY,
+**        .ElementCount               = 128,
+**        .ElementStride              = 2,
+**        .AggregateCount             = 0,
+**    },
+**
+** Results that go stale when the message stops arriving (the housekeeping
+** message is expected once a second, two in a row may be missed):
+**
+**    ** #170 (Heater - zone 1 temperature high) **
+**    {
+**        .DataType                   = LC_DATA_WORD_BE,
+**        .OperatorID                 = LC_OPER_GT,
+**        .MessageID                  = HTR_HK_TLM_MID,
+**        .WatchpointOffset           = 16,
+**        .BitMask                    = LC_NO_BITMASK,
+**        .CustomFuncArgument         = 0,
+**        .ResultAgeWhenStale         = 0,
+**        .ComparisonValue.Signed32   = 450,
+**        .MessagePeriod              = 3000,
+**    },
+**
+** Evaluated only on the latest message when the actionpoints are sampled
+** (useful for messages that arrive much faster than the sample rate):
+**
+**    ** #171 (Wheel 1 - speed high) **
+**    {
+**        .DataType                   = LC_DATA_FLOAT_LE,
+**        .OperatorID                 = LC_OPER_GT,
+**        .MessageID                  = RW_DATA_TLM_MID,
+**        .WatchpointOffset           = 12,
+**        .BitMask                    = LC_NO_BITMASK,
+**        .CustomFuncArgument         = 0,
+**        .ResultAgeWhenStale         = 0,
+**        .ComparisonValue.Float32    = 6000.0,
+**        .MonitorMode                = LC_MONITOR_LATEST,
+**    },
+**
+** Evaluated on every tenth message of a high rate message:
+**
+**    ** #172 (IMU - rate sensor saturated) **
+**    {
+**        .DataType                   = LC_DATA_UWORD_LE,
+**        .OperatorID                 = LC_OPER_EQ,
+**        .MessageID                  = IMU_DATA_TLM_MID,
+**        .WatchpointOffset           = 20,
+**        .BitMask                    = 0x0001,
+**        .CustomFuncArgument         = 0,
+**        .ResultAgeWhenStale         = 0,
+**        .ComparisonValue.Unsigned16 = 1,
+**        .MessageDecimation          = 10,
+**    },
+**
 *************************************************************************/
 
 /*************************************************************************
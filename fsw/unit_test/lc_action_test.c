@@ -63,7 +63,7 @@ void LC_SampleAPs_Test_SingleActionPointNominal(void) {
     uint16 StartIndex = 0;
     uint16 EndIndex   = 0;
 
-    LC_OperData.ARTPtr[StartIndex].CurrentState = 99;
+    LC_OperData.APSamples[StartIndex].CurrentState = 99;
 
     /* Execute the function being tested */
     LC_SampleAPs(StartIndex, EndIndex);
@@ -78,7 +78,7 @@ void LC_SampleAPs_Test_SingleActionPointError(void) {
     uint16 StartIndex = 0;
     uint16 EndIndex   = 0;
 
-    LC_OperData.ARTPtr[StartIndex].CurrentState = LC_ACTION_NOT_USED;
+    LC_OperData.APSamples[StartIndex].CurrentState = LC_ACTION_NOT_USED;
 
     /* Execute the function being tested */
     LC_SampleAPs(StartIndex, EndIndex);
@@ -108,18 +108,82 @@ void LC_SampleAPs_Test_MultiActionPointNominal(void) {
 
 } /* end LC_SampleAPs_Test_MultiActionPointNominal */
 
+void LC_SampleAPs_Test_APReferenceOrder(void) {
+    /* Actionpoint 0 uses the result of actionpoint 1 */
+    LC_OperData.ADTPtr[0].MaxFailsBeforeRTS = 5;
+    LC_TEST_ADT_RPN(0)[0]                   = LC_RPN_AP(1);
+    LC_TEST_ADT_RPN(0)[1]                   = LC_RPN_EQUAL;
+
+    LC_OperData.ADTPtr[1].MaxFailsBeforeRTS = 5;
+    LC_TEST_ADT_RPN(1)[0]                   = 0;
+    LC_TEST_ADT_RPN(1)[1]                   = LC_RPN_EQUAL;
+
+    LC_OperData.APSamples[0].CurrentState = LC_APSTATE_ACTIVE;
+    LC_OperData.APSamples[0].ActionResult = LC_ACTION_STALE;
+    LC_OperData.APSamples[1].CurrentState = LC_APSTATE_ACTIVE;
+    LC_OperData.APSamples[1].ActionResult = LC_ACTION_STALE;
+
+    LC_CompileActionpoints();
+
+    LC_OperData.WatchResults[0] = LC_WATCH_TRUE;
+
+    /* Execute the function being tested */
+    LC_SampleAPs(0, 1);
+
+    /* Verify results */
+    UtAssert_True(LC_OperData.HaveAPReferences == true,
+                  "LC_OperData.HaveAPReferences == true");
+    UtAssert_True(LC_OperData.APSamples[1].ActionResult == LC_ACTION_FAIL,
+                  "LC_OperData.APSamples[1].ActionResult == LC_ACTION_FAIL");
+    UtAssert_True(LC_OperData.APSamples[0].ActionResult == LC_ACTION_FAIL,
+                  "LC_OperData.APSamples[0].ActionResult == LC_ACTION_FAIL");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end LC_SampleAPs_Test_APReferenceOrder */
+
+void LC_SampleAPs_Test_LiveActionPointsOnly(void) {
+    uint16 TableIndex;
+
+    for (TableIndex = 1; TableIndex <= 4; TableIndex++) {
+        LC_TEST_ADT_RPN(TableIndex)[0] = 0;
+        LC_TEST_ADT_RPN(TableIndex)[1] = LC_RPN_EQUAL;
+    }
+
+    LC_OperData.APSamples[1].CurrentState = LC_APSTATE_ACTIVE;
+    LC_OperData.APSamples[2].CurrentState = LC_APSTATE_DISABLED;
+    LC_OperData.APSamples[3].CurrentState = LC_APSTATE_PASSIVE;
+    LC_OperData.APSamples[4].CurrentState = LC_APSTATE_ACTIVE;
+
+    LC_CompileActionpoints();
+
+    /* Execute the function being tested */
+    LC_SampleAPs(0, 3);
+
+    /* Verify results */
+    UtAssert_True(LC_AppData.APSampleCount == 2,
+                  "LC_AppData.APSampleCount == 2");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end LC_SampleAPs_Test_LiveActionPointsOnly */
+
 void LC_SampleSingleAP_Test_StateChangePassToFail(void) {
     uint16 APNumber = 0;
 
-    LC_OperData.ARTPtr[APNumber].CurrentState            = LC_APSTATE_ACTIVE;
-    LC_OperData.ARTPtr[APNumber].ActionResult            = LC_ACTION_PASS;
+    LC_OperData.APSamples[APNumber].CurrentState         = LC_APSTATE_ACTIVE;
+    LC_OperData.APSamples[APNumber].ActionResult         = LC_ACTION_PASS;
     LC_OperData.ARTPtr[APNumber].CumulativeEventMsgsSent = 0;
     LC_OperData.ADTPtr[APNumber].MaxPassFailEvents       = 100;
 
-    LC_OperData.ADTPtr[APNumber].RPNEquation[0] = 0;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[1] = LC_RPN_EQUAL;
+    LC_TEST_ADT_RPN(APNumber)[0] = 0;
+    LC_TEST_ADT_RPN(APNumber)[1] = LC_RPN_EQUAL;
 
-    LC_OperData.WRTPtr[0].WatchResult = LC_WATCH_TRUE;
+    LC_OperData.WatchResults[0] = LC_WATCH_TRUE;
+
+    LC_CompileActionpoints();
 
     /* Execute the function being tested */
     LC_SampleSingleAP(APNumber);
@@ -128,10 +192,10 @@ void LC_SampleSingleAP_Test_StateChangePassToFail(void) {
     UtAssert_True(LC_AppData.APSampleCount == 1,
                   "LC_AppData.APSampleCount == 1");
     UtAssert_True(
-        LC_OperData.ARTPtr[APNumber].ActionResult == LC_ACTION_FAIL,
-        "LC_OperData.ARTPtr[APNumber].ActionResult == LC_ACTION_FAIL");
-    UtAssert_True(LC_OperData.ARTPtr[APNumber].ConsecutiveFailCount == 1,
-                  "LC_OperData.ARTPtr[APNumber].ConsecutiveFailCount == 1");
+        LC_OperData.APSamples[APNumber].ActionResult == LC_ACTION_FAIL,
+        "LC_OperData.APSamples[APNumber].ActionResult == LC_ACTION_FAIL");
+    UtAssert_True(LC_OperData.APSamples[APNumber].ConsecutiveFailCount == 1,
+                  "LC_OperData.APSamples[APNumber].ConsecutiveFailCount == 1");
     UtAssert_True(LC_OperData.ARTPtr[APNumber].CumulativeFailCount == 1,
                   "LC_OperData.ARTPtr[APNumber].CumulativeFailCount == 1");
     UtAssert_True(LC_OperData.ARTPtr[APNumber].PassToFailCount == 1,
@@ -153,15 +217,15 @@ void LC_SampleSingleAP_Test_StateChangePassToFail(void) {
 void LC_SampleSingleAP_Test_ActiveRequestRTS(void) {
     uint16 APNumber = 0;
 
-    LC_OperData.ARTPtr[APNumber].CurrentState            = LC_APSTATE_ACTIVE;
-    LC_OperData.ARTPtr[APNumber].ActionResult            = LC_ACTION_FAIL;
+    LC_OperData.APSamples[APNumber].CurrentState         = LC_APSTATE_ACTIVE;
+    LC_OperData.APSamples[APNumber].ActionResult         = LC_ACTION_FAIL;
     LC_OperData.ARTPtr[APNumber].CumulativeEventMsgsSent = 0;
     LC_OperData.ADTPtr[APNumber].MaxPassFailEvents       = 100;
 
-    LC_OperData.ADTPtr[APNumber].RPNEquation[0] = 0;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[1] = LC_RPN_EQUAL;
+    LC_TEST_ADT_RPN(APNumber)[0] = 0;
+    LC_TEST_ADT_RPN(APNumber)[1] = LC_RPN_EQUAL;
 
-    LC_OperData.WRTPtr[0].WatchResult = LC_WATCH_TRUE;
+    LC_OperData.WatchResults[0] = LC_WATCH_TRUE;
 
     LC_OperData.ADTPtr[APNumber].EventID   = 1;
     LC_OperData.ADTPtr[APNumber].EventType = 2;
@@ -169,17 +233,19 @@ void LC_SampleSingleAP_Test_ActiveRequestRTS(void) {
     LC_AppData.CurrentLCState = LC_STATE_ACTIVE;
 
     LC_OperData.ADTPtr[APNumber].MaxFailsBeforeRTS = 5;
-    LC_OperData.ARTPtr[APNumber].ConsecutiveFailCount =
+    LC_OperData.APSamples[APNumber].ConsecutiveFailCount =
         LC_OperData.ADTPtr[APNumber].MaxFailsBeforeRTS;
     strncpy(LC_OperData.ADTPtr[APNumber].EventText, "Event Message", 50);
 
+    LC_CompileActionpoints();
+
     /* Execute the function being tested */
     LC_SampleSingleAP(APNumber);
 
     /* Verify results */
     UtAssert_True(
-        LC_OperData.ARTPtr[APNumber].CurrentState == LC_APSTATE_PASSIVE,
-        "LC_OperData.ARTPtr[APNumber].CurrentState == LC_APSTATE_PASSIVE");
+        LC_OperData.APSamples[APNumber].CurrentState == LC_APSTATE_PASSIVE,
+        "LC_OperData.APSamples[APNumber].CurrentState == LC_APSTATE_PASSIVE");
     UtAssert_True(LC_OperData.ARTPtr[APNumber].CumulativeRTSExecCount == 1,
                   "LC_OperData.ARTPtr[APNumber].CumulativeRTSExecCount == 1");
     UtAssert_True(LC_OperData.ARTPtr[APNumber].CumulativeEventMsgsSent == 1,
@@ -200,14 +266,14 @@ void LC_SampleSingleAP_Test_ActiveRequestRTS(void) {
 void LC_SampleSingleAP_Test_APFailWhileLCStatePassive(void) {
     uint16 APNumber = 0;
 
-    LC_OperData.ARTPtr[APNumber].CurrentState      = LC_APSTATE_ACTIVE;
-    LC_OperData.ARTPtr[APNumber].ActionResult      = LC_ACTION_FAIL;
+    LC_OperData.APSamples[APNumber].CurrentState   = LC_APSTATE_ACTIVE;
+    LC_OperData.APSamples[APNumber].ActionResult   = LC_ACTION_FAIL;
     LC_OperData.ADTPtr[APNumber].MaxPassFailEvents = 100;
 
-    LC_OperData.ADTPtr[APNumber].RPNEquation[0] = 0;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[1] = LC_RPN_EQUAL;
+    LC_TEST_ADT_RPN(APNumber)[0] = 0;
+    LC_TEST_ADT_RPN(APNumber)[1] = LC_RPN_EQUAL;
 
-    LC_OperData.WRTPtr[0].WatchResult = LC_WATCH_TRUE;
+    LC_OperData.WatchResults[0] = LC_WATCH_TRUE;
 
     LC_OperData.ADTPtr[APNumber].EventID   = 1;
     LC_OperData.ADTPtr[APNumber].EventType = 2;
@@ -215,17 +281,19 @@ void LC_SampleSingleAP_Test_APFailWhileLCStatePassive(void) {
     LC_AppData.CurrentLCState = LC_STATE_PASSIVE;
 
     LC_OperData.ADTPtr[APNumber].MaxFailsBeforeRTS = 5;
-    LC_OperData.ARTPtr[APNumber].ConsecutiveFailCount =
+    LC_OperData.APSamples[APNumber].ConsecutiveFailCount =
         LC_OperData.ADTPtr[APNumber].MaxFailsBeforeRTS;
     strncpy(LC_OperData.ADTPtr[APNumber].EventText, "Event Message", 50);
 
+    LC_CompileActionpoints();
+
     /* Execute the function being tested */
     LC_SampleSingleAP(APNumber);
 
     /* Verify results */
     UtAssert_True(
-        LC_OperData.ARTPtr[APNumber].CurrentState == LC_APSTATE_PASSIVE,
-        "LC_OperData.ARTPtr[APNumber].CurrentState == LC_APSTATE_PASSIVE");
+        LC_OperData.APSamples[APNumber].CurrentState == LC_APSTATE_PASSIVE,
+        "LC_OperData.APSamples[APNumber].CurrentState == LC_APSTATE_PASSIVE");
     UtAssert_True(LC_AppData.PassiveRTSExecCount == 1,
                   "LC_AppData.PassiveRTSExecCount == 1");
 
@@ -243,21 +311,21 @@ void LC_SampleSingleAP_Test_APFailWhileLCStatePassive(void) {
 void LC_SampleSingleAP_Test_APFailWhilePassive(void) {
     uint16 APNumber = 0;
 
-    LC_OperData.ARTPtr[APNumber].CurrentState            = LC_APSTATE_PASSIVE;
-    LC_OperData.ARTPtr[APNumber].ActionResult            = LC_ACTION_FAIL;
+    LC_OperData.APSamples[APNumber].CurrentState         = LC_APSTATE_PASSIVE;
+    LC_OperData.APSamples[APNumber].ActionResult         = LC_ACTION_FAIL;
     LC_OperData.ADTPtr[APNumber].MaxPassFailEvents       = 100;
     LC_OperData.ARTPtr[APNumber].CumulativeEventMsgsSent = 0;
 
-    LC_OperData.ADTPtr[APNumber].RPNEquation[0] = 0;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[1] = LC_RPN_EQUAL;
+    LC_TEST_ADT_RPN(APNumber)[0] = 0;
+    LC_TEST_ADT_RPN(APNumber)[1] = LC_RPN_EQUAL;
 
-    LC_OperData.WRTPtr[0].WatchResult = LC_WATCH_TRUE;
+    LC_OperData.WatchResults[0] = LC_WATCH_TRUE;
 
     LC_OperData.ADTPtr[APNumber].EventID   = 1;
     LC_OperData.ADTPtr[APNumber].EventType = 2;
 
     LC_OperData.ADTPtr[APNumber].MaxFailsBeforeRTS = 5;
-    LC_OperData.ARTPtr[APNumber].ConsecutiveFailCount =
+    LC_OperData.APSamples[APNumber].ConsecutiveFailCount =
         LC_OperData.ADTPtr[APNumber].MaxFailsBeforeRTS;
     strncpy(LC_OperData.ADTPtr[APNumber].EventText, "Event Message", 50);
 
@@ -267,6 +335,8 @@ void LC_SampleSingleAP_Test_APFailWhilePassive(void) {
 
     LC_AppData.PassiveRTSExecCount = 0;
 
+    LC_CompileActionpoints();
+
     /* Execute the function being tested */
     LC_SampleSingleAP(APNumber);
 
@@ -291,15 +361,17 @@ void LC_SampleSingleAP_Test_APFailWhilePassive(void) {
 void LC_SampleSingleAP_Test_StateChangeFailToPass(void) {
     uint16 APNumber = 0;
 
-    LC_OperData.ARTPtr[APNumber].CurrentState            = LC_APSTATE_ACTIVE;
-    LC_OperData.ARTPtr[APNumber].ActionResult            = LC_ACTION_FAIL;
+    LC_OperData.APSamples[APNumber].CurrentState         = LC_APSTATE_ACTIVE;
+    LC_OperData.APSamples[APNumber].ActionResult         = LC_ACTION_FAIL;
     LC_OperData.ADTPtr[APNumber].MaxFailPassEvents       = 1;
     LC_OperData.ARTPtr[APNumber].CumulativeEventMsgsSent = 0;
 
-    LC_OperData.ADTPtr[APNumber].RPNEquation[0] = 0;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[1] = LC_RPN_EQUAL;
+    LC_TEST_ADT_RPN(APNumber)[0] = 0;
+    LC_TEST_ADT_RPN(APNumber)[1] = LC_RPN_EQUAL;
 
-    LC_OperData.WRTPtr[0].WatchResult = LC_WATCH_FALSE;
+    LC_OperData.WatchResults[0] = LC_WATCH_FALSE;
+
+    LC_CompileActionpoints();
 
     /* Execute the function being tested */
     LC_SampleSingleAP(APNumber);
@@ -308,8 +380,8 @@ void LC_SampleSingleAP_Test_StateChangeFailToPass(void) {
     UtAssert_True(LC_AppData.APSampleCount == 1,
                   "LC_AppData.APSampleCount == 1");
     UtAssert_True(
-        LC_OperData.ARTPtr[APNumber].ActionResult == LC_ACTION_PASS,
-        "LC_OperData.ARTPtr[APNumber].ActionResult == LC_ACTION_PASS");
+        LC_OperData.APSamples[APNumber].ActionResult == LC_ACTION_PASS,
+        "LC_OperData.APSamples[APNumber].ActionResult == LC_ACTION_PASS");
     UtAssert_True(LC_OperData.ARTPtr[APNumber].FailToPassCount == 1,
                   "LC_OperData.ARTPtr[APNumber].FailToPassCount == 1");
     UtAssert_True(LC_OperData.ARTPtr[APNumber].CumulativeEventMsgsSent == 1,
@@ -320,8 +392,8 @@ void LC_SampleSingleAP_Test_StateChangeFailToPass(void) {
                              "AP state change from FAIL to PASS: AP = 0"),
         "AP state change from FAIL to PASS: AP = 0");
 
-    UtAssert_True(LC_OperData.ARTPtr[APNumber].ConsecutiveFailCount == 0,
-                  "LC_OperData.ARTPtr[APNumber].ConsecutiveFailCount == 0");
+    UtAssert_True(LC_OperData.APSamples[APNumber].ConsecutiveFailCount == 0,
+                  "LC_OperData.APSamples[APNumber].ConsecutiveFailCount == 0");
 
     UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 1,
                   "Ut_CFE_EVS_GetEventQueueDepth() == 1");
@@ -331,14 +403,16 @@ void LC_SampleSingleAP_Test_StateChangeFailToPass(void) {
 void LC_SampleSingleAP_Test_ActionStale(void) {
     uint16 APNumber = 0;
 
-    LC_OperData.ARTPtr[APNumber].CurrentState      = LC_APSTATE_ACTIVE;
-    LC_OperData.ARTPtr[APNumber].ActionResult      = LC_ACTION_FAIL;
+    LC_OperData.APSamples[APNumber].CurrentState   = LC_APSTATE_ACTIVE;
+    LC_OperData.APSamples[APNumber].ActionResult   = LC_ACTION_FAIL;
     LC_OperData.ADTPtr[APNumber].MaxFailPassEvents = 1;
 
-    LC_OperData.ADTPtr[APNumber].RPNEquation[0] = 0;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[1] = LC_RPN_EQUAL;
+    LC_TEST_ADT_RPN(APNumber)[0] = 0;
+    LC_TEST_ADT_RPN(APNumber)[1] = LC_RPN_EQUAL;
+
+    LC_OperData.WatchResults[0] = LC_WATCH_STALE;
 
-    LC_OperData.WRTPtr[0].WatchResult = LC_WATCH_STALE;
+    LC_CompileActionpoints();
 
     /* Execute the function being tested */
     LC_SampleSingleAP(APNumber);
@@ -347,10 +421,10 @@ void LC_SampleSingleAP_Test_ActionStale(void) {
     UtAssert_True(LC_AppData.APSampleCount == 1,
                   "LC_AppData.APSampleCount == 1");
     UtAssert_True(
-        LC_OperData.ARTPtr[APNumber].ActionResult == LC_ACTION_STALE,
-        "LC_OperData.ARTPtr[APNumber].ActionResult == LC_ACTION_STALE");
-    UtAssert_True(LC_OperData.ARTPtr[APNumber].ConsecutiveFailCount == 0,
-                  "LC_OperData.ARTPtr[APNumber].ConsecutiveFailCount == 0");
+        LC_OperData.APSamples[APNumber].ActionResult == LC_ACTION_STALE,
+        "LC_OperData.APSamples[APNumber].ActionResult == LC_ACTION_STALE");
+    UtAssert_True(LC_OperData.APSamples[APNumber].ConsecutiveFailCount == 0,
+                  "LC_OperData.APSamples[APNumber].ConsecutiveFailCount == 0");
 
     UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
                   "Ut_CFE_EVS_GetEventQueueDepth() == 0");
@@ -360,14 +434,16 @@ void LC_SampleSingleAP_Test_ActionStale(void) {
 void LC_SampleSingleAP_Test_ActionError(void) {
     uint16 APNumber = 0;
 
-    LC_OperData.ARTPtr[APNumber].CurrentState      = LC_APSTATE_ACTIVE;
-    LC_OperData.ARTPtr[APNumber].ActionResult      = LC_ACTION_FAIL;
+    LC_OperData.APSamples[APNumber].CurrentState   = LC_APSTATE_ACTIVE;
+    LC_OperData.APSamples[APNumber].ActionResult   = LC_ACTION_FAIL;
     LC_OperData.ADTPtr[APNumber].MaxFailPassEvents = 1;
 
-    LC_OperData.ADTPtr[APNumber].RPNEquation[0] = 0;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[1] = LC_RPN_EQUAL;
+    LC_TEST_ADT_RPN(APNumber)[0] = 0;
+    LC_TEST_ADT_RPN(APNumber)[1] = LC_RPN_EQUAL;
 
-    LC_OperData.WRTPtr[0].WatchResult = LC_WATCH_ERROR;
+    LC_OperData.WatchResults[0] = LC_WATCH_ERROR;
+
+    LC_CompileActionpoints();
 
     /* Execute the function being tested */
     LC_SampleSingleAP(APNumber);
@@ -376,8 +452,8 @@ void LC_SampleSingleAP_Test_ActionError(void) {
     UtAssert_True(LC_AppData.APSampleCount == 1,
                   "LC_AppData.APSampleCount == 1");
     UtAssert_True(
-        LC_OperData.ARTPtr[APNumber].ActionResult == LC_ACTION_ERROR,
-        "LC_OperData.ARTPtr[APNumber].ActionResult == LC_ACTION_ERROR");
+        LC_OperData.APSamples[APNumber].ActionResult == LC_ACTION_ERROR,
+        "LC_OperData.APSamples[APNumber].ActionResult == LC_ACTION_ERROR");
 
     UtAssert_True(
         Ut_CFE_EVS_EventSent(LC_ACTION_ERROR_ERR_EID, CFE_EVS_ERROR,
@@ -393,13 +469,15 @@ void LC_EvaluateRPN_Test_AndWatchFalseOp1(void) {
     uint8 Result;
     uint16 APNumber = 0;
 
-    LC_OperData.ADTPtr[APNumber].RPNEquation[0] = 0;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[1] = 1;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[2] = LC_RPN_AND;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[3] = LC_RPN_EQUAL;
+    LC_TEST_ADT_RPN(APNumber)[0] = 0;
+    LC_TEST_ADT_RPN(APNumber)[1] = 1;
+    LC_TEST_ADT_RPN(APNumber)[2] = LC_RPN_AND;
+    LC_TEST_ADT_RPN(APNumber)[3] = LC_RPN_EQUAL;
+
+    LC_OperData.WatchResults[0] = 0;
+    LC_OperData.WatchResults[1] = LC_WATCH_FALSE;
 
-    LC_OperData.WRTPtr[0].WatchResult = 0;
-    LC_OperData.WRTPtr[1].WatchResult = LC_WATCH_FALSE;
+    LC_CompileActionpoints();
 
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
@@ -416,13 +494,15 @@ void LC_EvaluateRPN_Test_AndWatchFalseOp2(void) {
     uint8 Result;
     uint16 APNumber = 0;
 
-    LC_OperData.ADTPtr[APNumber].RPNEquation[0] = 0;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[1] = 1;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[2] = LC_RPN_AND;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[3] = LC_RPN_EQUAL;
+    LC_TEST_ADT_RPN(APNumber)[0] = 0;
+    LC_TEST_ADT_RPN(APNumber)[1] = 1;
+    LC_TEST_ADT_RPN(APNumber)[2] = LC_RPN_AND;
+    LC_TEST_ADT_RPN(APNumber)[3] = LC_RPN_EQUAL;
 
-    LC_OperData.WRTPtr[0].WatchResult = LC_WATCH_FALSE;
-    LC_OperData.WRTPtr[1].WatchResult = 0;
+    LC_OperData.WatchResults[0] = LC_WATCH_FALSE;
+    LC_OperData.WatchResults[1] = 0;
+
+    LC_CompileActionpoints();
 
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
@@ -439,13 +519,15 @@ void LC_EvaluateRPN_Test_OrWatchTrueOp1(void) {
     uint8 Result;
     uint16 APNumber = 0;
 
-    LC_OperData.ADTPtr[APNumber].RPNEquation[0] = 0;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[1] = 1;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[2] = LC_RPN_OR;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[3] = LC_RPN_EQUAL;
+    LC_TEST_ADT_RPN(APNumber)[0] = 0;
+    LC_TEST_ADT_RPN(APNumber)[1] = 1;
+    LC_TEST_ADT_RPN(APNumber)[2] = LC_RPN_OR;
+    LC_TEST_ADT_RPN(APNumber)[3] = LC_RPN_EQUAL;
+
+    LC_OperData.WatchResults[0] = 0;
+    LC_OperData.WatchResults[1] = LC_WATCH_TRUE;
 
-    LC_OperData.WRTPtr[0].WatchResult = 0;
-    LC_OperData.WRTPtr[1].WatchResult = LC_WATCH_TRUE;
+    LC_CompileActionpoints();
 
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
@@ -462,13 +544,15 @@ void LC_EvaluateRPN_Test_OrWatchTrueOp2(void) {
     uint8 Result;
     uint16 APNumber = 0;
 
-    LC_OperData.ADTPtr[APNumber].RPNEquation[0] = 0;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[1] = 1;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[2] = LC_RPN_OR;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[3] = LC_RPN_EQUAL;
+    LC_TEST_ADT_RPN(APNumber)[0] = 0;
+    LC_TEST_ADT_RPN(APNumber)[1] = 1;
+    LC_TEST_ADT_RPN(APNumber)[2] = LC_RPN_OR;
+    LC_TEST_ADT_RPN(APNumber)[3] = LC_RPN_EQUAL;
 
-    LC_OperData.WRTPtr[0].WatchResult = LC_WATCH_TRUE;
-    LC_OperData.WRTPtr[1].WatchResult = 0;
+    LC_OperData.WatchResults[0] = LC_WATCH_TRUE;
+    LC_OperData.WatchResults[1] = 0;
+
+    LC_CompileActionpoints();
 
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
@@ -485,13 +569,15 @@ void LC_EvaluateRPN_Test_AndWatchErrorOp1(void) {
     uint8 Result;
     uint16 APNumber = 0;
 
-    LC_OperData.ADTPtr[APNumber].RPNEquation[0] = 0;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[1] = 1;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[2] = LC_RPN_AND;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[3] = LC_RPN_EQUAL;
+    LC_TEST_ADT_RPN(APNumber)[0] = 0;
+    LC_TEST_ADT_RPN(APNumber)[1] = 1;
+    LC_TEST_ADT_RPN(APNumber)[2] = LC_RPN_AND;
+    LC_TEST_ADT_RPN(APNumber)[3] = LC_RPN_EQUAL;
+
+    LC_OperData.WatchResults[0] = LC_WATCH_ERROR;
+    LC_OperData.WatchResults[1] = 99;
 
-    LC_OperData.WRTPtr[0].WatchResult = LC_WATCH_ERROR;
-    LC_OperData.WRTPtr[1].WatchResult = 99;
+    LC_CompileActionpoints();
 
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
@@ -508,13 +594,15 @@ void LC_EvaluateRPN_Test_AndWatchErrorOp2(void) {
     uint8 Result;
     uint16 APNumber = 0;
 
-    LC_OperData.ADTPtr[APNumber].RPNEquation[0] = 0;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[1] = 1;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[2] = LC_RPN_AND;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[3] = LC_RPN_EQUAL;
+    LC_TEST_ADT_RPN(APNumber)[0] = 0;
+    LC_TEST_ADT_RPN(APNumber)[1] = 1;
+    LC_TEST_ADT_RPN(APNumber)[2] = LC_RPN_AND;
+    LC_TEST_ADT_RPN(APNumber)[3] = LC_RPN_EQUAL;
 
-    LC_OperData.WRTPtr[0].WatchResult = 99;
-    LC_OperData.WRTPtr[1].WatchResult = LC_WATCH_ERROR;
+    LC_OperData.WatchResults[0] = 99;
+    LC_OperData.WatchResults[1] = LC_WATCH_ERROR;
+
+    LC_CompileActionpoints();
 
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
@@ -531,13 +619,15 @@ void LC_EvaluateRPN_Test_OrWatchErrorOp1(void) {
     uint8 Result;
     uint16 APNumber = 0;
 
-    LC_OperData.ADTPtr[APNumber].RPNEquation[0] = 0;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[1] = 1;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[2] = LC_RPN_OR;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[3] = LC_RPN_EQUAL;
+    LC_TEST_ADT_RPN(APNumber)[0] = 0;
+    LC_TEST_ADT_RPN(APNumber)[1] = 1;
+    LC_TEST_ADT_RPN(APNumber)[2] = LC_RPN_OR;
+    LC_TEST_ADT_RPN(APNumber)[3] = LC_RPN_EQUAL;
+
+    LC_OperData.WatchResults[0] = LC_WATCH_ERROR;
+    LC_OperData.WatchResults[1] = 99;
 
-    LC_OperData.WRTPtr[0].WatchResult = LC_WATCH_ERROR;
-    LC_OperData.WRTPtr[1].WatchResult = 99;
+    LC_CompileActionpoints();
 
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
@@ -554,13 +644,15 @@ void LC_EvaluateRPN_Test_OrWatchErrorOp2(void) {
     uint8 Result;
     uint16 APNumber = 0;
 
-    LC_OperData.ADTPtr[APNumber].RPNEquation[0] = 0;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[1] = 1;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[2] = LC_RPN_OR;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[3] = LC_RPN_EQUAL;
+    LC_TEST_ADT_RPN(APNumber)[0] = 0;
+    LC_TEST_ADT_RPN(APNumber)[1] = 1;
+    LC_TEST_ADT_RPN(APNumber)[2] = LC_RPN_OR;
+    LC_TEST_ADT_RPN(APNumber)[3] = LC_RPN_EQUAL;
 
-    LC_OperData.WRTPtr[0].WatchResult = 99;
-    LC_OperData.WRTPtr[1].WatchResult = LC_WATCH_ERROR;
+    LC_OperData.WatchResults[0] = 99;
+    LC_OperData.WatchResults[1] = LC_WATCH_ERROR;
+
+    LC_CompileActionpoints();
 
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
@@ -577,13 +669,15 @@ void LC_EvaluateRPN_Test_XorWatchErrorOp1(void) {
     uint8 Result;
     uint16 APNumber = 0;
 
-    LC_OperData.ADTPtr[APNumber].RPNEquation[0] = 0;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[1] = 1;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[2] = LC_RPN_XOR;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[3] = LC_RPN_EQUAL;
+    LC_TEST_ADT_RPN(APNumber)[0] = 0;
+    LC_TEST_ADT_RPN(APNumber)[1] = 1;
+    LC_TEST_ADT_RPN(APNumber)[2] = LC_RPN_XOR;
+    LC_TEST_ADT_RPN(APNumber)[3] = LC_RPN_EQUAL;
+
+    LC_OperData.WatchResults[0] = LC_WATCH_ERROR;
+    LC_OperData.WatchResults[1] = 99;
 
-    LC_OperData.WRTPtr[0].WatchResult = LC_WATCH_ERROR;
-    LC_OperData.WRTPtr[1].WatchResult = 99;
+    LC_CompileActionpoints();
 
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
@@ -600,13 +694,15 @@ void LC_EvaluateRPN_Test_XorWatchErrorOp2(void) {
     uint8 Result;
     uint16 APNumber = 0;
 
-    LC_OperData.ADTPtr[APNumber].RPNEquation[0] = 0;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[1] = 1;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[2] = LC_RPN_XOR;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[3] = LC_RPN_EQUAL;
+    LC_TEST_ADT_RPN(APNumber)[0] = 0;
+    LC_TEST_ADT_RPN(APNumber)[1] = 1;
+    LC_TEST_ADT_RPN(APNumber)[2] = LC_RPN_XOR;
+    LC_TEST_ADT_RPN(APNumber)[3] = LC_RPN_EQUAL;
 
-    LC_OperData.WRTPtr[0].WatchResult = 99;
-    LC_OperData.WRTPtr[1].WatchResult = LC_WATCH_ERROR;
+    LC_OperData.WatchResults[0] = 99;
+    LC_OperData.WatchResults[1] = LC_WATCH_ERROR;
+
+    LC_CompileActionpoints();
 
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
@@ -623,11 +719,13 @@ void LC_EvaluateRPN_Test_NotWatchError(void) {
     uint8 Result;
     uint16 APNumber = 0;
 
-    LC_OperData.ADTPtr[APNumber].RPNEquation[0] = 0;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[1] = LC_RPN_NOT;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[2] = LC_RPN_EQUAL;
+    LC_TEST_ADT_RPN(APNumber)[0] = 0;
+    LC_TEST_ADT_RPN(APNumber)[1] = LC_RPN_NOT;
+    LC_TEST_ADT_RPN(APNumber)[2] = LC_RPN_EQUAL;
+
+    LC_OperData.WatchResults[0] = LC_WATCH_ERROR;
 
-    LC_OperData.WRTPtr[0].WatchResult = LC_WATCH_ERROR;
+    LC_CompileActionpoints();
 
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
@@ -644,13 +742,15 @@ void LC_EvaluateRPN_Test_AndStaleOp1(void) {
     uint8 Result;
     uint16 APNumber = 0;
 
-    LC_OperData.ADTPtr[APNumber].RPNEquation[0] = 0;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[1] = 1;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[2] = LC_RPN_AND;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[3] = LC_RPN_EQUAL;
+    LC_TEST_ADT_RPN(APNumber)[0] = 0;
+    LC_TEST_ADT_RPN(APNumber)[1] = 1;
+    LC_TEST_ADT_RPN(APNumber)[2] = LC_RPN_AND;
+    LC_TEST_ADT_RPN(APNumber)[3] = LC_RPN_EQUAL;
 
-    LC_OperData.WRTPtr[0].WatchResult = LC_WATCH_STALE;
-    LC_OperData.WRTPtr[1].WatchResult = 99;
+    LC_OperData.WatchResults[0] = LC_WATCH_STALE;
+    LC_OperData.WatchResults[1] = 99;
+
+    LC_CompileActionpoints();
 
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
@@ -667,13 +767,15 @@ void LC_EvaluateRPN_Test_AndStaleOp2(void) {
     uint8 Result;
     uint16 APNumber = 0;
 
-    LC_OperData.ADTPtr[APNumber].RPNEquation[0] = 0;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[1] = 1;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[2] = LC_RPN_AND;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[3] = LC_RPN_EQUAL;
+    LC_TEST_ADT_RPN(APNumber)[0] = 0;
+    LC_TEST_ADT_RPN(APNumber)[1] = 1;
+    LC_TEST_ADT_RPN(APNumber)[2] = LC_RPN_AND;
+    LC_TEST_ADT_RPN(APNumber)[3] = LC_RPN_EQUAL;
+
+    LC_OperData.WatchResults[0] = 99;
+    LC_OperData.WatchResults[1] = LC_WATCH_STALE;
 
-    LC_OperData.WRTPtr[0].WatchResult = 99;
-    LC_OperData.WRTPtr[1].WatchResult = LC_WATCH_STALE;
+    LC_CompileActionpoints();
 
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
@@ -690,13 +792,15 @@ void LC_EvaluateRPN_Test_OrStaleOp1(void) {
     uint8 Result;
     uint16 APNumber = 0;
 
-    LC_OperData.ADTPtr[APNumber].RPNEquation[0] = 0;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[1] = 1;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[2] = LC_RPN_OR;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[3] = LC_RPN_EQUAL;
+    LC_TEST_ADT_RPN(APNumber)[0] = 0;
+    LC_TEST_ADT_RPN(APNumber)[1] = 1;
+    LC_TEST_ADT_RPN(APNumber)[2] = LC_RPN_OR;
+    LC_TEST_ADT_RPN(APNumber)[3] = LC_RPN_EQUAL;
 
-    LC_OperData.WRTPtr[0].WatchResult = LC_WATCH_STALE;
-    LC_OperData.WRTPtr[1].WatchResult = 99;
+    LC_OperData.WatchResults[0] = LC_WATCH_STALE;
+    LC_OperData.WatchResults[1] = 99;
+
+    LC_CompileActionpoints();
 
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
@@ -713,13 +817,15 @@ void LC_EvaluateRPN_Test_OrStaleOp2(void) {
     uint8 Result;
     uint16 APNumber = 0;
 
-    LC_OperData.ADTPtr[APNumber].RPNEquation[0] = 0;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[1] = 1;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[2] = LC_RPN_OR;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[3] = LC_RPN_EQUAL;
+    LC_TEST_ADT_RPN(APNumber)[0] = 0;
+    LC_TEST_ADT_RPN(APNumber)[1] = 1;
+    LC_TEST_ADT_RPN(APNumber)[2] = LC_RPN_OR;
+    LC_TEST_ADT_RPN(APNumber)[3] = LC_RPN_EQUAL;
+
+    LC_OperData.WatchResults[0] = 99;
+    LC_OperData.WatchResults[1] = LC_WATCH_STALE;
 
-    LC_OperData.WRTPtr[0].WatchResult = 99;
-    LC_OperData.WRTPtr[1].WatchResult = LC_WATCH_STALE;
+    LC_CompileActionpoints();
 
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
@@ -736,13 +842,15 @@ void LC_EvaluateRPN_Test_XorStaleOp1(void) {
     uint8 Result;
     uint16 APNumber = 0;
 
-    LC_OperData.ADTPtr[APNumber].RPNEquation[0] = 0;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[1] = 1;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[2] = LC_RPN_XOR;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[3] = LC_RPN_EQUAL;
+    LC_TEST_ADT_RPN(APNumber)[0] = 0;
+    LC_TEST_ADT_RPN(APNumber)[1] = 1;
+    LC_TEST_ADT_RPN(APNumber)[2] = LC_RPN_XOR;
+    LC_TEST_ADT_RPN(APNumber)[3] = LC_RPN_EQUAL;
 
-    LC_OperData.WRTPtr[0].WatchResult = LC_WATCH_STALE;
-    LC_OperData.WRTPtr[1].WatchResult = 99;
+    LC_OperData.WatchResults[0] = LC_WATCH_STALE;
+    LC_OperData.WatchResults[1] = 99;
+
+    LC_CompileActionpoints();
 
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
@@ -759,13 +867,15 @@ void LC_EvaluateRPN_Test_XorStaleOp2(void) {
     uint8 Result;
     uint16 APNumber = 0;
 
-    LC_OperData.ADTPtr[APNumber].RPNEquation[0] = 0;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[1] = 1;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[2] = LC_RPN_XOR;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[3] = LC_RPN_EQUAL;
+    LC_TEST_ADT_RPN(APNumber)[0] = 0;
+    LC_TEST_ADT_RPN(APNumber)[1] = 1;
+    LC_TEST_ADT_RPN(APNumber)[2] = LC_RPN_XOR;
+    LC_TEST_ADT_RPN(APNumber)[3] = LC_RPN_EQUAL;
+
+    LC_OperData.WatchResults[0] = 99;
+    LC_OperData.WatchResults[1] = LC_WATCH_STALE;
 
-    LC_OperData.WRTPtr[0].WatchResult = 99;
-    LC_OperData.WRTPtr[1].WatchResult = LC_WATCH_STALE;
+    LC_CompileActionpoints();
 
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
@@ -782,11 +892,13 @@ void LC_EvaluateRPN_Test_NotStale(void) {
     uint8 Result;
     uint16 APNumber = 0;
 
-    LC_OperData.ADTPtr[APNumber].RPNEquation[0] = 0;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[1] = LC_RPN_NOT;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[2] = LC_RPN_EQUAL;
+    LC_TEST_ADT_RPN(APNumber)[0] = 0;
+    LC_TEST_ADT_RPN(APNumber)[1] = LC_RPN_NOT;
+    LC_TEST_ADT_RPN(APNumber)[2] = LC_RPN_EQUAL;
 
-    LC_OperData.WRTPtr[0].WatchResult = LC_WATCH_STALE;
+    LC_OperData.WatchResults[0] = LC_WATCH_STALE;
+
+    LC_CompileActionpoints();
 
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
@@ -803,13 +915,15 @@ void LC_EvaluateRPN_Test_AndNominal(void) {
     uint8 Result;
     uint16 APNumber = 0;
 
-    LC_OperData.ADTPtr[APNumber].RPNEquation[0] = 0;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[1] = 1;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[2] = LC_RPN_AND;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[3] = LC_RPN_EQUAL;
+    LC_TEST_ADT_RPN(APNumber)[0] = 0;
+    LC_TEST_ADT_RPN(APNumber)[1] = 1;
+    LC_TEST_ADT_RPN(APNumber)[2] = LC_RPN_AND;
+    LC_TEST_ADT_RPN(APNumber)[3] = LC_RPN_EQUAL;
+
+    LC_OperData.WatchResults[0] = 77;
+    LC_OperData.WatchResults[1] = 99;
 
-    LC_OperData.WRTPtr[0].WatchResult = 77;
-    LC_OperData.WRTPtr[1].WatchResult = 99;
+    LC_CompileActionpoints();
 
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
@@ -826,13 +940,15 @@ void LC_EvaluateRPN_Test_OrNominal(void) {
     uint8 Result;
     uint16 APNumber = 0;
 
-    LC_OperData.ADTPtr[APNumber].RPNEquation[0] = 0;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[1] = 1;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[2] = LC_RPN_OR;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[3] = LC_RPN_EQUAL;
+    LC_TEST_ADT_RPN(APNumber)[0] = 0;
+    LC_TEST_ADT_RPN(APNumber)[1] = 1;
+    LC_TEST_ADT_RPN(APNumber)[2] = LC_RPN_OR;
+    LC_TEST_ADT_RPN(APNumber)[3] = LC_RPN_EQUAL;
 
-    LC_OperData.WRTPtr[0].WatchResult = 77;
-    LC_OperData.WRTPtr[1].WatchResult = 99;
+    LC_OperData.WatchResults[0] = 77;
+    LC_OperData.WatchResults[1] = 99;
+
+    LC_CompileActionpoints();
 
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
@@ -849,13 +965,15 @@ void LC_EvaluateRPN_Test_XorNominal(void) {
     uint8 Result;
     uint16 APNumber = 0;
 
-    LC_OperData.ADTPtr[APNumber].RPNEquation[0] = 0;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[1] = 1;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[2] = LC_RPN_XOR;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[3] = LC_RPN_EQUAL;
+    LC_TEST_ADT_RPN(APNumber)[0] = 0;
+    LC_TEST_ADT_RPN(APNumber)[1] = 1;
+    LC_TEST_ADT_RPN(APNumber)[2] = LC_RPN_XOR;
+    LC_TEST_ADT_RPN(APNumber)[3] = LC_RPN_EQUAL;
+
+    LC_OperData.WatchResults[0] = 77;
+    LC_OperData.WatchResults[1] = 99;
 
-    LC_OperData.WRTPtr[0].WatchResult = 77;
-    LC_OperData.WRTPtr[1].WatchResult = 99;
+    LC_CompileActionpoints();
 
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
@@ -872,11 +990,13 @@ void LC_EvaluateRPN_Test_NotNominal(void) {
     uint8 Result;
     uint16 APNumber = 0;
 
-    LC_OperData.ADTPtr[APNumber].RPNEquation[0] = 0;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[1] = LC_RPN_NOT;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[2] = LC_RPN_EQUAL;
+    LC_TEST_ADT_RPN(APNumber)[0] = 0;
+    LC_TEST_ADT_RPN(APNumber)[1] = LC_RPN_NOT;
+    LC_TEST_ADT_RPN(APNumber)[2] = LC_RPN_EQUAL;
 
-    LC_OperData.WRTPtr[0].WatchResult = 77;
+    LC_OperData.WatchResults[0] = 77;
+
+    LC_CompileActionpoints();
 
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
@@ -893,12 +1013,14 @@ void LC_EvaluateRPN_Test_EqualIllegalRPN(void) {
     uint8 Result;
     uint16 APNumber = 0;
 
-    LC_OperData.ADTPtr[APNumber].RPNEquation[0] = 0;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[1] = 1;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[2] = LC_RPN_EQUAL;
+    LC_TEST_ADT_RPN(APNumber)[0] = 0;
+    LC_TEST_ADT_RPN(APNumber)[1] = 1;
+    LC_TEST_ADT_RPN(APNumber)[2] = LC_RPN_EQUAL;
+
+    LC_OperData.WatchResults[0] = 77;
+    LC_OperData.WatchResults[1] = 77;
 
-    LC_OperData.WRTPtr[0].WatchResult = 77;
-    LC_OperData.WRTPtr[1].WatchResult = 77;
+    LC_CompileActionpoints();
 
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
@@ -921,10 +1043,12 @@ void LC_EvaluateRPN_Test_WatchpointNumberNominal(void) {
     uint8 Result;
     uint16 APNumber = 0;
 
-    LC_OperData.ADTPtr[APNumber].RPNEquation[0] = 0;
-    LC_OperData.ADTPtr[APNumber].RPNEquation[1] = LC_RPN_EQUAL;
+    LC_TEST_ADT_RPN(APNumber)[0] = 0;
+    LC_TEST_ADT_RPN(APNumber)[1] = LC_RPN_EQUAL;
 
-    LC_OperData.WRTPtr[0].WatchResult = 77;
+    LC_OperData.WatchResults[0] = 77;
+
+    LC_CompileActionpoints();
 
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
@@ -941,7 +1065,9 @@ void LC_EvaluateRPN_Test_DefaultIllegalRPN(void) {
     uint8 Result;
     uint16 APNumber = 0;
 
-    LC_OperData.ADTPtr[APNumber].RPNEquation[0] = LC_MAX_WATCHPOINTS;
+    LC_TEST_ADT_RPN(APNumber)[0] = LC_MAX_WATCHPOINTS;
+
+    LC_CompileActionpoints();
 
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
@@ -965,11 +1091,13 @@ void LC_EvaluateRPN_Test_EndOfBufferWhenNotDone(void) {
     uint16 APNumber = 0;
     uint32 i;
 
-    for (i = 0; i <= LC_MAX_RPN_EQU_SIZE; i++) {
-        LC_OperData.ADTPtr[APNumber].RPNEquation[i] = 0;
-        LC_OperData.WRTPtr[i].WatchResult           = 77;
+    for (i = 0; i <= LC_TEST_RPN_SLOT; i++) {
+        LC_TEST_ADT_RPN(APNumber)[i] = 0;
+        LC_OperData.WatchResults[i]  = 77;
     }
 
+    LC_CompileActionpoints();
+
     /* Execute the function being tested */
     Result = LC_EvaluateRPN(APNumber);
 
@@ -987,6 +1115,94 @@ void LC_EvaluateRPN_Test_EndOfBufferWhenNotDone(void) {
 
 } /* end LC_EvaluateRPN_Test_EndOfBufferWhenNotDone */
 
+void LC_EvaluateRPN_Test_VoteNominal(void) {
+    uint8 Result;
+    uint16 APNumber = 0;
+
+    LC_TEST_ADT_RPN(APNumber)[0] = 0;
+    LC_TEST_ADT_RPN(APNumber)[1] = 1;
+    LC_TEST_ADT_RPN(APNumber)[2] = 2;
+    LC_TEST_ADT_RPN(APNumber)[3] = LC_RPN_VOTE(2, 3);
+    LC_TEST_ADT_RPN(APNumber)[4] = LC_RPN_EQUAL;
+
+    LC_OperData.WatchResults[0] = LC_WATCH_TRUE;
+    LC_OperData.WatchResults[1] = LC_WATCH_FALSE;
+    LC_OperData.WatchResults[2] = LC_WATCH_TRUE;
+
+    LC_CompileActionpoints();
+
+    /* Use the checked interpreter */
+    LC_OperData.APSamples[APNumber].Verified = false;
+
+    /* Execute the function being tested */
+    Result = LC_EvaluateRPN(APNumber);
+
+    /* Verify results */
+    UtAssert_True(Result == LC_ACTION_FAIL, "Result == LC_ACTION_FAIL");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end LC_EvaluateRPN_Test_VoteNominal */
+
+void LC_EvaluateRPN_Test_VoteIllegalRPN(void) {
+    uint8 Result;
+    uint16 APNumber = 0;
+
+    LC_TEST_ADT_RPN(APNumber)[0] = 0;
+    LC_TEST_ADT_RPN(APNumber)[1] = LC_RPN_VOTE(2, 2);
+    LC_TEST_ADT_RPN(APNumber)[2] = LC_RPN_EQUAL;
+
+    LC_CompileActionpoints();
+
+    /* Execute the function being tested */
+    Result = LC_EvaluateRPN(APNumber);
+
+    /* Verify results */
+    UtAssert_True(Result == LC_ACTION_ERROR, "Result == LC_ACTION_ERROR");
+
+    UtAssert_True(
+        Ut_CFE_EVS_EventSent(LC_INVALID_RPN_ERR_EID, CFE_EVS_ERROR,
+                             "AP has illegal RPN expression: AP = 0, "
+                             "LastOperand = 1, StackPtr = 1"),
+        "AP has illegal RPN expression: AP = 0, LastOperand = 1, StackPtr = 1");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 1,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 1");
+
+} /* end LC_EvaluateRPN_Test_VoteIllegalRPN */
+
+void LC_EvaluateRPN_Test_APResultNominal(void) {
+    uint8 CheckedResult;
+    uint8 VerifiedResult;
+    uint16 APNumber = 0;
+
+    LC_TEST_ADT_RPN(APNumber)[0] = LC_RPN_AP(1);
+    LC_TEST_ADT_RPN(APNumber)[1] = LC_RPN_NOT;
+    LC_TEST_ADT_RPN(APNumber)[2] = LC_RPN_EQUAL;
+
+    LC_CompileActionpoints();
+
+    LC_OperData.APSamples[1].ActionResult = LC_ACTION_FAIL;
+
+    /* Execute the function being tested */
+    VerifiedResult = LC_EvaluateRPN(APNumber);
+
+    LC_OperData.APSamples[APNumber].Verified = false;
+
+    CheckedResult = LC_EvaluateRPN(APNumber);
+
+    /* Verify results */
+    UtAssert_True(VerifiedResult == LC_ACTION_PASS,
+                  "VerifiedResult == LC_ACTION_PASS");
+    UtAssert_True(CheckedResult == LC_ACTION_PASS,
+                  "CheckedResult == LC_ACTION_PASS");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end LC_EvaluateRPN_Test_APResultNominal */
+
 void LC_ValidateADT_Test_ActionNotUsed(void) {
     uint8 Result;
     uint32 TableIndex;
@@ -1160,7 +1376,7 @@ void LC_ValidateADT_Test_ValidateRpnAdtValError(void) {
         LC_OperData.ADTPtr[TableIndex].RTSId             = 1;
         LC_OperData.ADTPtr[TableIndex].MaxFailsBeforeRTS = 88;
         LC_OperData.ADTPtr[TableIndex].EventType         = CFE_EVS_DEBUG;
-        LC_OperData.ADTPtr[TableIndex].RPNEquation[0]    = 999;
+        LC_TEST_ADT_RPN(TableIndex)[0]                   = 999;
     }
 
     /* Execute the function being tested */
@@ -1194,9 +1410,9 @@ void LC_ValidateADT_Test_ValidateRpnAdtValNoError(void) {
         LC_OperData.ADTPtr[TableIndex].MaxFailsBeforeRTS = 88;
         LC_OperData.ADTPtr[TableIndex].EventType         = CFE_EVS_DEBUG;
 
-        LC_OperData.ADTPtr[TableIndex].RPNEquation[0] = LC_MAX_WATCHPOINTS - 1;
-        LC_OperData.ADTPtr[TableIndex].RPNEquation[1] = LC_RPN_NOT;
-        LC_OperData.ADTPtr[TableIndex].RPNEquation[2] = LC_RPN_EQUAL;
+        LC_TEST_ADT_RPN(TableIndex)[0] = LC_MAX_WATCHPOINTS - 1;
+        LC_TEST_ADT_RPN(TableIndex)[1] = LC_RPN_NOT;
+        LC_TEST_ADT_RPN(TableIndex)[2] = LC_RPN_EQUAL;
     }
 
     /* Execute the function being tested */
@@ -1215,19 +1431,146 @@ void LC_ValidateADT_Test_ValidateRpnAdtValNoError(void) {
 
 } /* end LC_ValidateADT_Test_ValidateRpnAdtValNoError */
 
+void LC_ValidateADT_Test_APReferenceCycle(void) {
+    uint8 Result;
+    uint32 TableIndex;
+
+    for (TableIndex = 0; TableIndex < LC_MAX_ACTIONPOINTS; TableIndex++) {
+        LC_OperData.ADTPtr[TableIndex].DefaultState      = LC_APSTATE_ACTIVE;
+        LC_OperData.ADTPtr[TableIndex].RTSId             = 1;
+        LC_OperData.ADTPtr[TableIndex].MaxFailsBeforeRTS = 88;
+        LC_OperData.ADTPtr[TableIndex].EventType         = CFE_EVS_DEBUG;
+
+        LC_TEST_ADT_RPN(TableIndex)[0] = 0;
+        LC_TEST_ADT_RPN(TableIndex)[1] = LC_RPN_EQUAL;
+    }
+
+    /* Actionpoints 1 and 2 use each other, actionpoint 0 uses 1 */
+    LC_TEST_ADT_RPN(0)[0] = LC_RPN_AP(1);
+    LC_TEST_ADT_RPN(1)[0] = LC_RPN_AP(2);
+    LC_TEST_ADT_RPN(2)[0] = LC_RPN_AP(1);
+
+    /* Execute the function being tested */
+    Result = LC_ValidateADT(LC_OperData.ADTPtr);
+
+    /* Verify results */
+    UtAssert_True(Result == LC_ADTVAL_ERR_APCYCLE,
+                  "Result == LC_ADTVAL_ERR_APCYCLE");
+
+    UtAssert_True(
+        Ut_CFE_EVS_EventSent(
+            LC_ADTVAL_APCYCLE_ERR_EID, CFE_EVS_ERROR,
+            "ADT verify AP reference cycle: AP = 0, Unordered = 3"),
+        "ADT verify AP reference cycle: AP = 0, Unordered = 3");
+
+    UtAssert_True(Ut_CFE_EVS_EventSent(
+                      LC_ADTVAL_INF_EID, CFE_EVS_INFORMATION,
+                      "ADT verify results: good = 173, bad = 3, unused = 0"),
+                  "ADT verify results: good = 173, bad = 3, unused = 0");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 2,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 2");
+
+} /* end LC_ValidateADT_Test_APReferenceCycle */
+
+void LC_ValidateADT_Test_RPNPoolError(void) {
+    uint8 Result;
+    uint32 TableIndex;
+
+    for (TableIndex = 0; TableIndex < LC_MAX_ACTIONPOINTS; TableIndex++) {
+        LC_OperData.ADTPtr[TableIndex].DefaultState      = LC_APSTATE_ACTIVE;
+        LC_OperData.ADTPtr[TableIndex].RTSId             = 1;
+        LC_OperData.ADTPtr[TableIndex].MaxFailsBeforeRTS = 88;
+        LC_OperData.ADTPtr[TableIndex].EventType         = CFE_EVS_DEBUG;
+
+        LC_TEST_ADT_RPN(TableIndex)[0] = 0;
+        LC_TEST_ADT_RPN(TableIndex)[1] = LC_RPN_EQUAL;
+    }
+
+    /* Actionpoint 1 reaches past the end of the pool */
+    LC_OperData.ADTPtr[1].RPNOffset = LC_MAX_RPN_POOL_SIZE - 1;
+    LC_OperData.ADTPtr[1].RPNLength = 2;
+
+    /* Actionpoint 2 selects no words at all */
+    LC_OperData.ADTPtr[2].RPNLength = 0;
+
+    /* Execute the function being tested */
+    Result = LC_ValidateADT(LC_OperData.ADTPtr);
+
+    /* Verify results */
+    UtAssert_True(Result == LC_ADTVAL_ERR_RPNPOOL,
+                  "Result == LC_ADTVAL_ERR_RPNPOOL");
+
+    UtAssert_True(
+        Ut_CFE_EVS_EventSent(
+            LC_ADTVAL_RPNPOOL_ERR_EID, CFE_EVS_ERROR,
+            "ADT verify RPN pool err: AP = 1, Offset = 3519, Length = 2"),
+        "ADT verify RPN pool err: AP = 1, Offset = 3519, Length = 2");
+
+    UtAssert_True(Ut_CFE_EVS_EventSent(
+                      LC_ADTVAL_INF_EID, CFE_EVS_INFORMATION,
+                      "ADT verify results: good = 174, bad = 2, unused = 0"),
+                  "ADT verify results: good = 174, bad = 2, unused = 0");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 2,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 2");
+
+} /* end LC_ValidateADT_Test_RPNPoolError */
+
+void LC_ValidateADT_Test_LongEquation(void) {
+    uint8 Result;
+    uint32 TableIndex;
+    uint16 RPNIndex;
+
+    /*
+    ** Every actionpoint selects the same equation, twice as long as
+    ** a test pool slot, that ORs 21 watchpoints
+    */
+    LC_TEST_ADT_RPN(0)[0] = 0;
+    for (RPNIndex = 1; RPNIndex <= 20; RPNIndex++) {
+        LC_TEST_ADT_RPN(0)[2 * RPNIndex - 1] = RPNIndex;
+        LC_TEST_ADT_RPN(0)[2 * RPNIndex]     = LC_RPN_OR;
+    }
+    LC_TEST_ADT_RPN(0)[41] = LC_RPN_EQUAL;
+
+    for (TableIndex = 0; TableIndex < LC_MAX_ACTIONPOINTS; TableIndex++) {
+        LC_OperData.ADTPtr[TableIndex].DefaultState      = LC_APSTATE_ACTIVE;
+        LC_OperData.ADTPtr[TableIndex].RTSId             = 1;
+        LC_OperData.ADTPtr[TableIndex].MaxFailsBeforeRTS = 88;
+        LC_OperData.ADTPtr[TableIndex].EventType         = CFE_EVS_DEBUG;
+        LC_OperData.ADTPtr[TableIndex].RPNOffset         = 0;
+        LC_OperData.ADTPtr[TableIndex].RPNLength         = 42;
+    }
+
+    /* Execute the function being tested */
+    Result = LC_ValidateADT(LC_OperData.ADTPtr);
+
+    /* Verify results */
+    UtAssert_True(Result == LC_ADTVAL_NO_ERR, "Result == LC_ADTVAL_NO_ERR");
+
+    UtAssert_True(Ut_CFE_EVS_EventSent(
+                      LC_ADTVAL_INF_EID, CFE_EVS_INFORMATION,
+                      "ADT verify results: good = 176, bad = 0, unused = 0"),
+                  "ADT verify results: good = 176, bad = 0, unused = 0");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 1,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 1");
+
+} /* end LC_ValidateADT_Test_LongEquation */
+
 void LC_ValidateRPN_Test_RpnAnd(void) {
     uint8 Result;
 
     int32 IndexValue, StackDepthValue;
 
-    LC_OperData.ADTPtr[0].RPNEquation[0] = LC_MAX_WATCHPOINTS - 1;
-    LC_OperData.ADTPtr[0].RPNEquation[1] = LC_MAX_WATCHPOINTS - 2;
-    LC_OperData.ADTPtr[0].RPNEquation[2] = LC_RPN_AND;
-    LC_OperData.ADTPtr[0].RPNEquation[3] = LC_RPN_EQUAL;
+    LC_TEST_ADT_RPN(0)[0] = LC_MAX_WATCHPOINTS - 1;
+    LC_TEST_ADT_RPN(0)[1] = LC_MAX_WATCHPOINTS - 2;
+    LC_TEST_ADT_RPN(0)[2] = LC_RPN_AND;
+    LC_TEST_ADT_RPN(0)[3] = LC_RPN_EQUAL;
 
     /* Execute the function being tested */
-    Result = LC_ValidateRPN(LC_OperData.ADTPtr[0].RPNEquation, &IndexValue,
-                            &StackDepthValue);
+    Result = LC_ValidateRPN(LC_TEST_ADT_RPN(0), LC_TEST_RPN_SLOT,
+                            &IndexValue, &StackDepthValue);
 
     /* Verify results */
     UtAssert_True(Result == LC_ADTVAL_NO_ERR, "Result == LC_ADTVAL_NO_ERR");
@@ -1242,14 +1585,14 @@ void LC_ValidateRPN_Test_RpnOr(void) {
 
     int32 IndexValue, StackDepthValue;
 
-    LC_OperData.ADTPtr[0].RPNEquation[0] = LC_MAX_WATCHPOINTS - 1;
-    LC_OperData.ADTPtr[0].RPNEquation[1] = LC_MAX_WATCHPOINTS - 2;
-    LC_OperData.ADTPtr[0].RPNEquation[2] = LC_RPN_OR;
-    LC_OperData.ADTPtr[0].RPNEquation[3] = LC_RPN_EQUAL;
+    LC_TEST_ADT_RPN(0)[0] = LC_MAX_WATCHPOINTS - 1;
+    LC_TEST_ADT_RPN(0)[1] = LC_MAX_WATCHPOINTS - 2;
+    LC_TEST_ADT_RPN(0)[2] = LC_RPN_OR;
+    LC_TEST_ADT_RPN(0)[3] = LC_RPN_EQUAL;
 
     /* Execute the function being tested */
-    Result = LC_ValidateRPN(LC_OperData.ADTPtr[0].RPNEquation, &IndexValue,
-                            &StackDepthValue);
+    Result = LC_ValidateRPN(LC_TEST_ADT_RPN(0), LC_TEST_RPN_SLOT,
+                            &IndexValue, &StackDepthValue);
 
     /* Verify results */
     UtAssert_True(Result == LC_ADTVAL_NO_ERR, "Result == LC_ADTVAL_NO_ERR");
@@ -1264,14 +1607,14 @@ void LC_ValidateRPN_Test_RpnXor(void) {
 
     int32 IndexValue, StackDepthValue;
 
-    LC_OperData.ADTPtr[0].RPNEquation[0] = LC_MAX_WATCHPOINTS - 1;
-    LC_OperData.ADTPtr[0].RPNEquation[1] = LC_MAX_WATCHPOINTS - 2;
-    LC_OperData.ADTPtr[0].RPNEquation[2] = LC_RPN_XOR;
-    LC_OperData.ADTPtr[0].RPNEquation[3] = LC_RPN_EQUAL;
+    LC_TEST_ADT_RPN(0)[0] = LC_MAX_WATCHPOINTS - 1;
+    LC_TEST_ADT_RPN(0)[1] = LC_MAX_WATCHPOINTS - 2;
+    LC_TEST_ADT_RPN(0)[2] = LC_RPN_XOR;
+    LC_TEST_ADT_RPN(0)[3] = LC_RPN_EQUAL;
 
     /* Execute the function being tested */
-    Result = LC_ValidateRPN(LC_OperData.ADTPtr[0].RPNEquation, &IndexValue,
-                            &StackDepthValue);
+    Result = LC_ValidateRPN(LC_TEST_ADT_RPN(0), LC_TEST_RPN_SLOT,
+                            &IndexValue, &StackDepthValue);
 
     /* Verify results */
     UtAssert_True(Result == LC_ADTVAL_NO_ERR, "Result == LC_ADTVAL_NO_ERR");
@@ -1286,13 +1629,13 @@ void LC_ValidateRPN_Test_RpnNot(void) {
 
     int32 IndexValue, StackDepthValue;
 
-    LC_OperData.ADTPtr[0].RPNEquation[0] = LC_MAX_WATCHPOINTS - 1;
-    LC_OperData.ADTPtr[0].RPNEquation[1] = LC_RPN_NOT;
-    LC_OperData.ADTPtr[0].RPNEquation[2] = LC_RPN_EQUAL;
+    LC_TEST_ADT_RPN(0)[0] = LC_MAX_WATCHPOINTS - 1;
+    LC_TEST_ADT_RPN(0)[1] = LC_RPN_NOT;
+    LC_TEST_ADT_RPN(0)[2] = LC_RPN_EQUAL;
 
     /* Execute the function being tested */
-    Result = LC_ValidateRPN(LC_OperData.ADTPtr[0].RPNEquation, &IndexValue,
-                            &StackDepthValue);
+    Result = LC_ValidateRPN(LC_TEST_ADT_RPN(0), LC_TEST_RPN_SLOT,
+                            &IndexValue, &StackDepthValue);
 
     /* Verify results */
     UtAssert_True(Result == LC_ADTVAL_NO_ERR, "Result == LC_ADTVAL_NO_ERR");
@@ -1307,11 +1650,11 @@ void LC_ValidateRPN_Test_StackDepthZero(void) {
 
     int32 IndexValue, StackDepthValue;
 
-    LC_OperData.ADTPtr[0].RPNEquation[0] = LC_RPN_NOT;
+    LC_TEST_ADT_RPN(0)[0] = LC_RPN_NOT;
 
     /* Execute the function being tested */
-    Result = LC_ValidateRPN(LC_OperData.ADTPtr[0].RPNEquation, &IndexValue,
-                            &StackDepthValue);
+    Result = LC_ValidateRPN(LC_TEST_ADT_RPN(0), LC_TEST_RPN_SLOT,
+                            &IndexValue, &StackDepthValue);
 
     /* Verify results */
     UtAssert_True(Result == LC_ADTVAL_ERR_RPN, "Result == LC_ADTVAL_ERR_RPN");
@@ -1328,11 +1671,11 @@ void LC_ValidateRPN_Test_InvalidBufferItem(void) {
 
     int32 IndexValue, StackDepthValue;
 
-    LC_OperData.ADTPtr[0].RPNEquation[0] = LC_MAX_WATCHPOINTS;
+    LC_TEST_ADT_RPN(0)[0] = LC_MAX_WATCHPOINTS;
 
     /* Execute the function being tested */
-    Result = LC_ValidateRPN(LC_OperData.ADTPtr[0].RPNEquation, &IndexValue,
-                            &StackDepthValue);
+    Result = LC_ValidateRPN(LC_TEST_ADT_RPN(0), LC_TEST_RPN_SLOT,
+                            &IndexValue, &StackDepthValue);
 
     /* Verify results */
     UtAssert_True(Result == LC_ADTVAL_ERR_RPN, "Result == LC_ADTVAL_ERR_RPN");
@@ -1344,65 +1687,1167 @@ void LC_ValidateRPN_Test_InvalidBufferItem(void) {
 
 } /* end LC_ValidateRPN_Test_InvalidBufferItem */
 
-void LC_Action_Test_AddTestCases(void) {
-    UtTest_Add(LC_SampleAPs_Test_SingleActionPointNominal, LC_Test_Setup,
-               LC_Test_TearDown, "LC_SampleAPs_Test_SingleActionPointNominal");
-    UtTest_Add(LC_SampleAPs_Test_SingleActionPointError, LC_Test_Setup,
-               LC_Test_TearDown, "LC_SampleAPs_Test_SingleActionPointError");
-    UtTest_Add(LC_SampleAPs_Test_MultiActionPointNominal, LC_Test_Setup,
-               LC_Test_TearDown, "LC_SampleAPs_Test_MultiActionPointNominal");
+void LC_ValidateRPN_Test_RpnVote(void) {
+    uint8 Result;
 
-    UtTest_Add(LC_SampleSingleAP_Test_StateChangePassToFail, LC_Test_Setup,
-               LC_Test_TearDown,
-               "LC_SampleSingleAP_Test_StateChangePassToFail");
-    UtTest_Add(LC_SampleSingleAP_Test_ActiveRequestRTS, LC_Test_Setup,
-               LC_Test_TearDown, "LC_SampleSingleAP_Test_ActiveRequestRTS");
-    UtTest_Add(LC_SampleSingleAP_Test_APFailWhileLCStatePassive, LC_Test_Setup,
-               LC_Test_TearDown,
-               "LC_SampleSingleAP_Test_APFailWhileLCStatePassive");
-    UtTest_Add(LC_SampleSingleAP_Test_APFailWhilePassive, LC_Test_Setup,
-               LC_Test_TearDown, "LC_SampleSingleAP_Test_APFailWhilePassive");
-    UtTest_Add(LC_SampleSingleAP_Test_StateChangeFailToPass, LC_Test_Setup,
-               LC_Test_TearDown,
-               "LC_SampleSingleAP_Test_StateChangeFailToPass");
-    UtTest_Add(LC_SampleSingleAP_Test_ActionStale, LC_Test_Setup,
-               LC_Test_TearDown, "LC_SampleSingleAP_Test_ActionStale");
-    UtTest_Add(LC_SampleSingleAP_Test_ActionError, LC_Test_Setup,
-               LC_Test_TearDown, "LC_SampleSingleAP_Test_ActionError");
+    int32 IndexValue, StackDepthValue;
 
-    UtTest_Add(LC_EvaluateRPN_Test_AndWatchFalseOp1, LC_Test_Setup,
-               LC_Test_TearDown, "LC_EvaluateRPN_Test_AndWatchFalseOp1");
-    UtTest_Add(LC_EvaluateRPN_Test_AndWatchFalseOp2, LC_Test_Setup,
-               LC_Test_TearDown, "LC_EvaluateRPN_Test_AndWatchFalseOp2");
-    UtTest_Add(LC_EvaluateRPN_Test_OrWatchTrueOp1, LC_Test_Setup,
-               LC_Test_TearDown, "LC_EvaluateRPN_Test_OrWatchTrueOp1");
-    UtTest_Add(LC_EvaluateRPN_Test_OrWatchTrueOp2, LC_Test_Setup,
-               LC_Test_TearDown, "LC_EvaluateRPN_Test_OrWatchTrueOp2");
-    UtTest_Add(LC_EvaluateRPN_Test_AndWatchErrorOp1, LC_Test_Setup,
-               LC_Test_TearDown, "LC_EvaluateRPN_Test_AndWatchErrorOp1");
-    UtTest_Add(LC_EvaluateRPN_Test_AndWatchErrorOp2, LC_Test_Setup,
-               LC_Test_TearDown, "LC_EvaluateRPN_Test_AndWatchErrorOp2");
-    UtTest_Add(LC_EvaluateRPN_Test_OrWatchErrorOp1, LC_Test_Setup,
-               LC_Test_TearDown, "LC_EvaluateRPN_Test_OrWatchErrorOp1");
-    UtTest_Add(LC_EvaluateRPN_Test_OrWatchErrorOp2, LC_Test_Setup,
-               LC_Test_TearDown, "LC_EvaluateRPN_Test_OrWatchErrorOp2");
-    UtTest_Add(LC_EvaluateRPN_Test_XorWatchErrorOp1, LC_Test_Setup,
-               LC_Test_TearDown, "LC_EvaluateRPN_Test_XorWatchErrorOp1");
-    UtTest_Add(LC_EvaluateRPN_Test_XorWatchErrorOp2, LC_Test_Setup,
-               LC_Test_TearDown, "LC_EvaluateRPN_Test_XorWatchErrorOp2");
-    UtTest_Add(LC_EvaluateRPN_Test_NotWatchError, LC_Test_Setup,
-               LC_Test_TearDown, "LC_EvaluateRPN_Test_NotWatchError");
-    UtTest_Add(LC_EvaluateRPN_Test_AndStaleOp1, LC_Test_Setup, LC_Test_TearDown,
-               "LC_EvaluateRPN_Test_AndStaleOp1");
-    UtTest_Add(LC_EvaluateRPN_Test_AndStaleOp2, LC_Test_Setup, LC_Test_TearDown,
-               "LC_EvaluateRPN_Test_AndStaleOp2");
-    UtTest_Add(LC_EvaluateRPN_Test_OrStaleOp1, LC_Test_Setup, LC_Test_TearDown,
-               "LC_EvaluateRPN_Test_OrStaleOp1");
-    UtTest_Add(LC_EvaluateRPN_Test_OrStaleOp2, LC_Test_Setup, LC_Test_TearDown,
-               "LC_EvaluateRPN_Test_OrStaleOp2");
-    UtTest_Add(LC_EvaluateRPN_Test_XorStaleOp1, LC_Test_Setup, LC_Test_TearDown,
-               "LC_EvaluateRPN_Test_XorStaleOp1");
-    UtTest_Add(LC_EvaluateRPN_Test_XorStaleOp2, LC_Test_Setup, LC_Test_TearDown,
+    LC_TEST_ADT_RPN(0)[0] = 0;
+    LC_TEST_ADT_RPN(0)[1] = 1;
+    LC_TEST_ADT_RPN(0)[2] = 2;
+    LC_TEST_ADT_RPN(0)[3] = LC_RPN_VOTE(2, 3);
+    LC_TEST_ADT_RPN(0)[4] = LC_RPN_EQUAL;
+
+    /* Execute the function being tested */
+    Result = LC_ValidateRPN(LC_TEST_ADT_RPN(0), LC_TEST_RPN_SLOT,
+                            &IndexValue, &StackDepthValue);
+
+    /* Verify results */
+    UtAssert_True(Result == LC_ADTVAL_NO_ERR, "Result == LC_ADTVAL_NO_ERR");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end LC_ValidateRPN_Test_RpnVote */
+
+void LC_ValidateRPN_Test_VoteTooFewOperands(void) {
+    uint8 Result;
+
+    int32 IndexValue, StackDepthValue;
+
+    LC_TEST_ADT_RPN(0)[0] = 0;
+    LC_TEST_ADT_RPN(0)[1] = 1;
+    LC_TEST_ADT_RPN(0)[2] = LC_RPN_VOTE(2, 3);
+    LC_TEST_ADT_RPN(0)[3] = LC_RPN_EQUAL;
+
+    /* Execute the function being tested */
+    Result = LC_ValidateRPN(LC_TEST_ADT_RPN(0), LC_TEST_RPN_SLOT,
+                            &IndexValue, &StackDepthValue);
+
+    /* Verify results */
+    UtAssert_True(Result == LC_ADTVAL_ERR_RPN, "Result == LC_ADTVAL_ERR_RPN");
+    UtAssert_True(IndexValue == 2, "IndexValue == 2");
+    UtAssert_True(StackDepthValue == 0, "StackDepthValue == 0");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end LC_ValidateRPN_Test_VoteTooFewOperands */
+
+void LC_ValidateRPN_Test_VoteKMoreThanN(void) {
+    uint8 Result;
+
+    int32 IndexValue, StackDepthValue;
+
+    LC_TEST_ADT_RPN(0)[0] = 0;
+    LC_TEST_ADT_RPN(0)[1] = 1;
+    LC_TEST_ADT_RPN(0)[2] = LC_RPN_VOTE(3, 2);
+    LC_TEST_ADT_RPN(0)[3] = LC_RPN_EQUAL;
+
+    /* Execute the function being tested */
+    Result = LC_ValidateRPN(LC_TEST_ADT_RPN(0), LC_TEST_RPN_SLOT,
+                            &IndexValue, &StackDepthValue);
+
+    /* Verify results */
+    UtAssert_True(Result == LC_ADTVAL_ERR_RPN, "Result == LC_ADTVAL_ERR_RPN");
+    UtAssert_True(IndexValue == 2, "IndexValue == 2");
+    UtAssert_True(StackDepthValue == 2, "StackDepthValue == 2");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end LC_ValidateRPN_Test_VoteKMoreThanN */
+
+void LC_ValidateRPN_Test_RpnAPResult(void) {
+    uint8 Result;
+
+    int32 IndexValue, StackDepthValue;
+
+    LC_TEST_ADT_RPN(0)[0] = 0;
+    LC_TEST_ADT_RPN(0)[1] = LC_RPN_AP(LC_MAX_ACTIONPOINTS - 1);
+    LC_TEST_ADT_RPN(0)[2] = LC_RPN_AND;
+    LC_TEST_ADT_RPN(0)[3] = LC_RPN_EQUAL;
+
+    /* Execute the function being tested */
+    Result = LC_ValidateRPN(LC_TEST_ADT_RPN(0), LC_TEST_RPN_SLOT,
+                            &IndexValue, &StackDepthValue);
+
+    /* Verify results */
+    UtAssert_True(Result == LC_ADTVAL_NO_ERR, "Result == LC_ADTVAL_NO_ERR");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end LC_ValidateRPN_Test_RpnAPResult */
+
+void LC_ValidateRPN_Test_APResultOutOfRange(void) {
+    uint8 Result;
+
+    int32 IndexValue, StackDepthValue;
+
+    LC_TEST_ADT_RPN(0)[0] = LC_RPN_AP(LC_MAX_ACTIONPOINTS);
+    LC_TEST_ADT_RPN(0)[1] = LC_RPN_EQUAL;
+
+    /* Execute the function being tested */
+    Result = LC_ValidateRPN(LC_TEST_ADT_RPN(0), LC_TEST_RPN_SLOT,
+                            &IndexValue, &StackDepthValue);
+
+    /* Verify results */
+    UtAssert_True(Result == LC_ADTVAL_ERR_RPN, "Result == LC_ADTVAL_ERR_RPN");
+    UtAssert_True(IndexValue == 0, "IndexValue == 0");
+    UtAssert_True(StackDepthValue == 0, "StackDepthValue == 0");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end LC_ValidateRPN_Test_APResultOutOfRange */
+
+void LC_ValidateRPN_Test_NoEqualInLength(void) {
+    uint8 Result;
+
+    int32 IndexValue, StackDepthValue;
+
+    LC_TEST_ADT_RPN(0)[0] = 0;
+    LC_TEST_ADT_RPN(0)[1] = 1;
+    LC_TEST_ADT_RPN(0)[2] = LC_RPN_AND;
+    LC_TEST_ADT_RPN(0)[3] = LC_RPN_EQUAL;
+
+    /* Execute the function being tested */
+    Result = LC_ValidateRPN(LC_TEST_ADT_RPN(0), 3, &IndexValue,
+                            &StackDepthValue);
+
+    /* Verify results */
+    UtAssert_True(Result == LC_ADTVAL_ERR_RPN, "Result == LC_ADTVAL_ERR_RPN");
+    UtAssert_True(IndexValue == 3, "IndexValue == 3");
+    UtAssert_True(StackDepthValue == 1, "StackDepthValue == 1");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end LC_ValidateRPN_Test_NoEqualInLength */
+
+void LC_ValidateRPN_Test_StackTooDeep(void) {
+    uint8 Result;
+    uint16 RPNIndex;
+
+    int32 IndexValue, StackDepthValue;
+
+    for (RPNIndex = 0; RPNIndex <= LC_MAX_RPN_STACK_DEPTH; RPNIndex++) {
+        LC_TEST_ADT_RPN(0)[RPNIndex] = RPNIndex;
+    }
+
+    /* Execute the function being tested */
+    Result = LC_ValidateRPN(LC_TEST_ADT_RPN(0), LC_MAX_RPN_STACK_DEPTH + 1,
+                            &IndexValue, &StackDepthValue);
+
+    /* Verify results */
+    UtAssert_True(Result == LC_ADTVAL_ERR_RPN, "Result == LC_ADTVAL_ERR_RPN");
+    UtAssert_True(IndexValue == LC_MAX_RPN_STACK_DEPTH,
+                  "IndexValue == LC_MAX_RPN_STACK_DEPTH");
+    UtAssert_True(StackDepthValue == LC_MAX_RPN_STACK_DEPTH + 1,
+                  "StackDepthValue == LC_MAX_RPN_STACK_DEPTH + 1");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end LC_ValidateRPN_Test_StackTooDeep */
+
+void LC_CompileActionpoints_Test_Nominal(void) {
+    LC_TEST_ADT_RPN(0)[0] = 0;
+    LC_TEST_ADT_RPN(0)[1] = LC_RPN_EQUAL;
+    LC_TEST_ADT_RPN(0)[2] = 7;
+
+    LC_OperData.ADTPtr[1].RTSId             = 12;
+    LC_OperData.ADTPtr[1].MaxFailsBeforeRTS = 3;
+    LC_TEST_ADT_RPN(1)[0]                   = 4;
+    LC_TEST_ADT_RPN(1)[1]                   = 5;
+    LC_TEST_ADT_RPN(1)[2]                   = LC_RPN_OR;
+    LC_TEST_ADT_RPN(1)[3]                   = LC_RPN_EQUAL;
+
+    LC_OperData.APSamples[1].CurrentState = LC_APSTATE_ACTIVE;
+
+    /* Execute the function being tested */
+    LC_CompileActionpoints();
+
+    /* Verify results */
+    UtAssert_True(LC_OperData.APSamples[0].RPNStart == 0,
+                  "LC_OperData.APSamples[0].RPNStart == 0");
+    UtAssert_True(LC_OperData.APSamples[0].RPNLength == 2,
+                  "LC_OperData.APSamples[0].RPNLength == 2");
+    UtAssert_True(LC_OperData.APSamples[1].RPNStart == LC_TEST_RPN_SLOT,
+                  "LC_OperData.APSamples[1].RPNStart == LC_TEST_RPN_SLOT");
+    UtAssert_True(LC_OperData.APSamples[1].RPNLength == 4,
+                  "LC_OperData.APSamples[1].RPNLength == 4");
+    UtAssert_True(LC_OperData.RPNPool[LC_TEST_RPN_SLOT + 2] == LC_RPN_OR,
+                  "LC_OperData.RPNPool[LC_TEST_RPN_SLOT + 2] == LC_RPN_OR");
+    UtAssert_True(LC_OperData.APSamples[1].RTSId == 12,
+                  "LC_OperData.APSamples[1].RTSId == 12");
+    UtAssert_True(LC_OperData.APSamples[1].MaxFailsBeforeRTS == 3,
+                  "LC_OperData.APSamples[1].MaxFailsBeforeRTS == 3");
+    UtAssert_True(LC_OperData.APSamples[1].CurrentState == LC_APSTATE_ACTIVE,
+                  "LC_OperData.APSamples[1].CurrentState == LC_APSTATE_ACTIVE");
+
+    /* An equation with no LC_RPN_EQUAL keeps all the words it selects */
+    UtAssert_True(LC_OperData.APSamples[2].RPNStart == 2 * LC_TEST_RPN_SLOT,
+                  "LC_OperData.APSamples[2].RPNStart == 2 * LC_TEST_RPN_SLOT");
+    UtAssert_True(LC_OperData.APSamples[2].RPNLength == LC_TEST_RPN_SLOT,
+                  "LC_OperData.APSamples[2].RPNLength == LC_TEST_RPN_SLOT");
+
+} /* end LC_CompileActionpoints_Test_Nominal */
+
+void LC_CompileActionpoints_Test_SharedPoolWords(void) {
+    /* Actionpoints 0 and 1 select the same pool words */
+    LC_TEST_ADT_RPN(0)[0] = 0;
+    LC_TEST_ADT_RPN(0)[1] = 1;
+    LC_TEST_ADT_RPN(0)[2] = LC_RPN_OR;
+    LC_TEST_ADT_RPN(0)[3] = LC_RPN_EQUAL;
+
+    LC_OperData.ADTPtr[1].RPNOffset = LC_OperData.ADTPtr[0].RPNOffset;
+    LC_OperData.ADTPtr[1].RPNLength = 4;
+
+    /* Actionpoint 2 starts outside the pool */
+    LC_OperData.ADTPtr[2].RPNOffset = LC_MAX_RPN_POOL_SIZE;
+
+    LC_OperData.WatchResults[0] = LC_WATCH_FALSE;
+    LC_OperData.WatchResults[1] = LC_WATCH_TRUE;
+
+    /* Execute the function being tested */
+    LC_CompileActionpoints();
+
+    /* Verify results */
+    UtAssert_True(LC_EvaluateRPN(0) == LC_ACTION_FAIL,
+                  "LC_EvaluateRPN(0) == LC_ACTION_FAIL");
+    UtAssert_True(LC_EvaluateRPN(1) == LC_ACTION_FAIL,
+                  "LC_EvaluateRPN(1) == LC_ACTION_FAIL");
+
+    UtAssert_True(LC_OperData.APSamples[2].RPNLength == 0,
+                  "LC_OperData.APSamples[2].RPNLength == 0");
+    UtAssert_True(LC_OperData.APSamples[2].Verified == false,
+                  "LC_OperData.APSamples[2].Verified == false");
+
+    /* The equations are still the same subexpression */
+    UtAssert_True(Ut_CFE_EVS_EventSent(
+                      LC_AP_SHARED_RPN_INF_EID, CFE_EVS_INFORMATION,
+                      "Shared AP subexpressions: Count = 1, Saved = 1/2"),
+                  "Shared AP subexpressions: Count = 1, Saved = 1/2");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 1,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 1");
+
+} /* end LC_CompileActionpoints_Test_SharedPoolWords */
+
+void LC_IndexLiveAPs_Test_SampleOrder(void) {
+    uint16 TableIndex;
+
+    for (TableIndex = 0; TableIndex < LC_MAX_ACTIONPOINTS; TableIndex++) {
+        LC_OperData.APSampleOrder[TableIndex] =
+            LC_MAX_ACTIONPOINTS - 1 - TableIndex;
+        LC_OperData.APSamples[TableIndex].CurrentState = LC_APSTATE_DISABLED;
+    }
+
+    LC_OperData.HaveAPReferences = true;
+
+    LC_OperData.APSamples[0].CurrentState  = LC_APSTATE_ACTIVE;
+    LC_OperData.APSamples[10].CurrentState = LC_APSTATE_PASSIVE;
+    LC_OperData.APSamples[11].CurrentState = LC_ACTION_NOT_USED;
+
+    /* Execute the function being tested */
+    LC_IndexLiveAPs();
+
+    /* Verify results */
+    UtAssert_True(LC_OperData.LiveAPCount == 2,
+                  "LC_OperData.LiveAPCount == 2");
+    UtAssert_True(LC_OperData.LiveAPs[0] == 10,
+                  "LC_OperData.LiveAPs[0] == 10");
+    UtAssert_True(LC_OperData.LiveAPs[1] == 0, "LC_OperData.LiveAPs[1] == 0");
+
+} /* end LC_IndexLiveAPs_Test_SampleOrder */
+
+void LC_GetADTEquation_Test_Nominal(void) {
+    const uint16 *RPNEquation;
+    uint16 RPNLength;
+
+    LC_OperData.ADTPtr[0].RPNOffset = 5;
+    LC_OperData.ADTPtr[0].RPNLength = 3;
+
+    LC_OperData.ADTPtr[1].RPNOffset = LC_MAX_RPN_POOL_SIZE - 2;
+    LC_OperData.ADTPtr[1].RPNLength = 3;
+
+    LC_OperData.ADTPtr[2].RPNOffset = 0;
+    LC_OperData.ADTPtr[2].RPNLength = 2 * LC_TEST_RPN_SLOT + 1;
+
+    LC_OperData.ADTPtr[3].RPNOffset = LC_MAX_RPN_POOL_SIZE;
+    LC_OperData.ADTPtr[3].RPNLength = 3;
+
+    /* Execute the function being tested */
+    RPNEquation = LC_GetADTEquation(&ADTable, 0, &RPNLength);
+
+    /* Verify results */
+    UtAssert_True(RPNEquation == &ADTable.RPNPool[5],
+                  "RPNEquation == &ADTable.RPNPool[5]");
+    UtAssert_True(RPNLength == 3, "RPNLength == 3");
+
+    /* Lengths are only limited to the pool */
+    RPNEquation = LC_GetADTEquation(&ADTable, 1, &RPNLength);
+    UtAssert_True(RPNLength == 2, "RPNLength == 2");
+
+    RPNEquation = LC_GetADTEquation(&ADTable, 2, &RPNLength);
+    UtAssert_True(RPNLength == 2 * LC_TEST_RPN_SLOT + 1,
+                  "RPNLength == 2 * LC_TEST_RPN_SLOT + 1");
+
+    RPNEquation = LC_GetADTEquation(&ADTable, 3, &RPNLength);
+    UtAssert_True(RPNEquation == ADTable.RPNPool,
+                  "RPNEquation == ADTable.RPNPool");
+    UtAssert_True(RPNLength == 0, "RPNLength == 0");
+
+} /* end LC_GetADTEquation_Test_Nominal */
+
+void LC_SyncART_Test_Nominal(void) {
+    LC_OperData.APSamples[2].CurrentState         = LC_APSTATE_PASSIVE;
+    LC_OperData.APSamples[2].ActionResult         = LC_ACTION_FAIL;
+    LC_OperData.APSamples[2].ConsecutiveFailCount = 4;
+
+    /* Execute the function being tested */
+    LC_SyncART();
+
+    /* Verify results */
+    UtAssert_True(LC_OperData.ARTPtr[2].CurrentState == LC_APSTATE_PASSIVE,
+                  "LC_OperData.ARTPtr[2].CurrentState == LC_APSTATE_PASSIVE");
+    UtAssert_True(LC_OperData.ARTPtr[2].ActionResult == LC_ACTION_FAIL,
+                  "LC_OperData.ARTPtr[2].ActionResult == LC_ACTION_FAIL");
+    UtAssert_True(LC_OperData.ARTPtr[2].ConsecutiveFailCount == 4,
+                  "LC_OperData.ARTPtr[2].ConsecutiveFailCount == 4");
+
+} /* end LC_SyncART_Test_Nominal */
+
+void LC_LoadActionResults_Test_Nominal(void) {
+    LC_OperData.ARTPtr[2].CurrentState         = LC_APSTATE_DISABLED;
+    LC_OperData.ARTPtr[2].ActionResult         = LC_ACTION_PASS;
+    LC_OperData.ARTPtr[2].ConsecutiveFailCount = 1;
+
+    /* Execute the function being tested */
+    LC_LoadActionResults();
+
+    /* Verify results */
+    UtAssert_True(
+        LC_OperData.APSamples[2].CurrentState == LC_APSTATE_DISABLED,
+        "LC_OperData.APSamples[2].CurrentState == LC_APSTATE_DISABLED");
+    UtAssert_True(LC_OperData.APSamples[2].ActionResult == LC_ACTION_PASS,
+                  "LC_OperData.APSamples[2].ActionResult == LC_ACTION_PASS");
+    UtAssert_True(LC_OperData.APSamples[2].ConsecutiveFailCount == 1,
+                  "LC_OperData.APSamples[2].ConsecutiveFailCount == 1");
+
+} /* end LC_LoadActionResults_Test_Nominal */
+
+void LC_LoadActionResults_Test_LiveIndex(void) {
+    LC_OperData.ARTPtr[2].CurrentState = LC_APSTATE_PASSIVE;
+    LC_OperData.ARTPtr[5].CurrentState = LC_APSTATE_PERMOFF;
+    LC_OperData.ARTPtr[7].CurrentState = LC_APSTATE_ACTIVE;
+
+    /* Execute the function being tested */
+    LC_LoadActionResults();
+
+    /* Verify results */
+    UtAssert_True(LC_OperData.LiveAPCount == 2,
+                  "LC_OperData.LiveAPCount == 2");
+    UtAssert_True(LC_OperData.LiveAPs[0] == 2, "LC_OperData.LiveAPs[0] == 2");
+    UtAssert_True(LC_OperData.LiveAPs[1] == 7, "LC_OperData.LiveAPs[1] == 7");
+
+} /* end LC_LoadActionResults_Test_LiveIndex */
+
+void LC_CreateAPDependencies_Test_Nominal(void) {
+    LC_TEST_ADT_RPN(0)[0] = 1;
+    LC_TEST_ADT_RPN(0)[1] = 1;
+    LC_TEST_ADT_RPN(0)[2] = LC_RPN_AND;
+    LC_TEST_ADT_RPN(0)[3] = LC_RPN_EQUAL;
+
+    LC_TEST_ADT_RPN(1)[0] = 1;
+    LC_TEST_ADT_RPN(1)[1] = 2;
+    LC_TEST_ADT_RPN(1)[2] = LC_RPN_OR;
+    LC_TEST_ADT_RPN(1)[3] = LC_RPN_EQUAL;
+
+    /* Execute the function being tested (called by LC_CompileActionpoints) */
+    LC_CompileActionpoints();
+
+    /* Verify results */
+    UtAssert_True(LC_OperData.APDependStart[1] == LC_MAX_ACTIONPOINTS - 2,
+                  "LC_OperData.APDependStart[1] == LC_MAX_ACTIONPOINTS - 2");
+    UtAssert_True(LC_OperData.APDependStart[2] == LC_MAX_ACTIONPOINTS,
+                  "LC_OperData.APDependStart[2] == LC_MAX_ACTIONPOINTS");
+    UtAssert_True(LC_OperData.APDependStart[3] == LC_MAX_ACTIONPOINTS + 1,
+                  "LC_OperData.APDependStart[3] == LC_MAX_ACTIONPOINTS + 1");
+    UtAssert_True(LC_OperData.APDependents[0] == 2,
+                  "LC_OperData.APDependents[0] == 2");
+    UtAssert_True(
+        LC_OperData.APDependents[LC_MAX_ACTIONPOINTS - 2] == 0,
+        "LC_OperData.APDependents[LC_MAX_ACTIONPOINTS - 2] == 0");
+    UtAssert_True(
+        LC_OperData.APDependents[LC_MAX_ACTIONPOINTS - 1] == 1,
+        "LC_OperData.APDependents[LC_MAX_ACTIONPOINTS - 1] == 1");
+    UtAssert_True(LC_OperData.APDependents[LC_MAX_ACTIONPOINTS] == 1,
+                  "LC_OperData.APDependents[LC_MAX_ACTIONPOINTS] == 1");
+
+} /* end LC_CreateAPDependencies_Test_Nominal */
+
+void LC_MarkAPsDirty_Test_Nominal(void) {
+    LC_TEST_ADT_RPN(0)[0] = 1;
+    LC_TEST_ADT_RPN(0)[1] = LC_RPN_EQUAL;
+
+    LC_TEST_ADT_RPN(1)[0] = 2;
+    LC_TEST_ADT_RPN(1)[1] = LC_RPN_EQUAL;
+
+    LC_CompileActionpoints();
+
+    LC_OperData.APSamples[0].Dirty = false;
+    LC_OperData.APSamples[1].Dirty = false;
+    LC_OperData.APSamples[2].Dirty = false;
+
+    /* Execute the function being tested */
+    LC_MarkAPsDirty(2);
+
+    /* Verify results */
+    UtAssert_True(LC_OperData.APSamples[0].Dirty == false,
+                  "LC_OperData.APSamples[0].Dirty == false");
+    UtAssert_True(LC_OperData.APSamples[1].Dirty == true,
+                  "LC_OperData.APSamples[1].Dirty == true");
+    UtAssert_True(LC_OperData.APSamples[2].Dirty == false,
+                  "LC_OperData.APSamples[2].Dirty == false");
+
+} /* end LC_MarkAPsDirty_Test_Nominal */
+
+void LC_MarkAPsDirty_Test_DependOverflow(void) {
+    uint32 TableIndex;
+    uint16 RPNIndex;
+    bool AllDirty = true;
+
+    /*
+    ** Every actionpoint selects the same 21 watchpoint equation, more
+    ** dependencies than there are pool words
+    */
+    LC_TEST_ADT_RPN(0)[0] = 0;
+    for (RPNIndex = 1; RPNIndex <= 20; RPNIndex++) {
+        LC_TEST_ADT_RPN(0)[2 * RPNIndex - 1] = RPNIndex;
+        LC_TEST_ADT_RPN(0)[2 * RPNIndex]     = LC_RPN_OR;
+    }
+    LC_TEST_ADT_RPN(0)[41] = LC_RPN_EQUAL;
+
+    for (TableIndex = 0; TableIndex < LC_MAX_ACTIONPOINTS; TableIndex++) {
+        LC_OperData.ADTPtr[TableIndex].RPNOffset = 0;
+        LC_OperData.ADTPtr[TableIndex].RPNLength = 42;
+    }
+
+    LC_CompileActionpoints();
+
+    for (TableIndex = 0; TableIndex < LC_MAX_ACTIONPOINTS; TableIndex++) {
+        LC_OperData.APSamples[TableIndex].Dirty = false;
+    }
+
+    /* Execute the function being tested */
+    LC_MarkAPsDirty(LC_MAX_WATCHPOINTS - 1);
+
+    /* Verify results */
+    for (TableIndex = 0; TableIndex < LC_MAX_ACTIONPOINTS; TableIndex++) {
+        if (LC_OperData.APSamples[TableIndex].Dirty == false) {
+            AllDirty = false;
+        }
+    }
+
+    UtAssert_True(LC_OperData.APDependOverflow == true,
+                  "LC_OperData.APDependOverflow == true");
+    UtAssert_True(AllDirty == true, "AllDirty == true");
+
+} /* end LC_MarkAPsDirty_Test_DependOverflow */
+
+void LC_SampleSingleAP_Test_NotDirty(void) {
+    uint16 APNumber = 0;
+
+    LC_OperData.ADTPtr[APNumber].MaxFailsBeforeRTS = 5;
+    LC_TEST_ADT_RPN(APNumber)[0]                   = 0;
+    LC_TEST_ADT_RPN(APNumber)[1]                   = LC_RPN_EQUAL;
+
+    LC_CompileActionpoints();
+
+    LC_OperData.APSamples[APNumber].CurrentState         = LC_APSTATE_ACTIVE;
+    LC_OperData.APSamples[APNumber].ActionResult         = LC_ACTION_FAIL;
+    LC_OperData.APSamples[APNumber].ConsecutiveFailCount = 1;
+    LC_OperData.APSamples[APNumber].Dirty                = false;
+
+    /* Would evaluate to pass, but the watchpoint did not change */
+    LC_OperData.WatchResults[0] = LC_WATCH_FALSE;
+
+    /* Execute the function being tested */
+    LC_SampleSingleAP(APNumber);
+
+    /* Verify results */
+    UtAssert_True(
+        LC_OperData.APSamples[APNumber].ActionResult == LC_ACTION_FAIL,
+        "LC_OperData.APSamples[APNumber].ActionResult == LC_ACTION_FAIL");
+    UtAssert_True(
+        LC_OperData.APSamples[APNumber].ConsecutiveFailCount == 2,
+        "LC_OperData.APSamples[APNumber].ConsecutiveFailCount == 2");
+    UtAssert_True(LC_OperData.ARTPtr[APNumber].CumulativeFailCount == 1,
+                  "LC_OperData.ARTPtr[APNumber].CumulativeFailCount == 1");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end LC_SampleSingleAP_Test_NotDirty */
+
+void LC_SampleSingleAP_Test_MarksReferrersDirty(void) {
+    LC_TEST_ADT_RPN(0)[0] = LC_RPN_AP(1);
+    LC_TEST_ADT_RPN(0)[1] = LC_RPN_EQUAL;
+
+    LC_OperData.ADTPtr[1].MaxFailsBeforeRTS = 5;
+    LC_TEST_ADT_RPN(1)[0]                   = 0;
+    LC_TEST_ADT_RPN(1)[1]                   = LC_RPN_EQUAL;
+
+    LC_CompileActionpoints();
+
+    LC_OperData.APSamples[0].Dirty        = false;
+    LC_OperData.APSamples[1].CurrentState = LC_APSTATE_ACTIVE;
+    LC_OperData.APSamples[1].ActionResult = LC_ACTION_PASS;
+
+    LC_OperData.WatchResults[0] = LC_WATCH_TRUE;
+
+    /* Execute the function being tested */
+    LC_SampleSingleAP(1);
+
+    /* Verify results */
+    UtAssert_True(LC_OperData.APSamples[1].ActionResult == LC_ACTION_FAIL,
+                  "LC_OperData.APSamples[1].ActionResult == LC_ACTION_FAIL");
+    UtAssert_True(LC_OperData.APSamples[0].Dirty == true,
+                  "LC_OperData.APSamples[0].Dirty == true");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end LC_SampleSingleAP_Test_MarksReferrersDirty */
+
+void LC_CreateAPGroups_Test_Nominal(void) {
+    uint16 APNumber;
+
+    for (APNumber = 0; APNumber < LC_AP_GROUP_MIN_LANES + 1; APNumber++) {
+        LC_TEST_ADT_RPN(APNumber)[0] = APNumber;
+        LC_TEST_ADT_RPN(APNumber)[1] = APNumber + 1;
+        LC_TEST_ADT_RPN(APNumber)[2] = LC_RPN_AND;
+        LC_TEST_ADT_RPN(APNumber)[3] = LC_RPN_EQUAL;
+    }
+
+    /* Same length, different shape */
+    LC_TEST_ADT_RPN(APNumber)[0] = 1;
+    LC_TEST_ADT_RPN(APNumber)[1] = LC_RPN_NOT;
+    LC_TEST_ADT_RPN(APNumber)[2] = LC_RPN_NOT;
+    LC_TEST_ADT_RPN(APNumber)[3] = LC_RPN_EQUAL;
+
+    /* Execute the function being tested (called by LC_CompileActionpoints) */
+    LC_CompileActionpoints();
+
+    /* Verify results */
+    UtAssert_True(LC_OperData.APGroupCount == 1,
+                  "LC_OperData.APGroupCount == 1");
+    UtAssert_True(LC_OperData.APGroups[0].LaneCount ==
+                      LC_AP_GROUP_MIN_LANES + 1,
+                  "LC_OperData.APGroups[0].LaneCount == "
+                  "LC_AP_GROUP_MIN_LANES + 1");
+    UtAssert_True(LC_OperData.APOrder[LC_OperData.APGroups[0].OrderStart] ==
+                      0,
+                  "LC_OperData.APOrder[LC_OperData.APGroups[0].OrderStart] "
+                  "== 0");
+
+} /* end LC_CreateAPGroups_Test_Nominal */
+
+void LC_EvaluateAPGroups_Test_MatchesRPN(void) {
+    uint8 WatchValues[4] = {LC_WATCH_FALSE, LC_WATCH_TRUE, LC_WATCH_ERROR,
+                            LC_WATCH_STALE};
+    uint16 Operators[3]  = {LC_RPN_AND, LC_RPN_OR, LC_RPN_XOR};
+    uint16 OperatorIndex;
+    uint16 APNumber;
+    bool AllMatch = true;
+
+    /* One actionpoint for each pair of operand results and operator */
+    for (APNumber = 0; APNumber < 48; APNumber++) {
+        OperatorIndex = APNumber / 16;
+
+        LC_TEST_ADT_RPN(APNumber)[0] = (APNumber % 16) / 4;
+        LC_TEST_ADT_RPN(APNumber)[1] = APNumber % 4;
+        LC_TEST_ADT_RPN(APNumber)[2] = Operators[OperatorIndex];
+        LC_TEST_ADT_RPN(APNumber)[3] = LC_RPN_NOT;
+        LC_TEST_ADT_RPN(APNumber)[4] = LC_RPN_EQUAL;
+    }
+
+    memcpy(LC_OperData.WatchResults, WatchValues, sizeof(WatchValues));
+
+    LC_CompileActionpoints();
+
+    for (APNumber = 0; APNumber < 48; APNumber++) {
+        LC_OperData.APSamples[APNumber].CurrentState = LC_APSTATE_ACTIVE;
+    }
+
+    /* Execute the function being tested */
+    LC_EvaluateAPGroups(0, LC_MAX_ACTIONPOINTS - 1);
+
+    /* Verify results */
+    for (APNumber = 0; APNumber < 48; APNumber++) {
+        if ((LC_OperData.APSamples[APNumber].HaveGroupResult == false) ||
+            (LC_OperData.APSamples[APNumber].GroupResult !=
+             LC_EvaluateRPN(APNumber))) {
+            AllMatch = false;
+        }
+    }
+
+    UtAssert_True(AllMatch == true, "AllMatch == true");
+
+    UtAssert_True(LC_OperData.APSamples[48].HaveGroupResult == false,
+                  "LC_OperData.APSamples[48].HaveGroupResult == false");
+
+} /* end LC_EvaluateAPGroups_Test_MatchesRPN */
+
+void LC_BuildWatchPlanes_Test_CustomResult(void) {
+    bool Result;
+
+    memset(LC_OperData.WatchResults, LC_WATCH_STALE,
+           sizeof(LC_OperData.WatchResults));
+
+    LC_OperData.WatchResults[0] = LC_WATCH_TRUE;
+    LC_OperData.WatchResults[1] = LC_WATCH_ERROR;
+    LC_OperData.WatchResults[2] = 7;
+
+    /* Execute the function being tested */
+    Result = LC_BuildWatchPlanes();
+
+    /* Verify results */
+    UtAssert_True(Result == false, "Result == false");
+    UtAssert_True(LC_OperData.WatchValidBits[0] == 0x01,
+                  "LC_OperData.WatchValidBits[0] == 0x01");
+    UtAssert_True(LC_OperData.WatchValueBits[0] == 0x03,
+                  "LC_OperData.WatchValueBits[0] == 0x03");
+
+} /* end LC_BuildWatchPlanes_Test_CustomResult */
+
+void LC_VerifyRPN_Test_Nominal(void) {
+    LC_TEST_ADT_RPN(0)[0] = 0;
+    LC_TEST_ADT_RPN(0)[1] = 1;
+    LC_TEST_ADT_RPN(0)[2] = LC_RPN_XOR;
+    LC_TEST_ADT_RPN(0)[3] = LC_RPN_NOT;
+    LC_TEST_ADT_RPN(0)[4] = LC_RPN_EQUAL;
+
+    LC_CompileActionpoints();
+
+    /* Execute the function being tested (called by LC_CompileActionpoints) */
+    LC_OperData.APSamples[0].Verified = LC_VerifyRPN(0);
+
+    /* Verify results */
+    UtAssert_True(LC_OperData.APSamples[0].Verified == true,
+                  "LC_OperData.APSamples[0].Verified == true");
+
+} /* end LC_VerifyRPN_Test_Nominal */
+
+void LC_VerifyRPN_Test_Illegal(void) {
+    uint16 RPNIndex;
+
+    /* Operator without enough operands */
+    LC_TEST_ADT_RPN(0)[0] = 0;
+    LC_TEST_ADT_RPN(0)[1] = LC_RPN_AND;
+    LC_TEST_ADT_RPN(0)[2] = LC_RPN_EQUAL;
+
+    /* Two results left at LC_RPN_EQUAL */
+    LC_TEST_ADT_RPN(1)[0] = 0;
+    LC_TEST_ADT_RPN(1)[1] = 1;
+    LC_TEST_ADT_RPN(1)[2] = LC_RPN_EQUAL;
+
+    /* Watchpoint number out of range */
+    LC_TEST_ADT_RPN(2)[0] = LC_MAX_WATCHPOINTS;
+    LC_TEST_ADT_RPN(2)[1] = LC_RPN_EQUAL;
+
+    /* Deeper than the stack */
+    for (RPNIndex = 0; RPNIndex <= LC_MAX_RPN_STACK_DEPTH; RPNIndex++) {
+        LC_TEST_ADT_RPN(3)[RPNIndex] = 0;
+    }
+    for (; RPNIndex <= 2 * LC_MAX_RPN_STACK_DEPTH; RPNIndex++) {
+        LC_TEST_ADT_RPN(3)[RPNIndex] = LC_RPN_OR;
+    }
+    LC_TEST_ADT_RPN(3)[RPNIndex] = LC_RPN_EQUAL;
+    LC_OperData.ADTPtr[3].RPNLength = 2 * LC_MAX_RPN_STACK_DEPTH + 2;
+
+    /* Execute the function being tested */
+    LC_CompileActionpoints();
+
+    /* Verify results */
+    UtAssert_True(LC_OperData.APSamples[0].Verified == false,
+                  "LC_OperData.APSamples[0].Verified == false");
+    UtAssert_True(LC_OperData.APSamples[1].Verified == false,
+                  "LC_OperData.APSamples[1].Verified == false");
+    UtAssert_True(LC_OperData.APSamples[2].Verified == false,
+                  "LC_OperData.APSamples[2].Verified == false");
+    UtAssert_True(LC_OperData.APSamples[3].Verified == false,
+                  "LC_OperData.APSamples[3].Verified == false");
+
+} /* end LC_VerifyRPN_Test_Illegal */
+
+void LC_EvaluateVerifiedRPN_Test_MatchesChecked(void) {
+    uint8 WatchValues[4] = {LC_WATCH_FALSE, LC_WATCH_TRUE, LC_WATCH_ERROR,
+                            LC_WATCH_STALE};
+    uint16 Operators[3]  = {LC_RPN_AND, LC_RPN_OR, LC_RPN_XOR};
+    uint16 OperatorIndex;
+    uint16 APNumber;
+    uint8 VerifiedResult;
+    bool AllMatch = true;
+
+    /* One actionpoint for each pair of operand results and operator */
+    for (APNumber = 0; APNumber < 48; APNumber++) {
+        OperatorIndex = APNumber / 16;
+
+        LC_TEST_ADT_RPN(APNumber)[0] = (APNumber % 16) / 4;
+        LC_TEST_ADT_RPN(APNumber)[1] = APNumber % 4;
+        LC_TEST_ADT_RPN(APNumber)[2] = Operators[OperatorIndex];
+        LC_TEST_ADT_RPN(APNumber)[3] = LC_RPN_NOT;
+        LC_TEST_ADT_RPN(APNumber)[4] = LC_RPN_EQUAL;
+    }
+
+    memcpy(LC_OperData.WatchResults, WatchValues, sizeof(WatchValues));
+
+    LC_CompileActionpoints();
+
+    /* Execute the function being tested */
+    for (APNumber = 0; APNumber < 48; APNumber++) {
+        VerifiedResult = LC_EvaluateVerifiedRPN(APNumber);
+
+        LC_OperData.APSamples[APNumber].Verified = false;
+
+        if (VerifiedResult != LC_EvaluateRPN(APNumber)) {
+            AllMatch = false;
+        }
+    }
+
+    /* Verify results */
+    UtAssert_True(AllMatch == true, "AllMatch == true");
+
+} /* end LC_EvaluateVerifiedRPN_Test_MatchesChecked */
+
+void LC_CreateSharedRPN_Test_Nominal(void) {
+    uint16 *RPNEquation;
+
+    /* (WP 0 AND WP 1) shared by two equations of different shapes */
+    LC_TEST_ADT_RPN(0)[0] = 0;
+    LC_TEST_ADT_RPN(0)[1] = 1;
+    LC_TEST_ADT_RPN(0)[2] = LC_RPN_AND;
+    LC_TEST_ADT_RPN(0)[3] = 2;
+    LC_TEST_ADT_RPN(0)[4] = LC_RPN_OR;
+    LC_TEST_ADT_RPN(0)[5] = LC_RPN_EQUAL;
+
+    LC_TEST_ADT_RPN(1)[0] = 0;
+    LC_TEST_ADT_RPN(1)[1] = 1;
+    LC_TEST_ADT_RPN(1)[2] = LC_RPN_AND;
+    LC_TEST_ADT_RPN(1)[3] = LC_RPN_NOT;
+    LC_TEST_ADT_RPN(1)[4] = LC_RPN_EQUAL;
+
+    /* Execute the function being tested (called by LC_CompileActionpoints) */
+    LC_CompileActionpoints();
+
+    /* Verify results */
+    RPNEquation =
+        &LC_OperData.RPNPool[LC_OperData.APSamples[0].RPNStart];
+
+    UtAssert_True(LC_OperData.SharedRPNCount == 1,
+                  "LC_OperData.SharedRPNCount == 1");
+    UtAssert_True(LC_OperData.SharedRPN[0].Length == 3,
+                  "LC_OperData.SharedRPN[0].Length == 3");
+    UtAssert_True(LC_OperData.SharedRPN[0].Uses == 2,
+                  "LC_OperData.SharedRPN[0].Uses == 2");
+    UtAssert_True(LC_OperData.APSamples[0].RPNLength == 9,
+                  "LC_OperData.APSamples[0].RPNLength == 9");
+    UtAssert_True(RPNEquation[0] == LC_RPN_SHARED_BEGIN,
+                  "RPNEquation[0] == LC_RPN_SHARED_BEGIN");
+    UtAssert_True(RPNEquation[1] == 0, "RPNEquation[1] == 0");
+    UtAssert_True(RPNEquation[5] == LC_RPN_SHARED_END,
+                  "RPNEquation[5] == LC_RPN_SHARED_END");
+    UtAssert_True(RPNEquation[8] == LC_RPN_EQUAL,
+                  "RPNEquation[8] == LC_RPN_EQUAL");
+
+    UtAssert_True(Ut_CFE_EVS_EventSent(
+                      LC_AP_SHARED_RPN_INF_EID, CFE_EVS_INFORMATION,
+                      "Shared AP subexpressions: Count = 1, Saved = 1/4"),
+                  "Shared AP subexpressions: Count = 1, Saved = 1/4");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 1,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 1");
+
+} /* end LC_CreateSharedRPN_Test_Nominal */
+
+void LC_CreateSharedRPN_Test_NotRepeated(void) {
+    LC_TEST_ADT_RPN(0)[0] = 0;
+    LC_TEST_ADT_RPN(0)[1] = 1;
+    LC_TEST_ADT_RPN(0)[2] = LC_RPN_AND;
+    LC_TEST_ADT_RPN(0)[3] = LC_RPN_EQUAL;
+
+    LC_TEST_ADT_RPN(1)[0] = 0;
+    LC_TEST_ADT_RPN(1)[1] = 1;
+    LC_TEST_ADT_RPN(1)[2] = LC_RPN_OR;
+    LC_TEST_ADT_RPN(1)[3] = LC_RPN_EQUAL;
+
+    /* Execute the function being tested (called by LC_CompileActionpoints) */
+    LC_CompileActionpoints();
+
+    /* Verify results */
+    UtAssert_True(LC_OperData.SharedRPNCount == 0,
+                  "LC_OperData.SharedRPNCount == 0");
+    UtAssert_True(LC_OperData.APSamples[0].RPNLength == 4,
+                  "LC_OperData.APSamples[0].RPNLength == 4");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end LC_CreateSharedRPN_Test_NotRepeated */
+
+void LC_EvaluateVerifiedRPN_Test_SharedResult(void) {
+    uint8 Result;
+
+    LC_TEST_ADT_RPN(0)[0] = 0;
+    LC_TEST_ADT_RPN(0)[1] = 1;
+    LC_TEST_ADT_RPN(0)[2] = LC_RPN_AND;
+    LC_TEST_ADT_RPN(0)[3] = LC_RPN_EQUAL;
+
+    LC_TEST_ADT_RPN(1)[0] = 0;
+    LC_TEST_ADT_RPN(1)[1] = 1;
+    LC_TEST_ADT_RPN(1)[2] = LC_RPN_AND;
+    LC_TEST_ADT_RPN(1)[3] = LC_RPN_NOT;
+    LC_TEST_ADT_RPN(1)[4] = LC_RPN_EQUAL;
+
+    LC_OperData.WatchResults[0] = LC_WATCH_TRUE;
+    LC_OperData.WatchResults[1] = LC_WATCH_TRUE;
+
+    LC_CompileActionpoints();
+
+    /* Execute the function being tested */
+    Result = LC_EvaluateVerifiedRPN(0);
+
+    /* Verify results */
+    UtAssert_True(Result == LC_ACTION_FAIL, "Result == LC_ACTION_FAIL");
+    UtAssert_True(LC_OperData.SharedRPN[0].Valid == true,
+                  "LC_OperData.SharedRPN[0].Valid == true");
+
+    /* The shared result is used for the rest of the sample */
+    LC_OperData.WatchResults[0] = LC_WATCH_FALSE;
+
+    Result = LC_EvaluateVerifiedRPN(1);
+
+    UtAssert_True(Result == LC_ACTION_PASS, "Result == LC_ACTION_PASS");
+
+} /* end LC_EvaluateVerifiedRPN_Test_SharedResult */
+
+void LC_HashRPNSubtrees_Test_Nominal(void) {
+    const LC_RPNSubtree_t *Subtrees;
+    uint16 First;
+
+    LC_TEST_ADT_RPN(0)[0] = 0;
+    LC_TEST_ADT_RPN(0)[1] = 1;
+    LC_TEST_ADT_RPN(0)[2] = LC_RPN_AND;
+    LC_TEST_ADT_RPN(0)[3] = 2;
+    LC_TEST_ADT_RPN(0)[4] = LC_RPN_NOT;
+    LC_TEST_ADT_RPN(0)[5] = LC_RPN_OR;
+    LC_TEST_ADT_RPN(0)[6] = LC_RPN_EQUAL;
+
+    LC_TEST_ADT_RPN(1)[0] = 0;
+    LC_TEST_ADT_RPN(1)[1] = 1;
+    LC_TEST_ADT_RPN(1)[2] = LC_RPN_AND;
+    LC_TEST_ADT_RPN(1)[3] = LC_RPN_NOT;
+    LC_TEST_ADT_RPN(1)[4] = LC_RPN_EQUAL;
+
+    LC_CompileActionpoints();
+
+    /* Execute the function being tested */
+    LC_HashRPNSubtrees();
+
+    /* Verify results */
+    Subtrees = LC_OperData.RPNSubtrees;
+    First    = LC_OperData.APSubtreeStart[0];
+
+    /* (2 NOT) is too short to share */
+    UtAssert_True(LC_OperData.APSubtreeStart[1] == First + 2,
+                  "LC_OperData.APSubtreeStart[1] == First + 2");
+    UtAssert_True(Subtrees[First].Offset == 0, "Subtrees[First].Offset == 0");
+    UtAssert_True(Subtrees[First].Length == 3, "Subtrees[First].Length == 3");
+    UtAssert_True(Subtrees[First].Count == 2, "Subtrees[First].Count == 2");
+    UtAssert_True(Subtrees[First + 1].Offset == 0,
+                  "Subtrees[First + 1].Offset == 0");
+    UtAssert_True(Subtrees[First + 1].Length == 6,
+                  "Subtrees[First + 1].Length == 6");
+
+    /* The second (0 1 AND) refers to the first */
+    UtAssert_True(LC_OperData.APSubtreeStart[2] == First + 4,
+                  "LC_OperData.APSubtreeStart[2] == First + 4");
+    UtAssert_True(Subtrees[First + 2].Match == First,
+                  "Subtrees[First + 2].Match == First");
+    UtAssert_True(Subtrees[First + 3].Match == First + 3,
+                  "Subtrees[First + 3].Match == First + 3");
+    UtAssert_True(Subtrees[First + 3].Count == 1,
+                  "Subtrees[First + 3].Count == 1");
+
+} /* end LC_HashRPNSubtrees_Test_Nominal */
+
+void LC_HashRPNSubtrees_Test_Capped(void) {
+    uint16 APNumber;
+
+    /* Two subtrees in each equation, more than there is room for */
+    for (APNumber = 0; APNumber < LC_MAX_ACTIONPOINTS; APNumber++) {
+        LC_TEST_ADT_RPN(APNumber)[0] = 0;
+        LC_TEST_ADT_RPN(APNumber)[1] = 1;
+        LC_TEST_ADT_RPN(APNumber)[2] = LC_RPN_AND;
+        LC_TEST_ADT_RPN(APNumber)[3] = 2;
+        LC_TEST_ADT_RPN(APNumber)[4] = LC_RPN_OR;
+        LC_TEST_ADT_RPN(APNumber)[5] = LC_RPN_EQUAL;
+    }
+
+    LC_CompileActionpoints();
+
+    for (APNumber = 0; APNumber < LC_MAX_ACTIONPOINTS; APNumber++) {
+        LC_OperData.APSamples[APNumber].Verified  = true;
+        LC_OperData.APSamples[APNumber].Grouped   = false;
+        LC_OperData.APSamples[APNumber].RPNLength = 6;
+    }
+
+    /* Execute the function being tested */
+    LC_HashRPNSubtrees();
+
+    /* Verify results */
+    UtAssert_True(
+        LC_OperData.APSubtreeStart[LC_MAX_ACTIONPOINTS] == LC_MAX_RPN_SUBTREES,
+        "LC_OperData.APSubtreeStart[LC_MAX_ACTIONPOINTS] == "
+        "LC_MAX_RPN_SUBTREES");
+    UtAssert_True(LC_OperData.APSubtreeStart[LC_MAX_RPN_SUBTREES / 2] ==
+                      LC_MAX_RPN_SUBTREES,
+                  "LC_OperData.APSubtreeStart[LC_MAX_RPN_SUBTREES / 2] == "
+                  "LC_MAX_RPN_SUBTREES");
+    UtAssert_True(LC_OperData.RPNSubtrees[LC_MAX_RPN_SUBTREES - 1].Count == 1,
+                  "LC_OperData.RPNSubtrees[LC_MAX_RPN_SUBTREES - 1].Count "
+                  "== 1");
+    UtAssert_True(LC_OperData.RPNSubtrees[0].Count == LC_MAX_RPN_SUBTREES / 2,
+                  "LC_OperData.RPNSubtrees[0].Count == "
+                  "LC_MAX_RPN_SUBTREES / 2");
+
+} /* end LC_HashRPNSubtrees_Test_Capped */
+
+void LC_EvaluateVote_Test_Nominal(void) {
+    uint16 TwoTrue[3]  = {LC_WATCH_TRUE, LC_WATCH_FALSE, LC_WATCH_TRUE};
+    uint16 TwoFalse[3] = {LC_WATCH_FALSE, LC_WATCH_ERROR, LC_WATCH_FALSE};
+    uint16 ErrorUndecided[3] = {LC_WATCH_TRUE, LC_WATCH_ERROR, LC_WATCH_FALSE};
+    uint16 StaleUndecided[3] = {LC_WATCH_TRUE, LC_WATCH_STALE, LC_WATCH_FALSE};
+    uint16 TwoTrueResult;
+    uint16 TwoFalseResult;
+    uint16 ErrorResult;
+    uint16 StaleResult;
+
+    /* Execute the function being tested */
+    TwoTrueResult  = LC_EvaluateVote(LC_RPN_VOTE(2, 3), TwoTrue);
+    TwoFalseResult = LC_EvaluateVote(LC_RPN_VOTE(2, 3), TwoFalse);
+    ErrorResult    = LC_EvaluateVote(LC_RPN_VOTE(2, 3), ErrorUndecided);
+    StaleResult    = LC_EvaluateVote(LC_RPN_VOTE(2, 3), StaleUndecided);
+
+    /* Verify results */
+    UtAssert_True(TwoTrueResult == LC_WATCH_TRUE,
+                  "TwoTrueResult == LC_WATCH_TRUE");
+    UtAssert_True(TwoFalseResult == LC_WATCH_FALSE,
+                  "TwoFalseResult == LC_WATCH_FALSE");
+    UtAssert_True(ErrorResult == LC_WATCH_ERROR,
+                  "ErrorResult == LC_WATCH_ERROR");
+    UtAssert_True(StaleResult == LC_WATCH_STALE,
+                  "StaleResult == LC_WATCH_STALE");
+
+} /* end LC_EvaluateVote_Test_Nominal */
+
+void LC_EvaluateVoteGroup_Test_MatchesVote(void) {
+    uint16 WatchValues[4] = {LC_WATCH_FALSE, LC_WATCH_TRUE, LC_WATCH_ERROR,
+                             LC_WATCH_STALE};
+    uint32 ValidBits[3];
+    uint32 ValueBits[3];
+    uint16 Operands[3];
+    uint16 Combination;
+    uint16 Operand;
+    uint16 Lane;
+    uint16 Half;
+    uint16 Expected;
+    uint16 LaneResult;
+    bool AllMatch = true;
+
+    /* Every combination of 3 operand results, 32 lanes at a time */
+    for (Half = 0; Half < 2; Half++) {
+        memset(ValidBits, 0, sizeof(ValidBits));
+        memset(ValueBits, 0, sizeof(ValueBits));
+
+        for (Lane = 0; Lane < 32; Lane++) {
+            Combination = (Half * 32) + Lane;
+
+            for (Operand = 0; Operand < 3; Operand++) {
+                switch (WatchValues[(Combination >> (Operand * 2)) & 3]) {
+                    case LC_WATCH_TRUE:
+                        ValidBits[Operand] |= 1UL << Lane;
+                        ValueBits[Operand] |= 1UL << Lane;
+                        break;
+                    case LC_WATCH_FALSE:
+                        ValidBits[Operand] |= 1UL << Lane;
+                        break;
+                    case LC_WATCH_ERROR:
+                        ValueBits[Operand] |= 1UL << Lane;
+                        break;
+                    default:
+                        break;
+                }
+            }
+        }
+
+        /* Execute the function being tested */
+        LC_EvaluateVoteGroup(LC_RPN_VOTE(2, 3), ValidBits, ValueBits);
+
+        /* Verify results */
+        for (Lane = 0; Lane < 32; Lane++) {
+            Combination = (Half * 32) + Lane;
+
+            for (Operand = 0; Operand < 3; Operand++) {
+                Operands[Operand] =
+                    WatchValues[(Combination >> (Operand * 2)) & 3];
+            }
+
+            Expected = LC_EvaluateVote(LC_RPN_VOTE(2, 3), Operands);
+
+            if ((ValidBits[0] >> Lane) & 1) {
+                LaneResult = ((ValueBits[0] >> Lane) & 1) ? LC_WATCH_TRUE
+                                                          : LC_WATCH_FALSE;
+            } else {
+                LaneResult = ((ValueBits[0] >> Lane) & 1) ? LC_WATCH_ERROR
+                                                          : LC_WATCH_STALE;
+            }
+
+            if (LaneResult != Expected) {
+                AllMatch = false;
+            }
+        }
+    }
+
+    UtAssert_True(AllMatch == true, "AllMatch == true");
+
+} /* end LC_EvaluateVoteGroup_Test_MatchesVote */
+
+void LC_OrderActionpoints_Test_Nominal(void) {
+    uint16 APOrder[LC_MAX_ACTIONPOINTS];
+    uint16 OrderedCount;
+    uint32 TableIndex;
+
+    for (TableIndex = 0; TableIndex < LC_MAX_ACTIONPOINTS; TableIndex++) {
+        LC_OperData.ADTPtr[TableIndex].DefaultState = LC_ACTION_NOT_USED;
+    }
+
+    /* Actionpoint 0 uses 2, which uses 1 */
+    LC_OperData.ADTPtr[0].DefaultState = LC_APSTATE_ACTIVE;
+    LC_TEST_ADT_RPN(0)[0]              = LC_RPN_AP(2);
+    LC_TEST_ADT_RPN(0)[1]              = LC_RPN_EQUAL;
+
+    LC_OperData.ADTPtr[1].DefaultState = LC_APSTATE_ACTIVE;
+    LC_TEST_ADT_RPN(1)[0]              = 0;
+    LC_TEST_ADT_RPN(1)[1]              = LC_RPN_EQUAL;
+
+    LC_OperData.ADTPtr[2].DefaultState = LC_APSTATE_ACTIVE;
+    LC_TEST_ADT_RPN(2)[0]              = LC_RPN_AP(1);
+    LC_TEST_ADT_RPN(2)[1]              = LC_RPN_EQUAL;
+
+    /* Execute the function being tested */
+    OrderedCount = LC_OrderActionpoints(&ADTable, APOrder);
+
+    /* Verify results */
+    UtAssert_True(OrderedCount == LC_MAX_ACTIONPOINTS,
+                  "OrderedCount == LC_MAX_ACTIONPOINTS");
+    UtAssert_True(APOrder[0] == 1, "APOrder[0] == 1");
+    UtAssert_True(APOrder[1] == 2, "APOrder[1] == 2");
+    UtAssert_True(APOrder[2] == 3, "APOrder[2] == 3");
+    UtAssert_True(APOrder[LC_MAX_ACTIONPOINTS - 1] == 0,
+                  "APOrder[LC_MAX_ACTIONPOINTS - 1] == 0");
+
+} /* end LC_OrderActionpoints_Test_Nominal */
+
+void LC_CreateAPGroups_Test_APReference(void) {
+    uint16 APNumber;
+
+    /* Same shape, but every equation uses an actionpoint result */
+    for (APNumber = 0; APNumber < LC_AP_GROUP_MIN_LANES + 1; APNumber++) {
+        LC_TEST_ADT_RPN(APNumber)[0] = APNumber;
+        LC_TEST_ADT_RPN(APNumber)[1] = LC_RPN_AP(LC_MAX_ACTIONPOINTS - 1);
+        LC_TEST_ADT_RPN(APNumber)[2] = LC_RPN_AND;
+        LC_TEST_ADT_RPN(APNumber)[3] = LC_RPN_EQUAL;
+    }
+
+    /* Execute the function being tested */
+    LC_CompileActionpoints();
+
+    /* Verify results */
+    UtAssert_True(LC_OperData.APSamples[0].Verified == true,
+                  "LC_OperData.APSamples[0].Verified == true");
+    UtAssert_True(LC_OperData.APSamples[0].Grouped == false,
+                  "LC_OperData.APSamples[0].Grouped == false");
+
+} /* end LC_CreateAPGroups_Test_APReference */
+
+void LC_Action_Test_AddTestCases(void) {
+    UtTest_Add(LC_SampleAPs_Test_SingleActionPointNominal, LC_Test_Setup,
+               LC_Test_TearDown, "LC_SampleAPs_Test_SingleActionPointNominal");
+    UtTest_Add(LC_SampleAPs_Test_SingleActionPointError, LC_Test_Setup,
+               LC_Test_TearDown, "LC_SampleAPs_Test_SingleActionPointError");
+    UtTest_Add(LC_SampleAPs_Test_MultiActionPointNominal, LC_Test_Setup,
+               LC_Test_TearDown, "LC_SampleAPs_Test_MultiActionPointNominal");
+    UtTest_Add(LC_SampleAPs_Test_APReferenceOrder, LC_Test_Setup,
+               LC_Test_TearDown, "LC_SampleAPs_Test_APReferenceOrder");
+    UtTest_Add(LC_SampleAPs_Test_LiveActionPointsOnly, LC_Test_Setup,
+               LC_Test_TearDown, "LC_SampleAPs_Test_LiveActionPointsOnly");
+
+    UtTest_Add(LC_SampleSingleAP_Test_StateChangePassToFail, LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_SampleSingleAP_Test_StateChangePassToFail");
+    UtTest_Add(LC_SampleSingleAP_Test_ActiveRequestRTS, LC_Test_Setup,
+               LC_Test_TearDown, "LC_SampleSingleAP_Test_ActiveRequestRTS");
+    UtTest_Add(LC_SampleSingleAP_Test_APFailWhileLCStatePassive, LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_SampleSingleAP_Test_APFailWhileLCStatePassive");
+    UtTest_Add(LC_SampleSingleAP_Test_APFailWhilePassive, LC_Test_Setup,
+               LC_Test_TearDown, "LC_SampleSingleAP_Test_APFailWhilePassive");
+    UtTest_Add(LC_SampleSingleAP_Test_StateChangeFailToPass, LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_SampleSingleAP_Test_StateChangeFailToPass");
+    UtTest_Add(LC_SampleSingleAP_Test_ActionStale, LC_Test_Setup,
+               LC_Test_TearDown, "LC_SampleSingleAP_Test_ActionStale");
+    UtTest_Add(LC_SampleSingleAP_Test_ActionError, LC_Test_Setup,
+               LC_Test_TearDown, "LC_SampleSingleAP_Test_ActionError");
+
+    UtTest_Add(LC_EvaluateRPN_Test_AndWatchFalseOp1, LC_Test_Setup,
+               LC_Test_TearDown, "LC_EvaluateRPN_Test_AndWatchFalseOp1");
+    UtTest_Add(LC_EvaluateRPN_Test_AndWatchFalseOp2, LC_Test_Setup,
+               LC_Test_TearDown, "LC_EvaluateRPN_Test_AndWatchFalseOp2");
+    UtTest_Add(LC_EvaluateRPN_Test_OrWatchTrueOp1, LC_Test_Setup,
+               LC_Test_TearDown, "LC_EvaluateRPN_Test_OrWatchTrueOp1");
+    UtTest_Add(LC_EvaluateRPN_Test_OrWatchTrueOp2, LC_Test_Setup,
+               LC_Test_TearDown, "LC_EvaluateRPN_Test_OrWatchTrueOp2");
+    UtTest_Add(LC_EvaluateRPN_Test_AndWatchErrorOp1, LC_Test_Setup,
+               LC_Test_TearDown, "LC_EvaluateRPN_Test_AndWatchErrorOp1");
+    UtTest_Add(LC_EvaluateRPN_Test_AndWatchErrorOp2, LC_Test_Setup,
+               LC_Test_TearDown, "LC_EvaluateRPN_Test_AndWatchErrorOp2");
+    UtTest_Add(LC_EvaluateRPN_Test_OrWatchErrorOp1, LC_Test_Setup,
+               LC_Test_TearDown, "LC_EvaluateRPN_Test_OrWatchErrorOp1");
+    UtTest_Add(LC_EvaluateRPN_Test_OrWatchErrorOp2, LC_Test_Setup,
+               LC_Test_TearDown, "LC_EvaluateRPN_Test_OrWatchErrorOp2");
+    UtTest_Add(LC_EvaluateRPN_Test_XorWatchErrorOp1, LC_Test_Setup,
+               LC_Test_TearDown, "LC_EvaluateRPN_Test_XorWatchErrorOp1");
+    UtTest_Add(LC_EvaluateRPN_Test_XorWatchErrorOp2, LC_Test_Setup,
+               LC_Test_TearDown, "LC_EvaluateRPN_Test_XorWatchErrorOp2");
+    UtTest_Add(LC_EvaluateRPN_Test_NotWatchError, LC_Test_Setup,
+               LC_Test_TearDown, "LC_EvaluateRPN_Test_NotWatchError");
+    UtTest_Add(LC_EvaluateRPN_Test_AndStaleOp1, LC_Test_Setup, LC_Test_TearDown,
+               "LC_EvaluateRPN_Test_AndStaleOp1");
+    UtTest_Add(LC_EvaluateRPN_Test_AndStaleOp2, LC_Test_Setup, LC_Test_TearDown,
+               "LC_EvaluateRPN_Test_AndStaleOp2");
+    UtTest_Add(LC_EvaluateRPN_Test_OrStaleOp1, LC_Test_Setup, LC_Test_TearDown,
+               "LC_EvaluateRPN_Test_OrStaleOp1");
+    UtTest_Add(LC_EvaluateRPN_Test_OrStaleOp2, LC_Test_Setup, LC_Test_TearDown,
+               "LC_EvaluateRPN_Test_OrStaleOp2");
+    UtTest_Add(LC_EvaluateRPN_Test_XorStaleOp1, LC_Test_Setup, LC_Test_TearDown,
+               "LC_EvaluateRPN_Test_XorStaleOp1");
+    UtTest_Add(LC_EvaluateRPN_Test_XorStaleOp2, LC_Test_Setup, LC_Test_TearDown,
                "LC_EvaluateRPN_Test_XorStaleOp2");
     UtTest_Add(LC_EvaluateRPN_Test_NotStale, LC_Test_Setup, LC_Test_TearDown,
                "LC_EvaluateRPN_Test_NotStale");
@@ -1422,6 +2867,12 @@ void LC_Action_Test_AddTestCases(void) {
                LC_Test_TearDown, "LC_EvaluateRPN_Test_DefaultIllegalRPN");
     UtTest_Add(LC_EvaluateRPN_Test_EndOfBufferWhenNotDone, LC_Test_Setup,
                LC_Test_TearDown, "LC_EvaluateRPN_Test_EndOfBufferWhenNotDone");
+    UtTest_Add(LC_EvaluateRPN_Test_VoteNominal, LC_Test_Setup, LC_Test_TearDown,
+               "LC_EvaluateRPN_Test_VoteNominal");
+    UtTest_Add(LC_EvaluateRPN_Test_VoteIllegalRPN, LC_Test_Setup,
+               LC_Test_TearDown, "LC_EvaluateRPN_Test_VoteIllegalRPN");
+    UtTest_Add(LC_EvaluateRPN_Test_APResultNominal, LC_Test_Setup,
+               LC_Test_TearDown, "LC_EvaluateRPN_Test_APResultNominal");
 
     UtTest_Add(LC_ValidateADT_Test_ActionNotUsed, LC_Test_Setup,
                LC_Test_TearDown, "LC_ValidateADT_Test_ActionNotUsed");
@@ -1438,6 +2889,12 @@ void LC_Action_Test_AddTestCases(void) {
     UtTest_Add(LC_ValidateADT_Test_ValidateRpnAdtValNoError, LC_Test_Setup,
                LC_Test_TearDown,
                "LC_ValidateADT_Test_ValidateRpnAdtValNoError");
+    UtTest_Add(LC_ValidateADT_Test_APReferenceCycle, LC_Test_Setup,
+               LC_Test_TearDown, "LC_ValidateADT_Test_APReferenceCycle");
+    UtTest_Add(LC_ValidateADT_Test_RPNPoolError, LC_Test_Setup,
+               LC_Test_TearDown, "LC_ValidateADT_Test_RPNPoolError");
+    UtTest_Add(LC_ValidateADT_Test_LongEquation, LC_Test_Setup,
+               LC_Test_TearDown, "LC_ValidateADT_Test_LongEquation");
 
     UtTest_Add(LC_ValidateRPN_Test_RpnAnd, LC_Test_Setup, LC_Test_TearDown,
                "LC_ValidateRPN_Test_RpnAnd");
@@ -1451,6 +2908,76 @@ void LC_Action_Test_AddTestCases(void) {
                LC_Test_TearDown, "LC_ValidateRPN_Test_StackDepthZero");
     UtTest_Add(LC_ValidateRPN_Test_InvalidBufferItem, LC_Test_Setup,
                LC_Test_TearDown, "LC_ValidateRPN_Test_InvalidBufferItem");
+    UtTest_Add(LC_ValidateRPN_Test_RpnVote, LC_Test_Setup, LC_Test_TearDown,
+               "LC_ValidateRPN_Test_RpnVote");
+    UtTest_Add(LC_ValidateRPN_Test_VoteTooFewOperands, LC_Test_Setup,
+               LC_Test_TearDown, "LC_ValidateRPN_Test_VoteTooFewOperands");
+    UtTest_Add(LC_ValidateRPN_Test_VoteKMoreThanN, LC_Test_Setup,
+               LC_Test_TearDown, "LC_ValidateRPN_Test_VoteKMoreThanN");
+    UtTest_Add(LC_ValidateRPN_Test_RpnAPResult, LC_Test_Setup, LC_Test_TearDown,
+               "LC_ValidateRPN_Test_RpnAPResult");
+    UtTest_Add(LC_ValidateRPN_Test_APResultOutOfRange, LC_Test_Setup,
+               LC_Test_TearDown, "LC_ValidateRPN_Test_APResultOutOfRange");
+    UtTest_Add(LC_ValidateRPN_Test_NoEqualInLength, LC_Test_Setup,
+               LC_Test_TearDown, "LC_ValidateRPN_Test_NoEqualInLength");
+    UtTest_Add(LC_ValidateRPN_Test_StackTooDeep, LC_Test_Setup,
+               LC_Test_TearDown, "LC_ValidateRPN_Test_StackTooDeep");
+
+    UtTest_Add(LC_CompileActionpoints_Test_Nominal, LC_Test_Setup,
+               LC_Test_TearDown, "LC_CompileActionpoints_Test_Nominal");
+    UtTest_Add(LC_CompileActionpoints_Test_SharedPoolWords, LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_CompileActionpoints_Test_SharedPoolWords");
+    UtTest_Add(LC_GetADTEquation_Test_Nominal, LC_Test_Setup,
+               LC_Test_TearDown, "LC_GetADTEquation_Test_Nominal");
+    UtTest_Add(LC_IndexLiveAPs_Test_SampleOrder, LC_Test_Setup,
+               LC_Test_TearDown, "LC_IndexLiveAPs_Test_SampleOrder");
+    UtTest_Add(LC_SyncART_Test_Nominal, LC_Test_Setup, LC_Test_TearDown,
+               "LC_SyncART_Test_Nominal");
+    UtTest_Add(LC_LoadActionResults_Test_Nominal, LC_Test_Setup,
+               LC_Test_TearDown, "LC_LoadActionResults_Test_Nominal");
+    UtTest_Add(LC_LoadActionResults_Test_LiveIndex, LC_Test_Setup,
+               LC_Test_TearDown, "LC_LoadActionResults_Test_LiveIndex");
+    UtTest_Add(LC_CreateAPDependencies_Test_Nominal, LC_Test_Setup,
+               LC_Test_TearDown, "LC_CreateAPDependencies_Test_Nominal");
+    UtTest_Add(LC_MarkAPsDirty_Test_Nominal, LC_Test_Setup, LC_Test_TearDown,
+               "LC_MarkAPsDirty_Test_Nominal");
+    UtTest_Add(LC_MarkAPsDirty_Test_DependOverflow, LC_Test_Setup,
+               LC_Test_TearDown, "LC_MarkAPsDirty_Test_DependOverflow");
+    UtTest_Add(LC_SampleSingleAP_Test_NotDirty, LC_Test_Setup,
+               LC_Test_TearDown, "LC_SampleSingleAP_Test_NotDirty");
+    UtTest_Add(LC_SampleSingleAP_Test_MarksReferrersDirty, LC_Test_Setup,
+               LC_Test_TearDown, "LC_SampleSingleAP_Test_MarksReferrersDirty");
+    UtTest_Add(LC_CreateAPGroups_Test_Nominal, LC_Test_Setup,
+               LC_Test_TearDown, "LC_CreateAPGroups_Test_Nominal");
+    UtTest_Add(LC_EvaluateAPGroups_Test_MatchesRPN, LC_Test_Setup,
+               LC_Test_TearDown, "LC_EvaluateAPGroups_Test_MatchesRPN");
+    UtTest_Add(LC_BuildWatchPlanes_Test_CustomResult, LC_Test_Setup,
+               LC_Test_TearDown, "LC_BuildWatchPlanes_Test_CustomResult");
+    UtTest_Add(LC_VerifyRPN_Test_Nominal, LC_Test_Setup, LC_Test_TearDown,
+               "LC_VerifyRPN_Test_Nominal");
+    UtTest_Add(LC_VerifyRPN_Test_Illegal, LC_Test_Setup, LC_Test_TearDown,
+               "LC_VerifyRPN_Test_Illegal");
+    UtTest_Add(LC_EvaluateVerifiedRPN_Test_MatchesChecked, LC_Test_Setup,
+               LC_Test_TearDown, "LC_EvaluateVerifiedRPN_Test_MatchesChecked");
+    UtTest_Add(LC_CreateSharedRPN_Test_Nominal, LC_Test_Setup,
+               LC_Test_TearDown, "LC_CreateSharedRPN_Test_Nominal");
+    UtTest_Add(LC_CreateSharedRPN_Test_NotRepeated, LC_Test_Setup,
+               LC_Test_TearDown, "LC_CreateSharedRPN_Test_NotRepeated");
+    UtTest_Add(LC_EvaluateVerifiedRPN_Test_SharedResult, LC_Test_Setup,
+               LC_Test_TearDown, "LC_EvaluateVerifiedRPN_Test_SharedResult");
+    UtTest_Add(LC_HashRPNSubtrees_Test_Nominal, LC_Test_Setup,
+               LC_Test_TearDown, "LC_HashRPNSubtrees_Test_Nominal");
+    UtTest_Add(LC_HashRPNSubtrees_Test_Capped, LC_Test_Setup,
+               LC_Test_TearDown, "LC_HashRPNSubtrees_Test_Capped");
+    UtTest_Add(LC_EvaluateVote_Test_Nominal, LC_Test_Setup, LC_Test_TearDown,
+               "LC_EvaluateVote_Test_Nominal");
+    UtTest_Add(LC_EvaluateVoteGroup_Test_MatchesVote, LC_Test_Setup,
+               LC_Test_TearDown, "LC_EvaluateVoteGroup_Test_MatchesVote");
+    UtTest_Add(LC_OrderActionpoints_Test_Nominal, LC_Test_Setup,
+               LC_Test_TearDown, "LC_OrderActionpoints_Test_Nominal");
+    UtTest_Add(LC_CreateAPGroups_Test_APReference, LC_Test_Setup,
+               LC_Test_TearDown, "LC_CreateAPGroups_Test_APReference");
 
 } /* end LC_Action_Test_AddTestCases */
 
@@ -310,7 +310,7 @@ void LC_AppInit_Test_Nominal(void) {
      * subfunction */
     /* Note: not testing LC_OperData.MessageLinks == 0, because it is modified
      * by a subfunction */
-    /* Note: not testing LC_OperData.WatchPtLinks == 0, because it is modified
+    /* Note: not testing LC_OperData.WatchEvals == 0, because it is modified
      * by a subfunction */
     UtAssert_True(LC_OperData.HaveActiveCDS == 0,
                   "LC_OperData.HaveActiveCDS == 0");
@@ -41,6 +41,7 @@
 #include "lc_msgids.h"
 #include "lc_test_utils.h"
 #include "lc_version.h"
+#include "lc_watch.h"
 #include "ut_cfe_es_hooks.h"
 #include "ut_cfe_es_stubs.h"
 #include "ut_cfe_evs_hooks.h"
@@ -259,6 +260,26 @@ void LC_AppPipe_Test_ResetWPStats(void) {
 
 } /* end LC_AppPipe_Test_ResetWPStats */
 
+void LC_AppPipe_Test_SendMIDStats(void) {
+    int32 Result;
+    LC_NoArgsCmd_t CmdPacket;
+
+    CFE_SB_InitMsg((CFE_SB_MsgPtr_t)(&CmdPacket), LC_CMD_MID,
+                   sizeof(LC_NoArgsCmd_t), TRUE);
+    CFE_SB_SetCmdCode((CFE_SB_MsgPtr_t)(&CmdPacket), LC_SEND_MID_STATS_CC);
+
+    /* Execute the function being tested */
+    Result = LC_AppPipe((CFE_SB_MsgPtr_t)(&CmdPacket));
+
+    /* Verify results */
+    UtAssert_True(Result == CFE_SUCCESS, "Result == CFE_SUCCESS");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 1,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 1");
+    /* Generates 1 event message we don't care about in this test */
+
+} /* end LC_AppPipe_Test_SendMIDStats */
+
 void LC_AppPipe_Test_InvalidCommandCode(void) {
     int32 Result;
     LC_SetAPPermOff_t CmdPacket;
@@ -309,14 +330,15 @@ void LC_SampleAPReq_Test_AllowSampleAllWatchStale(void) {
     LC_AppData.CurrentLCState = 99;
     CmdPacket.StartIndex = CmdPacket.EndIndex = LC_ALL_ACTIONPOINTS;
     CmdPacket.UpdateAge                       = 1;
-    LC_OperData.WRTPtr[0].CountdownToStale    = 1;
+
+    LC_SetStaleCountdown(0, 1);
 
     /* Execute the function being tested */
     LC_SampleAPReq((CFE_SB_MsgPtr_t)(&CmdPacket));
 
     /* Verify results */
-    UtAssert_True(LC_OperData.WRTPtr[0].WatchResult == LC_WATCH_STALE,
-                  "LC_OperData.WRTPtr[0].WatchResult == LC_WATCH_STALE");
+    UtAssert_True(LC_OperData.WatchResults[0] == LC_WATCH_STALE,
+                  "LC_OperData.WatchResults[0] == LC_WATCH_STALE");
 
     UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
                   "Ut_CFE_EVS_GetEventQueueDepth() == 0");
@@ -333,14 +355,15 @@ void LC_SampleAPReq_Test_StartLessOrEqualToEndAndEndWithinArrayWatchStale(
     LC_AppData.CurrentLCState = 99;
     CmdPacket.StartIndex = CmdPacket.EndIndex = LC_MAX_ACTIONPOINTS - 1;
     CmdPacket.UpdateAge                       = 1;
-    LC_OperData.WRTPtr[0].CountdownToStale    = 1;
+
+    LC_SetStaleCountdown(0, 1);
 
     /* Execute the function being tested */
     LC_SampleAPReq((CFE_SB_MsgPtr_t)(&CmdPacket));
 
     /* Verify results */
-    UtAssert_True(LC_OperData.WRTPtr[0].WatchResult == LC_WATCH_STALE,
-                  "LC_OperData.WRTPtr[0].WatchResult == LC_WATCH_STALE");
+    UtAssert_True(LC_OperData.WatchResults[0] == LC_WATCH_STALE,
+                  "LC_OperData.WatchResults[0] == LC_WATCH_STALE");
 
     UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
                   "Ut_CFE_EVS_GetEventQueueDepth() == 0");
@@ -371,6 +394,44 @@ void LC_SampleAPReq_Test_ArrayIndexOutOfRange(void) {
 
 } /* end LC_SampleAPReq_Test_ArrayIndexOutOfRange */
 
+void LC_SampleAPReq_Test_ArrayIndexOutOfRangeNoChange(void) {
+    LC_SampleAP_t CmdPacket;
+
+    CFE_SB_InitMsg((CFE_SB_MsgPtr_t)(&CmdPacket), LC_SAMPLE_AP_MID,
+                   sizeof(LC_SampleAP_t), TRUE);
+
+    LC_AppData.CurrentLCState = 99;
+    CmdPacket.StartIndex      = LC_MAX_ACTIONPOINTS;
+    CmdPacket.EndIndex        = LC_MAX_ACTIONPOINTS;
+
+    /* A snapshot waiting to be evaluated and a timed MessageID */
+    LC_OperData.MessageIDsCount                 = 1;
+    LC_OperData.HaveSnapshots                   = true;
+    LC_OperData.HaveMessagePeriods              = true;
+    LC_OperData.MessageLinks[0].SnapshotPending = true;
+    LC_OperData.MessageLinks[0].StaleTimed      = true;
+
+    /* Execute the function being tested */
+    LC_SampleAPReq((CFE_SB_MsgPtr_t)(&CmdPacket));
+
+    /* Verify results */
+    UtAssert_True(LC_OperData.MessageLinks[0].SnapshotPending == true,
+                  "LC_OperData.MessageLinks[0].SnapshotPending == true");
+    UtAssert_True(LC_OperData.MessageLinks[0].StaleTimed == true,
+                  "LC_OperData.MessageLinks[0].StaleTimed == true");
+
+    UtAssert_True(Ut_CFE_EVS_EventSent(
+                      LC_APSAMPLE_APNUM_ERR_EID, CFE_EVS_ERROR,
+                      "Sample AP error: invalid AP number, start = 176, "
+                      "end = 176"),
+                  "Sample AP error: invalid AP number, start = 176, "
+                  "end = 176");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 1,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 1");
+
+} /* end LC_SampleAPReq_Test_ArrayIndexOutOfRangeNoChange */
+
 void LC_HousekeepingReq_Test_WatchStale(void) {
     int32 Result;
     uint16 TableIndex;
@@ -382,7 +443,7 @@ void LC_HousekeepingReq_Test_WatchStale(void) {
                    sizeof(LC_NoArgsCmd_t), TRUE);
 
     for (TableIndex = 0; TableIndex < LC_MAX_WATCHPOINTS; TableIndex++) {
-        LC_OperData.WRTPtr[TableIndex].WatchResult = LC_WATCH_STALE;
+        LC_OperData.WatchResults[TableIndex] = LC_WATCH_STALE;
     }
 
     /* Set to prevent an unintended error message in subfunction LC_ManageTables
@@ -435,7 +496,7 @@ void LC_HousekeepingReq_Test_WatchFalse(void) {
                    sizeof(LC_NoArgsCmd_t), TRUE);
 
     for (TableIndex = 0; TableIndex < LC_MAX_WATCHPOINTS; TableIndex++) {
-        LC_OperData.WRTPtr[TableIndex].WatchResult = LC_WATCH_FALSE;
+        LC_OperData.WatchResults[TableIndex] = LC_WATCH_FALSE;
     }
 
     /* Set to prevent an unintended error message in subfunction LC_ManageTables
@@ -491,7 +552,7 @@ void LC_HousekeepingReq_Test_WatchTrue(void) {
                    sizeof(LC_NoArgsCmd_t), TRUE);
 
     for (TableIndex = 0; TableIndex < LC_MAX_WATCHPOINTS; TableIndex++) {
-        LC_OperData.WRTPtr[TableIndex].WatchResult = LC_WATCH_TRUE;
+        LC_OperData.WatchResults[TableIndex] = LC_WATCH_TRUE;
     }
 
     /* Set to prevent an unintended error message in subfunction LC_ManageTables
@@ -544,7 +605,7 @@ void LC_HousekeepingReq_Test_WatchError(void) {
                    sizeof(LC_NoArgsCmd_t), TRUE);
 
     for (TableIndex = 0; TableIndex < LC_MAX_WATCHPOINTS; TableIndex++) {
-        LC_OperData.WRTPtr[TableIndex].WatchResult = LC_WATCH_ERROR;
+        LC_OperData.WatchResults[TableIndex] = LC_WATCH_ERROR;
     }
 
     /* Set to prevent an unintended error message in subfunction LC_ManageTables
@@ -597,7 +658,7 @@ void LC_HousekeepingReq_Test_DefaultWatchResult(void) {
                    sizeof(LC_NoArgsCmd_t), TRUE);
 
     for (TableIndex = 0; TableIndex < LC_MAX_WATCHPOINTS; TableIndex++) {
-        LC_OperData.WRTPtr[TableIndex].WatchResult = 99;
+        LC_OperData.WatchResults[TableIndex] = 99;
     }
 
     /* Set to prevent an unintended error message in subfunction LC_ManageTables
@@ -650,8 +711,8 @@ void LC_HousekeepingReq_Test_ActionNotUsedStale(void) {
                    sizeof(LC_NoArgsCmd_t), TRUE);
 
     for (TableIndex = 0; TableIndex < LC_MAX_ACTIONPOINTS; TableIndex++) {
-        LC_OperData.ARTPtr[TableIndex].CurrentState = LC_ACTION_NOT_USED;
-        LC_OperData.ARTPtr[TableIndex].ActionResult = LC_ACTION_STALE;
+        LC_OperData.APSamples[TableIndex].CurrentState = LC_ACTION_NOT_USED;
+        LC_OperData.APSamples[TableIndex].ActionResult = LC_ACTION_STALE;
     }
 
     /* Set to prevent an unintended error message in subfunction LC_ManageTables
@@ -704,8 +765,8 @@ void LC_HousekeepingReq_Test_APStateActiveActionPass(void) {
                    sizeof(LC_NoArgsCmd_t), TRUE);
 
     for (TableIndex = 0; TableIndex < LC_MAX_ACTIONPOINTS; TableIndex++) {
-        LC_OperData.ARTPtr[TableIndex].CurrentState = LC_APSTATE_ACTIVE;
-        LC_OperData.ARTPtr[TableIndex].ActionResult = LC_ACTION_PASS;
+        LC_OperData.APSamples[TableIndex].CurrentState = LC_APSTATE_ACTIVE;
+        LC_OperData.APSamples[TableIndex].ActionResult = LC_ACTION_PASS;
     }
 
     /* Set to prevent an unintended error message in subfunction LC_ManageTables
@@ -761,8 +822,8 @@ void LC_HousekeepingReq_Test_APStatePassiveActionFail(void) {
                    sizeof(LC_NoArgsCmd_t), TRUE);
 
     for (TableIndex = 0; TableIndex < LC_MAX_ACTIONPOINTS; TableIndex++) {
-        LC_OperData.ARTPtr[TableIndex].CurrentState = LC_APSTATE_PASSIVE;
-        LC_OperData.ARTPtr[TableIndex].ActionResult = LC_ACTION_FAIL;
+        LC_OperData.APSamples[TableIndex].CurrentState = LC_APSTATE_PASSIVE;
+        LC_OperData.APSamples[TableIndex].ActionResult = LC_ACTION_FAIL;
     }
 
     /* Set to prevent an unintended error message in subfunction LC_ManageTables
@@ -815,8 +876,8 @@ void LC_HousekeepingReq_Test_APStateDisabledActionError(void) {
                    sizeof(LC_NoArgsCmd_t), TRUE);
 
     for (TableIndex = 0; TableIndex < LC_MAX_ACTIONPOINTS; TableIndex++) {
-        LC_OperData.ARTPtr[TableIndex].CurrentState = LC_APSTATE_DISABLED;
-        LC_OperData.ARTPtr[TableIndex].ActionResult = LC_ACTION_ERROR;
+        LC_OperData.APSamples[TableIndex].CurrentState = LC_APSTATE_DISABLED;
+        LC_OperData.APSamples[TableIndex].ActionResult = LC_ACTION_ERROR;
     }
 
     /* Set to prevent an unintended error message in subfunction LC_ManageTables
@@ -869,8 +930,8 @@ void LC_HousekeepingReq_Test_APStatePermOffActionError(void) {
                    sizeof(LC_NoArgsCmd_t), TRUE);
 
     for (TableIndex = 0; TableIndex < LC_MAX_ACTIONPOINTS; TableIndex++) {
-        LC_OperData.ARTPtr[TableIndex].CurrentState = LC_APSTATE_PERMOFF;
-        LC_OperData.ARTPtr[TableIndex].ActionResult = LC_ACTION_ERROR;
+        LC_OperData.APSamples[TableIndex].CurrentState = LC_APSTATE_PERMOFF;
+        LC_OperData.APSamples[TableIndex].ActionResult = LC_ACTION_ERROR;
     }
 
     /* Set to prevent an unintended error message in subfunction LC_ManageTables
@@ -923,8 +984,8 @@ void LC_HousekeepingReq_Test_DefaultCurrentStateAndActionResult(void) {
                    sizeof(LC_NoArgsCmd_t), TRUE);
 
     for (TableIndex = 0; TableIndex < LC_MAX_ACTIONPOINTS; TableIndex++) {
-        LC_OperData.ARTPtr[TableIndex].CurrentState = 99;
-        LC_OperData.ARTPtr[TableIndex].ActionResult = 99;
+        LC_OperData.APSamples[TableIndex].CurrentState = 99;
+        LC_OperData.APSamples[TableIndex].ActionResult = 99;
     }
 
     /* Set to prevent an unintended error message in subfunction LC_ManageTables
@@ -1030,6 +1091,10 @@ void LC_ResetCounters_Test(void) {
     LC_AppData.RTSExecCount        = 5;
     LC_AppData.PassiveRTSExecCount = 6;
 
+    LC_OperData.MessageIDsCount                = 1;
+    LC_OperData.MessageLinks[0].MessageCount   = 7;
+    LC_OperData.MessageLinks[0].DecimatedCount = 8;
+
     /* Execute the function being tested */
     LC_ResetCounters();
 
@@ -1043,6 +1108,10 @@ void LC_ResetCounters_Test(void) {
     UtAssert_True(LC_AppData.RTSExecCount == 0, "LC_AppData.RTSExecCount == 0");
     UtAssert_True(LC_AppData.PassiveRTSExecCount == 0,
                   "LC_AppData.PassiveRTSExecCount == 0");
+    UtAssert_True(LC_OperData.MessageLinks[0].MessageCount == 0,
+                  "LC_OperData.MessageLinks[0].MessageCount == 0");
+    UtAssert_True(LC_OperData.MessageLinks[0].DecimatedCount == 0,
+                  "LC_OperData.MessageLinks[0].DecimatedCount == 0");
 
     UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
                   "Ut_CFE_EVS_GetEventQueueDepth() == 0");
@@ -1184,7 +1253,7 @@ void LC_SetAPStateCmd_Test_SetAllActionPointsActive(void) {
     CmdPacket.APNumber   = LC_ALL_ACTIONPOINTS;
 
     for (TableIndex = 0; TableIndex < LC_MAX_ACTIONPOINTS; TableIndex++) {
-        LC_OperData.ARTPtr[TableIndex].CurrentState = 99;
+        LC_OperData.APSamples[TableIndex].CurrentState = 99;
     }
 
     /* Execute the function being tested */
@@ -1195,20 +1264,20 @@ void LC_SetAPStateCmd_Test_SetAllActionPointsActive(void) {
     /* Checks for first index: */
     TableIndex = 0;
     UtAssert_True(
-        LC_OperData.ARTPtr[TableIndex].CurrentState == LC_APSTATE_ACTIVE,
-        "LC_OperData.ARTPtr[TableIndex].CurrentState == LC_APSTATE_ACTIVE");
+        LC_OperData.APSamples[TableIndex].CurrentState == LC_APSTATE_ACTIVE,
+        "LC_OperData.APSamples[TableIndex].CurrentState == LC_APSTATE_ACTIVE");
 
     /* Checks for middle index: */
     TableIndex = LC_MAX_ACTIONPOINTS / 2;
     UtAssert_True(
-        LC_OperData.ARTPtr[TableIndex].CurrentState == LC_APSTATE_ACTIVE,
-        "LC_OperData.ARTPtr[TableIndex].CurrentState == LC_APSTATE_ACTIVE");
+        LC_OperData.APSamples[TableIndex].CurrentState == LC_APSTATE_ACTIVE,
+        "LC_OperData.APSamples[TableIndex].CurrentState == LC_APSTATE_ACTIVE");
 
     /* Checks for last index: */
     TableIndex = LC_MAX_ACTIONPOINTS - 1;
     UtAssert_True(
-        LC_OperData.ARTPtr[TableIndex].CurrentState == LC_APSTATE_ACTIVE,
-        "LC_OperData.ARTPtr[TableIndex].CurrentState == LC_APSTATE_ACTIVE");
+        LC_OperData.APSamples[TableIndex].CurrentState == LC_APSTATE_ACTIVE,
+        "LC_OperData.APSamples[TableIndex].CurrentState == LC_APSTATE_ACTIVE");
 
     UtAssert_True(
         Ut_CFE_EVS_EventSent(LC_APSTATE_INF_EID, CFE_EVS_INFORMATION,
@@ -1231,7 +1300,7 @@ void LC_SetAPStateCmd_Test_SetAllActionPointsPassive(void) {
     CmdPacket.APNumber   = LC_ALL_ACTIONPOINTS;
 
     for (TableIndex = 0; TableIndex < LC_MAX_ACTIONPOINTS; TableIndex++) {
-        LC_OperData.ARTPtr[TableIndex].CurrentState = 99;
+        LC_OperData.APSamples[TableIndex].CurrentState = 99;
     }
 
     /* Execute the function being tested */
@@ -1242,20 +1311,20 @@ void LC_SetAPStateCmd_Test_SetAllActionPointsPassive(void) {
     /* Checks for first index: */
     TableIndex = 0;
     UtAssert_True(
-        LC_OperData.ARTPtr[TableIndex].CurrentState == LC_APSTATE_PASSIVE,
-        "LC_OperData.ARTPtr[TableIndex].CurrentState == LC_APSTATE_PASSIVE");
+        LC_OperData.APSamples[TableIndex].CurrentState == LC_APSTATE_PASSIVE,
+        "LC_OperData.APSamples[TableIndex].CurrentState == LC_APSTATE_PASSIVE");
 
     /* Checks for middle index: */
     TableIndex = LC_MAX_ACTIONPOINTS / 2;
     UtAssert_True(
-        LC_OperData.ARTPtr[TableIndex].CurrentState == LC_APSTATE_PASSIVE,
-        "LC_OperData.ARTPtr[TableIndex].CurrentState == LC_APSTATE_PASSIVE");
+        LC_OperData.APSamples[TableIndex].CurrentState == LC_APSTATE_PASSIVE,
+        "LC_OperData.APSamples[TableIndex].CurrentState == LC_APSTATE_PASSIVE");
 
     /* Checks for last index: */
     TableIndex = LC_MAX_ACTIONPOINTS - 1;
     UtAssert_True(
-        LC_OperData.ARTPtr[TableIndex].CurrentState == LC_APSTATE_PASSIVE,
-        "LC_OperData.ARTPtr[TableIndex].CurrentState == LC_APSTATE_PASSIVE");
+        LC_OperData.APSamples[TableIndex].CurrentState == LC_APSTATE_PASSIVE,
+        "LC_OperData.APSamples[TableIndex].CurrentState == LC_APSTATE_PASSIVE");
 
     UtAssert_True(
         Ut_CFE_EVS_EventSent(LC_APSTATE_INF_EID, CFE_EVS_INFORMATION,
@@ -1278,7 +1347,7 @@ void LC_SetAPStateCmd_Test_SetAllActionPointsDisabled(void) {
     CmdPacket.APNumber   = LC_ALL_ACTIONPOINTS;
 
     for (TableIndex = 0; TableIndex < LC_MAX_ACTIONPOINTS; TableIndex++) {
-        LC_OperData.ARTPtr[TableIndex].CurrentState = 99;
+        LC_OperData.APSamples[TableIndex].CurrentState = 99;
     }
 
     /* Execute the function being tested */
@@ -1289,20 +1358,23 @@ void LC_SetAPStateCmd_Test_SetAllActionPointsDisabled(void) {
     /* Checks for first index: */
     TableIndex = 0;
     UtAssert_True(
-        LC_OperData.ARTPtr[TableIndex].CurrentState == LC_APSTATE_DISABLED,
-        "LC_OperData.ARTPtr[TableIndex].CurrentState == LC_APSTATE_DISABLED");
+        LC_OperData.APSamples[TableIndex].CurrentState == LC_APSTATE_DISABLED,
+        "LC_OperData.APSamples[TableIndex].CurrentState == "
+        "LC_APSTATE_DISABLED");
 
     /* Checks for middle index: */
     TableIndex = LC_MAX_ACTIONPOINTS / 2;
     UtAssert_True(
-        LC_OperData.ARTPtr[TableIndex].CurrentState == LC_APSTATE_DISABLED,
-        "LC_OperData.ARTPtr[TableIndex].CurrentState == LC_APSTATE_DISABLED");
+        LC_OperData.APSamples[TableIndex].CurrentState == LC_APSTATE_DISABLED,
+        "LC_OperData.APSamples[TableIndex].CurrentState == "
+        "LC_APSTATE_DISABLED");
 
     /* Checks for last index: */
     TableIndex = LC_MAX_ACTIONPOINTS - 1;
     UtAssert_True(
-        LC_OperData.ARTPtr[TableIndex].CurrentState == LC_APSTATE_DISABLED,
-        "LC_OperData.ARTPtr[TableIndex].CurrentState == LC_APSTATE_DISABLED");
+        LC_OperData.APSamples[TableIndex].CurrentState == LC_APSTATE_DISABLED,
+        "LC_OperData.APSamples[TableIndex].CurrentState == "
+        "LC_APSTATE_DISABLED");
 
     UtAssert_True(
         Ut_CFE_EVS_EventSent(LC_APSTATE_INF_EID, CFE_EVS_INFORMATION,
@@ -1323,16 +1395,20 @@ void LC_SetAPStateCmd_Test_UpdateSingleActionPointActive(void) {
     CmdPacket.NewAPState = LC_APSTATE_ACTIVE;
     CmdPacket.APNumber   = LC_MAX_ACTIONPOINTS - 1;
 
-    LC_OperData.ARTPtr[CmdPacket.APNumber].CurrentState = 99;
+    LC_OperData.APSamples[CmdPacket.APNumber].CurrentState = 99;
 
     /* Execute the function being tested */
     LC_SetAPStateCmd((CFE_SB_MsgPtr_t)(&CmdPacket));
 
     /* Verify results */
-    UtAssert_True(LC_OperData.ARTPtr[CmdPacket.APNumber].CurrentState ==
+    UtAssert_True(LC_OperData.APSamples[CmdPacket.APNumber].CurrentState ==
                       LC_APSTATE_ACTIVE,
-                  "LC_OperData.ARTPtr[CmdPacket.APNumber].CurrentState == "
+                  "LC_OperData.APSamples[CmdPacket.APNumber].CurrentState == "
                   "LC_APSTATE_ACTIVE");
+    UtAssert_True(LC_OperData.LiveAPCount == 1,
+                  "LC_OperData.LiveAPCount == 1");
+    UtAssert_True(LC_OperData.LiveAPs[0] == CmdPacket.APNumber,
+                  "LC_OperData.LiveAPs[0] == CmdPacket.APNumber");
 
     UtAssert_True(
         Ut_CFE_EVS_EventSent(LC_APSTATE_INF_EID, CFE_EVS_INFORMATION,
@@ -1353,15 +1429,15 @@ void LC_SetAPStateCmd_Test_UpdateSingleActionPointPassive(void) {
     CmdPacket.NewAPState = LC_APSTATE_PASSIVE;
     CmdPacket.APNumber   = LC_MAX_ACTIONPOINTS - 1;
 
-    LC_OperData.ARTPtr[CmdPacket.APNumber].CurrentState = 99;
+    LC_OperData.APSamples[CmdPacket.APNumber].CurrentState = 99;
 
     /* Execute the function being tested */
     LC_SetAPStateCmd((CFE_SB_MsgPtr_t)(&CmdPacket));
 
     /* Verify results */
-    UtAssert_True(LC_OperData.ARTPtr[CmdPacket.APNumber].CurrentState ==
+    UtAssert_True(LC_OperData.APSamples[CmdPacket.APNumber].CurrentState ==
                       LC_APSTATE_PASSIVE,
-                  "LC_OperData.ARTPtr[CmdPacket.APNumber].CurrentState == "
+                  "LC_OperData.APSamples[CmdPacket.APNumber].CurrentState == "
                   "LC_APSTATE_PASSIVE");
 
     UtAssert_True(
@@ -1383,15 +1459,15 @@ void LC_SetAPStateCmd_Test_UpdateSingleActionPointDisabled(void) {
     CmdPacket.NewAPState = LC_APSTATE_DISABLED;
     CmdPacket.APNumber   = LC_MAX_ACTIONPOINTS - 1;
 
-    LC_OperData.ARTPtr[CmdPacket.APNumber].CurrentState = 99;
+    LC_OperData.APSamples[CmdPacket.APNumber].CurrentState = 99;
 
     /* Execute the function being tested */
     LC_SetAPStateCmd((CFE_SB_MsgPtr_t)(&CmdPacket));
 
     /* Verify results */
-    UtAssert_True(LC_OperData.ARTPtr[CmdPacket.APNumber].CurrentState ==
+    UtAssert_True(LC_OperData.APSamples[CmdPacket.APNumber].CurrentState ==
                       LC_APSTATE_DISABLED,
-                  "LC_OperData.ARTPtr[CmdPacket.APNumber].CurrentState == "
+                  "LC_OperData.APSamples[CmdPacket.APNumber].CurrentState == "
                   "LC_APSTATE_DISABLED");
 
     UtAssert_True(
@@ -1413,7 +1489,7 @@ void LC_SetAPStateCmd_Test_InvalidCurrentAPStateActive(void) {
     CmdPacket.NewAPState = LC_APSTATE_ACTIVE;
     CmdPacket.APNumber   = LC_MAX_ACTIONPOINTS - 1;
 
-    LC_OperData.ARTPtr[CmdPacket.APNumber].CurrentState = LC_APSTATE_PERMOFF;
+    LC_OperData.APSamples[CmdPacket.APNumber].CurrentState = LC_APSTATE_PERMOFF;
 
     /* Execute the function being tested */
     LC_SetAPStateCmd((CFE_SB_MsgPtr_t)(&CmdPacket));
@@ -1441,7 +1517,7 @@ void LC_SetAPStateCmd_Test_InvalidCurrentAPStatePassive(void) {
     CmdPacket.NewAPState = LC_APSTATE_PASSIVE;
     CmdPacket.APNumber   = LC_MAX_ACTIONPOINTS - 1;
 
-    LC_OperData.ARTPtr[CmdPacket.APNumber].CurrentState = LC_APSTATE_PERMOFF;
+    LC_OperData.APSamples[CmdPacket.APNumber].CurrentState = LC_APSTATE_PERMOFF;
 
     /* Execute the function being tested */
     LC_SetAPStateCmd((CFE_SB_MsgPtr_t)(&CmdPacket));
@@ -1469,7 +1545,7 @@ void LC_SetAPStateCmd_Test_InvalidCurrentAPStateDisabled(void) {
     CmdPacket.NewAPState = LC_APSTATE_DISABLED;
     CmdPacket.APNumber   = LC_MAX_ACTIONPOINTS - 1;
 
-    LC_OperData.ARTPtr[CmdPacket.APNumber].CurrentState = LC_APSTATE_PERMOFF;
+    LC_OperData.APSamples[CmdPacket.APNumber].CurrentState = LC_APSTATE_PERMOFF;
 
     /* Execute the function being tested */
     LC_SetAPStateCmd((CFE_SB_MsgPtr_t)(&CmdPacket));
@@ -1497,7 +1573,7 @@ void LC_SetAPStateCmd_Test_InvalidAPNumberActive(void) {
     CmdPacket.NewAPState = LC_APSTATE_ACTIVE;
     CmdPacket.APNumber   = LC_MAX_ACTIONPOINTS;
 
-    LC_OperData.ARTPtr[CmdPacket.APNumber].CurrentState = LC_APSTATE_PERMOFF;
+    LC_OperData.APSamples[CmdPacket.APNumber].CurrentState = LC_APSTATE_PERMOFF;
 
     /* Execute the function being tested */
     LC_SetAPStateCmd((CFE_SB_MsgPtr_t)(&CmdPacket));
@@ -1524,7 +1600,7 @@ void LC_SetAPStateCmd_Test_InvalidAPNumberPassive(void) {
     CmdPacket.NewAPState = LC_APSTATE_PASSIVE;
     CmdPacket.APNumber   = LC_MAX_ACTIONPOINTS;
 
-    LC_OperData.ARTPtr[CmdPacket.APNumber].CurrentState = LC_APSTATE_PERMOFF;
+    LC_OperData.APSamples[CmdPacket.APNumber].CurrentState = LC_APSTATE_PERMOFF;
 
     /* Execute the function being tested */
     LC_SetAPStateCmd((CFE_SB_MsgPtr_t)(&CmdPacket));
@@ -1551,7 +1627,7 @@ void LC_SetAPStateCmd_Test_InvalidAPNumberDisabled(void) {
     CmdPacket.NewAPState = LC_APSTATE_DISABLED;
     CmdPacket.APNumber   = LC_MAX_ACTIONPOINTS;
 
-    LC_OperData.ARTPtr[CmdPacket.APNumber].CurrentState = LC_APSTATE_PERMOFF;
+    LC_OperData.APSamples[CmdPacket.APNumber].CurrentState = LC_APSTATE_PERMOFF;
 
     /* Execute the function being tested */
     LC_SetAPStateCmd((CFE_SB_MsgPtr_t)(&CmdPacket));
@@ -1625,7 +1701,7 @@ void LC_SetAPPermOffCmd_Test_APNotDisabled(void) {
 
     CmdPacket.APNumber = 1;
 
-    LC_OperData.ARTPtr[CmdPacket.APNumber].CurrentState = 99;
+    LC_OperData.APSamples[CmdPacket.APNumber].CurrentState = 99;
 
     /* Execute the function being tested */
     LC_SetAPPermOffCmd((CFE_SB_MsgPtr_t)(&CmdPacket));
@@ -1652,14 +1728,16 @@ void LC_SetAPPermOffCmd_Test_Nominal(void) {
 
     CmdPacket.APNumber = 1;
 
-    LC_OperData.ARTPtr[CmdPacket.APNumber].CurrentState = LC_APSTATE_DISABLED;
+    LC_OperData.APSamples[CmdPacket.APNumber].CurrentState =
+        LC_APSTATE_DISABLED;
 
     /* Execute the function being tested */
     LC_SetAPPermOffCmd((CFE_SB_MsgPtr_t)(&CmdPacket));
 
     /* Verify results */
-    UtAssert_True(LC_OperData.ARTPtr[CmdPacket.APNumber].CurrentState == 4,
-                  "LC_OperData.ARTPtr[CmdPacket.APNumber].CurrentState == 4");
+    UtAssert_True(
+        LC_OperData.APSamples[CmdPacket.APNumber].CurrentState == 4,
+        "LC_OperData.APSamples[CmdPacket.APNumber].CurrentState == 4");
     UtAssert_True(LC_AppData.CmdCount == 1, "LC_AppData.CmdCount == 1");
 
     UtAssert_True(
@@ -1749,14 +1827,14 @@ void LC_ResetResultsAP_Test(void) {
     boolean ResetStatsCmd = FALSE;
 
     for (TableIndex = StartIndex; TableIndex <= EndIndex; TableIndex++) {
-        LC_OperData.ARTPtr[TableIndex].ActionResult = 99;
-        LC_OperData.ARTPtr[TableIndex].CurrentState = 99;
+        LC_OperData.APSamples[TableIndex].ActionResult = 99;
+        LC_OperData.APSamples[TableIndex].CurrentState = 99;
 
         LC_OperData.ARTPtr[TableIndex].PassiveAPCount  = 99;
         LC_OperData.ARTPtr[TableIndex].FailToPassCount = 99;
         LC_OperData.ARTPtr[TableIndex].PassToFailCount = 99;
 
-        LC_OperData.ARTPtr[TableIndex].ConsecutiveFailCount    = 99;
+        LC_OperData.APSamples[TableIndex].ConsecutiveFailCount = 99;
         LC_OperData.ARTPtr[TableIndex].CumulativeFailCount     = 99;
         LC_OperData.ARTPtr[TableIndex].CumulativeRTSExecCount  = 99;
         LC_OperData.ARTPtr[TableIndex].CumulativeEventMsgsSent = 99;
@@ -1773,11 +1851,11 @@ void LC_ResetResultsAP_Test(void) {
     TableIndex = StartIndex;
 
     UtAssert_True(
-        LC_OperData.ARTPtr[TableIndex].ActionResult == LC_ACTION_STALE,
-        "LC_OperData.ARTPtr[TableIndex].ActionResult == LC_ACTION_STALE");
+        LC_OperData.APSamples[TableIndex].ActionResult == LC_ACTION_STALE,
+        "LC_OperData.APSamples[TableIndex].ActionResult == LC_ACTION_STALE");
 
-    UtAssert_True(LC_OperData.ARTPtr[TableIndex].CurrentState == 1,
-                  "LC_OperData.ARTPtr[TableIndex].CurrentState == 1");
+    UtAssert_True(LC_OperData.APSamples[TableIndex].CurrentState == 1,
+                  "LC_OperData.APSamples[TableIndex].CurrentState == 1");
 
     UtAssert_True(LC_OperData.ARTPtr[TableIndex].PassiveAPCount == 0,
                   "LC_OperData.ARTPtr[TableIndex].PassiveAPCount == 0");
@@ -1786,8 +1864,9 @@ void LC_ResetResultsAP_Test(void) {
     UtAssert_True(LC_OperData.ARTPtr[TableIndex].PassToFailCount == 0,
                   "LC_OperData.ARTPtr[TableIndex].PassToFailCount == 0");
 
-    UtAssert_True(LC_OperData.ARTPtr[TableIndex].ConsecutiveFailCount == 0,
-                  "LC_OperData.ARTPtr[TableIndex].ConsecutiveFailCount == 0");
+    UtAssert_True(
+        LC_OperData.APSamples[TableIndex].ConsecutiveFailCount == 0,
+        "LC_OperData.APSamples[TableIndex].ConsecutiveFailCount == 0");
     UtAssert_True(LC_OperData.ARTPtr[TableIndex].CumulativeFailCount == 0,
                   "LC_OperData.ARTPtr[TableIndex].CumulativeFailCount == 0");
     UtAssert_True(LC_OperData.ARTPtr[TableIndex].CumulativeRTSExecCount == 0,
@@ -1800,11 +1879,11 @@ void LC_ResetResultsAP_Test(void) {
     TableIndex = (StartIndex + EndIndex) / 2;
 
     UtAssert_True(
-        LC_OperData.ARTPtr[TableIndex].ActionResult == LC_ACTION_STALE,
-        "LC_OperData.ARTPtr[TableIndex].ActionResult == LC_ACTION_STALE");
+        LC_OperData.APSamples[TableIndex].ActionResult == LC_ACTION_STALE,
+        "LC_OperData.APSamples[TableIndex].ActionResult == LC_ACTION_STALE");
 
-    UtAssert_True(LC_OperData.ARTPtr[TableIndex].CurrentState == 1,
-                  "LC_OperData.ARTPtr[TableIndex].CurrentState == 1");
+    UtAssert_True(LC_OperData.APSamples[TableIndex].CurrentState == 1,
+                  "LC_OperData.APSamples[TableIndex].CurrentState == 1");
 
     UtAssert_True(LC_OperData.ARTPtr[TableIndex].PassiveAPCount == 0,
                   "LC_OperData.ARTPtr[TableIndex].PassiveAPCount == 0");
@@ -1813,8 +1892,9 @@ void LC_ResetResultsAP_Test(void) {
     UtAssert_True(LC_OperData.ARTPtr[TableIndex].PassToFailCount == 0,
                   "LC_OperData.ARTPtr[TableIndex].PassToFailCount == 0");
 
-    UtAssert_True(LC_OperData.ARTPtr[TableIndex].ConsecutiveFailCount == 0,
-                  "LC_OperData.ARTPtr[TableIndex].ConsecutiveFailCount == 0");
+    UtAssert_True(
+        LC_OperData.APSamples[TableIndex].ConsecutiveFailCount == 0,
+        "LC_OperData.APSamples[TableIndex].ConsecutiveFailCount == 0");
     UtAssert_True(LC_OperData.ARTPtr[TableIndex].CumulativeFailCount == 0,
                   "LC_OperData.ARTPtr[TableIndex].CumulativeFailCount == 0");
     UtAssert_True(LC_OperData.ARTPtr[TableIndex].CumulativeRTSExecCount == 0,
@@ -1824,11 +1904,11 @@ void LC_ResetResultsAP_Test(void) {
     TableIndex = EndIndex;
 
     UtAssert_True(
-        LC_OperData.ARTPtr[TableIndex].ActionResult == LC_ACTION_STALE,
-        "LC_OperData.ARTPtr[TableIndex].ActionResult == LC_ACTION_STALE");
+        LC_OperData.APSamples[TableIndex].ActionResult == LC_ACTION_STALE,
+        "LC_OperData.APSamples[TableIndex].ActionResult == LC_ACTION_STALE");
 
-    UtAssert_True(LC_OperData.ARTPtr[TableIndex].CurrentState == 1,
-                  "LC_OperData.ARTPtr[TableIndex].CurrentState == 1");
+    UtAssert_True(LC_OperData.APSamples[TableIndex].CurrentState == 1,
+                  "LC_OperData.APSamples[TableIndex].CurrentState == 1");
 
     UtAssert_True(LC_OperData.ARTPtr[TableIndex].PassiveAPCount == 0,
                   "LC_OperData.ARTPtr[TableIndex].PassiveAPCount == 0");
@@ -1837,8 +1917,9 @@ void LC_ResetResultsAP_Test(void) {
     UtAssert_True(LC_OperData.ARTPtr[TableIndex].PassToFailCount == 0,
                   "LC_OperData.ARTPtr[TableIndex].PassToFailCount == 0");
 
-    UtAssert_True(LC_OperData.ARTPtr[TableIndex].ConsecutiveFailCount == 0,
-                  "LC_OperData.ARTPtr[TableIndex].ConsecutiveFailCount == 0");
+    UtAssert_True(
+        LC_OperData.APSamples[TableIndex].ConsecutiveFailCount == 0,
+        "LC_OperData.APSamples[TableIndex].ConsecutiveFailCount == 0");
     UtAssert_True(LC_OperData.ARTPtr[TableIndex].CumulativeFailCount == 0,
                   "LC_OperData.ARTPtr[TableIndex].CumulativeFailCount == 0");
     UtAssert_True(LC_OperData.ARTPtr[TableIndex].CumulativeRTSExecCount == 0,
@@ -1919,6 +2000,85 @@ void LC_ResetWPStatsCmd_Test_InvalidWPNumber(void) {
 
 } /* end LC_ResetWPStatsCmd_Test_InvalidWPNumber */
 
+void LC_SendMIDStatsCmd_Test_Nominal(void) {
+    LC_NoArgsCmd_t CmdPacket;
+    uint16 MessageLinkIndex;
+
+    CFE_SB_InitMsg((CFE_SB_MsgPtr_t)(&CmdPacket), LC_CMD_MID,
+                   sizeof(LC_NoArgsCmd_t), TRUE);
+
+    /* One more MessageID than fits in a packet */
+    LC_OperData.MessageIDsCount = LC_MID_STATS_PER_PKT + 1;
+
+    for (MessageLinkIndex = 0; MessageLinkIndex < LC_OperData.MessageIDsCount;
+         MessageLinkIndex++) {
+        LC_OperData.MessageLinks[MessageLinkIndex].MessageID =
+            0x0800 + MessageLinkIndex;
+        LC_OperData.MessageLinks[MessageLinkIndex].MessageDecimation = 1;
+    }
+
+    LC_OperData.MessageLinks[LC_MID_STATS_PER_PKT].MessageDecimation = 10;
+    LC_OperData.MessageLinks[LC_MID_STATS_PER_PKT].MessageCount      = 25;
+    LC_OperData.MessageLinks[LC_MID_STATS_PER_PKT].DecimatedCount    = 22;
+
+    /* Execute the function being tested */
+    LC_SendMIDStatsCmd((CFE_SB_MsgPtr_t)(&CmdPacket));
+
+    /* Verify results, the packet holds the last MessageID sent */
+    UtAssert_True(LC_AppData.CmdCount == 1, "LC_AppData.CmdCount == 1");
+
+    UtAssert_True(LC_OperData.MIDStatsPacket.StartIndex ==
+                      LC_MID_STATS_PER_PKT,
+                  "LC_OperData.MIDStatsPacket.StartIndex == "
+                  "LC_MID_STATS_PER_PKT");
+    UtAssert_True(LC_OperData.MIDStatsPacket.EntryCount == 1,
+                  "LC_OperData.MIDStatsPacket.EntryCount == 1");
+    UtAssert_True(
+        LC_OperData.MIDStatsPacket.Entries[0].MessageDecimation == 10,
+        "LC_OperData.MIDStatsPacket.Entries[0].MessageDecimation == 10");
+    UtAssert_True(LC_OperData.MIDStatsPacket.Entries[0].MessageCount == 25,
+                  "LC_OperData.MIDStatsPacket.Entries[0].MessageCount == 25");
+    UtAssert_True(
+        LC_OperData.MIDStatsPacket.Entries[0].DecimatedCount == 22,
+        "LC_OperData.MIDStatsPacket.Entries[0].DecimatedCount == 22");
+
+    UtAssert_True(
+        Ut_CFE_EVS_EventSent(LC_MID_STATS_INF_EID, CFE_EVS_INFORMATION,
+                             "Send MID stats command: MIDs = 33, Packets = 2"),
+        "Send MID stats command: MIDs = 33, Packets = 2");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 1,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 1");
+
+} /* end LC_SendMIDStatsCmd_Test_Nominal */
+
+void LC_SendMIDStatsCmd_Test_NoMessageIDs(void) {
+    LC_NoArgsCmd_t CmdPacket;
+
+    CFE_SB_InitMsg((CFE_SB_MsgPtr_t)(&CmdPacket), LC_CMD_MID,
+                   sizeof(LC_NoArgsCmd_t), TRUE);
+
+    LC_OperData.MessageIDsCount = 0;
+
+    /* Execute the function being tested */
+    LC_SendMIDStatsCmd((CFE_SB_MsgPtr_t)(&CmdPacket));
+
+    /* Verify results */
+    UtAssert_True(LC_AppData.CmdCount == 1, "LC_AppData.CmdCount == 1");
+
+    UtAssert_True(LC_OperData.MIDStatsPacket.EntryCount == 0,
+                  "LC_OperData.MIDStatsPacket.EntryCount == 0");
+
+    UtAssert_True(
+        Ut_CFE_EVS_EventSent(LC_MID_STATS_INF_EID, CFE_EVS_INFORMATION,
+                             "Send MID stats command: MIDs = 0, Packets = 1"),
+        "Send MID stats command: MIDs = 0, Packets = 1");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 1,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 1");
+
+} /* end LC_SendMIDStatsCmd_Test_NoMessageIDs */
+
 void LC_ResetResultsWP_Test(void) {
     uint32 TableIndex;
     uint32 StartIndex     = 0;
@@ -1926,8 +2086,8 @@ void LC_ResetResultsWP_Test(void) {
     boolean ResetStatsCmd = FALSE;
 
     for (TableIndex = StartIndex; TableIndex <= EndIndex; TableIndex++) {
-        LC_OperData.WRTPtr[TableIndex].WatchResult      = 99;
-        LC_OperData.WRTPtr[TableIndex].CountdownToStale = 99;
+        LC_OperData.WatchResults[TableIndex] = 99;
+        LC_SetStaleCountdown(TableIndex, 99);
 
         LC_OperData.WRTPtr[TableIndex].EvaluationCount      = 99;
         LC_OperData.WRTPtr[TableIndex].FalseToTrueCount     = 99;
@@ -1954,10 +2114,10 @@ void LC_ResetResultsWP_Test(void) {
     TableIndex = StartIndex;
 
     UtAssert_True(
-        LC_OperData.WRTPtr[TableIndex].WatchResult == LC_WATCH_STALE,
-        "LC_OperData.WRTPtr[TableIndex].WatchResult == LC_WATCH_STALE");
-    UtAssert_True(LC_OperData.WRTPtr[TableIndex].CountdownToStale == 0,
-                  "LC_OperData.WRTPtr[TableIndex].CountdownToStale == 0");
+        LC_OperData.WatchResults[TableIndex] == LC_WATCH_STALE,
+        "LC_OperData.WatchResults[TableIndex] == LC_WATCH_STALE");
+    UtAssert_True(LC_GetStaleCountdown(TableIndex) == 0,
+                  "LC_GetStaleCountdown(TableIndex) == 0");
 
     UtAssert_True(LC_OperData.WRTPtr[TableIndex].EvaluationCount == 0,
                   "LC_OperData.WRTPtr[TableIndex].EvaluationCount == 0");
@@ -1996,10 +2156,10 @@ void LC_ResetResultsWP_Test(void) {
     TableIndex = (StartIndex + EndIndex) / 2;
 
     UtAssert_True(
-        LC_OperData.WRTPtr[TableIndex].WatchResult == LC_WATCH_STALE,
-        "LC_OperData.WRTPtr[TableIndex].WatchResult == LC_WATCH_STALE");
-    UtAssert_True(LC_OperData.WRTPtr[TableIndex].CountdownToStale == 0,
-                  "LC_OperData.WRTPtr[TableIndex].CountdownToStale == 0");
+        LC_OperData.WatchResults[TableIndex] == LC_WATCH_STALE,
+        "LC_OperData.WatchResults[TableIndex] == LC_WATCH_STALE");
+    UtAssert_True(LC_GetStaleCountdown(TableIndex) == 0,
+                  "LC_GetStaleCountdown(TableIndex) == 0");
 
     UtAssert_True(LC_OperData.WRTPtr[TableIndex].EvaluationCount == 0,
                   "LC_OperData.WRTPtr[TableIndex].EvaluationCount == 0");
@@ -2038,10 +2198,10 @@ void LC_ResetResultsWP_Test(void) {
     TableIndex = EndIndex;
 
     UtAssert_True(
-        LC_OperData.WRTPtr[TableIndex].WatchResult == LC_WATCH_STALE,
-        "LC_OperData.WRTPtr[TableIndex].WatchResult == LC_WATCH_STALE");
-    UtAssert_True(LC_OperData.WRTPtr[TableIndex].CountdownToStale == 0,
-                  "LC_OperData.WRTPtr[TableIndex].CountdownToStale == 0");
+        LC_OperData.WatchResults[TableIndex] == LC_WATCH_STALE,
+        "LC_OperData.WatchResults[TableIndex] == LC_WATCH_STALE");
+    UtAssert_True(LC_GetStaleCountdown(TableIndex) == 0,
+                  "LC_GetStaleCountdown(TableIndex) == 0");
 
     UtAssert_True(LC_OperData.WRTPtr[TableIndex].EvaluationCount == 0,
                   "LC_OperData.WRTPtr[TableIndex].EvaluationCount == 0");
@@ -2349,6 +2509,8 @@ void LC_Cmds_Test_AddTestCases(void) {
                "LC_AppPipe_Test_ResetAPStats");
     UtTest_Add(LC_AppPipe_Test_ResetWPStats, LC_Test_Setup, LC_Test_TearDown,
                "LC_AppPipe_Test_ResetWPStats");
+    UtTest_Add(LC_AppPipe_Test_SendMIDStats, LC_Test_Setup,
+               LC_Test_TearDown, "LC_AppPipe_Test_SendMIDStats");
     UtTest_Add(LC_AppPipe_Test_InvalidCommandCode, LC_Test_Setup,
                LC_Test_TearDown, "LC_AppPipe_Test_InvalidCommandCode");
     UtTest_Add(LC_AppPipe_Test_MonitorPacket, LC_Test_Setup, LC_Test_TearDown,
@@ -2363,6 +2525,9 @@ void LC_Cmds_Test_AddTestCases(void) {
         "LC_SampleAPReq_Test_StartLessOrEqualToEndAndEndWithinArrayWatchStale");
     UtTest_Add(LC_SampleAPReq_Test_ArrayIndexOutOfRange, LC_Test_Setup,
                LC_Test_TearDown, "LC_SampleAPReq_Test_ArrayIndexOutOfRange");
+    UtTest_Add(LC_SampleAPReq_Test_ArrayIndexOutOfRangeNoChange,
+               LC_Test_Setup, LC_Test_TearDown,
+               "LC_SampleAPReq_Test_ArrayIndexOutOfRangeNoChange");
 
     UtTest_Add(LC_HousekeepingReq_Test_WatchStale, LC_Test_Setup,
                LC_Test_TearDown, "LC_HousekeepingReq_Test_WatchStale");
@@ -2477,6 +2642,10 @@ void LC_Cmds_Test_AddTestCases(void) {
                LC_Test_TearDown, "LC_ResetWPStatsCmd_Test_SingleWatchPoint");
     UtTest_Add(LC_ResetWPStatsCmd_Test_InvalidWPNumber, LC_Test_Setup,
                LC_Test_TearDown, "LC_ResetWPStatsCmd_Test_InvalidWPNumber");
+    UtTest_Add(LC_SendMIDStatsCmd_Test_Nominal, LC_Test_Setup,
+               LC_Test_TearDown, "LC_SendMIDStatsCmd_Test_Nominal");
+    UtTest_Add(LC_SendMIDStatsCmd_Test_NoMessageIDs, LC_Test_Setup,
+               LC_Test_TearDown, "LC_SendMIDStatsCmd_Test_NoMessageIDs");
 
     UtTest_Add(LC_ResetResultsWP_Test, LC_Test_Setup, LC_Test_TearDown,
                "LC_ResetResultsWP_Test");
@@ -57,7 +57,7 @@
 **       Watchpoint Definition Table (WDT)
 **
 **  \par Limits:
-**       This parameter can't be larger than 65520 (0xFFF0) because
+**       This parameter can't be larger than 63488 (0xF800) because
 **       higher values are reserved for use as Reverse Polish
 **       operators. It must be a multiple of 4 to avoid
 **       indexing past the end of the array as LC indexes
@@ -81,8 +81,9 @@
 **       Actionpoint Definition Table (ADT)
 **
 **  \par Limits:
-**       This parameter can't be larger than an unsigned 16 bit
-**       integer (65535). It must be a multiple of 2 to avoid
+**       This parameter can't be larger than 1008 because actionpoint
+**       numbers are used in Reverse Polish equations as operands
+**       0xFC00 to 0xFFEF. It must be a multiple of 2 to avoid
 **       indexing past the end of the array as LC indexes
 **       ahead to build the packed status bytes.
 **
@@ -90,7 +91,8 @@
 **       This parameter will dictate the size of the Actionpoint
 **       Definition Table:
 **
-**       ADT Size = LC_MAX_ACTIONPOINTS * sizeof(#LC_ADTEntry_t)
+**       ADT Size = LC_MAX_ACTIONPOINTS * sizeof(#LC_ADTEntry_t) +
+**                  #LC_MAX_RPN_POOL_SIZE * 2
 **
 **       The total size of this table should not exceed the
 **       cFE size limit for a single buffered table set by the
@@ -127,6 +129,20 @@
 */
 //  #define LC_SAVE_TO_CDS */
 
+/** \lccfg Checked RPN evaluation compiler switch
+**
+**  \par Description:
+**       Compile switch that makes LC evaluate every actionpoint
+**       equation with the interpreter that checks each stack
+**       operation, as a debugging aid. Otherwise the equations
+**       verified when the ADT is loaded are evaluated without
+**       those checks, and only the rest use the checked interpreter.
+**
+**  \par Limits:
+**       n/a
+*/
+/* #define LC_CHECKED_RPN */
+
 /** \lccfg LC state when CDS is restored
 **
 **  \par Description:
@@ -169,18 +185,71 @@
 */
 #define LC_ADT_FILENAME "/cf/apps/lc_def_adt.tbl"
 
-/** \lccfg Maximum reverse polish (RPN) equation size
+/** \lccfg Maximum reverse polish (RPN) equation stack depth
 **
 **  \par Description:
-**       Maximum combined number of operators and operands that may
-**       exist in an actionpoint definition's reverse polish equation
+**       Maximum number of operands an actionpoint definition's reverse
+**       polish equation may have waiting for their operators at once.
+**       This is also the largest N a K of N vote may have.
 **
 **  \par Limits:
-**       The LC app does not place a limit on this parameter.
-**       However, raising this value will increase the size of the
-**       Actionpoint Definition Table (ADT)
+**       This parameter must be at least 2 and can't exceed 127. It
+**       sets the size of the evaluation stacks, not of any table
 */
-#define LC_MAX_RPN_EQU_SIZE 20
+#define LC_MAX_RPN_STACK_DEPTH 20
+
+/** \lccfg Actionpoint definition table RPN pool size
+**
+**  \par Description:
+**       Number of 16 bit words in the RPN pool of the Actionpoint
+**       Definition Table (ADT), which holds the reverse polish
+**       equations of all actionpoints. Each actionpoint selects its
+**       equation by pool offset and length, so equations only take
+**       the words they use and may share words. An equation is only
+**       limited by the pool and by #LC_MAX_RPN_STACK_DEPTH.
+**
+**       The default gives every actionpoint the 20 words each had
+**       before equations moved into a shared pool, so any table
+**       that loaded then still fits.
+**
+**  \par Limits:
+**       This parameter must be at least 2 and can't exceed 65535.
+**       Raising this value will increase the size of the Actionpoint
+**       Definition Table (ADT) and of the compiled equations LC keeps
+**       for it
+*/
+#define LC_MAX_RPN_POOL_SIZE (LC_MAX_ACTIONPOINTS * 20)
+
+/** \lccfg RPN subtrees considered for sharing
+**
+**  \par Description:
+**       Number of subexpressions of 3 or more words LC looks at when
+**       it shares the subexpressions repeated across actionpoint
+**       equations, after an ADT load. Subexpressions are taken in
+**       actionpoint order, and those past this number are evaluated
+**       in each equation that uses them. Each takes 20 bytes that are
+**       only used while the table loads.
+**
+**  \par Limits:
+**       This parameter must be greater than zero and can't be larger
+**       than 65534.
+*/
+#define LC_MAX_RPN_SUBTREES 256
+
+/** \lccfg Shared RPN equation words
+**
+**  \par Description:
+**       Number of 16 bit words set aside, beyond the copy of the ADT
+**       RPN pool, for the equations that use shared subexpressions.
+**       Each such equation is copied with 3 more words for every
+**       shared subexpression it uses, in actionpoint order, and one
+**       that doesn't fit evaluates its subexpressions itself.
+**
+**  \par Limits:
+**       This parameter must be greater than zero and can't be larger
+**       than 65535.
+*/
+#define LC_SHARED_RPN_POOL_WORDS 1024
 
 /** \lccfg Maximum actionpoint event text string size
 **
@@ -214,6 +283,67 @@
 */
 #define LC_MAX_VALID_ADT_RTSID 0xFFF0
 
+/** \lccfg Maximum watchpoint array elements
+**
+**  \par Description:
+**       Maximum number of elements that a single array watchpoint
+**       (a WDT entry with an AggregateType other than #LC_AGGR_NONE)
+**       may cover
+**
+**  \par Limits:
+**       This parameter must be greater than zero and can't be larger
+**       than an unsigned 16 bit integer (65535).
+*/
+#define LC_MAX_WP_ELEMENTS 128
+
+/** \lccfg Watchpoint array element result words
+**
+**  \par Description:
+**       Number of 32 bit words set aside to keep the per element
+**       results of array watchpoints, one bit per element. Words are
+**       handed out in watchpoint table order when the WDT is loaded,
+**       and an array watchpoint that doesn't fit is still evaluated
+**       but has no element results kept.
+**
+**  \par Limits:
+**       This parameter must be greater than zero and less than 65535.
+*/
+#define LC_MAX_ELEMENT_RESULT_WORDS 64
+
+/** \lccfg Latest message snapshot words
+**
+**  \par Description:
+**       Number of 32 bit words set aside to keep a copy of the latest
+**       message of each MessageID whose watchpoints all use
+**       #LC_MONITOR_LATEST. Each MessageID takes the words needed to
+**       hold the data of all its watchpoints. Words are handed out in
+**       the order MessageIDs first appear in the WDT when it is loaded,
+**       and a MessageID that doesn't fit is evaluated as each message
+**       arrives.
+**
+**  \par Limits:
+**       This parameter must be greater than zero and can't be larger
+**       than 1048576.
+*/
+#define LC_SNAPSHOT_POOL_WORDS 256
+
+/** \lccfg Message fingerprint words
+**
+**  \par Description:
+**       Number of 32 bit words set aside to keep the watched bytes of
+**       the last message of each MessageID. A message whose watched
+**       bytes match the ones kept only updates the watchpoint
+**       statistics, without evaluating the watchpoints again. Words
+**       are handed out in the order MessageIDs first appear in the WDT
+**       when it is loaded, and a MessageID that doesn't fit is
+**       evaluated in full every time.
+**
+**  \par Limits:
+**       This parameter must be greater than zero and can't be larger
+**       than 1048576.
+*/
+#define LC_FINGERPRINT_POOL_WORDS 256
+
 /** \lccfg Floating Point Compare Tolerance
 **
 **  \par Description:
@@ -29,14 +29,12 @@ extern LC_OperData_t LC_OperData;
 
 /* Global table variables for table pointers contained in LC_OperData */
 LC_WDTEntry_t WDTable[LC_MAX_WATCHPOINTS];
-LC_ADTEntry_t ADTable[LC_MAX_ACTIONPOINTS];
+LC_ADT_t ADTable;
 LC_WRTEntry_t WRTable[LC_MAX_WATCHPOINTS];
 LC_ARTEntry_t ARTable[LC_MAX_ACTIONPOINTS];
 
 LC_MessageList_t HashTable[LC_HASH_TABLE_ENTRIES];
 
-LC_WatchPtList_t WatchPtList[LC_HASH_TABLE_ENTRIES][LC_MAX_WATCHPOINTS];
-
 /*
  * Function Definitions
  */
@@ -50,26 +48,25 @@ void LC_Test_Setup(void) {
     CFE_PSP_MemSet(&LC_OperData, 0, sizeof(LC_OperData_t));
 
     LC_OperData.WDTPtr = WDTable;
-    LC_OperData.ADTPtr = ADTable;
+    LC_OperData.ADTPtr = ADTable.Entries;
     LC_OperData.WRTPtr = WRTable;
     LC_OperData.ARTPtr = ARTable;
 
     memset(LC_OperData.WDTPtr, 0, sizeof(LC_WDTEntry_t) * LC_MAX_WATCHPOINTS);
-    memset(LC_OperData.ADTPtr, 0, sizeof(LC_ADTEntry_t) * LC_MAX_ACTIONPOINTS);
+    memset(&ADTable, 0, sizeof(LC_ADT_t));
     memset(LC_OperData.WRTPtr, 0, sizeof(LC_WRTEntry_t) * LC_MAX_WATCHPOINTS);
     memset(LC_OperData.ARTPtr, 0, sizeof(LC_ARTEntry_t) * LC_MAX_ACTIONPOINTS);
 
+    /* each actionpoint gets its own equation slot in the RPN pool */
+    for (i = 0; i < LC_MAX_ACTIONPOINTS; i++) {
+        ADTable.Entries[i].RPNOffset = i * LC_TEST_RPN_SLOT;
+        ADTable.Entries[i].RPNLength = LC_TEST_RPN_SLOT;
+    }
+
     for (i = 0; i < LC_HASH_TABLE_ENTRIES; i++) {
         LC_OperData.HashTable[i] = &HashTable[i];
 
         memset(LC_OperData.HashTable[i], 0, sizeof(LC_MessageList_t));
-
-        LC_OperData.HashTable[i]->WatchPtList = WatchPtList[i];
-
-        memset(LC_OperData.HashTable[i]->WatchPtList, 0,
-               sizeof(LC_WatchPtList_t) * LC_MAX_WATCHPOINTS);
-
-        LC_OperData.MessageLinks[i].WatchPtList = WatchPtList[i];
     }
 
     Ut_CFE_EVS_Reset();
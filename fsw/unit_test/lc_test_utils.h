@@ -42,6 +42,21 @@
 #include "ut_osapi_stubs.h"
 #include "ut_osfileapi_stubs.h"
 
+/*
+ * Global table variables for table pointers contained in LC_OperData
+ */
+
+extern LC_ADT_t ADTable;
+
+/*
+ * RPN pool slot of an actionpoint's equation in the test ADT
+ */
+
+#define LC_TEST_RPN_SLOT 20
+
+#define LC_TEST_ADT_RPN(APNumber)                                          \
+    (&ADTable.RPNPool[(APNumber)*LC_TEST_RPN_SLOT])
+
 /*
  * Function Definitions
  */
@@ -96,24 +96,295 @@ void LC_CreateHashTable_Test_NominalAllSameMID(void) {
     LC_CreateHashTable();
 
     /* Verify results */
-    /* Nothing to verify for LC_OperData.WatchPtLinks, because it depends on
-     * LC_AddWatchpoint, which we're not testing here */
+    UtAssert_True(LC_OperData.MessageIDsCount == 1,
+                  "LC_OperData.MessageIDsCount == 1");
+    UtAssert_True(LC_OperData.WatchpointCount == LC_MAX_WATCHPOINTS,
+                  "LC_OperData.WatchpointCount == LC_MAX_WATCHPOINTS");
+    UtAssert_True(LC_OperData.MessageLinks[0].EvalStart == 0,
+                  "LC_OperData.MessageLinks[0].EvalStart == 0");
+    UtAssert_True(
+        LC_OperData.MessageLinks[0].EvalCount == LC_MAX_WATCHPOINTS,
+        "LC_OperData.MessageLinks[0].EvalCount == LC_MAX_WATCHPOINTS");
+    UtAssert_True(
+        LC_OperData.WatchEvals[LC_MAX_WATCHPOINTS - 1].WatchIndex ==
+            LC_MAX_WATCHPOINTS - 1,
+        "LC_OperData.WatchEvals[LC_MAX_WATCHPOINTS - 1].WatchIndex == "
+        "LC_MAX_WATCHPOINTS - 1");
 
     UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
                   "Ut_CFE_EVS_GetEventQueueDepth() == 0");
 
 } /* end LC_CreateHashTable_Test_NominalAllSameMID */
 
-void LC_AddWatchpoint_Test_HashTableAndWatchPtListNullPointersNominal(void) {
-    LC_WatchPtList_t *Result;
-    int32 HashTableIndex     = 1;
+void LC_CreateHashTable_Test_PerfectHashUpperByteMIDs(void) {
+    int32 WatchPtTblIndex;
+    LC_MessageList_t *MessageLink;
+    bool AllFound = true;
+
+    for (WatchPtTblIndex = 0; WatchPtTblIndex < LC_MAX_WATCHPOINTS;
+         WatchPtTblIndex++) {
+        LC_OperData.WDTPtr[WatchPtTblIndex].DataType = LC_WATCH_NOT_USED;
+    }
+
+    /* MessageID's that differ only in their upper byte */
+    for (WatchPtTblIndex = 0; WatchPtTblIndex < 8; WatchPtTblIndex++) {
+        LC_OperData.WDTPtr[WatchPtTblIndex].DataType = LC_DATA_UBYTE;
+        LC_OperData.WDTPtr[WatchPtTblIndex].MessageID =
+            0x08A5 + (WatchPtTblIndex << 8);
+    }
+
+    /* Execute the function being tested */
+    LC_CreateHashTable();
+
+    /* Verify results */
+    for (WatchPtTblIndex = 0; WatchPtTblIndex < 8; WatchPtTblIndex++) {
+        MessageLink =
+            LC_FindMessageLink(LC_OperData.WDTPtr[WatchPtTblIndex].MessageID);
+
+        if ((MessageLink == (LC_MessageList_t *)NULL) ||
+            (MessageLink->EvalCount != 1) ||
+            (LC_OperData.WatchEvals[MessageLink->EvalStart].WatchIndex !=
+             WatchPtTblIndex)) {
+            AllFound = false;
+        }
+    }
+
+    UtAssert_True(LC_OperData.MessageIDsCount == 8,
+                  "LC_OperData.MessageIDsCount == 8");
+    UtAssert_True(AllFound == true, "AllFound == true");
+    UtAssert_True(LC_FindMessageLink(0x08A4) == (LC_MessageList_t *)NULL,
+                  "LC_FindMessageLink(0x08A4) == NULL");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end LC_CreateHashTable_Test_PerfectHashUpperByteMIDs */
+
+void LC_CreateHashTable_Test_LatestSnapshots(void) {
+    int32 WatchPtTblIndex;
+    LC_MessageList_t *BuiltInLink;
+    LC_MessageList_t *CustomLink;
+
+    for (WatchPtTblIndex = 0; WatchPtTblIndex < LC_MAX_WATCHPOINTS;
+         WatchPtTblIndex++) {
+        LC_OperData.WDTPtr[WatchPtTblIndex].DataType = LC_WATCH_NOT_USED;
+    }
+
+    for (WatchPtTblIndex = 0; WatchPtTblIndex < 3; WatchPtTblIndex++) {
+        LC_OperData.WDTPtr[WatchPtTblIndex].DataType    = LC_DATA_UBYTE;
+        LC_OperData.WDTPtr[WatchPtTblIndex].OperatorID  = LC_OPER_EQ;
+        LC_OperData.WDTPtr[WatchPtTblIndex].BitMask     = LC_NO_BITMASK;
+        LC_OperData.WDTPtr[WatchPtTblIndex].MonitorMode = LC_MONITOR_LATEST;
+        LC_OperData.WDTPtr[WatchPtTblIndex].MessageID   = 0x0892;
+    }
+
+    /* A MessageID whose only watchpoint reads its first byte */
+    LC_OperData.WDTPtr[0].MessageID = 0x0891;
+
+    /* A custom function on the other MessageID may read any byte */
+    LC_OperData.WDTPtr[2].OperatorID = LC_OPER_CUSTOM;
+
+    /* Execute the function being tested */
+    LC_CreateHashTable();
+
+    /* Verify results */
+    BuiltInLink = LC_FindMessageLink(0x0891);
+    CustomLink  = LC_FindMessageLink(0x0892);
+
+    UtAssert_True(BuiltInLink->EveryMessage == false,
+                  "BuiltInLink->EveryMessage == false");
+    UtAssert_True(BuiltInLink->SnapshotSize == sizeof(CCSDS_PriHdr_t),
+                  "BuiltInLink->SnapshotSize == sizeof(CCSDS_PriHdr_t)");
+
+    UtAssert_True(CustomLink->EveryMessage == true,
+                  "CustomLink->EveryMessage == true");
+    UtAssert_True(CustomLink->SnapshotSize == 0,
+                  "CustomLink->SnapshotSize == 0");
+
+} /* end LC_CreateHashTable_Test_LatestSnapshots */
+
+void LC_CreateHashTable_Test_SharedData(void) {
+    int32 WatchPtTblIndex;
+    LC_MessageList_t *MessageLink;
+    LC_WatchEval_t *EvalList;
+
+    for (WatchPtTblIndex = 0; WatchPtTblIndex < LC_MAX_WATCHPOINTS;
+         WatchPtTblIndex++) {
+        LC_OperData.WDTPtr[WatchPtTblIndex].DataType = LC_WATCH_NOT_USED;
+    }
+
+    /* Two limits on the same bus voltage, one on another word */
+    for (WatchPtTblIndex = 0; WatchPtTblIndex < 3; WatchPtTblIndex++) {
+        LC_OperData.WDTPtr[WatchPtTblIndex].DataType   = LC_DATA_UWORD_BE;
+        LC_OperData.WDTPtr[WatchPtTblIndex].OperatorID = LC_OPER_LT;
+        LC_OperData.WDTPtr[WatchPtTblIndex].MessageID  = 0x0890;
+        LC_OperData.WDTPtr[WatchPtTblIndex].BitMask    = LC_NO_BITMASK;
+        LC_OperData.WDTPtr[WatchPtTblIndex].WatchpointOffset = 184;
+    }
+
+    LC_OperData.WDTPtr[2].WatchpointOffset = 186;
+
+    /* Execute the function being tested */
+    LC_CreateHashTable();
+
+    /* Verify results */
+    MessageLink = LC_FindMessageLink(0x0890);
+    EvalList    = &LC_OperData.WatchEvals[MessageLink->EvalStart];
+
+    UtAssert_True(EvalList[0].ReuseDatum == false,
+                  "EvalList[0].ReuseDatum == false");
+    UtAssert_True(EvalList[1].ReuseDatum == true,
+                  "EvalList[1].ReuseDatum == true");
+    UtAssert_True(EvalList[1].DatumIndex == EvalList[0].DatumIndex,
+                  "EvalList[1].DatumIndex == EvalList[0].DatumIndex");
+    UtAssert_True(EvalList[2].ReuseDatum == false,
+                  "EvalList[2].ReuseDatum == false");
+
+    UtAssert_True(Ut_CFE_EVS_EventSent(
+                      LC_WP_SHARED_DATA_INF_EID, CFE_EVS_INFORMATION,
+                      "WP data extractions merged: Merged = 1, WPs = 3"),
+                  "WP data extractions merged: Merged = 1, WPs = 3");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 1,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 1");
+
+} /* end LC_CreateHashTable_Test_SharedData */
+
+void LC_CreateFingerprint_Test_MergedSpans(void) {
+    LC_MessageList_t *MessageLink = &LC_OperData.MessageLinks[0];
+    LC_WatchEval_t *EvalPtr       = LC_OperData.WatchEvals;
+
+    MessageLink->EvalStart = 0;
+    MessageLink->EvalCount = 3;
+
+    /* Out of offset order, the first two are close enough to merge */
+    EvalPtr[0].CompareType      = LC_EVAL_UNSIGNED;
+    EvalPtr[0].WatchpointOffset = 40;
+    EvalPtr[0].DataExtent       = 1;
+
+    EvalPtr[1].CompareType      = LC_EVAL_SIGNED;
+    EvalPtr[1].WatchpointOffset = 20;
+    EvalPtr[1].DataExtent       = 2;
+
+    EvalPtr[2].CompareType      = LC_EVAL_FLOAT;
+    EvalPtr[2].WatchpointOffset = 12;
+    EvalPtr[2].DataExtent       = 4;
+
+    /* Execute the function being tested */
+    LC_CreateFingerprint(MessageLink);
+
+    /* Verify results */
+    UtAssert_True(MessageLink->SpanCount == 2,
+                  "MessageLink->SpanCount == 2");
+    UtAssert_True(LC_OperData.WatchSpans[0].Offset == 12,
+                  "LC_OperData.WatchSpans[0].Offset == 12");
+    UtAssert_True(LC_OperData.WatchSpans[0].Length == 10,
+                  "LC_OperData.WatchSpans[0].Length == 10");
+    UtAssert_True(LC_OperData.WatchSpans[1].Offset == 40,
+                  "LC_OperData.WatchSpans[1].Offset == 40");
+    UtAssert_True(LC_OperData.WatchSpans[1].Length == 1,
+                  "LC_OperData.WatchSpans[1].Length == 1");
+    UtAssert_True(LC_OperData.WatchSpanCount == 2,
+                  "LC_OperData.WatchSpanCount == 2");
+    UtAssert_True(LC_OperData.FingerprintWordsUsed == 3,
+                  "LC_OperData.FingerprintWordsUsed == 3");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end LC_CreateFingerprint_Test_MergedSpans */
+
+void LC_CreateFingerprint_Test_CustomFunction(void) {
+    LC_MessageList_t *MessageLink = &LC_OperData.MessageLinks[0];
+    LC_WatchEval_t *EvalPtr       = LC_OperData.WatchEvals;
+
+    MessageLink->EvalStart = 0;
+    MessageLink->EvalCount = 2;
+
+    EvalPtr[0].CompareType      = LC_EVAL_UNSIGNED;
+    EvalPtr[0].WatchpointOffset = 12;
+    EvalPtr[0].DataExtent       = 1;
+
+    EvalPtr[1].CompareType      = LC_EVAL_UNSIGNED;
+    EvalPtr[1].OperatorID       = LC_OPER_CUSTOM;
+    EvalPtr[1].WatchpointOffset = 16;
+    EvalPtr[1].DataExtent       = 1;
+
+    /* Execute the function being tested */
+    LC_CreateFingerprint(MessageLink);
+
+    /* Verify results */
+    UtAssert_True(MessageLink->SpanCount == 0,
+                  "MessageLink->SpanCount == 0");
+    UtAssert_True(LC_OperData.FingerprintWordsUsed == 0,
+                  "LC_OperData.FingerprintWordsUsed == 0");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end LC_CreateFingerprint_Test_CustomFunction */
+
+void LC_CreatePerfectHash_Test_ClusteredMIDs(void) {
+    const LC_HashBucket_t *Bucket;
+    uint32 MessageLinkIndex;
+    uint32 HashTableIndex;
+    uint32 SlotsUsed = 0;
+    bool AllFound    = true;
+
+    /* A full table of MessageID's that share their low byte */
+    LC_OperData.MessageIDsCount = LC_MAX_WATCHPOINTS;
+
+    for (MessageLinkIndex = 0; MessageLinkIndex < LC_MAX_WATCHPOINTS;
+         MessageLinkIndex++) {
+        LC_OperData.MessageLinks[MessageLinkIndex].MessageID =
+            (MessageLinkIndex << 8) | 0x21;
+    }
+
+    /* Execute the function being tested */
+    LC_CreatePerfectHash();
+
+    /* Verify results */
+    for (MessageLinkIndex = 0; MessageLinkIndex < LC_MAX_WATCHPOINTS;
+         MessageLinkIndex++) {
+        if (LC_FindMessageLink(
+                LC_OperData.MessageLinks[MessageLinkIndex].MessageID) !=
+            &LC_OperData.MessageLinks[MessageLinkIndex]) {
+            AllFound = false;
+        }
+    }
+
+    /* The second level tables end within the slots */
+    for (HashTableIndex = 0; HashTableIndex < LC_HASH_TABLE_ENTRIES;
+         HashTableIndex++) {
+        Bucket = &LC_OperData.HashBuckets[HashTableIndex];
+
+        if ((LC_OperData.HashTable[HashTableIndex] !=
+             (LC_MessageList_t *)NULL) &&
+            ((Bucket->SlotStart + (1UL << Bucket->SlotBits)) > SlotsUsed)) {
+            SlotsUsed = Bucket->SlotStart + (1UL << Bucket->SlotBits);
+        }
+    }
+
+    UtAssert_True(AllFound == true, "AllFound == true");
+    UtAssert_True(LC_FindMessageLink(0x0022) == (LC_MessageList_t *)NULL,
+                  "LC_FindMessageLink(0x0022) == NULL");
+    UtAssert_True(SlotsUsed <= LC_HASH_SLOT_ENTRIES,
+                  "SlotsUsed <= LC_HASH_SLOT_ENTRIES");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end LC_CreatePerfectHash_Test_ClusteredMIDs */
+
+void LC_AddWatchpoint_Test_HashTableNullPointerNominal(void) {
+    LC_MessageList_t *Result;
     CFE_SB_MsgId_t MessageID = 1;
+    int32 HashTableIndex     = LC_GetHashTableIndex(MessageID);
 
-    LC_OperData.HashTable[HashTableIndex]   = 0;
-    LC_OperData.MessageLinks[0].WatchPtList = 0;
+    LC_OperData.HashTable[HashTableIndex] = 0;
 
     /* Execute the function being tested */
-    Result = (LC_WatchPtList_t *)LC_AddWatchpoint(MessageID);
+    Result = LC_AddWatchpoint(MessageID);
 
     /* Verify results */
     UtAssert_True(
@@ -122,65 +393,59 @@ void LC_AddWatchpoint_Test_HashTableAndWatchPtListNullPointersNominal(void) {
         "&LC_OperData.MessageLinks[0]");
     UtAssert_True(LC_OperData.MessageLinks[0].MessageID == 1,
                   "LC_OperData.MessageLinks[0].MessageID == 1");
-    UtAssert_True(
-        LC_OperData.MessageLinks[0].WatchPtList == &LC_OperData.WatchPtLinks[0],
-        "LC_OperData.MessageLinks[0].WatchPtList == "
-        "&LC_OperData.WatchPtLinks[0]");
-    UtAssert_True(Result == &LC_OperData.WatchPtLinks[0],
-                  "Result == &LC_OperData.WatchPtLinks[0]");
+    UtAssert_True(LC_OperData.MessageIDsCount == 1,
+                  "LC_OperData.MessageIDsCount == 1");
+    UtAssert_True(Result == &LC_OperData.MessageLinks[0],
+                  "Result == &LC_OperData.MessageLinks[0]");
 
     UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
                   "Ut_CFE_EVS_GetEventQueueDepth() == 0");
 
-} /* end LC_AddWatchpoint_Test_HashTableAndWatchPtListNullPointersNominal */
+} /* end LC_AddWatchpoint_Test_HashTableNullPointerNominal */
 
-void LC_AddWatchpoint_Test_HashTableAndWatchPtListNotNullPointerTwoMsgLinksMIDFound(
-    void) {
-    LC_WatchPtList_t *Result;
-    int32 HashTableIndex     = 0;
+void LC_AddWatchpoint_Test_HashTableNotNullPointerTwoMsgLinksMIDFound(void) {
+    LC_MessageList_t *Result;
     CFE_SB_MsgId_t MessageID = 5;
+    int32 HashTableIndex     = LC_GetHashTableIndex(MessageID);
 
-    LC_OperData.MessageLinks[0].MessageID = 5;
-    LC_OperData.MessageLinks[1].MessageID = 0;
+    LC_OperData.MessageIDsCount           = 2;
+    LC_OperData.MessageLinks[0].MessageID = 0;
+    LC_OperData.MessageLinks[1].MessageID = 5;
 
-    LC_OperData.MessageLinks[0].WatchPtList->Next =
-        &LC_OperData.WatchPtLinks[1];
+    LC_OperData.HashTable[HashTableIndex]       = &LC_OperData.MessageLinks[0];
     LC_OperData.HashTable[HashTableIndex]->Next = &LC_OperData.MessageLinks[1];
 
-    LC_OperData.MessageLinks[1].WatchPtList->Next =
-        &LC_OperData.WatchPtLinks[2];
-
     /* Execute the function being tested */
-    Result = (LC_WatchPtList_t *)LC_AddWatchpoint(MessageID);
+    Result = LC_AddWatchpoint(MessageID);
 
     /* Verify results */
-    UtAssert_True(Result == &LC_OperData.WatchPtLinks[0],
-                  "Result == &LC_OperData.WatchPtLinks[0]");
-    /* Not verifying line "WatchPtLink->Next =
-     * &LC_OperData.WatchPtLinks[LC_OperData.WatchpointCount++]" */
+    UtAssert_True(Result == &LC_OperData.MessageLinks[1],
+                  "Result == &LC_OperData.MessageLinks[1]");
+    UtAssert_True(LC_OperData.MessageIDsCount == 2,
+                  "LC_OperData.MessageIDsCount == 2");
 
     UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
                   "Ut_CFE_EVS_GetEventQueueDepth() == 0");
 
-} /* end
-     LC_AddWatchpoint_Test_HashTableAndWatchPtListNotNullPointerTwoMsgLinksMIDFound
-   */
+} /* end LC_AddWatchpoint_Test_HashTableNotNullPointerTwoMsgLinksMIDFound */
 
 void LC_AddWatchpoint_Test_NullPointersErrorSubscribingWatchpoint(void) {
-    LC_WatchPtList_t *Result;
-    int32 HashTableIndex     = 1;
+    LC_MessageList_t *Result;
     CFE_SB_MsgId_t MessageID = 1;
+    int32 HashTableIndex     = LC_GetHashTableIndex(MessageID);
 
-    LC_OperData.HashTable[HashTableIndex]   = 0;
-    LC_OperData.MessageLinks[0].WatchPtList = 0;
+    LC_OperData.HashTable[HashTableIndex] = 0;
 
     /* Set to generate error message LC_SUB_WP_ERR_EID */
     Ut_CFE_SB_SetReturnCode(UT_CFE_SB_SUBSCRIBE_INDEX, -1, 1);
 
     /* Execute the function being tested */
-    Result = (LC_WatchPtList_t *)LC_AddWatchpoint(MessageID);
+    Result = LC_AddWatchpoint(MessageID);
 
     /* Verify results */
+    UtAssert_True(Result == &LC_OperData.MessageLinks[0],
+                  "Result == &LC_OperData.MessageLinks[0]");
+
     UtAssert_True(
         Ut_CFE_EVS_EventSent(
             LC_SUB_WP_ERR_EID, CFE_EVS_ERROR,
@@ -199,234 +464,1106 @@ void LC_CheckMsgForWPs_Test_Nominal(void) {
     CFE_SB_InitMsg((CFE_SB_MsgPtr_t)(&CmdPacket), 1, sizeof(LC_NoArgsCmd_t),
                    TRUE);
 
-    LC_AppData.CurrentLCState                                 = 99;
-    LC_OperData.HashTable[LC_GetHashTableIndex(1)]->MessageID = 99;
-    LC_OperData.HashTable[LC_GetHashTableIndex(1)]->Next =
-        LC_OperData.HashTable[LC_GetHashTableIndex(2)];
-    LC_OperData.HashTable[LC_GetHashTableIndex(1)]->Next->MessageID = 1;
+    LC_AppData.CurrentLCState             = 99;
+    LC_OperData.MessageIDsCount           = 2;
+    LC_OperData.MessageLinks[0].MessageID = 99;
+    LC_OperData.MessageLinks[1].MessageID = 1;
+    LC_OperData.MessageLinks[1].EvalStart = 0;
+    LC_OperData.MessageLinks[1].EvalCount = 1;
+    LC_OperData.MessageLinks[1].MaxExtent = 1;
+    LC_CreatePerfectHash();
 
-    LC_OperData.HashTable[LC_GetHashTableIndex(1)]
-        ->Next->WatchPtList->WatchIndex             = WatchIndex;
     LC_OperData.WDTPtr[WatchIndex].DataType         = LC_DATA_BYTE;
-    LC_OperData.WDTPtr[WatchIndex].WatchpointOffset = -1;
+    LC_OperData.WDTPtr[WatchIndex].WatchpointOffset = 0;
+    LC_OperData.WDTPtr[WatchIndex].OperatorID       = LC_OPER_CUSTOM;
+
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
+    /* Execute the function being tested */
+    LC_CheckMsgForWPs(1, (CFE_SB_MsgPtr_t)(&CmdPacket));
+
+    /* Verify results */
+    UtAssert_True(LC_AppData.MonitoredMsgCount == 1,
+                  "LC_AppData.MonitoredMsgCount == 1");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 1,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 1");
+    /* Generates 1 event message we don't care about in this test */
+
+} /* end LC_CheckMsgForWPs_Test_Nominal */
+
+void LC_CheckMsgForWPs_Test_ShortMessage(void) {
+    LC_NoArgsCmd_t CmdPacket;
+    LC_MessageList_t *MessageLink;
+    uint16 WatchIndex = 0;
+
+    CFE_SB_InitMsg((CFE_SB_MsgPtr_t)(&CmdPacket), 1, sizeof(LC_NoArgsCmd_t),
+                   TRUE);
+
+    LC_AppData.CurrentLCState = 99;
+
+    MessageLink                 = &LC_OperData.MessageLinks[0];
+    LC_OperData.MessageIDsCount = 1;
+
+    MessageLink->MessageID = 1;
+    MessageLink->EvalStart = 0;
+    MessageLink->EvalCount = 2;
+    MessageLink->MaxExtent = sizeof(LC_NoArgsCmd_t) + 1;
+    LC_CreatePerfectHash();
+
+    /* First WP fits in the message, second one does not */
+    LC_OperData.WDTPtr[WatchIndex].DataType         = LC_DATA_UBYTE;
+    LC_OperData.WDTPtr[WatchIndex].OperatorID       = LC_OPER_EQ;
+    LC_OperData.WDTPtr[WatchIndex].WatchpointOffset = 0;
+    LC_OperData.WDTPtr[WatchIndex].BitMask          = LC_NO_BITMASK;
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
+    LC_OperData.WDTPtr[WatchIndex + 1].DataType   = LC_DATA_UBYTE;
+    LC_OperData.WDTPtr[WatchIndex + 1].OperatorID = LC_OPER_EQ;
+    LC_OperData.WDTPtr[WatchIndex + 1].WatchpointOffset =
+        sizeof(LC_NoArgsCmd_t);
+    LC_CompileWatchpoint(WatchIndex + 1, &LC_OperData.WatchEvals[1]);
+
+    /* Execute the function being tested */
+    LC_CheckMsgForWPs(1, (CFE_SB_MsgPtr_t)(&CmdPacket));
+
+    /* Verify results */
+    UtAssert_True(LC_OperData.WRTPtr[WatchIndex].EvaluationCount == 1,
+                  "LC_OperData.WRTPtr[WatchIndex].EvaluationCount == 1");
+    UtAssert_True(
+        LC_OperData.WatchResults[WatchIndex + 1] == LC_WATCH_ERROR,
+        "LC_OperData.WatchResults[WatchIndex + 1] == LC_WATCH_ERROR");
+    UtAssert_True(LC_AppData.MonitoredMsgCount == 1,
+                  "LC_AppData.MonitoredMsgCount == 1");
+
+    UtAssert_True(Ut_CFE_EVS_EventSent(LC_WP_OFFSET_ERR_EID, CFE_EVS_ERROR,
+                                       "WP offset error: MID = 1, WP = 1, "
+                                       "Offset = 8, DataSize = 1, MsgLen = 8"),
+                  "WP offset error: MID = 1, WP = 1, Offset = 8, DataSize = 1, "
+                  "MsgLen = 8");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 1,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 1");
+
+} /* end LC_CheckMsgForWPs_Test_ShortMessage */
+
+void LC_CheckMsgForWPs_Test_MessagePeriod(void) {
+    LC_NoArgsCmd_t CmdPacket;
+    LC_MessageList_t *MessageLink;
+    uint16 WatchIndex = 0;
+
+    CFE_SB_InitMsg((CFE_SB_MsgPtr_t)(&CmdPacket), 1, sizeof(LC_NoArgsCmd_t),
+                   TRUE);
+
+    LC_AppData.CurrentLCState = 99;
+
+    MessageLink                 = &LC_OperData.MessageLinks[0];
+    LC_OperData.MessageIDsCount = 1;
+
+    MessageLink->MessageID     = 1;
+    MessageLink->EvalStart     = 0;
+    MessageLink->EvalCount     = 1;
+    MessageLink->MaxExtent     = 1;
+    MessageLink->MessagePeriod = 1500;
+    MessageLink->StaleTimed    = false;
+    LC_CreatePerfectHash();
+
+    LC_OperData.WDTPtr[WatchIndex].DataType         = LC_DATA_UBYTE;
+    LC_OperData.WDTPtr[WatchIndex].OperatorID       = LC_OPER_EQ;
+    LC_OperData.WDTPtr[WatchIndex].WatchpointOffset = 0;
+    LC_OperData.WDTPtr[WatchIndex].BitMask          = LC_NO_BITMASK;
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
+    /* Execute the function being tested */
+    LC_CheckMsgForWPs(1, (CFE_SB_MsgPtr_t)(&CmdPacket));
+
+    /* Verify results */
+    UtAssert_True(MessageLink->StaleTimed == true,
+                  "MessageLink->StaleTimed == true");
+    UtAssert_True(LC_AppData.MonitoredMsgCount == 1,
+                  "LC_AppData.MonitoredMsgCount == 1");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end LC_CheckMsgForWPs_Test_MessagePeriod */
+
+void LC_CheckMsgForWPs_Test_MessagePeriodLCClock(void) {
+    LC_HkPacket_t TlmPacket;
+    LC_MessageList_t *MessageLink;
+    CFE_TIME_SysTime_t MessageTime = {1000, 0};
+    uint16 WatchIndex              = 0;
+
+    CFE_SB_InitMsg((CFE_SB_MsgPtr_t)(&TlmPacket), LC_HK_TLM_MID,
+                   sizeof(LC_HkPacket_t), TRUE);
+
+    /* The message time stamp is well ahead of the LC clock */
+    CFE_SB_SetMsgTime((CFE_SB_MsgPtr_t)(&TlmPacket), MessageTime);
+
+    LC_AppData.CurrentLCState = 99;
+
+    MessageLink                 = &LC_OperData.MessageLinks[0];
+    LC_OperData.MessageIDsCount = 1;
+
+    MessageLink->MessageID     = LC_HK_TLM_MID;
+    MessageLink->EvalStart     = 0;
+    MessageLink->EvalCount     = 1;
+    MessageLink->MaxExtent     = 1;
+    MessageLink->MessagePeriod = 1500;
+    MessageLink->StaleTimed    = false;
+
+    MessageLink->StaleAge.Seconds    = 1;
+    MessageLink->StaleAge.Subseconds = 0x80000000;
+    LC_CreatePerfectHash();
+
+    LC_OperData.WDTPtr[WatchIndex].DataType         = LC_DATA_UBYTE;
+    LC_OperData.WDTPtr[WatchIndex].OperatorID       = LC_OPER_EQ;
+    LC_OperData.WDTPtr[WatchIndex].WatchpointOffset = 0;
+    LC_OperData.WDTPtr[WatchIndex].BitMask          = LC_NO_BITMASK;
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
+    /* Execute the function being tested */
+    LC_CheckMsgForWPs(LC_HK_TLM_MID, (CFE_SB_MsgPtr_t)(&TlmPacket));
+
+    /* Verify results */
+    UtAssert_True(MessageLink->StaleTimed == true,
+                  "MessageLink->StaleTimed == true");
+
+    /* The deadline is a period after receipt by the LC clock */
+    UtAssert_True(CFE_TIME_Compare(MessageLink->StaleTime, MessageTime) ==
+                      CFE_TIME_A_LT_B,
+                  "CFE_TIME_Compare(MessageLink->StaleTime, MessageTime) == "
+                  "CFE_TIME_A_LT_B");
+
+    LC_CheckMessageAges(MessageTime);
+
+    UtAssert_True(MessageLink->StaleTimed == false,
+                  "MessageLink->StaleTimed == false");
+    UtAssert_True(LC_OperData.WatchResults[WatchIndex] == LC_WATCH_STALE,
+                  "LC_OperData.WatchResults[WatchIndex] == LC_WATCH_STALE");
+
+} /* end LC_CheckMsgForWPs_Test_MessagePeriodLCClock */
+
+void LC_CheckMsgForWPs_Test_LatestValue(void) {
+    LC_NoArgsCmd_t CmdPacket;
+    LC_MessageList_t *MessageLink;
+    uint16 WatchIndex = 0;
+
+    CFE_SB_InitMsg((CFE_SB_MsgPtr_t)(&CmdPacket), 1, sizeof(LC_NoArgsCmd_t),
+                   TRUE);
+
+    LC_AppData.CurrentLCState = 99;
+
+    MessageLink                 = &LC_OperData.MessageLinks[0];
+    LC_OperData.MessageIDsCount = 1;
+
+    MessageLink->MessageID     = 1;
+    MessageLink->EvalStart     = 0;
+    MessageLink->EvalCount     = 1;
+    MessageLink->MaxExtent     = 1;
+    MessageLink->SnapshotStart = 0;
+    MessageLink->SnapshotSize  = 1;
+    LC_CreatePerfectHash();
+
+    LC_OperData.WDTPtr[WatchIndex].DataType         = LC_DATA_UBYTE;
+    LC_OperData.WDTPtr[WatchIndex].OperatorID       = LC_OPER_EQ;
+    LC_OperData.WDTPtr[WatchIndex].WatchpointOffset = 0;
+    LC_OperData.WDTPtr[WatchIndex].BitMask          = LC_NO_BITMASK;
+    LC_OperData.WDTPtr[WatchIndex].MonitorMode      = LC_MONITOR_LATEST;
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
+    /* Execute the function being tested */
+    LC_CheckMsgForWPs(1, (CFE_SB_MsgPtr_t)(&CmdPacket));
+
+    /* Verify results */
+    UtAssert_True(MessageLink->SnapshotPending == true,
+                  "MessageLink->SnapshotPending == true");
+    UtAssert_True(LC_OperData.WRTPtr[WatchIndex].EvaluationCount == 0,
+                  "LC_OperData.WRTPtr[WatchIndex].EvaluationCount == 0");
+    UtAssert_True(LC_AppData.MonitoredMsgCount == 1,
+                  "LC_AppData.MonitoredMsgCount == 1");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end LC_CheckMsgForWPs_Test_LatestValue */
+
+void LC_CheckMsgForWPs_Test_Decimation(void) {
+    LC_NoArgsCmd_t CmdPacket;
+    LC_MessageList_t *MessageLink;
+    uint16 WatchIndex = 0;
+    uint16 MessageIndex;
+
+    CFE_SB_InitMsg((CFE_SB_MsgPtr_t)(&CmdPacket), 1, sizeof(LC_NoArgsCmd_t),
+                   TRUE);
+
+    LC_AppData.CurrentLCState = 99;
+
+    MessageLink                 = &LC_OperData.MessageLinks[0];
+    LC_OperData.MessageIDsCount = 1;
+
+    MessageLink->MessageID         = 1;
+    MessageLink->EvalStart         = 0;
+    MessageLink->EvalCount         = 1;
+    MessageLink->MaxExtent         = 1;
+    MessageLink->MessageDecimation = 3;
+    LC_CreatePerfectHash();
+
+    LC_OperData.WDTPtr[WatchIndex].DataType           = LC_DATA_UBYTE;
+    LC_OperData.WDTPtr[WatchIndex].OperatorID         = LC_OPER_EQ;
+    LC_OperData.WDTPtr[WatchIndex].WatchpointOffset   = 0;
+    LC_OperData.WDTPtr[WatchIndex].BitMask            = LC_NO_BITMASK;
+    LC_OperData.WDTPtr[WatchIndex].ResultAgeWhenStale = 5;
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
+    /* Execute the function being tested */
+    for (MessageIndex = 0; MessageIndex < 4; MessageIndex++) {
+        LC_CheckMsgForWPs(1, (CFE_SB_MsgPtr_t)(&CmdPacket));
+    }
+
+    /* Verify results, the first and fourth messages are evaluated */
+    UtAssert_True(LC_OperData.WRTPtr[WatchIndex].EvaluationCount == 2,
+                  "LC_OperData.WRTPtr[WatchIndex].EvaluationCount == 2");
+    UtAssert_True(MessageLink->MessageCount == 4,
+                  "MessageLink->MessageCount == 4");
+    UtAssert_True(MessageLink->DecimatedCount == 2,
+                  "MessageLink->DecimatedCount == 2");
+    UtAssert_True(MessageLink->DecimationCountdown == 2,
+                  "MessageLink->DecimationCountdown == 2");
+    UtAssert_True(LC_AppData.MonitoredMsgCount == 4,
+                  "LC_AppData.MonitoredMsgCount == 4");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end LC_CheckMsgForWPs_Test_Decimation */
+
+void LC_CheckMsgForWPs_Test_UnreferencedMessageID(void) {
+    LC_NoArgsCmd_t CmdPacket;
+
+    LC_OperData.HashTable[LC_GetHashTableIndex(1)] = (LC_MessageList_t *)NULL;
+
+    CFE_SB_InitMsg((CFE_SB_MsgPtr_t)(&CmdPacket), 1, sizeof(LC_NoArgsCmd_t),
+                   TRUE);
+
+    /* Execute the function being tested */
+    LC_CheckMsgForWPs(1, (CFE_SB_MsgPtr_t)(&CmdPacket));
+
+    /* Verify results */
+    UtAssert_True(Ut_CFE_EVS_EventSent(
+                      LC_MID_INF_EID, CFE_EVS_INFORMATION,
+                      "Msg with unreferenced message ID rcvd: ID = 0x0001"),
+                  "Msg with unreferenced message ID rcvd: ID = 0x0001");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 1,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 1");
+
+} /* end LC_CheckMsgForWPs_Test_UnreferencedMessageID */
+
+void LC_ProcessWP_Test_CustomFunctionWatchFalse(void) {
+    uint16 WatchIndex = 0;
+    LC_NoArgsCmd_t CmdPacket;
+    CFE_TIME_SysTime_t Timestamp;
+
+    CFE_SB_InitMsg((CFE_SB_MsgPtr_t)(&CmdPacket), 1, sizeof(LC_NoArgsCmd_t),
+                   TRUE);
+
+    LC_OperData.WDTPtr[WatchIndex].DataType           = LC_DATA_BYTE;
+    LC_OperData.WDTPtr[WatchIndex].OperatorID         = LC_OPER_CUSTOM;
+    LC_OperData.WDTPtr[WatchIndex].CustomFuncArgument = 0;
+    LC_OperData.WDTPtr[WatchIndex].ResultAgeWhenStale = 1;
+
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
+    /* Execute the function being tested */
+    LC_ProcessWP(&LC_OperData.WatchEvals[0], (CFE_SB_MsgPtr_t)(&CmdPacket),
+                 Timestamp);
+
+    /* Verify results */
+    UtAssert_True(LC_OperData.WRTPtr[WatchIndex].ConsecutiveTrueCount == 0,
+                  "LC_OperData.WRTPtr[WatchIndex].ConsecutiveTrueCount == 0");
+    UtAssert_True(LC_GetStaleCountdown(WatchIndex) == 1,
+                  "LC_GetStaleCountdown(WatchIndex) == 1");
+
+    UtAssert_True(
+        LC_OperData.WatchResults[WatchIndex] == LC_WATCH_FALSE,
+        "LC_OperData.WatchResults[WatchIndex] == LC_WATCH_FALSE");
+    UtAssert_True(LC_OperData.WRTPtr[WatchIndex].EvaluationCount == 1,
+                  "LC_OperData.WRTPtr[WatchIndex].EvaluationCount == 1");
+
+    /* Note: this event message is generated in a subfunction, but is tested
+     * anyway to verify that the correct code path has been reached */
+    UtAssert_True(
+        Ut_CFE_EVS_EventSent(LC_CFCALL_ERR_EID, CFE_EVS_ERROR,
+                             "Unexpected LC_CustomFunction call: WP = 0"),
+        "Unexpected LC_CustomFunction call: WP = 0");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 1,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 1");
+
+} /* end LC_ProcessWP_Test_CustomFunctionWatchFalse */
+
+void LC_ProcessWP_Test_OperatorCompareError(void) {
+    uint16 WatchIndex = 0;
+    LC_NoArgsCmd_t CmdPacket;
+    CFE_TIME_SysTime_t Timestamp;
+
+    CFE_SB_InitMsg((CFE_SB_MsgPtr_t)(&CmdPacket), 1, sizeof(LC_NoArgsCmd_t),
+                   TRUE);
+
+    LC_OperData.WDTPtr[WatchIndex].DataType        = LC_DATA_BYTE;
+    LC_OperData.WDTPtr[WatchIndex].OperatorID      = 99;
+    LC_OperData.WRTPtr[WatchIndex].EvaluationCount = 0;
+
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
+    /* Execute the function being tested */
+    LC_ProcessWP(&LC_OperData.WatchEvals[0], (CFE_SB_MsgPtr_t)(&CmdPacket),
+                 Timestamp);
+
+    /* Verify results */
+    UtAssert_True(
+        LC_OperData.WatchResults[WatchIndex] == LC_WATCH_ERROR,
+        "LC_OperData.WatchResults[WatchIndex] == LC_WATCH_ERROR");
+    UtAssert_True(LC_OperData.WRTPtr[WatchIndex].EvaluationCount == 1,
+                  "LC_OperData.WRTPtr[WatchIndex].EvaluationCount == 1");
+    UtAssert_True(LC_GetStaleCountdown(WatchIndex) == 0,
+                  "LC_GetStaleCountdown(WatchIndex) == 0");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 1,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 1");
+    /* Generates 1 event message we don't care about in this test */
+
+} /* end LC_ProcessWP_Test_OperatorCompareError */
+
+void LC_ProcessWP_Test_OperatorCompareWatchTruePreviousStale(void) {
+    uint16 WatchIndex = 0;
+    LC_NoArgsCmd_t CmdPacket;
+    CFE_TIME_SysTime_t Timestamp;
+
+    Timestamp.Seconds    = 3;
+    Timestamp.Subseconds = 5;
+
+    CFE_SB_InitMsg((CFE_SB_MsgPtr_t)(&CmdPacket), 1, sizeof(LC_NoArgsCmd_t),
+                   TRUE);
+
+    LC_OperData.WDTPtr[WatchIndex].DataType                = LC_DATA_BYTE;
+    LC_OperData.WDTPtr[WatchIndex].OperatorID              = LC_OPER_LE;
+    LC_OperData.WatchResults[WatchIndex]                   = LC_WATCH_STALE;
+    LC_OperData.WDTPtr[WatchIndex].ResultAgeWhenStale      = 1;
+    LC_OperData.WDTPtr[WatchIndex].BitMask                 = 0;
+    LC_OperData.WDTPtr[WatchIndex].ComparisonValue.Signed8 = 1;
+    LC_OperData.WRTPtr[WatchIndex].EvaluationCount         = 0;
+
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
+    /* Execute the function being tested */
+    LC_ProcessWP(&LC_OperData.WatchEvals[0], (CFE_SB_MsgPtr_t)(&CmdPacket),
+                 Timestamp);
+
+    /* Verify results */
+    UtAssert_True(
+        LC_OperData.WatchResults[WatchIndex] == LC_WATCH_TRUE,
+        "LC_OperData.WatchResults[WatchIndex] == LC_WATCH_TRUE");
+    UtAssert_True(LC_OperData.WRTPtr[WatchIndex].EvaluationCount == 1,
+                  "LC_OperData.WRTPtr[WatchIndex].EvaluationCount == 1");
+
+    UtAssert_True(LC_OperData.WRTPtr[WatchIndex].CumulativeTrueCount == 1,
+                  "LC_OperData.WRTPtr[WatchIndex].CumulativeTrueCount == 1");
+    UtAssert_True(LC_OperData.WRTPtr[WatchIndex].ConsecutiveTrueCount == 1,
+                  "LC_OperData.WRTPtr[WatchIndex].ConsecutiveTrueCount == 1");
+    UtAssert_True(LC_GetStaleCountdown(WatchIndex) == 1,
+                  "LC_GetStaleCountdown(WatchIndex) == 1");
+
+    UtAssert_True(LC_OperData.WRTPtr[WatchIndex].FalseToTrueCount == 1,
+                  "LC_OperData.WRTPtr[WatchIndex].FalseToTrueCount == 1");
+    UtAssert_True(LC_OperData.WRTPtr[WatchIndex].LastFalseToTrue.Value == 0,
+                  "LC_OperData.WRTPtr[WatchIndex].LastFalseToTrue.Value == 0");
+    UtAssert_True(
+        LC_OperData.WRTPtr[WatchIndex].LastFalseToTrue.Timestamp.Seconds == 3,
+        "LC_OperData.WRTPtr[WatchIndex].LastFalseToTrue.Timestamp.Seconds == "
+        "3");
+    UtAssert_True(
+        LC_OperData.WRTPtr[WatchIndex].LastFalseToTrue.Timestamp.Subseconds ==
+            5,
+        "LC_OperData.WRTPtr[WatchIndex].LastFalseToTrue.Timestamp.Subseconds "
+        "== 5");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end LC_ProcessWP_Test_OperatorCompareWatchTruePreviousStale */
+
+void LC_ProcessWP_Test_OperatorCompareWatchFalsePreviousStale(void) {
+    uint16 WatchIndex = 0;
+    LC_NoArgsCmd_t CmdPacket;
+    CFE_TIME_SysTime_t Timestamp;
+
+    Timestamp.Seconds    = 3;
+    Timestamp.Subseconds = 5;
+
+    CFE_SB_InitMsg((CFE_SB_MsgPtr_t)(&CmdPacket), 1, sizeof(LC_NoArgsCmd_t),
+                   TRUE);
+
+    LC_OperData.WDTPtr[WatchIndex].DataType                = LC_DATA_BYTE;
+    LC_OperData.WDTPtr[WatchIndex].OperatorID              = LC_OPER_GE;
+    LC_OperData.WatchResults[WatchIndex]                   = LC_WATCH_STALE;
+    LC_OperData.WDTPtr[WatchIndex].ResultAgeWhenStale      = 1;
+    LC_OperData.WDTPtr[WatchIndex].BitMask                 = 0;
+    LC_OperData.WDTPtr[WatchIndex].ComparisonValue.Signed8 = 1;
+    LC_OperData.WRTPtr[WatchIndex].EvaluationCount         = 0;
+
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
+    /* Execute the function being tested */
+    LC_ProcessWP(&LC_OperData.WatchEvals[0], (CFE_SB_MsgPtr_t)(&CmdPacket),
+                 Timestamp);
+
+    /* Verify results */
+    UtAssert_True(
+        LC_OperData.WatchResults[WatchIndex] == LC_WATCH_FALSE,
+        "LC_OperData.WatchResults[WatchIndex] == LC_WATCH_FALSE");
+    UtAssert_True(LC_OperData.WRTPtr[WatchIndex].EvaluationCount == 1,
+                  "LC_OperData.WRTPtr[WatchIndex].EvaluationCount == 1");
+
+    UtAssert_True(LC_OperData.WRTPtr[WatchIndex].ConsecutiveTrueCount == 0,
+                  "LC_OperData.WRTPtr[WatchIndex].ConsecutiveTrueCount == 0");
+    UtAssert_True(LC_GetStaleCountdown(WatchIndex) == 1,
+                  "LC_GetStaleCountdown(WatchIndex) == 1");
+
+    UtAssert_True(LC_OperData.WRTPtr[WatchIndex].LastTrueToFalse.Value == 0,
+                  "LC_OperData.WRTPtr[WatchIndex].LastTrueToFalse.Value == 0");
+    UtAssert_True(
+        LC_OperData.WRTPtr[WatchIndex].LastTrueToFalse.Timestamp.Seconds == 3,
+        "LC_OperData.WRTPtr[WatchIndex].LastTrueToFalse.Timestamp.Seconds == "
+        "3");
+    UtAssert_True(
+        LC_OperData.WRTPtr[WatchIndex].LastTrueToFalse.Timestamp.Subseconds ==
+            5,
+        "LC_OperData.WRTPtr[WatchIndex].LastTrueToFalse.Timestamp.Subseconds "
+        "== 5");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end LC_ProcessWP_Test_OperatorCompareWatchFalsePreviousStale */
+
+void LC_ProcessWPBatch_Test_Nominal(void) {
+    LC_NoArgsCmd_t CmdPacket;
+    CFE_TIME_SysTime_t Timestamp;
+
+    Timestamp.Seconds    = 3;
+    Timestamp.Subseconds = 5;
+
+    CFE_SB_InitMsg((CFE_SB_MsgPtr_t)(&CmdPacket), 1, sizeof(LC_NoArgsCmd_t),
+                   TRUE);
+
+    LC_OperData.WDTPtr[0].DataType                  = LC_DATA_UBYTE;
+    LC_OperData.WDTPtr[0].OperatorID                = LC_OPER_LE;
+    LC_OperData.WDTPtr[0].BitMask                   = 0;
+    LC_OperData.WDTPtr[0].ComparisonValue.Unsigned8 = 1;
+    LC_OperData.WatchResults[0]                     = LC_WATCH_STALE;
+
+    LC_OperData.WDTPtr[1].DataType                  = LC_DATA_UBYTE;
+    LC_OperData.WDTPtr[1].OperatorID                = LC_OPER_GT;
+    LC_OperData.WDTPtr[1].BitMask                   = 0;
+    LC_OperData.WDTPtr[1].ComparisonValue.Unsigned8 = 0;
+    LC_OperData.WatchResults[1]                     = LC_WATCH_STALE;
+
+    LC_CompileWatchpoint(0, &LC_OperData.WatchEvals[0]);
+    LC_CompileWatchpoint(1, &LC_OperData.WatchEvals[1]);
+
+    /* Execute the function being tested */
+    LC_ProcessWPBatch(&LC_OperData.WatchEvals[0], 2,
+                      (CFE_SB_MsgPtr_t)(&CmdPacket), Timestamp);
+
+    /* Verify results */
+    UtAssert_True(LC_OperData.WatchResults[0] == LC_WATCH_TRUE,
+                  "LC_OperData.WatchResults[0] == LC_WATCH_TRUE");
+    UtAssert_True(LC_OperData.WRTPtr[0].FalseToTrueCount == 1,
+                  "LC_OperData.WRTPtr[0].FalseToTrueCount == 1");
+    UtAssert_True(LC_OperData.WatchResults[1] == LC_WATCH_FALSE,
+                  "LC_OperData.WatchResults[1] == LC_WATCH_FALSE");
+    UtAssert_True(LC_OperData.WRTPtr[1].EvaluationCount == 1,
+                  "LC_OperData.WRTPtr[1].EvaluationCount == 1");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end LC_ProcessWPBatch_Test_Nominal */
+
+void LC_ProcessWPLadder_Test_Nominal(void) {
+    LC_NoArgsCmd_t CmdPacket;
+    CFE_TIME_SysTime_t Timestamp;
+    uint16 WatchIndex;
+
+    Timestamp.Seconds    = 3;
+    Timestamp.Subseconds = 5;
+
+    CFE_SB_InitMsg((CFE_SB_MsgPtr_t)(&CmdPacket), 1, sizeof(LC_NoArgsCmd_t),
+                   TRUE);
+
+    /* The masked datum is 0, which is equal to the first two rungs */
+    LC_OperData.WDTPtr[0].OperatorID                = LC_OPER_LT;
+    LC_OperData.WDTPtr[0].ComparisonValue.Unsigned8 = 0;
+    LC_OperData.WDTPtr[1].OperatorID                = LC_OPER_GE;
+    LC_OperData.WDTPtr[1].ComparisonValue.Unsigned8 = 0;
+    LC_OperData.WDTPtr[2].OperatorID                = LC_OPER_LT;
+    LC_OperData.WDTPtr[2].ComparisonValue.Unsigned8 = 5;
+
+    for (WatchIndex = 0; WatchIndex < 3; WatchIndex++) {
+        LC_OperData.WDTPtr[WatchIndex].DataType    = LC_DATA_UBYTE;
+        LC_OperData.WDTPtr[WatchIndex].BitMask     = 0;
+        LC_OperData.WatchResults[WatchIndex] = LC_WATCH_STALE;
+
+        LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[WatchIndex]);
+
+        LC_OperData.LadderThresholds[WatchIndex] =
+            LC_OperData.WatchEvals[WatchIndex].ComparisonValue;
+    }
+
+    /* Execute the function being tested */
+    LC_ProcessWPLadder(&LC_OperData.WatchEvals[0], 3,
+                       (CFE_SB_MsgPtr_t)(&CmdPacket), Timestamp);
+
+    /* Verify results */
+    UtAssert_True(LC_OperData.WatchResults[0] == LC_WATCH_FALSE,
+                  "LC_OperData.WatchResults[0] == LC_WATCH_FALSE");
+    UtAssert_True(LC_OperData.WatchResults[1] == LC_WATCH_TRUE,
+                  "LC_OperData.WatchResults[1] == LC_WATCH_TRUE");
+    UtAssert_True(LC_OperData.WatchResults[2] == LC_WATCH_TRUE,
+                  "LC_OperData.WatchResults[2] == LC_WATCH_TRUE");
+    UtAssert_True(LC_OperData.WRTPtr[2].EvaluationCount == 1,
+                  "LC_OperData.WRTPtr[2].EvaluationCount == 1");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end LC_ProcessWPLadder_Test_Nominal */
+
+void LC_GetLadderBound_Test_Signed(void) {
+    LC_MultiType_t Thresholds[4];
+    LC_MultiType_t WPValue;
+    uint8 LowerBound;
+    uint8 UpperBound;
+
+    Thresholds[0].Signed32 = -20;
+    Thresholds[1].Signed32 = -5;
+    Thresholds[2].Signed32 = -5;
+    Thresholds[3].Signed32 = 40;
+
+    WPValue.Signed32 = -5;
+
+    /* Execute the function being tested */
+    LowerBound =
+        LC_GetLadderBound(Thresholds, 4, LC_EVAL_SIGNED, WPValue, false);
+    UpperBound =
+        LC_GetLadderBound(Thresholds, 4, LC_EVAL_SIGNED, WPValue, true);
+
+    /* Verify results */
+    UtAssert_True(LowerBound == 1, "LowerBound == 1");
+    UtAssert_True(UpperBound == 3, "UpperBound == 3");
+
+} /* end LC_GetLadderBound_Test_Signed */
+
+void LC_ProcessWPFlagBank_Test_Nominal(void) {
+    LC_NoArgsCmd_t CmdPacket;
+    CFE_TIME_SysTime_t Timestamp;
+    uint16 WatchIndex;
+
+    Timestamp.Seconds    = 3;
+    Timestamp.Subseconds = 5;
+
+    CFE_SB_InitMsg((CFE_SB_MsgPtr_t)(&CmdPacket), 1, sizeof(LC_NoArgsCmd_t),
+                   TRUE);
+
+    /* Status word is the 0x0C byte placed at the end of the packet */
+    ((uint8 *)&CmdPacket)[sizeof(LC_NoArgsCmd_t) - 1] = 0x0C;
+
+    LC_OperData.WDTPtr[0].OperatorID                = LC_OPER_EQ;
+    LC_OperData.WDTPtr[0].BitMask                   = 0x04;
+    LC_OperData.WDTPtr[0].ComparisonValue.Unsigned8 = 0x04;
+    LC_OperData.WDTPtr[1].OperatorID                = LC_OPER_NE;
+    LC_OperData.WDTPtr[1].BitMask                   = 0x08;
+    LC_OperData.WDTPtr[1].ComparisonValue.Unsigned8 = 0x08;
+    LC_OperData.WDTPtr[2].OperatorID                = LC_OPER_EQ;
+    LC_OperData.WDTPtr[2].BitMask                   = 0x10;
+    LC_OperData.WDTPtr[2].ComparisonValue.Unsigned8 = 0;
+
+    for (WatchIndex = 0; WatchIndex < 3; WatchIndex++) {
+        LC_OperData.WDTPtr[WatchIndex].DataType = LC_DATA_UBYTE;
+        LC_OperData.WDTPtr[WatchIndex].WatchpointOffset =
+            sizeof(LC_NoArgsCmd_t) - 1;
+        LC_OperData.WatchResults[WatchIndex] = LC_WATCH_STALE;
+
+        LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[WatchIndex]);
+
+        LC_OperData.WatchEvals[WatchIndex].FlagCount = 3 - WatchIndex;
+    }
+
+    for (WatchIndex = 3; WatchIndex > 0; WatchIndex--) {
+        LC_SetFlagBank(&LC_OperData.WatchEvals[WatchIndex - 1],
+                       WatchIndex - 1);
+    }
+
+    /* Execute the function being tested */
+    LC_ProcessWPFlagBank(&LC_OperData.WatchEvals[0], 3,
+                         (CFE_SB_MsgPtr_t)(&CmdPacket), Timestamp);
+
+    /* Verify results */
+    UtAssert_True(LC_OperData.FlagBanks[0].CareMask == 0x1C,
+                  "LC_OperData.FlagBanks[0].CareMask == 0x1C");
+    UtAssert_True(LC_OperData.FlagBanks[0].Expected == 0x04,
+                  "LC_OperData.FlagBanks[0].Expected == 0x04");
+
+    UtAssert_True(LC_OperData.WatchResults[0] == LC_WATCH_TRUE,
+                  "LC_OperData.WatchResults[0] == LC_WATCH_TRUE");
+    UtAssert_True(LC_OperData.WatchResults[1] == LC_WATCH_FALSE,
+                  "LC_OperData.WatchResults[1] == LC_WATCH_FALSE");
+    UtAssert_True(LC_OperData.WatchResults[2] == LC_WATCH_TRUE,
+                  "LC_OperData.WatchResults[2] == LC_WATCH_TRUE");
+    UtAssert_True(LC_OperData.WRTPtr[0].LastFalseToTrue.Value == 0x04,
+                  "LC_OperData.WRTPtr[0].LastFalseToTrue.Value == 0x04");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end LC_ProcessWPFlagBank_Test_Nominal */
+
+void LC_GetMaskedWPData_Test_ReuseDatum(void) {
+    uint32 Result;
+    LC_NoArgsCmd_t CmdPacket;
+
+    CFE_SB_InitMsg((CFE_SB_MsgPtr_t)(&CmdPacket), 1, sizeof(LC_NoArgsCmd_t),
+                   TRUE);
+
+    LC_OperData.WatchEvals[1].DatumIndex = 0;
+    LC_OperData.WatchEvals[1].ReuseDatum = true;
+    LC_OperData.DatumValues[0]           = 0x1234;
+
+    /* Execute the function being tested */
+    Result = LC_GetMaskedWPData(&LC_OperData.WatchEvals[1],
+                                (CFE_SB_MsgPtr_t)(&CmdPacket));
+
+    /* Verify results */
+    UtAssert_True(Result == 0x1234, "Result == 0x1234");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end LC_GetMaskedWPData_Test_ReuseDatum */
+
+void LC_SyncWRT_Test_Nominal(void) {
+    LC_OperData.WatchResults[3] = LC_WATCH_TRUE;
+    LC_SetStaleCountdown(3, 5);
+
+    LC_OperData.WRTPtr[3].WatchResult      = LC_WATCH_STALE;
+    LC_OperData.WRTPtr[3].CountdownToStale = 0;
+
+    /* Execute the function being tested */
+    LC_SyncWRT();
+
+    /* Verify results */
+    UtAssert_True(LC_OperData.WRTPtr[3].WatchResult == LC_WATCH_TRUE,
+                  "LC_OperData.WRTPtr[3].WatchResult == LC_WATCH_TRUE");
+    UtAssert_True(LC_OperData.WRTPtr[3].CountdownToStale == 5,
+                  "LC_OperData.WRTPtr[3].CountdownToStale == 5");
+
+} /* end LC_SyncWRT_Test_Nominal */
+
+void LC_LoadWatchResults_Test_Nominal(void) {
+    LC_OperData.WRTPtr[3].WatchResult      = LC_WATCH_FALSE;
+    LC_OperData.WRTPtr[3].CountdownToStale = 2;
+
+    /* Execute the function being tested */
+    LC_LoadWatchResults();
+
+    /* Verify results */
+    UtAssert_True(LC_OperData.WatchResults[3] == LC_WATCH_FALSE,
+                  "LC_OperData.WatchResults[3] == LC_WATCH_FALSE");
+    UtAssert_True(LC_GetStaleCountdown(3) == 2,
+                  "LC_GetStaleCountdown(3) == 2");
+
+} /* end LC_LoadWatchResults_Test_Nominal */
+
+void LC_AgeWatchResults_Test_Nominal(void) {
+    uint32 Tick;
+
+    LC_OperData.WatchResults[1] = LC_WATCH_TRUE;
+    LC_OperData.WatchResults[2] = LC_WATCH_FALSE;
+    LC_OperData.WatchResults[3] = LC_WATCH_TRUE;
+
+    LC_SetStaleCountdown(1, 1);
+    LC_SetStaleCountdown(2, 3);
+    LC_SetStaleCountdown(3, LC_STALE_WHEEL_SIZE + 1);
+
+    /* Execute the function being tested */
+    LC_AgeWatchResults();
+
+    /* Verify results */
+    UtAssert_True(LC_OperData.WatchResults[1] == LC_WATCH_STALE,
+                  "LC_OperData.WatchResults[1] == LC_WATCH_STALE");
+    UtAssert_True(LC_OperData.WatchResults[2] == LC_WATCH_FALSE,
+                  "LC_OperData.WatchResults[2] == LC_WATCH_FALSE");
+    UtAssert_True(LC_OperData.WatchResults[3] == LC_WATCH_TRUE,
+                  "LC_OperData.WatchResults[3] == LC_WATCH_TRUE");
+    UtAssert_True(LC_GetStaleCountdown(1) == 0,
+                  "LC_GetStaleCountdown(1) == 0");
+    UtAssert_True(LC_GetStaleCountdown(2) == 2,
+                  "LC_GetStaleCountdown(2) == 2");
+    UtAssert_True(LC_GetStaleCountdown(3) == LC_STALE_WHEEL_SIZE,
+                  "LC_GetStaleCountdown(3) == LC_STALE_WHEEL_SIZE");
+
+    /* Watchpoint 3 shares a slot with watchpoint 1 and lasts a turn */
+    for (Tick = 0; Tick < LC_STALE_WHEEL_SIZE - 1; Tick++) {
+        LC_AgeWatchResults();
+    }
+
+    UtAssert_True(LC_OperData.WatchResults[2] == LC_WATCH_STALE,
+                  "LC_OperData.WatchResults[2] == LC_WATCH_STALE");
+    UtAssert_True(LC_OperData.WatchResults[3] == LC_WATCH_TRUE,
+                  "LC_OperData.WatchResults[3] == LC_WATCH_TRUE");
+    UtAssert_True(LC_GetStaleCountdown(3) == 1,
+                  "LC_GetStaleCountdown(3) == 1");
+
+    LC_AgeWatchResults();
+
+    UtAssert_True(LC_OperData.WatchResults[3] == LC_WATCH_STALE,
+                  "LC_OperData.WatchResults[3] == LC_WATCH_STALE");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end LC_AgeWatchResults_Test_Nominal */
+
+void LC_SetStaleCountdown_Test_Restart(void) {
+    LC_OperData.WatchResults[4] = LC_WATCH_TRUE;
+    LC_OperData.WatchResults[5] = LC_WATCH_TRUE;
+    LC_OperData.WatchResults[6] = LC_WATCH_TRUE;
+
+    LC_SetStaleCountdown(4, 1);
+    LC_SetStaleCountdown(5, 1);
+    LC_SetStaleCountdown(6, 1);
+
+    /* Execute the function being tested */
+    LC_SetStaleCountdown(5, 2);
+    LC_SetStaleCountdown(6, 0);
+
+    /* Verify results */
+    LC_AgeWatchResults();
+
+    UtAssert_True(LC_OperData.WatchResults[4] == LC_WATCH_STALE,
+                  "LC_OperData.WatchResults[4] == LC_WATCH_STALE");
+    UtAssert_True(LC_OperData.WatchResults[5] == LC_WATCH_TRUE,
+                  "LC_OperData.WatchResults[5] == LC_WATCH_TRUE");
+    UtAssert_True(LC_OperData.WatchResults[6] == LC_WATCH_TRUE,
+                  "LC_OperData.WatchResults[6] == LC_WATCH_TRUE");
+    UtAssert_True(LC_GetStaleCountdown(5) == 1,
+                  "LC_GetStaleCountdown(5) == 1");
+    UtAssert_True(LC_GetStaleCountdown(6) == 0,
+                  "LC_GetStaleCountdown(6) == 0");
+
+    LC_AgeWatchResults();
+
+    UtAssert_True(LC_OperData.WatchResults[5] == LC_WATCH_STALE,
+                  "LC_OperData.WatchResults[5] == LC_WATCH_STALE");
+    UtAssert_True(LC_OperData.WatchResults[6] == LC_WATCH_TRUE,
+                  "LC_OperData.WatchResults[6] == LC_WATCH_TRUE");
+
+} /* end LC_SetStaleCountdown_Test_Restart */
+
+void LC_CheckMessageAges_Test_Nominal(void) {
+    CFE_TIME_SysTime_t CurrentTime;
+
+    LC_OperData.MessageIDsCount = 2;
+
+    LC_OperData.MessageLinks[0].EvalStart         = 0;
+    LC_OperData.MessageLinks[0].EvalCount         = 2;
+    LC_OperData.MessageLinks[0].StaleTime.Seconds = 10;
+    LC_OperData.MessageLinks[0].StaleTimed        = true;
+    LC_OperData.WatchEvals[0].WatchIndex          = 3;
+    LC_OperData.WatchEvals[1].WatchIndex          = 5;
+
+    LC_OperData.MessageLinks[1].EvalStart         = 2;
+    LC_OperData.MessageLinks[1].EvalCount         = 1;
+    LC_OperData.MessageLinks[1].StaleTime.Seconds = 20;
+    LC_OperData.MessageLinks[1].StaleTimed        = true;
+    LC_OperData.WatchEvals[2].WatchIndex          = 7;
+
+    LC_OperData.WatchResults[3] = LC_WATCH_TRUE;
+    LC_OperData.WatchResults[5] = LC_WATCH_FALSE;
+    LC_OperData.WatchResults[7] = LC_WATCH_TRUE;
+
+    LC_SetStaleCountdown(3, 4);
+
+    CurrentTime.Seconds    = 15;
+    CurrentTime.Subseconds = 0;
+
+    /* Execute the function being tested */
+    LC_CheckMessageAges(CurrentTime);
+
+    /* Verify results */
+    UtAssert_True(LC_OperData.WatchResults[3] == LC_WATCH_STALE,
+                  "LC_OperData.WatchResults[3] == LC_WATCH_STALE");
+    UtAssert_True(LC_OperData.WatchResults[5] == LC_WATCH_STALE,
+                  "LC_OperData.WatchResults[5] == LC_WATCH_STALE");
+    UtAssert_True(LC_OperData.WatchResults[7] == LC_WATCH_TRUE,
+                  "LC_OperData.WatchResults[7] == LC_WATCH_TRUE");
+    UtAssert_True(LC_GetStaleCountdown(3) == 0,
+                  "LC_GetStaleCountdown(3) == 0");
+    UtAssert_True(LC_OperData.MessageLinks[0].StaleTimed == false,
+                  "LC_OperData.MessageLinks[0].StaleTimed == false");
+    UtAssert_True(LC_OperData.MessageLinks[1].StaleTimed == true,
+                  "LC_OperData.MessageLinks[1].StaleTimed == true");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end LC_CheckMessageAges_Test_Nominal */
+
+void LC_EvaluateSnapshots_Test_Nominal(void) {
+    LC_MessageList_t *MessageLink;
+    uint16 WatchIndex = 0;
+
+    MessageLink = &LC_OperData.MessageLinks[0];
+    MessageLink->MessageID       = 1;
+    MessageLink->EvalStart       = 0;
+    MessageLink->EvalCount       = 1;
+    MessageLink->MaxExtent       = 1;
+    MessageLink->SnapshotStart   = 0;
+    MessageLink->SnapshotSize    = 1;
+    MessageLink->SnapshotPending = true;
+
+    LC_OperData.MessageIDsCount = 1;
+
+    LC_OperData.WDTPtr[WatchIndex].DataType         = LC_DATA_UBYTE;
+    LC_OperData.WDTPtr[WatchIndex].OperatorID       = LC_OPER_EQ;
+    LC_OperData.WDTPtr[WatchIndex].WatchpointOffset = 0;
+    LC_OperData.WDTPtr[WatchIndex].BitMask          = LC_NO_BITMASK;
+    LC_OperData.WDTPtr[WatchIndex].MonitorMode      = LC_MONITOR_LATEST;
+    LC_OperData.WDTPtr[WatchIndex].ComparisonValue.Unsigned32 = 5;
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
+    *((uint8 *)LC_OperData.SnapshotPool) = 5;
+
+    /* Execute the function being tested */
+    LC_EvaluateSnapshots();
+
+    /* Verify results */
+    UtAssert_True(MessageLink->SnapshotPending == false,
+                  "MessageLink->SnapshotPending == false");
+    UtAssert_True(LC_OperData.WRTPtr[WatchIndex].EvaluationCount == 1,
+                  "LC_OperData.WRTPtr[WatchIndex].EvaluationCount == 1");
+    UtAssert_True(LC_OperData.WatchResults[WatchIndex] == LC_WATCH_TRUE,
+                  "LC_OperData.WatchResults[WatchIndex] == LC_WATCH_TRUE");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end LC_EvaluateSnapshots_Test_Nominal */
+
+void LC_MatchFingerprint_Test_Nominal(void) {
+    LC_NoArgsCmd_t CmdPacket;
+    LC_MessageList_t *MessageLink = &LC_OperData.MessageLinks[0];
+    uint8 *MsgBytes               = (uint8 *)&CmdPacket;
+    bool FirstMatch;
+    bool SecondMatch;
+    bool ThirdMatch;
+
+    CFE_SB_InitMsg((CFE_SB_MsgPtr_t)(&CmdPacket), 1, sizeof(LC_NoArgsCmd_t),
+                   TRUE);
 
-    LC_OperData.HashTable[LC_GetHashTableIndex(1)]->Next->Next =
-        LC_OperData.HashTable[LC_GetHashTableIndex(3)];
-    LC_OperData.HashTable[LC_GetHashTableIndex(1)]
-        ->Next->Next->WatchPtList->WatchIndex = 99;
+    LC_OperData.WatchSpans[0].Offset = 0;
+    LC_OperData.WatchSpans[0].Length = 2;
+    LC_OperData.WatchSpans[1].Offset = 6;
+    LC_OperData.WatchSpans[1].Length = 2;
 
-    LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_CUSTOM;
+    MessageLink->SpanStart        = 0;
+    MessageLink->SpanCount        = 2;
+    MessageLink->FingerprintStart = 0;
 
     /* Execute the function being tested */
-    LC_CheckMsgForWPs(1, (CFE_SB_MsgPtr_t)(&CmdPacket));
+    FirstMatch =
+        LC_MatchFingerprint(MessageLink, (CFE_SB_MsgPtr_t)(&CmdPacket));
+    SecondMatch =
+        LC_MatchFingerprint(MessageLink, (CFE_SB_MsgPtr_t)(&CmdPacket));
+
+    MsgBytes[7]++;
+    ThirdMatch =
+        LC_MatchFingerprint(MessageLink, (CFE_SB_MsgPtr_t)(&CmdPacket));
 
     /* Verify results */
-    UtAssert_True(LC_AppData.MonitoredMsgCount == 1,
-                  "LC_AppData.MonitoredMsgCount == 1");
+    UtAssert_True(FirstMatch == false, "FirstMatch == false");
+    UtAssert_True(SecondMatch == true, "SecondMatch == true");
+    UtAssert_True(ThirdMatch == false, "ThirdMatch == false");
+    UtAssert_True(MessageLink->FingerprintValid == true,
+                  "MessageLink->FingerprintValid == true");
+    UtAssert_True(
+        ((uint8 *)LC_OperData.FingerprintPool)[3] == MsgBytes[7],
+        "((uint8 *)LC_OperData.FingerprintPool)[3] == MsgBytes[7]");
 
-    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 1,
-                  "Ut_CFE_EVS_GetEventQueueDepth() == 1");
-    /* Generates 1 event message we don't care about in this test */
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
 
-} /* end LC_CheckMsgForWPs_Test_Nominal */
+} /* end LC_MatchFingerprint_Test_Nominal */
 
-void LC_CheckMsgForWPs_Test_UnreferencedMessageID(void) {
-    LC_NoArgsCmd_t CmdPacket;
+void LC_RepeatWPResults_Test_Nominal(void) {
+    LC_MessageList_t *MessageLink = &LC_OperData.MessageLinks[0];
+    bool Result;
 
-    LC_OperData.HashTable[LC_GetHashTableIndex(1)] = (LC_MessageList_t *)NULL;
+    MessageLink->EvalStart = 0;
+    MessageLink->EvalCount = 2;
 
-    CFE_SB_InitMsg((CFE_SB_MsgPtr_t)(&CmdPacket), 1, sizeof(LC_NoArgsCmd_t),
-                   TRUE);
+    LC_OperData.WatchEvals[0].WatchIndex         = 3;
+    LC_OperData.WatchEvals[0].ResultAgeWhenStale = 5;
+    LC_OperData.WatchEvals[1].WatchIndex         = 4;
+
+    LC_OperData.WatchResults[3] = LC_WATCH_TRUE;
+    LC_OperData.WatchResults[4] = LC_WATCH_FALSE;
+
+    LC_OperData.WRTPtr[3].ConsecutiveTrueCount = 2;
 
     /* Execute the function being tested */
-    LC_CheckMsgForWPs(1, (CFE_SB_MsgPtr_t)(&CmdPacket));
+    Result = LC_RepeatWPResults(MessageLink);
 
     /* Verify results */
-    UtAssert_True(Ut_CFE_EVS_EventSent(
-                      LC_MID_INF_EID, CFE_EVS_INFORMATION,
-                      "Msg with unreferenced message ID rcvd: ID = 0x0001"),
-                  "Msg with unreferenced message ID rcvd: ID = 0x0001");
+    UtAssert_True(Result == true, "Result == true");
+    UtAssert_True(LC_OperData.WRTPtr[3].EvaluationCount == 1,
+                  "LC_OperData.WRTPtr[3].EvaluationCount == 1");
+    UtAssert_True(LC_OperData.WRTPtr[3].CumulativeTrueCount == 1,
+                  "LC_OperData.WRTPtr[3].CumulativeTrueCount == 1");
+    UtAssert_True(LC_OperData.WRTPtr[3].ConsecutiveTrueCount == 3,
+                  "LC_OperData.WRTPtr[3].ConsecutiveTrueCount == 3");
+    UtAssert_True(LC_GetStaleCountdown(3) == 5,
+                  "LC_GetStaleCountdown(3) == 5");
+    UtAssert_True(LC_OperData.WRTPtr[4].EvaluationCount == 1,
+                  "LC_OperData.WRTPtr[4].EvaluationCount == 1");
+    UtAssert_True(LC_OperData.WRTPtr[4].CumulativeTrueCount == 0,
+                  "LC_OperData.WRTPtr[4].CumulativeTrueCount == 0");
 
-    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 1,
-                  "Ut_CFE_EVS_GetEventQueueDepth() == 1");
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
 
-} /* end LC_CheckMsgForWPs_Test_UnreferencedMessageID */
+} /* end LC_RepeatWPResults_Test_Nominal */
 
-void LC_ProcessWP_Test_CustomFunctionWatchFalse(void) {
-    uint16 WatchIndex = 0;
-    LC_NoArgsCmd_t CmdPacket;
-    CFE_TIME_SysTime_t Timestamp;
+void LC_RepeatWPResults_Test_Stale(void) {
+    LC_MessageList_t *MessageLink = &LC_OperData.MessageLinks[0];
+    bool Result;
 
-    CFE_SB_InitMsg((CFE_SB_MsgPtr_t)(&CmdPacket), 1, sizeof(LC_NoArgsCmd_t),
-                   TRUE);
+    MessageLink->EvalStart = 0;
+    MessageLink->EvalCount = 2;
 
-    LC_OperData.WDTPtr[WatchIndex].DataType           = LC_DATA_BYTE;
-    LC_OperData.WDTPtr[WatchIndex].OperatorID         = LC_OPER_CUSTOM;
-    LC_OperData.WDTPtr[WatchIndex].CustomFuncArgument = 0;
-    LC_OperData.WDTPtr[WatchIndex].ResultAgeWhenStale = 1;
+    LC_OperData.WatchEvals[0].WatchIndex = 3;
+    LC_OperData.WatchEvals[1].WatchIndex = 4;
+
+    LC_OperData.WatchResults[3] = LC_WATCH_TRUE;
+    LC_OperData.WatchResults[4] = LC_WATCH_STALE;
 
     /* Execute the function being tested */
-    LC_ProcessWP(WatchIndex, (CFE_SB_MsgPtr_t)(&CmdPacket), Timestamp);
+    Result = LC_RepeatWPResults(MessageLink);
 
     /* Verify results */
-    UtAssert_True(LC_OperData.WRTPtr[WatchIndex].ConsecutiveTrueCount == 0,
-                  "LC_OperData.WRTPtr[WatchIndex].ConsecutiveTrueCount == 0");
-    UtAssert_True(LC_OperData.WRTPtr[WatchIndex].CountdownToStale == 1,
-                  "LC_OperData.WRTPtr[WatchIndex].CountdownToStale == 1");
-
-    UtAssert_True(
-        LC_OperData.WRTPtr[WatchIndex].WatchResult == LC_WATCH_FALSE,
-        "LC_OperData.WRTPtr[WatchIndex].WatchResult == LC_WATCH_FALSE");
-    UtAssert_True(LC_OperData.WRTPtr[WatchIndex].EvaluationCount == 1,
-                  "LC_OperData.WRTPtr[WatchIndex].EvaluationCount == 1");
+    UtAssert_True(Result == false, "Result == false");
+    UtAssert_True(LC_OperData.WRTPtr[3].EvaluationCount == 0,
+                  "LC_OperData.WRTPtr[3].EvaluationCount == 0");
 
-    /* Note: this event message is generated in a subfunction, but is tested
-     * anyway to verify that the correct code path has been reached */
-    UtAssert_True(
-        Ut_CFE_EVS_EventSent(LC_CFCALL_ERR_EID, CFE_EVS_ERROR,
-                             "Unexpected LC_CustomFunction call: WP = 0"),
-        "Unexpected LC_CustomFunction call: WP = 0");
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
 
-    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 1,
-                  "Ut_CFE_EVS_GetEventQueueDepth() == 1");
+} /* end LC_RepeatWPResults_Test_Stale */
 
-} /* end LC_ProcessWP_Test_CustomFunctionWatchFalse */
+void LC_RefreshWPAges_Test_Nominal(void) {
+    LC_MessageList_t *MessageLink = &LC_OperData.MessageLinks[0];
 
-void LC_ProcessWP_Test_OperatorCompareError(void) {
-    uint16 WatchIndex = 0;
-    LC_NoArgsCmd_t CmdPacket;
-    CFE_TIME_SysTime_t Timestamp;
+    MessageLink->EvalStart = 0;
+    MessageLink->EvalCount = 2;
 
-    CFE_SB_InitMsg((CFE_SB_MsgPtr_t)(&CmdPacket), 1, sizeof(LC_NoArgsCmd_t),
-                   TRUE);
+    LC_OperData.WatchEvals[0].WatchIndex         = 3;
+    LC_OperData.WatchEvals[0].ResultAgeWhenStale = 5;
+    LC_OperData.WatchEvals[1].WatchIndex         = 4;
+    LC_OperData.WatchEvals[1].ResultAgeWhenStale = 5;
 
-    LC_OperData.WDTPtr[WatchIndex].DataType        = LC_DATA_BYTE;
-    LC_OperData.WDTPtr[WatchIndex].OperatorID      = 99;
-    LC_OperData.WRTPtr[WatchIndex].EvaluationCount = 0;
+    LC_OperData.WatchResults[3] = LC_WATCH_FALSE;
+    LC_OperData.WatchResults[4] = LC_WATCH_STALE;
 
     /* Execute the function being tested */
-    LC_ProcessWP(WatchIndex, (CFE_SB_MsgPtr_t)(&CmdPacket), Timestamp);
+    LC_RefreshWPAges(MessageLink);
 
     /* Verify results */
-    UtAssert_True(
-        LC_OperData.WRTPtr[WatchIndex].WatchResult == LC_WATCH_ERROR,
-        "LC_OperData.WRTPtr[WatchIndex].WatchResult == LC_WATCH_ERROR");
-    UtAssert_True(LC_OperData.WRTPtr[WatchIndex].EvaluationCount == 1,
-                  "LC_OperData.WRTPtr[WatchIndex].EvaluationCount == 1");
-    UtAssert_True(LC_OperData.WRTPtr[WatchIndex].CountdownToStale == 0,
-                  "LC_OperData.WRTPtr[WatchIndex].CountdownToStale == 0");
+    UtAssert_True(LC_GetStaleCountdown(3) == 5,
+                  "LC_GetStaleCountdown(3) == 5");
+    UtAssert_True(LC_GetStaleCountdown(4) == 0,
+                  "LC_GetStaleCountdown(4) == 0");
+    UtAssert_True(LC_OperData.WRTPtr[3].EvaluationCount == 0,
+                  "LC_OperData.WRTPtr[3].EvaluationCount == 0");
 
-    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 1,
-                  "Ut_CFE_EVS_GetEventQueueDepth() == 1");
-    /* Generates 1 event message we don't care about in this test */
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
 
-} /* end LC_ProcessWP_Test_OperatorCompareError */
+} /* end LC_RefreshWPAges_Test_Nominal */
 
-void LC_ProcessWP_Test_OperatorCompareWatchTruePreviousStale(void) {
+void LC_ProcessWPArray_Test_CountTrue(void) {
+    uint8 Result;
     uint16 WatchIndex = 0;
-    LC_NoArgsCmd_t CmdPacket;
-    CFE_TIME_SysTime_t Timestamp;
+    uint32 TrueCount;
+    uint8 WPData[9] = {11, 0, 3, 0, 20, 0, 10, 0, 50};
 
-    Timestamp.Seconds    = 3;
-    Timestamp.Subseconds = 5;
+    LC_OperData.WDTPtr[WatchIndex].DataType                  = LC_DATA_UBYTE;
+    LC_OperData.WDTPtr[WatchIndex].OperatorID                = LC_OPER_GT;
+    LC_OperData.WDTPtr[WatchIndex].BitMask                   = LC_NO_BITMASK;
+    LC_OperData.WDTPtr[WatchIndex].ComparisonValue.Unsigned8 = 10;
+    LC_OperData.WDTPtr[WatchIndex].AggregateType             = LC_AGGR_COUNT;
+    LC_OperData.WDTPtr[WatchIndex].AggregateCount            = 2;
+    LC_OperData.WDTPtr[WatchIndex].ElementCount              = 5;
+    LC_OperData.WDTPtr[WatchIndex].ElementStride             = 2;
 
-    CFE_SB_InitMsg((CFE_SB_MsgPtr_t)(&CmdPacket), 1, sizeof(LC_NoArgsCmd_t),
-                   TRUE);
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
 
-    LC_OperData.WDTPtr[WatchIndex].DataType                = LC_DATA_BYTE;
-    LC_OperData.WDTPtr[WatchIndex].OperatorID              = LC_OPER_LE;
-    LC_OperData.WRTPtr[WatchIndex].WatchResult             = LC_WATCH_STALE;
-    LC_OperData.WDTPtr[WatchIndex].ResultAgeWhenStale      = 1;
-    LC_OperData.WDTPtr[WatchIndex].BitMask                 = 0;
-    LC_OperData.WDTPtr[WatchIndex].ComparisonValue.Signed8 = 1;
-    LC_OperData.WRTPtr[WatchIndex].EvaluationCount         = 0;
+    LC_OperData.WatchEvals[0].ElementResultStart = 0;
 
     /* Execute the function being tested */
-    LC_ProcessWP(WatchIndex, (CFE_SB_MsgPtr_t)(&CmdPacket), Timestamp);
+    Result = LC_ProcessWPArray(&LC_OperData.WatchEvals[0], WPData, &TrueCount);
 
     /* Verify results */
-    UtAssert_True(
-        LC_OperData.WRTPtr[WatchIndex].WatchResult == LC_WATCH_TRUE,
-        "LC_OperData.WRTPtr[WatchIndex].WatchResult == LC_WATCH_TRUE");
-    UtAssert_True(LC_OperData.WRTPtr[WatchIndex].EvaluationCount == 1,
-                  "LC_OperData.WRTPtr[WatchIndex].EvaluationCount == 1");
-
-    UtAssert_True(LC_OperData.WRTPtr[WatchIndex].CumulativeTrueCount == 1,
-                  "LC_OperData.WRTPtr[WatchIndex].CumulativeTrueCount == 1");
-    UtAssert_True(LC_OperData.WRTPtr[WatchIndex].ConsecutiveTrueCount == 1,
-                  "LC_OperData.WRTPtr[WatchIndex].ConsecutiveTrueCount == 1");
-    UtAssert_True(LC_OperData.WRTPtr[WatchIndex].CountdownToStale == 1,
-                  "LC_OperData.WRTPtr[WatchIndex].CountdownToStale == 1");
-
-    UtAssert_True(LC_OperData.WRTPtr[WatchIndex].FalseToTrueCount == 1,
-                  "LC_OperData.WRTPtr[WatchIndex].FalseToTrueCount == 1");
-    UtAssert_True(LC_OperData.WRTPtr[WatchIndex].LastFalseToTrue.Value == 0,
-                  "LC_OperData.WRTPtr[WatchIndex].LastFalseToTrue.Value == 0");
-    UtAssert_True(
-        LC_OperData.WRTPtr[WatchIndex].LastFalseToTrue.Timestamp.Seconds == 3,
-        "LC_OperData.WRTPtr[WatchIndex].LastFalseToTrue.Timestamp.Seconds == "
-        "3");
-    UtAssert_True(
-        LC_OperData.WRTPtr[WatchIndex].LastFalseToTrue.Timestamp.Subseconds ==
-            5,
-        "LC_OperData.WRTPtr[WatchIndex].LastFalseToTrue.Timestamp.Subseconds "
-        "== 5");
+    UtAssert_True(Result == LC_WATCH_TRUE, "Result == LC_WATCH_TRUE");
+    UtAssert_True(TrueCount == 3, "TrueCount == 3");
+    UtAssert_True(LC_OperData.ElementResults[0] == 0x15,
+                  "LC_OperData.ElementResults[0] == 0x15");
 
     UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
                   "Ut_CFE_EVS_GetEventQueueDepth() == 0");
 
-} /* end LC_ProcessWP_Test_OperatorCompareWatchTruePreviousStale */
+} /* end LC_ProcessWPArray_Test_CountTrue */
 
-void LC_ProcessWP_Test_OperatorCompareWatchFalsePreviousStale(void) {
+void LC_ProcessWPArray_Test_AllFalse(void) {
+    uint8 Result;
     uint16 WatchIndex = 0;
-    LC_NoArgsCmd_t CmdPacket;
-    CFE_TIME_SysTime_t Timestamp;
+    uint32 TrueCount;
+    uint8 WPData[3] = {11, 3, 20};
 
-    Timestamp.Seconds    = 3;
-    Timestamp.Subseconds = 5;
-
-    CFE_SB_InitMsg((CFE_SB_MsgPtr_t)(&CmdPacket), 1, sizeof(LC_NoArgsCmd_t),
-                   TRUE);
+    LC_OperData.WDTPtr[WatchIndex].DataType                  = LC_DATA_UBYTE;
+    LC_OperData.WDTPtr[WatchIndex].OperatorID                = LC_OPER_GT;
+    LC_OperData.WDTPtr[WatchIndex].BitMask                   = LC_NO_BITMASK;
+    LC_OperData.WDTPtr[WatchIndex].ComparisonValue.Unsigned8 = 10;
+    LC_OperData.WDTPtr[WatchIndex].AggregateType             = LC_AGGR_ALL;
+    LC_OperData.WDTPtr[WatchIndex].ElementCount              = 3;
+    LC_OperData.WDTPtr[WatchIndex].ElementStride             = 1;
 
-    LC_OperData.WDTPtr[WatchIndex].DataType                = LC_DATA_BYTE;
-    LC_OperData.WDTPtr[WatchIndex].OperatorID              = LC_OPER_GE;
-    LC_OperData.WRTPtr[WatchIndex].WatchResult             = LC_WATCH_STALE;
-    LC_OperData.WDTPtr[WatchIndex].ResultAgeWhenStale      = 1;
-    LC_OperData.WDTPtr[WatchIndex].BitMask                 = 0;
-    LC_OperData.WDTPtr[WatchIndex].ComparisonValue.Signed8 = 1;
-    LC_OperData.WRTPtr[WatchIndex].EvaluationCount         = 0;
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
 
     /* Execute the function being tested */
-    LC_ProcessWP(WatchIndex, (CFE_SB_MsgPtr_t)(&CmdPacket), Timestamp);
+    Result = LC_ProcessWPArray(&LC_OperData.WatchEvals[0], WPData, &TrueCount);
 
     /* Verify results */
-    UtAssert_True(
-        LC_OperData.WRTPtr[WatchIndex].WatchResult == LC_WATCH_FALSE,
-        "LC_OperData.WRTPtr[WatchIndex].WatchResult == LC_WATCH_FALSE");
-    UtAssert_True(LC_OperData.WRTPtr[WatchIndex].EvaluationCount == 1,
-                  "LC_OperData.WRTPtr[WatchIndex].EvaluationCount == 1");
-
-    UtAssert_True(LC_OperData.WRTPtr[WatchIndex].ConsecutiveTrueCount == 0,
-                  "LC_OperData.WRTPtr[WatchIndex].ConsecutiveTrueCount == 0");
-    UtAssert_True(LC_OperData.WRTPtr[WatchIndex].CountdownToStale == 1,
-                  "LC_OperData.WRTPtr[WatchIndex].CountdownToStale == 1");
-
-    UtAssert_True(LC_OperData.WRTPtr[WatchIndex].LastTrueToFalse.Value == 0,
-                  "LC_OperData.WRTPtr[WatchIndex].LastTrueToFalse.Value == 0");
-    UtAssert_True(
-        LC_OperData.WRTPtr[WatchIndex].LastTrueToFalse.Timestamp.Seconds == 3,
-        "LC_OperData.WRTPtr[WatchIndex].LastTrueToFalse.Timestamp.Seconds == "
-        "3");
-    UtAssert_True(
-        LC_OperData.WRTPtr[WatchIndex].LastTrueToFalse.Timestamp.Subseconds ==
-            5,
-        "LC_OperData.WRTPtr[WatchIndex].LastTrueToFalse.Timestamp.Subseconds "
-        "== 5");
+    UtAssert_True(Result == LC_WATCH_FALSE, "Result == LC_WATCH_FALSE");
+    UtAssert_True(TrueCount == 2, "TrueCount == 2");
+    UtAssert_True(LC_OperData.WatchEvals[0].DataExtent == 3,
+                  "LC_OperData.WatchEvals[0].DataExtent == 3");
 
     UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
                   "Ut_CFE_EVS_GetEventQueueDepth() == 0");
 
-} /* end LC_ProcessWP_Test_OperatorCompareWatchFalsePreviousStale */
+} /* end LC_ProcessWPArray_Test_AllFalse */
 
 void LC_OperatorCompare_Test_DataByte(void) {
     uint8 Result;
@@ -435,14 +1572,16 @@ void LC_OperatorCompare_Test_DataByte(void) {
 
     LC_OperData.WDTPtr[WatchIndex].DataType                = LC_DATA_BYTE;
     LC_OperData.WDTPtr[WatchIndex].OperatorID              = LC_OPER_LE;
-    LC_OperData.WRTPtr[WatchIndex].WatchResult             = LC_WATCH_STALE;
+    LC_OperData.WatchResults[WatchIndex]                   = LC_WATCH_STALE;
     LC_OperData.WDTPtr[WatchIndex].ResultAgeWhenStale      = 1;
     LC_OperData.WDTPtr[WatchIndex].BitMask                 = 0;
     LC_OperData.WDTPtr[WatchIndex].ComparisonValue.Signed8 = 1;
     LC_OperData.WRTPtr[WatchIndex].EvaluationCount         = 0;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_OperatorCompare(WatchIndex, ProcessedWPData);
+    Result = LC_OperatorCompare(&LC_OperData.WatchEvals[0], ProcessedWPData);
 
     /* Verify results */
     UtAssert_True(Result == LC_WATCH_TRUE, "Result == LC_WATCH_TRUE");
@@ -459,14 +1598,16 @@ void LC_OperatorCompare_Test_DataWordLE(void) {
 
     LC_OperData.WDTPtr[WatchIndex].DataType                 = LC_DATA_WORD_LE;
     LC_OperData.WDTPtr[WatchIndex].OperatorID               = LC_OPER_LE;
-    LC_OperData.WRTPtr[WatchIndex].WatchResult              = LC_WATCH_STALE;
+    LC_OperData.WatchResults[WatchIndex]                    = LC_WATCH_STALE;
     LC_OperData.WDTPtr[WatchIndex].ResultAgeWhenStale       = 1;
     LC_OperData.WDTPtr[WatchIndex].BitMask                  = 0;
     LC_OperData.WDTPtr[WatchIndex].ComparisonValue.Signed16 = 1;
     LC_OperData.WRTPtr[WatchIndex].EvaluationCount          = 0;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_OperatorCompare(WatchIndex, ProcessedWPData);
+    Result = LC_OperatorCompare(&LC_OperData.WatchEvals[0], ProcessedWPData);
 
     /* Verify results */
     UtAssert_True(Result == LC_WATCH_TRUE, "Result == LC_WATCH_TRUE");
@@ -483,14 +1624,16 @@ void LC_OperatorCompare_Test_DataDWordLE(void) {
 
     LC_OperData.WDTPtr[WatchIndex].DataType                 = LC_DATA_DWORD_LE;
     LC_OperData.WDTPtr[WatchIndex].OperatorID               = LC_OPER_LE;
-    LC_OperData.WRTPtr[WatchIndex].WatchResult              = LC_WATCH_STALE;
+    LC_OperData.WatchResults[WatchIndex]                    = LC_WATCH_STALE;
     LC_OperData.WDTPtr[WatchIndex].ResultAgeWhenStale       = 1;
     LC_OperData.WDTPtr[WatchIndex].BitMask                  = 0;
     LC_OperData.WDTPtr[WatchIndex].ComparisonValue.Signed32 = 1;
     LC_OperData.WRTPtr[WatchIndex].EvaluationCount          = 0;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_OperatorCompare(WatchIndex, ProcessedWPData);
+    Result = LC_OperatorCompare(&LC_OperData.WatchEvals[0], ProcessedWPData);
 
     /* Verify results */
     UtAssert_True(Result == LC_WATCH_TRUE, "Result == LC_WATCH_TRUE");
@@ -507,14 +1650,16 @@ void LC_OperatorCompare_Test_DataUByte(void) {
 
     LC_OperData.WDTPtr[WatchIndex].DataType                  = LC_DATA_UBYTE;
     LC_OperData.WDTPtr[WatchIndex].OperatorID                = LC_OPER_LE;
-    LC_OperData.WRTPtr[WatchIndex].WatchResult               = LC_WATCH_STALE;
+    LC_OperData.WatchResults[WatchIndex]                     = LC_WATCH_STALE;
     LC_OperData.WDTPtr[WatchIndex].ResultAgeWhenStale        = 1;
     LC_OperData.WDTPtr[WatchIndex].BitMask                   = 0;
     LC_OperData.WDTPtr[WatchIndex].ComparisonValue.Unsigned8 = 1;
     LC_OperData.WRTPtr[WatchIndex].EvaluationCount           = 0;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_OperatorCompare(WatchIndex, ProcessedWPData);
+    Result = LC_OperatorCompare(&LC_OperData.WatchEvals[0], ProcessedWPData);
 
     /* Verify results */
     UtAssert_True(Result == LC_WATCH_TRUE, "Result == LC_WATCH_TRUE");
@@ -531,14 +1676,16 @@ void LC_OperatorCompare_Test_DataUWordLE(void) {
 
     LC_OperData.WDTPtr[WatchIndex].DataType           = LC_DATA_UWORD_LE;
     LC_OperData.WDTPtr[WatchIndex].OperatorID         = LC_OPER_LE;
-    LC_OperData.WRTPtr[WatchIndex].WatchResult        = LC_WATCH_STALE;
+    LC_OperData.WatchResults[WatchIndex]              = LC_WATCH_STALE;
     LC_OperData.WDTPtr[WatchIndex].ResultAgeWhenStale = 1;
     LC_OperData.WDTPtr[WatchIndex].BitMask            = 0;
     LC_OperData.WDTPtr[WatchIndex].ComparisonValue.Unsigned16 = 1;
     LC_OperData.WRTPtr[WatchIndex].EvaluationCount            = 0;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_OperatorCompare(WatchIndex, ProcessedWPData);
+    Result = LC_OperatorCompare(&LC_OperData.WatchEvals[0], ProcessedWPData);
 
     /* Verify results */
     UtAssert_True(Result == LC_WATCH_TRUE, "Result == LC_WATCH_TRUE");
@@ -555,14 +1702,16 @@ void LC_OperatorCompare_Test_DataUDWordLE(void) {
 
     LC_OperData.WDTPtr[WatchIndex].DataType           = LC_DATA_UDWORD_LE;
     LC_OperData.WDTPtr[WatchIndex].OperatorID         = LC_OPER_LE;
-    LC_OperData.WRTPtr[WatchIndex].WatchResult        = LC_WATCH_STALE;
+    LC_OperData.WatchResults[WatchIndex]              = LC_WATCH_STALE;
     LC_OperData.WDTPtr[WatchIndex].ResultAgeWhenStale = 1;
     LC_OperData.WDTPtr[WatchIndex].BitMask            = 0;
     LC_OperData.WDTPtr[WatchIndex].ComparisonValue.Unsigned32 = 1;
     LC_OperData.WRTPtr[WatchIndex].EvaluationCount            = 0;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_OperatorCompare(WatchIndex, ProcessedWPData);
+    Result = LC_OperatorCompare(&LC_OperData.WatchEvals[0], ProcessedWPData);
 
     /* Verify results */
     UtAssert_True(Result == LC_WATCH_TRUE, "Result == LC_WATCH_TRUE");
@@ -579,14 +1728,16 @@ void LC_OperatorCompare_Test_DataFloatLE(void) {
 
     LC_OperData.WDTPtr[WatchIndex].DataType                = LC_DATA_FLOAT_LE;
     LC_OperData.WDTPtr[WatchIndex].OperatorID              = LC_OPER_LE;
-    LC_OperData.WRTPtr[WatchIndex].WatchResult             = LC_WATCH_STALE;
+    LC_OperData.WatchResults[WatchIndex]                   = LC_WATCH_STALE;
     LC_OperData.WDTPtr[WatchIndex].ResultAgeWhenStale      = 1;
     LC_OperData.WDTPtr[WatchIndex].BitMask                 = 0;
     LC_OperData.WDTPtr[WatchIndex].ComparisonValue.Float32 = 1.0;
     LC_OperData.WRTPtr[WatchIndex].EvaluationCount         = 0;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_OperatorCompare(WatchIndex, ProcessedWPData);
+    Result = LC_OperatorCompare(&LC_OperData.WatchEvals[0], ProcessedWPData);
 
     /* Verify results */
     UtAssert_True(Result == LC_WATCH_TRUE, "Result == LC_WATCH_TRUE");
@@ -603,14 +1754,16 @@ void LC_OperatorCompare_Test_DataTypeError(void) {
 
     LC_OperData.WDTPtr[WatchIndex].DataType                = 99;
     LC_OperData.WDTPtr[WatchIndex].OperatorID              = LC_OPER_LE;
-    LC_OperData.WRTPtr[WatchIndex].WatchResult             = LC_WATCH_STALE;
+    LC_OperData.WatchResults[WatchIndex]                   = LC_WATCH_STALE;
     LC_OperData.WDTPtr[WatchIndex].ResultAgeWhenStale      = 1;
     LC_OperData.WDTPtr[WatchIndex].BitMask                 = 0;
     LC_OperData.WDTPtr[WatchIndex].ComparisonValue.Float32 = 1.0;
     LC_OperData.WRTPtr[WatchIndex].EvaluationCount         = 0;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_OperatorCompare(WatchIndex, ProcessedWPData);
+    Result = LC_OperatorCompare(&LC_OperData.WatchEvals[0], ProcessedWPData);
 
     /* Verify results */
     UtAssert_True(Result == LC_WATCH_ERROR, "Result == LC_WATCH_ERROR");
@@ -633,8 +1786,11 @@ void LC_SignedCompare_Test_LE(void) {
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_LE;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_SignedCompare(WatchIndex, WPValue, CompareValue);
+    Result = LC_SignedCompare(&LC_OperData.WatchEvals[0], WPValue,
+                              CompareValue);
 
     /* Verify results */
     UtAssert_True(Result == LC_WATCH_TRUE, "Result == LC_WATCH_TRUE");
@@ -652,8 +1808,11 @@ void LC_SignedCompare_Test_LT(void) {
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_LT;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_SignedCompare(WatchIndex, WPValue, CompareValue);
+    Result = LC_SignedCompare(&LC_OperData.WatchEvals[0], WPValue,
+                              CompareValue);
 
     /* Verify results */
     UtAssert_True(Result == LC_WATCH_TRUE, "Result == LC_WATCH_TRUE");
@@ -671,8 +1830,11 @@ void LC_SignedCompare_Test_EQ(void) {
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_EQ;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_SignedCompare(WatchIndex, WPValue, CompareValue);
+    Result = LC_SignedCompare(&LC_OperData.WatchEvals[0], WPValue,
+                              CompareValue);
 
     /* Verify results */
     UtAssert_True(Result == LC_WATCH_TRUE, "Result == LC_WATCH_TRUE");
@@ -690,8 +1852,11 @@ void LC_SignedCompare_Test_NE(void) {
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_NE;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_SignedCompare(WatchIndex, WPValue, CompareValue);
+    Result = LC_SignedCompare(&LC_OperData.WatchEvals[0], WPValue,
+                              CompareValue);
 
     /* Verify results */
     UtAssert_True(Result == LC_WATCH_TRUE, "Result == LC_WATCH_TRUE");
@@ -709,8 +1874,11 @@ void LC_SignedCompare_Test_GT(void) {
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_GT;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_SignedCompare(WatchIndex, WPValue, CompareValue);
+    Result = LC_SignedCompare(&LC_OperData.WatchEvals[0], WPValue,
+                              CompareValue);
 
     /* Verify results */
     UtAssert_True(Result == LC_WATCH_TRUE, "Result == LC_WATCH_TRUE");
@@ -728,8 +1896,11 @@ void LC_SignedCompare_Test_GE(void) {
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_GE;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_SignedCompare(WatchIndex, WPValue, CompareValue);
+    Result = LC_SignedCompare(&LC_OperData.WatchEvals[0], WPValue,
+                              CompareValue);
 
     /* Verify results */
     UtAssert_True(Result == LC_WATCH_TRUE, "Result == LC_WATCH_TRUE");
@@ -747,8 +1918,11 @@ void LC_SignedCompare_Test_InvalidOperatorID(void) {
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = 99;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_SignedCompare(WatchIndex, WPValue, CompareValue);
+    Result = LC_SignedCompare(&LC_OperData.WatchEvals[0], WPValue,
+                              CompareValue);
 
     /* Verify results */
     UtAssert_True(Result == LC_WATCH_ERROR, "Result == LC_WATCH_ERROR");
@@ -771,8 +1945,11 @@ void LC_UnsignedCompare_Test_LE(void) {
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_LE;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_UnsignedCompare(WatchIndex, WPValue, CompareValue);
+    Result = LC_UnsignedCompare(&LC_OperData.WatchEvals[0], WPValue,
+                                CompareValue);
 
     /* Verify results */
     UtAssert_True(Result == LC_WATCH_TRUE, "Result == LC_WATCH_TRUE");
@@ -790,8 +1967,11 @@ void LC_UnsignedCompare_Test_LT(void) {
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_LT;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_UnsignedCompare(WatchIndex, WPValue, CompareValue);
+    Result = LC_UnsignedCompare(&LC_OperData.WatchEvals[0], WPValue,
+                                CompareValue);
 
     /* Verify results */
     UtAssert_True(Result == LC_WATCH_TRUE, "Result == LC_WATCH_TRUE");
@@ -809,8 +1989,11 @@ void LC_UnsignedCompare_Test_EQ(void) {
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_EQ;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_UnsignedCompare(WatchIndex, WPValue, CompareValue);
+    Result = LC_UnsignedCompare(&LC_OperData.WatchEvals[0], WPValue,
+                                CompareValue);
 
     /* Verify results */
     UtAssert_True(Result == LC_WATCH_TRUE, "Result == LC_WATCH_TRUE");
@@ -828,8 +2011,11 @@ void LC_UnsignedCompare_Test_NE(void) {
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_NE;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_UnsignedCompare(WatchIndex, WPValue, CompareValue);
+    Result = LC_UnsignedCompare(&LC_OperData.WatchEvals[0], WPValue,
+                                CompareValue);
 
     /* Verify results */
     UtAssert_True(Result == LC_WATCH_TRUE, "Result == LC_WATCH_TRUE");
@@ -847,8 +2033,11 @@ void LC_UnsignedCompare_Test_GT(void) {
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_GT;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_UnsignedCompare(WatchIndex, WPValue, CompareValue);
+    Result = LC_UnsignedCompare(&LC_OperData.WatchEvals[0], WPValue,
+                                CompareValue);
 
     /* Verify results */
     UtAssert_True(Result == LC_WATCH_TRUE, "Result == LC_WATCH_TRUE");
@@ -866,8 +2055,11 @@ void LC_UnsignedCompare_Test_GE(void) {
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_GE;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_UnsignedCompare(WatchIndex, WPValue, CompareValue);
+    Result = LC_UnsignedCompare(&LC_OperData.WatchEvals[0], WPValue,
+                                CompareValue);
 
     /* Verify results */
     UtAssert_True(Result == LC_WATCH_TRUE, "Result == LC_WATCH_TRUE");
@@ -885,8 +2077,11 @@ void LC_UnsignedCompare_Test_InvalidOperatorID(void) {
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = 99;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_UnsignedCompare(WatchIndex, WPValue, CompareValue);
+    Result = LC_UnsignedCompare(&LC_OperData.WatchEvals[0], WPValue,
+                                CompareValue);
 
     /* Verify results */
     UtAssert_True(Result == LC_WATCH_ERROR, "Result == LC_WATCH_ERROR");
@@ -912,8 +2107,11 @@ void LC_FloatCompare_Test_LE(void) {
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_LE;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_FloatCompare(WatchIndex, WPMultiType, CompareMultiType);
+    Result = LC_FloatCompare(&LC_OperData.WatchEvals[0], WPMultiType,
+                             CompareMultiType);
 
     /* Verify results */
     UtAssert_True(Result == LC_WATCH_TRUE, "Result == LC_WATCH_TRUE");
@@ -934,8 +2132,11 @@ void LC_FloatCompare_Test_LT(void) {
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_LT;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_FloatCompare(WatchIndex, WPMultiType, CompareMultiType);
+    Result = LC_FloatCompare(&LC_OperData.WatchEvals[0], WPMultiType,
+                             CompareMultiType);
 
     /* Verify results */
     UtAssert_True(Result == LC_WATCH_TRUE, "Result == LC_WATCH_TRUE");
@@ -956,8 +2157,11 @@ void LC_FloatCompare_Test_EQ(void) {
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_EQ;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_FloatCompare(WatchIndex, WPMultiType, CompareMultiType);
+    Result = LC_FloatCompare(&LC_OperData.WatchEvals[0], WPMultiType,
+                             CompareMultiType);
 
     /* Verify results */
     UtAssert_True(Result == LC_WATCH_TRUE, "Result == LC_WATCH_TRUE");
@@ -978,8 +2182,11 @@ void LC_FloatCompare_Test_NE(void) {
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_NE;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_FloatCompare(WatchIndex, WPMultiType, CompareMultiType);
+    Result = LC_FloatCompare(&LC_OperData.WatchEvals[0], WPMultiType,
+                             CompareMultiType);
 
     /* Verify results */
     UtAssert_True(Result == LC_WATCH_TRUE, "Result == LC_WATCH_TRUE");
@@ -1000,8 +2207,11 @@ void LC_FloatCompare_Test_GT(void) {
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_GT;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_FloatCompare(WatchIndex, WPMultiType, CompareMultiType);
+    Result = LC_FloatCompare(&LC_OperData.WatchEvals[0], WPMultiType,
+                             CompareMultiType);
 
     /* Verify results */
     UtAssert_True(Result == LC_WATCH_TRUE, "Result == LC_WATCH_TRUE");
@@ -1022,8 +2232,11 @@ void LC_FloatCompare_Test_GE(void) {
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_GE;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_FloatCompare(WatchIndex, WPMultiType, CompareMultiType);
+    Result = LC_FloatCompare(&LC_OperData.WatchEvals[0], WPMultiType,
+                             CompareMultiType);
 
     /* Verify results */
     UtAssert_True(Result == LC_WATCH_TRUE, "Result == LC_WATCH_TRUE");
@@ -1033,6 +2246,32 @@ void LC_FloatCompare_Test_GE(void) {
 
 } /* end LC_FloatCompare_Test_GE */
 
+void LC_FloatCompare_Test_LTWithinTolerance(void) {
+    uint8 Result;
+    uint16 WatchIndex = 0;
+    LC_MultiType_t WPMultiType;
+    LC_MultiType_t CompareMultiType;
+
+    /* Relational operators compare exactly, even inside the tolerance */
+    WPMultiType.Float32      = 0.0;
+    CompareMultiType.Float32 = 1.0e-30;
+
+    LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_LT;
+
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
+    /* Execute the function being tested */
+    Result = LC_FloatCompare(&LC_OperData.WatchEvals[0], WPMultiType,
+                             CompareMultiType);
+
+    /* Verify results */
+    UtAssert_True(Result == LC_WATCH_TRUE, "Result == LC_WATCH_TRUE");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end LC_FloatCompare_Test_LTWithinTolerance */
+
 void LC_FloatCompare_Test_InvalidOperatorID(void) {
     uint8 Result;
     uint16 WatchIndex = 0;
@@ -1044,8 +2283,11 @@ void LC_FloatCompare_Test_InvalidOperatorID(void) {
 
     LC_OperData.WDTPtr[WatchIndex].OperatorID = 99;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_FloatCompare(WatchIndex, WPMultiType, CompareMultiType);
+    Result = LC_FloatCompare(&LC_OperData.WatchEvals[0], WPMultiType,
+                             CompareMultiType);
 
     /* Verify results */
     UtAssert_True(Result == LC_WATCH_ERROR, "Result == LC_WATCH_ERROR");
@@ -1058,36 +2300,261 @@ void LC_FloatCompare_Test_InvalidOperatorID(void) {
     UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 1,
                   "Ut_CFE_EVS_GetEventQueueDepth() == 1");
 
-} /* end LC_FloatCompare_Test_InvalidOperatorID */
+} /* end LC_FloatCompare_Test_InvalidOperatorID */
+
+void LC_FloatCompare_Test_NaN(void) {
+    uint8 Result;
+    uint16 WatchIndex = 0;
+    LC_MultiType_t WPMultiType;
+    LC_MultiType_t CompareMultiType;
+
+    WPMultiType.Float32      = 1.0;
+    WPMultiType.Unsigned32   = 0x7F8FFFFF;
+    CompareMultiType.Float32 = 0.0;
+
+    LC_OperData.WDTPtr[WatchIndex].OperatorID = 99;
+
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
+    /* Execute the function being tested */
+    Result = LC_FloatCompare(&LC_OperData.WatchEvals[0], WPMultiType,
+                             CompareMultiType);
+
+    /* Verify results */
+    UtAssert_True(Result == LC_WATCH_ERROR, "Result == LC_WATCH_ERROR");
+
+    UtAssert_True(
+        Ut_CFE_EVS_EventSent(
+            LC_WP_NAN_ERR_EID, CFE_EVS_ERROR,
+            "WP data value is a float NAN: WP = 0, Value = 0x7F8FFFFF"),
+        "WP data value is a float NAN: WP = 0, Value = 0x7F8FFFFF");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 1,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 1");
+
+} /* end LC_FloatCompare_Test_NaN */
+
+void LC_SignedCompareBatch_Test_Nominal(void) {
+    LC_MultiType_t WPValues[3];
+    LC_MultiType_t CompareValues[3];
+    uint8 AcceptMasks[3];
+    uint8 WPEvalResults[3];
+
+    WPValues[0].Signed32      = -2;
+    CompareValues[0].Signed32 = 1;
+    AcceptMasks[0]            = LC_ACCEPT_LT;
+
+    WPValues[1].Signed32      = 5;
+    CompareValues[1].Signed32 = 5;
+    AcceptMasks[1]            = LC_ACCEPT_LT | LC_ACCEPT_GT;
+
+    WPValues[2].Signed32      = 7;
+    CompareValues[2].Signed32 = -7;
+    AcceptMasks[2]            = LC_ACCEPT_EQ | LC_ACCEPT_GT;
+
+    /* Execute the function being tested */
+    LC_SignedCompareBatch(WPValues, CompareValues, AcceptMasks, WPEvalResults,
+                          3);
+
+    /* Verify results */
+    UtAssert_True(WPEvalResults[0] == LC_WATCH_TRUE,
+                  "WPEvalResults[0] == LC_WATCH_TRUE");
+    UtAssert_True(WPEvalResults[1] == LC_WATCH_FALSE,
+                  "WPEvalResults[1] == LC_WATCH_FALSE");
+    UtAssert_True(WPEvalResults[2] == LC_WATCH_TRUE,
+                  "WPEvalResults[2] == LC_WATCH_TRUE");
+
+} /* end LC_SignedCompareBatch_Test_Nominal */
+
+void LC_UnsignedCompareBatch_Test_Nominal(void) {
+    LC_MultiType_t WPValues[2];
+    LC_MultiType_t CompareValues[2];
+    uint8 AcceptMasks[2];
+    uint8 WPEvalResults[2];
+
+    /* Would be true as a signed compare */
+    WPValues[0].Unsigned32      = 0xFFFFFFFF;
+    CompareValues[0].Unsigned32 = 1;
+    AcceptMasks[0]              = LC_ACCEPT_LT;
+
+    WPValues[1].Unsigned32      = 3;
+    CompareValues[1].Unsigned32 = 3;
+    AcceptMasks[1]              = LC_ACCEPT_LT | LC_ACCEPT_EQ;
+
+    /* Execute the function being tested */
+    LC_UnsignedCompareBatch(WPValues, CompareValues, AcceptMasks,
+                            WPEvalResults, 2);
+
+    /* Verify results */
+    UtAssert_True(WPEvalResults[0] == LC_WATCH_FALSE,
+                  "WPEvalResults[0] == LC_WATCH_FALSE");
+    UtAssert_True(WPEvalResults[1] == LC_WATCH_TRUE,
+                  "WPEvalResults[1] == LC_WATCH_TRUE");
+
+} /* end LC_UnsignedCompareBatch_Test_Nominal */
+
+void LC_FloatCompareBatch_Test_NaN(void) {
+    LC_MultiType_t WPValues[2];
+    LC_MultiType_t CompareValues[2];
+    uint8 AcceptMasks[2];
+    uint8 WPEvalResults[2];
+
+    WPValues[0].Unsigned32   = 0x7F8FFFFF;
+    CompareValues[0].Float32 = 1.0;
+    AcceptMasks[0]           = LC_ACCEPT_LT | LC_ACCEPT_EQ;
+
+    WPValues[1].Float32      = 1.0;
+    CompareValues[1].Float32 = 1.0;
+    AcceptMasks[1]           = LC_ACCEPT_EQ | LC_ACCEPT_NEAR;
+
+    /* Execute the function being tested */
+    LC_FloatCompareBatch(WPValues, CompareValues, AcceptMasks, WPEvalResults,
+                         2);
+
+    /* Verify results */
+    UtAssert_True(WPEvalResults[0] == LC_WATCH_ERROR,
+                  "WPEvalResults[0] == LC_WATCH_ERROR");
+    UtAssert_True(WPEvalResults[1] == LC_WATCH_TRUE,
+                  "WPEvalResults[1] == LC_WATCH_TRUE");
+
+    /* The event is sent when the lane is compared again alone */
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end LC_FloatCompareBatch_Test_NaN */
+
+void LC_SignedCompareBatch_Test_SevenLanes(void) {
+    LC_MultiType_t WPValues[7];
+    LC_MultiType_t CompareValues[7];
+    uint8 AcceptMasks[7];
+    uint8 WPEvalResults[7];
+    const int32 Values[7]   = {-2, 5, 7, 0x7FFFFFFF, -1, 3, 4};
+    const int32 Compares[7] = {1, 5, -7, (int32)0x80000000, 0, 3, 9};
+    const uint8 Masks[7]    = {LC_ACCEPT_LT,
+                               LC_ACCEPT_LT | LC_ACCEPT_GT,
+                               LC_ACCEPT_EQ | LC_ACCEPT_GT,
+                               LC_ACCEPT_GT,
+                               LC_ACCEPT_GT,
+                               LC_ACCEPT_EQ,
+                               LC_ACCEPT_LT | LC_ACCEPT_EQ};
+    const uint8 Expected[7] = {LC_WATCH_TRUE,  LC_WATCH_FALSE, LC_WATCH_TRUE,
+                               LC_WATCH_TRUE,  LC_WATCH_FALSE, LC_WATCH_TRUE,
+                               LC_WATCH_TRUE};
+    uint32 Lane;
+
+    /* Four lanes take the SIMD path where there is one, three do not */
+    for (Lane = 0; Lane < 7; Lane++) {
+        WPValues[Lane].Signed32      = Values[Lane];
+        CompareValues[Lane].Signed32 = Compares[Lane];
+        AcceptMasks[Lane]            = Masks[Lane];
+    }
 
-void LC_FloatCompare_Test_NaN(void) {
-    uint8 Result;
-    uint16 WatchIndex = 0;
-    LC_MultiType_t WPMultiType;
-    LC_MultiType_t CompareMultiType;
+    /* Execute the function being tested */
+    LC_SignedCompareBatch(WPValues, CompareValues, AcceptMasks, WPEvalResults,
+                          7);
 
-    WPMultiType.Float32      = 1.0;
-    WPMultiType.Unsigned32   = 0x7F8FFFFF;
-    CompareMultiType.Float32 = 0.0;
+    /* Verify results */
+    for (Lane = 0; Lane < 7; Lane++) {
+        UtAssert_True(WPEvalResults[Lane] == Expected[Lane],
+                      "WPEvalResults[Lane] == Expected[Lane]");
+    }
 
-    LC_OperData.WDTPtr[WatchIndex].OperatorID = 99;
+} /* end LC_SignedCompareBatch_Test_SevenLanes */
+
+void LC_UnsignedCompareBatch_Test_SevenLanes(void) {
+    LC_MultiType_t WPValues[7];
+    LC_MultiType_t CompareValues[7];
+    uint8 AcceptMasks[7];
+    uint8 WPEvalResults[7];
+    const uint32 Values[7]   = {0xFFFFFFFF, 3, 0x80000000, 0, 7, 0xFFFFFFFF,
+                                0x7FFFFFFF};
+    const uint32 Compares[7] = {1, 3, 0x7FFFFFFF, 0xFFFFFFFF, 7, 0xFFFFFFFF,
+                                0x80000000};
+    const uint8 Masks[7]     = {LC_ACCEPT_LT,
+                                LC_ACCEPT_LT | LC_ACCEPT_EQ,
+                                LC_ACCEPT_GT,
+                                LC_ACCEPT_LT,
+                                LC_ACCEPT_LT | LC_ACCEPT_GT,
+                                LC_ACCEPT_EQ,
+                                LC_ACCEPT_GT};
+    const uint8 Expected[7]  = {LC_WATCH_FALSE, LC_WATCH_TRUE, LC_WATCH_TRUE,
+                                LC_WATCH_TRUE,  LC_WATCH_FALSE, LC_WATCH_TRUE,
+                                LC_WATCH_FALSE};
+    uint32 Lane;
+
+    for (Lane = 0; Lane < 7; Lane++) {
+        WPValues[Lane].Unsigned32      = Values[Lane];
+        CompareValues[Lane].Unsigned32 = Compares[Lane];
+        AcceptMasks[Lane]              = Masks[Lane];
+    }
 
     /* Execute the function being tested */
-    Result = LC_FloatCompare(WatchIndex, WPMultiType, CompareMultiType);
+    LC_UnsignedCompareBatch(WPValues, CompareValues, AcceptMasks,
+                            WPEvalResults, 7);
 
     /* Verify results */
-    UtAssert_True(Result == LC_WATCH_ERROR, "Result == LC_WATCH_ERROR");
+    for (Lane = 0; Lane < 7; Lane++) {
+        UtAssert_True(WPEvalResults[Lane] == Expected[Lane],
+                      "WPEvalResults[Lane] == Expected[Lane]");
+    }
 
-    UtAssert_True(
-        Ut_CFE_EVS_EventSent(
-            LC_WP_NAN_ERR_EID, CFE_EVS_ERROR,
-            "WP data value is a float NAN: WP = 0, Value = 0x7F8FFFFF"),
-        "WP data value is a float NAN: WP = 0, Value = 0x7F8FFFFF");
+} /* end LC_UnsignedCompareBatch_Test_SevenLanes */
+
+void LC_FloatCompareBatch_Test_SevenLanes(void) {
+    LC_MultiType_t WPValues[7];
+    LC_MultiType_t CompareValues[7];
+    uint8 AcceptMasks[7];
+    uint8 WPEvalResults[7];
+    const uint8 Masks[7]    = {LC_ACCEPT_LT,
+                               LC_ACCEPT_LT | LC_ACCEPT_EQ,
+                               LC_ACCEPT_EQ | LC_ACCEPT_NEAR,
+                               LC_ACCEPT_LT | LC_ACCEPT_GT | LC_ACCEPT_NEAR,
+                               LC_ACCEPT_GT,
+                               LC_ACCEPT_EQ | LC_ACCEPT_NEAR,
+                               LC_ACCEPT_LT};
+    const uint8 Expected[7] = {LC_WATCH_TRUE,  LC_WATCH_ERROR, LC_WATCH_TRUE,
+                               LC_WATCH_FALSE, LC_WATCH_TRUE,  LC_WATCH_ERROR,
+                               LC_WATCH_FALSE};
+    uint32 Lane;
+
+    WPValues[0].Float32      = -1.5f;
+    CompareValues[0].Float32 = 2.0f;
+
+    /* NAN in a SIMD lane and in a scalar lane */
+    WPValues[1].Unsigned32   = 0xFFC00000;
+    CompareValues[1].Float32 = 1.0f;
+
+    WPValues[2].Float32      = 1.0e-30f;
+    CompareValues[2].Float32 = 0.0f;
+
+    /* Within the tolerance, so not LT or GT */
+    WPValues[3].Float32      = 0.0f;
+    CompareValues[3].Float32 = 1.0e-30f;
+
+    WPValues[4].Unsigned32   = 0x7F800000;
+    CompareValues[4].Float32 = 3.0e38f;
+
+    WPValues[5].Unsigned32   = 0x7F800001;
+    CompareValues[5].Float32 = 0.0f;
+
+    WPValues[6].Float32      = 2.0f;
+    CompareValues[6].Float32 = 2.0f;
+
+    for (Lane = 0; Lane < 7; Lane++) {
+        AcceptMasks[Lane] = Masks[Lane];
+    }
 
-    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 1,
-                  "Ut_CFE_EVS_GetEventQueueDepth() == 1");
+    /* Execute the function being tested */
+    LC_FloatCompareBatch(WPValues, CompareValues, AcceptMasks, WPEvalResults,
+                         7);
 
-} /* end LC_FloatCompare_Test_NaN */
+    /* Verify results */
+    for (Lane = 0; Lane < 7; Lane++) {
+        UtAssert_True(WPEvalResults[Lane] == Expected[Lane],
+                      "WPEvalResults[Lane] == Expected[Lane]");
+    }
+
+} /* end LC_FloatCompareBatch_Test_SevenLanes */
 
 void LC_WPOffsetValid_Test_DataUByte(void) {
     boolean Result;
@@ -1100,8 +2567,12 @@ void LC_WPOffsetValid_Test_DataUByte(void) {
     LC_OperData.WDTPtr[WatchIndex].DataType         = LC_DATA_UBYTE;
     LC_OperData.WDTPtr[WatchIndex].WatchpointOffset = 0;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_WPOffsetValid(WatchIndex, (CFE_SB_MsgPtr_t)(&CmdPacket));
+    Result = LC_WPOffsetValid(&LC_OperData.WatchEvals[0],
+                              (CFE_SB_MsgPtr_t)(&CmdPacket),
+                              sizeof(LC_NoArgsCmd_t));
 
     /* Verify results */
     UtAssert_True(Result == TRUE, "Result == TRUE");
@@ -1122,8 +2593,12 @@ void LC_WPOffsetValid_Test_UWordLE(void) {
     LC_OperData.WDTPtr[WatchIndex].DataType         = LC_DATA_UWORD_LE;
     LC_OperData.WDTPtr[WatchIndex].WatchpointOffset = 0;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_WPOffsetValid(WatchIndex, (CFE_SB_MsgPtr_t)(&CmdPacket));
+    Result = LC_WPOffsetValid(&LC_OperData.WatchEvals[0],
+                              (CFE_SB_MsgPtr_t)(&CmdPacket),
+                              sizeof(LC_NoArgsCmd_t));
 
     /* Verify results */
     UtAssert_True(Result == TRUE, "Result == TRUE");
@@ -1144,8 +2619,12 @@ void LC_WPOffsetValid_Test_UDWordLE(void) {
     LC_OperData.WDTPtr[WatchIndex].DataType         = LC_DATA_UDWORD_LE;
     LC_OperData.WDTPtr[WatchIndex].WatchpointOffset = 0;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_WPOffsetValid(WatchIndex, (CFE_SB_MsgPtr_t)(&CmdPacket));
+    Result = LC_WPOffsetValid(&LC_OperData.WatchEvals[0],
+                              (CFE_SB_MsgPtr_t)(&CmdPacket),
+                              sizeof(LC_NoArgsCmd_t));
 
     /* Verify results */
     UtAssert_True(Result == TRUE, "Result == TRUE");
@@ -1166,8 +2645,12 @@ void LC_WPOffsetValid_Test_FloatLE(void) {
     LC_OperData.WDTPtr[WatchIndex].DataType         = LC_DATA_FLOAT_LE;
     LC_OperData.WDTPtr[WatchIndex].WatchpointOffset = 0;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_WPOffsetValid(WatchIndex, (CFE_SB_MsgPtr_t)(&CmdPacket));
+    Result = LC_WPOffsetValid(&LC_OperData.WatchEvals[0],
+                              (CFE_SB_MsgPtr_t)(&CmdPacket),
+                              sizeof(LC_NoArgsCmd_t));
 
     /* Verify results */
     UtAssert_True(Result == TRUE, "Result == TRUE");
@@ -1188,8 +2671,12 @@ void LC_WPOffsetValid_Test_DataTypeError(void) {
     LC_OperData.WDTPtr[WatchIndex].DataType         = 99;
     LC_OperData.WDTPtr[WatchIndex].WatchpointOffset = 0;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_WPOffsetValid(WatchIndex, (CFE_SB_MsgPtr_t)(&CmdPacket));
+    Result = LC_WPOffsetValid(&LC_OperData.WatchEvals[0],
+                              (CFE_SB_MsgPtr_t)(&CmdPacket),
+                              sizeof(LC_NoArgsCmd_t));
 
     /* Verify results */
     UtAssert_True(Result == FALSE, "Result == FALSE");
@@ -1200,10 +2687,10 @@ void LC_WPOffsetValid_Test_DataTypeError(void) {
                   "WP has undefined data type: WP = 0, DataType = 99");
 
     UtAssert_True(
-        LC_OperData.WRTPtr[WatchIndex].WatchResult == LC_WATCH_ERROR,
-        "LC_OperData.WRTPtr[WatchIndex].WatchResult == LC_WATCH_ERROR");
-    UtAssert_True(LC_OperData.WRTPtr[WatchIndex].CountdownToStale == 0,
-                  "LC_OperData.WRTPtr[WatchIndex].CountdownToStale == 0");
+        LC_OperData.WatchResults[WatchIndex] == LC_WATCH_ERROR,
+        "LC_OperData.WatchResults[WatchIndex] == LC_WATCH_ERROR");
+    UtAssert_True(LC_GetStaleCountdown(WatchIndex) == 0,
+                  "LC_GetStaleCountdown(WatchIndex) == 0");
 
     UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 1,
                   "Ut_CFE_EVS_GetEventQueueDepth() == 1");
@@ -1221,8 +2708,12 @@ void LC_WPOffsetValid_Test_OffsetError(void) {
     LC_OperData.WDTPtr[WatchIndex].DataType         = LC_DATA_UBYTE;
     LC_OperData.WDTPtr[WatchIndex].WatchpointOffset = sizeof(LC_NoArgsCmd_t);
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_WPOffsetValid(WatchIndex, (CFE_SB_MsgPtr_t)(&CmdPacket));
+    Result = LC_WPOffsetValid(&LC_OperData.WatchEvals[0],
+                              (CFE_SB_MsgPtr_t)(&CmdPacket),
+                              sizeof(LC_NoArgsCmd_t));
 
     /* Verify results */
     UtAssert_True(Result == FALSE, "Result == FALSE");
@@ -1234,10 +2725,10 @@ void LC_WPOffsetValid_Test_OffsetError(void) {
                   "MsgLen = 8");
 
     UtAssert_True(
-        LC_OperData.WRTPtr[WatchIndex].WatchResult == LC_WATCH_ERROR,
-        "LC_OperData.WRTPtr[WatchIndex].WatchResult == LC_WATCH_ERROR");
-    UtAssert_True(LC_OperData.WRTPtr[WatchIndex].CountdownToStale == 0,
-                  "LC_OperData.WRTPtr[WatchIndex].CountdownToStale == 0");
+        LC_OperData.WatchResults[WatchIndex] == LC_WATCH_ERROR,
+        "LC_OperData.WatchResults[WatchIndex] == LC_WATCH_ERROR");
+    UtAssert_True(LC_GetStaleCountdown(WatchIndex) == 0,
+                  "LC_GetStaleCountdown(WatchIndex) == 0");
 
     UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 1,
                   "Ut_CFE_EVS_GetEventQueueDepth() == 1");
@@ -1245,7 +2736,6 @@ void LC_WPOffsetValid_Test_OffsetError(void) {
 } /* end LC_WPOffsetValid_Test_OffsetError */
 
 void LC_GetSizedWPData_Test_DataByte(void) {
-    boolean Result;
     uint16 WatchIndex = 0;
     uint8 WPData[4];
     uint32 SizedData;
@@ -1257,11 +2747,12 @@ void LC_GetSizedWPData_Test_DataByte(void) {
 
     LC_OperData.WDTPtr[WatchIndex].DataType = LC_DATA_BYTE;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_GetSizedWPData(WatchIndex, WPData, &SizedData);
+    SizedData = LC_GetSizedWPData(&LC_OperData.WatchEvals[0], WPData);
 
     /* Verify results */
-    UtAssert_True(Result == TRUE, "Result == TRUE");
     UtAssert_True(SizedData == 1, "SizedData == 1");
 
     UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
@@ -1270,7 +2761,6 @@ void LC_GetSizedWPData_Test_DataByte(void) {
 } /* end LC_GetSizedWPData_Test_DataByte */
 
 void LC_GetSizedWPData_Test_DataUByte(void) {
-    boolean Result;
     uint16 WatchIndex = 0;
     uint8 WPData[4];
     uint32 SizedData;
@@ -1282,11 +2772,12 @@ void LC_GetSizedWPData_Test_DataUByte(void) {
 
     LC_OperData.WDTPtr[WatchIndex].DataType = LC_DATA_UBYTE;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_GetSizedWPData(WatchIndex, WPData, &SizedData);
+    SizedData = LC_GetSizedWPData(&LC_OperData.WatchEvals[0], WPData);
 
     /* Verify results */
-    UtAssert_True(Result == TRUE, "Result == TRUE");
     UtAssert_True(SizedData == 1, "SizedData == 1");
 
     UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
@@ -1295,7 +2786,6 @@ void LC_GetSizedWPData_Test_DataUByte(void) {
 } /* end LC_GetSizedWPData_Test_DataUByte */
 
 void LC_GetSizedWPData_Test_DataWordBELittleEndian(void) {
-    boolean Result;
     uint16 WatchIndex = 0;
     uint8 WPData[4];
     uint32 SizedData;
@@ -1307,11 +2797,12 @@ void LC_GetSizedWPData_Test_DataWordBELittleEndian(void) {
 
     LC_OperData.WDTPtr[WatchIndex].DataType = LC_DATA_WORD_BE;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_GetSizedWPData(WatchIndex, WPData, &SizedData);
+    SizedData = LC_GetSizedWPData(&LC_OperData.WatchEvals[0], WPData);
 
     /* Verify results */
-    UtAssert_True(Result == TRUE, "Result == TRUE");
     UtAssert_True(SizedData == 0x0102, "SizedData == 0x0102");
 
     UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
@@ -1320,7 +2811,6 @@ void LC_GetSizedWPData_Test_DataWordBELittleEndian(void) {
 } /* end LC_GetSizedWPData_Test_DataWordBELittleEndian */
 
 void LC_GetSizedWPData_Test_DataWordLELittleEndian(void) {
-    boolean Result;
     uint16 WatchIndex = 0;
     uint8 WPData[4];
     uint32 SizedData;
@@ -1332,11 +2822,12 @@ void LC_GetSizedWPData_Test_DataWordLELittleEndian(void) {
 
     LC_OperData.WDTPtr[WatchIndex].DataType = LC_DATA_WORD_LE;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_GetSizedWPData(WatchIndex, WPData, &SizedData);
+    SizedData = LC_GetSizedWPData(&LC_OperData.WatchEvals[0], WPData);
 
     /* Verify results */
-    UtAssert_True(Result == TRUE, "Result == TRUE");
     UtAssert_True(SizedData == 0x0201, "SizedData == 0x0201");
 
     UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
@@ -1345,7 +2836,6 @@ void LC_GetSizedWPData_Test_DataWordLELittleEndian(void) {
 } /* end LC_GetSizedWPData_Test_DataWordLELittleEndian */
 
 void LC_GetSizedWPData_Test_DataUWordBELittleEndian(void) {
-    boolean Result;
     uint16 WatchIndex = 0;
     uint8 WPData[4];
     uint32 SizedData;
@@ -1357,11 +2847,12 @@ void LC_GetSizedWPData_Test_DataUWordBELittleEndian(void) {
 
     LC_OperData.WDTPtr[WatchIndex].DataType = LC_DATA_UWORD_BE;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_GetSizedWPData(WatchIndex, WPData, &SizedData);
+    SizedData = LC_GetSizedWPData(&LC_OperData.WatchEvals[0], WPData);
 
     /* Verify results */
-    UtAssert_True(Result == TRUE, "Result == TRUE");
     UtAssert_True(SizedData == 0x0102, "SizedData == 0x0102");
 
     UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
@@ -1370,7 +2861,6 @@ void LC_GetSizedWPData_Test_DataUWordBELittleEndian(void) {
 } /* end LC_GetSizedWPData_Test_DataUWordBELittleEndian */
 
 void LC_GetSizedWPData_Test_DataUWordLELittleEndian(void) {
-    boolean Result;
     uint16 WatchIndex = 0;
     uint8 WPData[4];
     uint32 SizedData;
@@ -1382,11 +2872,12 @@ void LC_GetSizedWPData_Test_DataUWordLELittleEndian(void) {
 
     LC_OperData.WDTPtr[WatchIndex].DataType = LC_DATA_UWORD_LE;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_GetSizedWPData(WatchIndex, WPData, &SizedData);
+    SizedData = LC_GetSizedWPData(&LC_OperData.WatchEvals[0], WPData);
 
     /* Verify results */
-    UtAssert_True(Result == TRUE, "Result == TRUE");
     UtAssert_True(SizedData == 0x0201, "SizedData == 0x0201");
 
     UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
@@ -1395,7 +2886,6 @@ void LC_GetSizedWPData_Test_DataUWordLELittleEndian(void) {
 } /* end LC_GetSizedWPData_Test_DataUWordLELittleEndian */
 
 void LC_GetSizedWPData_Test_DataFloatBELittleEndian(void) {
-    boolean Result;
     uint16 WatchIndex = 0;
     uint8 WPData[4];
     uint32 SizedData;
@@ -1407,11 +2897,12 @@ void LC_GetSizedWPData_Test_DataFloatBELittleEndian(void) {
 
     LC_OperData.WDTPtr[WatchIndex].DataType = LC_DATA_FLOAT_BE;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_GetSizedWPData(WatchIndex, WPData, &SizedData);
+    SizedData = LC_GetSizedWPData(&LC_OperData.WatchEvals[0], WPData);
 
     /* Verify results */
-    UtAssert_True(Result == TRUE, "Result == TRUE");
     UtAssert_True(SizedData == 0x01020304, "SizedData == 0x01020304");
 
     UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
@@ -1420,7 +2911,6 @@ void LC_GetSizedWPData_Test_DataFloatBELittleEndian(void) {
 } /* end LC_GetSizedWPData_Test_DataFloatBELittleEndian */
 
 void LC_GetSizedWPData_Test_DataFloatLELittleEndian(void) {
-    boolean Result;
     uint16 WatchIndex = 0;
     uint8 WPData[4];
     uint32 SizedData;
@@ -1432,11 +2922,12 @@ void LC_GetSizedWPData_Test_DataFloatLELittleEndian(void) {
 
     LC_OperData.WDTPtr[WatchIndex].DataType = LC_DATA_FLOAT_LE;
 
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
     /* Execute the function being tested */
-    Result = LC_GetSizedWPData(WatchIndex, WPData, &SizedData);
+    SizedData = LC_GetSizedWPData(&LC_OperData.WatchEvals[0], WPData);
 
     /* Verify results */
-    UtAssert_True(Result == TRUE, "Result == TRUE");
     UtAssert_True(SizedData == 0x04030201, "SizedData == 0x04030201");
 
     UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
@@ -1444,39 +2935,357 @@ void LC_GetSizedWPData_Test_DataFloatLELittleEndian(void) {
 
 } /* end LC_GetSizedWPData_Test_DataFloatLELittleEndian */
 
-void LC_GetSizedWPData_Test_DataTypeError(void) {
-    boolean Result;
+void LC_GetSizedWPData_Test_SignedWordSwapMapFallback(void) {
     uint16 WatchIndex = 0;
     uint8 WPData[4];
     uint32 SizedData;
 
-    WPData[0] = 1;
-    WPData[1] = 2;
+    WPData[0] = 0xFF;
+    WPData[1] = 0xFE;
     WPData[2] = 3;
     WPData[3] = 4;
 
+    LC_OperData.WDTPtr[WatchIndex].DataType = LC_DATA_WORD_BE;
+
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
+    /* Force the byte map path used when no kernel is available */
+    LC_OperData.WatchEvals[0].ExtractFunc = (LC_ExtractFunc_t)NULL;
+
+    /* Execute the function being tested */
+    SizedData = LC_GetSizedWPData(&LC_OperData.WatchEvals[0], WPData);
+
+    /* Verify results */
+    UtAssert_True(SizedData == 0xFFFFFFFE, "SizedData == 0xFFFFFFFE");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end LC_GetSizedWPData_Test_SignedWordSwapMapFallback */
+
+void LC_GetSizedWPData_Test_DataUDWordBEKernel(void) {
+    uint16 WatchIndex = 0;
+    uint8 WPData[5];
+    uint32 SizedData;
+
+    WPData[0] = 9;
+    WPData[1] = 1;
+    WPData[2] = 2;
+    WPData[3] = 3;
+    WPData[4] = 4;
+
+    LC_OperData.WDTPtr[WatchIndex].DataType = LC_DATA_UDWORD_BE;
+
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
+    /* Execute the function being tested (misaligned datum) */
+    SizedData = LC_GetSizedWPData(&LC_OperData.WatchEvals[0], &WPData[1]);
+
+    /* Verify results */
+    UtAssert_True(SizedData == 0x01020304, "SizedData == 0x01020304");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end LC_GetSizedWPData_Test_DataUDWordBEKernel */
+
+void LC_CompileWatchpoint_Test_SignedWordBE(void) {
+    uint16 WatchIndex = 0;
+
+    LC_OperData.WDTPtr[WatchIndex].DataType                 = LC_DATA_WORD_BE;
+    LC_OperData.WDTPtr[WatchIndex].OperatorID               = LC_OPER_LT;
+    LC_OperData.WDTPtr[WatchIndex].WatchpointOffset         = 12;
+    LC_OperData.WDTPtr[WatchIndex].BitMask                  = LC_NO_BITMASK;
+    LC_OperData.WDTPtr[WatchIndex].ResultAgeWhenStale       = 3;
+    LC_OperData.WDTPtr[WatchIndex].ComparisonValue.Signed16 = -2;
+
+    /* Execute the function being tested */
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
+    /* Verify results */
+    UtAssert_True(LC_OperData.WatchEvals[0].DataSize == sizeof(int16),
+                  "LC_OperData.WatchEvals[0].DataSize == sizeof(int16)");
+    UtAssert_True(
+        LC_OperData.WatchEvals[0].CompareType == LC_EVAL_SIGNED,
+        "LC_OperData.WatchEvals[0].CompareType == LC_EVAL_SIGNED");
+    UtAssert_True(LC_OperData.WatchEvals[0].WidthMask == 0x0000FFFF,
+                  "LC_OperData.WatchEvals[0].WidthMask == 0x0000FFFF");
+    UtAssert_True(LC_OperData.WatchEvals[0].SignBit == 0x00008000,
+                  "LC_OperData.WatchEvals[0].SignBit == 0x00008000");
+    UtAssert_True(LC_OperData.WatchEvals[0].WatchpointOffset == 12,
+                  "LC_OperData.WatchEvals[0].WatchpointOffset == 12");
+    UtAssert_True(LC_OperData.WatchEvals[0].ResultAgeWhenStale == 3,
+                  "LC_OperData.WatchEvals[0].ResultAgeWhenStale == 3");
+    UtAssert_True(LC_OperData.WatchEvals[0].ComparisonValue.Signed32 == -2,
+                  "LC_OperData.WatchEvals[0].ComparisonValue.Signed32 == -2");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end LC_CompileWatchpoint_Test_SignedWordBE */
+
+void LC_CompileWatchpoint_Test_UnsignedByte(void) {
+    uint16 WatchIndex = 0;
+
+    LC_OperData.WDTPtr[WatchIndex].DataType                   = LC_DATA_UBYTE;
+    LC_OperData.WDTPtr[WatchIndex].OperatorID                 = LC_OPER_GE;
+    LC_OperData.WDTPtr[WatchIndex].ComparisonValue.Unsigned32 = 0xFFFFFFFF;
+
+    /* Execute the function being tested */
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
+    /* Verify results */
+    UtAssert_True(LC_OperData.WatchEvals[0].DataSize == sizeof(uint8),
+                  "LC_OperData.WatchEvals[0].DataSize == sizeof(uint8)");
+    UtAssert_True(
+        LC_OperData.WatchEvals[0].CompareType == LC_EVAL_UNSIGNED,
+        "LC_OperData.WatchEvals[0].CompareType == LC_EVAL_UNSIGNED");
+    UtAssert_True(LC_OperData.WatchEvals[0].SignBit == 0,
+                  "LC_OperData.WatchEvals[0].SignBit == 0");
+    UtAssert_True(LC_OperData.WatchEvals[0].ExtractFunc == LC_ExtractUint8,
+                  "LC_OperData.WatchEvals[0].ExtractFunc == LC_ExtractUint8");
+    UtAssert_True(LC_OperData.WatchEvals[0].ComparisonValue.Unsigned32 == 0xFF,
+                  "LC_OperData.WatchEvals[0].ComparisonValue.Unsigned32 == "
+                  "0xFF");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end LC_CompileWatchpoint_Test_UnsignedByte */
+
+void LC_CompileWatchpoint_Test_UndefinedDataType(void) {
+    uint16 WatchIndex = 0;
+
     LC_OperData.WDTPtr[WatchIndex].DataType = 99;
 
     /* Execute the function being tested */
-    Result = LC_GetSizedWPData(WatchIndex, WPData, &SizedData);
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
 
     /* Verify results */
-    UtAssert_True(Result == FALSE, "Result == FALSE");
+    UtAssert_True(LC_OperData.WatchEvals[0].DataSize == 0,
+                  "LC_OperData.WatchEvals[0].DataSize == 0");
     UtAssert_True(
-        LC_OperData.WRTPtr[WatchIndex].WatchResult == LC_WATCH_ERROR,
-        "LC_OperData.WRTPtr[WatchIndex].WatchResult == LC_WATCH_ERROR");
-    UtAssert_True(LC_OperData.WRTPtr[WatchIndex].CountdownToStale == 0,
-                  "LC_OperData.WRTPtr[WatchIndex].CountdownToStale == 0");
+        LC_OperData.WatchEvals[0].CompareType == LC_EVAL_UNDEFINED,
+        "LC_OperData.WatchEvals[0].CompareType == LC_EVAL_UNDEFINED");
+    UtAssert_True(LC_OperData.WatchEvals[0].DataType == 99,
+                  "LC_OperData.WatchEvals[0].DataType == 99");
+    UtAssert_True(LC_OperData.WatchEvals[0].ExtractFunc == NULL,
+                  "LC_OperData.WatchEvals[0].ExtractFunc == NULL");
 
-    UtAssert_True(Ut_CFE_EVS_EventSent(
-                      LC_WP_DATATYPE_ERR_EID, CFE_EVS_ERROR,
-                      "WP has undefined data type: WP = 0, DataType = 99"),
-                  "WP has undefined data type: WP = 0, DataType = 99");
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
 
-    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 1,
-                  "Ut_CFE_EVS_GetEventQueueDepth() == 1");
+} /* end LC_CompileWatchpoint_Test_UndefinedDataType */
+
+void LC_CompileWatchpoint_Test_AcceptMask(void) {
+    uint16 WatchIndex = 0;
+
+    LC_OperData.WDTPtr[WatchIndex].DataType   = LC_DATA_UBYTE;
+    LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_LE;
+
+    /* Execute the function being tested */
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
+    /* Verify results */
+    UtAssert_True(LC_OperData.WatchEvals[0].AcceptMask ==
+                      (LC_ACCEPT_LT | LC_ACCEPT_EQ),
+                  "LC_OperData.WatchEvals[0].AcceptMask == "
+                  "(LC_ACCEPT_LT | LC_ACCEPT_EQ)");
+
+    LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_NE;
+
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
+    UtAssert_True(LC_OperData.WatchEvals[0].AcceptMask ==
+                      (LC_ACCEPT_LT | LC_ACCEPT_GT | LC_ACCEPT_NEAR),
+                  "LC_OperData.WatchEvals[0].AcceptMask == "
+                  "(LC_ACCEPT_LT | LC_ACCEPT_GT | LC_ACCEPT_NEAR)");
+
+    LC_OperData.WDTPtr[WatchIndex].OperatorID = LC_OPER_CUSTOM;
+
+    LC_CompileWatchpoint(WatchIndex, &LC_OperData.WatchEvals[0]);
+
+    UtAssert_True(LC_OperData.WatchEvals[0].AcceptMask == 0,
+                  "LC_OperData.WatchEvals[0].AcceptMask == 0");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 0,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 0");
+
+} /* end LC_CompileWatchpoint_Test_AcceptMask */
+
+void LC_CreateBatches_Test_GroupByCompareType(void) {
+    LC_MessageList_t *MessageLink = &LC_OperData.MessageLinks[0];
+
+    MessageLink->EvalStart = 0;
+    MessageLink->EvalCount = 4;
+
+    LC_OperData.WatchEvals[0].WatchIndex  = 0;
+    LC_OperData.WatchEvals[0].CompareType = LC_EVAL_SIGNED;
+    LC_OperData.WatchEvals[0].AcceptMask  = LC_ACCEPT_LT;
+
+    LC_OperData.WatchEvals[1].WatchIndex  = 1;
+    LC_OperData.WatchEvals[1].CompareType = LC_EVAL_UNSIGNED;
+    LC_OperData.WatchEvals[1].AcceptMask  = LC_ACCEPT_GT;
+
+    LC_OperData.WatchEvals[2].WatchIndex  = 2;
+    LC_OperData.WatchEvals[2].CompareType = LC_EVAL_SIGNED;
+    LC_OperData.WatchEvals[2].AcceptMask  = LC_ACCEPT_EQ;
+
+    /* Custom function */
+    LC_OperData.WatchEvals[3].WatchIndex  = 3;
+    LC_OperData.WatchEvals[3].CompareType = LC_EVAL_SIGNED;
+    LC_OperData.WatchEvals[3].AcceptMask  = 0;
+
+    /* Execute the function being tested */
+    LC_CreateBatches(MessageLink);
+
+    /* Verify results */
+    UtAssert_True(LC_OperData.WatchEvals[0].WatchIndex == 3,
+                  "LC_OperData.WatchEvals[0].WatchIndex == 3");
+    UtAssert_True(LC_OperData.WatchEvals[1].WatchIndex == 0,
+                  "LC_OperData.WatchEvals[1].WatchIndex == 0");
+    UtAssert_True(LC_OperData.WatchEvals[2].WatchIndex == 2,
+                  "LC_OperData.WatchEvals[2].WatchIndex == 2");
+    UtAssert_True(LC_OperData.WatchEvals[3].WatchIndex == 1,
+                  "LC_OperData.WatchEvals[3].WatchIndex == 1");
+
+    UtAssert_True(LC_OperData.WatchEvals[0].BatchCount == 1,
+                  "LC_OperData.WatchEvals[0].BatchCount == 1");
+    UtAssert_True(LC_OperData.WatchEvals[1].BatchCount == 2,
+                  "LC_OperData.WatchEvals[1].BatchCount == 2");
+    UtAssert_True(LC_OperData.WatchEvals[3].BatchCount == 1,
+                  "LC_OperData.WatchEvals[3].BatchCount == 1");
+
+} /* end LC_CreateBatches_Test_GroupByCompareType */
+
+void LC_CreateBatches_Test_SplitLongRun(void) {
+    LC_MessageList_t *MessageLink = &LC_OperData.MessageLinks[0];
+    uint16 EvalIndex;
+
+    MessageLink->EvalStart = 0;
+    MessageLink->EvalCount = LC_BATCH_LANES + 1;
+
+    for (EvalIndex = 0; EvalIndex < MessageLink->EvalCount; EvalIndex++) {
+        LC_OperData.WatchEvals[EvalIndex].WatchIndex  = EvalIndex;
+        LC_OperData.WatchEvals[EvalIndex].CompareType = LC_EVAL_FLOAT;
+        LC_OperData.WatchEvals[EvalIndex].AcceptMask  = LC_ACCEPT_GT;
+    }
+
+    /* Execute the function being tested */
+    LC_CreateBatches(MessageLink);
+
+    /* Verify results */
+    UtAssert_True(LC_OperData.WatchEvals[0].BatchCount == LC_BATCH_LANES,
+                  "LC_OperData.WatchEvals[0].BatchCount == LC_BATCH_LANES");
+    UtAssert_True(LC_OperData.WatchEvals[LC_BATCH_LANES].BatchCount == 1,
+                  "LC_OperData.WatchEvals[LC_BATCH_LANES].BatchCount == 1");
+    UtAssert_True(LC_OperData.WatchEvals[LC_BATCH_LANES].WatchIndex ==
+                      LC_BATCH_LANES,
+                  "LC_OperData.WatchEvals[LC_BATCH_LANES].WatchIndex == "
+                  "LC_BATCH_LANES");
+
+} /* end LC_CreateBatches_Test_SplitLongRun */
+
+void LC_CreateBatches_Test_Ladder(void) {
+    LC_MessageList_t *MessageLink = &LC_OperData.MessageLinks[0];
+    uint16 EvalIndex;
+
+    MessageLink->EvalStart = 0;
+    MessageLink->EvalCount = 4;
+
+    for (EvalIndex = 0; EvalIndex < MessageLink->EvalCount; EvalIndex++) {
+        LC_OperData.WatchEvals[EvalIndex].WatchIndex       = EvalIndex;
+        LC_OperData.WatchEvals[EvalIndex].CompareType      = LC_EVAL_SIGNED;
+        LC_OperData.WatchEvals[EvalIndex].AcceptMask       = LC_ACCEPT_GT;
+        LC_OperData.WatchEvals[EvalIndex].WatchpointOffset = 12;
+    }
+
+    LC_OperData.WatchEvals[0].ComparisonValue.Signed32 = 30;
+    LC_OperData.WatchEvals[2].ComparisonValue.Signed32 = -10;
+    LC_OperData.WatchEvals[3].ComparisonValue.Signed32 = 20;
+
+    /* Another datum */
+    LC_OperData.WatchEvals[1].WatchpointOffset = 16;
+
+    /* Execute the function being tested */
+    LC_CreateBatches(MessageLink);
+
+    /* Verify results */
+    UtAssert_True(LC_OperData.WatchEvals[0].WatchIndex == 2,
+                  "LC_OperData.WatchEvals[0].WatchIndex == 2");
+    UtAssert_True(LC_OperData.WatchEvals[1].WatchIndex == 3,
+                  "LC_OperData.WatchEvals[1].WatchIndex == 3");
+    UtAssert_True(LC_OperData.WatchEvals[2].WatchIndex == 0,
+                  "LC_OperData.WatchEvals[2].WatchIndex == 0");
+    UtAssert_True(LC_OperData.WatchEvals[3].WatchIndex == 1,
+                  "LC_OperData.WatchEvals[3].WatchIndex == 1");
+
+    UtAssert_True(LC_OperData.WatchEvals[0].RungCount == 3,
+                  "LC_OperData.WatchEvals[0].RungCount == 3");
+    UtAssert_True(LC_OperData.WatchEvals[2].RungCount == 1,
+                  "LC_OperData.WatchEvals[2].RungCount == 1");
+    UtAssert_True(LC_OperData.WatchEvals[3].RungCount == 0,
+                  "LC_OperData.WatchEvals[3].RungCount == 0");
+
+    UtAssert_True(LC_OperData.LadderThresholds[0].Signed32 == -10,
+                  "LC_OperData.LadderThresholds[0].Signed32 == -10");
+    UtAssert_True(LC_OperData.LadderThresholds[2].Signed32 == 30,
+                  "LC_OperData.LadderThresholds[2].Signed32 == 30");
+
+} /* end LC_CreateBatches_Test_Ladder */
+
+void LC_CreateBatches_Test_FlagBank(void) {
+    LC_MessageList_t *MessageLink = &LC_OperData.MessageLinks[0];
+    uint16 EvalIndex;
+
+    MessageLink->EvalStart = 0;
+    MessageLink->EvalCount = 4;
+
+    for (EvalIndex = 0; EvalIndex < MessageLink->EvalCount; EvalIndex++) {
+        LC_OperData.WatchEvals[EvalIndex].WatchIndex  = EvalIndex;
+        LC_OperData.WatchEvals[EvalIndex].CompareType = LC_EVAL_UNSIGNED;
+        LC_OperData.WatchEvals[EvalIndex].OperatorID  = LC_OPER_EQ;
+        LC_OperData.WatchEvals[EvalIndex].AcceptMask =
+            LC_ACCEPT_EQ | LC_ACCEPT_NEAR;
+        LC_OperData.WatchEvals[EvalIndex].WidthMask        = 0xFFFF;
+        LC_OperData.WatchEvals[EvalIndex].WatchpointOffset = 12;
+    }
+
+    LC_OperData.WatchEvals[0].BitMask = 0x0100;
+    LC_OperData.WatchEvals[2].BitMask = 0x0001;
+    LC_OperData.WatchEvals[3].BitMask = 0x0002;
+
+    LC_OperData.WatchEvals[3].OperatorID = LC_OPER_NE;
+    LC_OperData.WatchEvals[3].AcceptMask =
+        LC_ACCEPT_LT | LC_ACCEPT_GT | LC_ACCEPT_NEAR;
+
+    /* Not a single bit */
+    LC_OperData.WatchEvals[1].BitMask = 0x0003;
+
+    /* Execute the function being tested */
+    LC_CreateBatches(MessageLink);
+
+    /* Verify results */
+    UtAssert_True(LC_OperData.WatchEvals[0].WatchIndex == 2,
+                  "LC_OperData.WatchEvals[0].WatchIndex == 2");
+    UtAssert_True(LC_OperData.WatchEvals[1].WatchIndex == 3,
+                  "LC_OperData.WatchEvals[1].WatchIndex == 3");
+    UtAssert_True(LC_OperData.WatchEvals[2].WatchIndex == 0,
+                  "LC_OperData.WatchEvals[2].WatchIndex == 0");
+    UtAssert_True(LC_OperData.WatchEvals[3].WatchIndex == 1,
+                  "LC_OperData.WatchEvals[3].WatchIndex == 1");
+
+    UtAssert_True(LC_OperData.WatchEvals[0].FlagCount == 3,
+                  "LC_OperData.WatchEvals[0].FlagCount == 3");
+    UtAssert_True(LC_OperData.WatchEvals[3].FlagCount == 0,
+                  "LC_OperData.WatchEvals[3].FlagCount == 0");
+
+    UtAssert_True(LC_OperData.FlagBanks[0].CareMask == 0x0103,
+                  "LC_OperData.FlagBanks[0].CareMask == 0x0103");
+    UtAssert_True(LC_OperData.FlagBanks[0].Expected == 0x0002,
+                  "LC_OperData.FlagBanks[0].Expected == 0x0002");
 
-} /* end LC_GetSizedWPData_Test_DataTypeError */
+} /* end LC_CreateBatches_Test_FlagBank */
 
 void LC_ValidateWDT_Test_UnusedTableEntry(void) {
     int32 Result;
@@ -1725,6 +3534,78 @@ void LC_ValidateWDT_Test_NonFloatingPointPassed(void) {
 
 } /* end LC_ValidateWDT_Test_NonFloatingPointPassed */
 
+void LC_ValidateWDT_Test_BadArraySettings(void) {
+    int32 Result;
+    int32 TableIndex;
+
+    for (TableIndex = 0; TableIndex < LC_MAX_WATCHPOINTS; TableIndex++) {
+        LC_OperData.WDTPtr[TableIndex].DataType   = LC_DATA_BYTE;
+        LC_OperData.WDTPtr[TableIndex].OperatorID = LC_OPER_LT;
+        LC_OperData.WDTPtr[TableIndex].MessageID  = CFE_SB_HIGHEST_VALID_MSGID;
+        LC_OperData.WDTPtr[TableIndex].ComparisonValue.Unsigned32 = 1;
+        LC_OperData.WDTPtr[TableIndex].AggregateType  = LC_AGGR_COUNT;
+        LC_OperData.WDTPtr[TableIndex].ElementCount   = 4;
+        LC_OperData.WDTPtr[TableIndex].ElementStride  = 1;
+        LC_OperData.WDTPtr[TableIndex].AggregateCount = 5;
+    }
+
+    /* Execute the function being tested */
+    Result = LC_ValidateWDT(LC_OperData.WDTPtr);
+
+    /* Verify results */
+    UtAssert_True(Result == LC_WDTVAL_ERR_ARRAY,
+                  "Result == LC_WDTVAL_ERR_ARRAY");
+
+    UtAssert_True(
+        Ut_CFE_EVS_EventSent(
+            LC_WDTVAL_ERR_EID, CFE_EVS_ERROR,
+            "WDT verify err: WP = 0, Err = 6, DType = 1, Oper = 1, MID = 8191"),
+        "WDT verify err: WP = 0, Err = 6, DType = 1, Oper = 1, MID = 8191");
+
+    UtAssert_True(Ut_CFE_EVS_EventSent(
+                      LC_WDTVAL_INF_EID, CFE_EVS_INFORMATION,
+                      "WDT verify results: good = 0, bad = 176, unused = 0"),
+                  "WDT verify results: good = 0, bad = 176, unused = 0");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 2,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 2");
+
+} /* end LC_ValidateWDT_Test_BadArraySettings */
+
+void LC_ValidateWDT_Test_BadMonitorMode(void) {
+    int32 Result;
+    int32 TableIndex;
+
+    for (TableIndex = 0; TableIndex < LC_MAX_WATCHPOINTS; TableIndex++) {
+        LC_OperData.WDTPtr[TableIndex].DataType   = LC_DATA_BYTE;
+        LC_OperData.WDTPtr[TableIndex].OperatorID = LC_OPER_LT;
+        LC_OperData.WDTPtr[TableIndex].MessageID  = CFE_SB_HIGHEST_VALID_MSGID;
+        LC_OperData.WDTPtr[TableIndex].ComparisonValue.Unsigned32 = 1;
+        LC_OperData.WDTPtr[TableIndex].MonitorMode = 99;
+    }
+
+    /* Execute the function being tested */
+    Result = LC_ValidateWDT(LC_OperData.WDTPtr);
+
+    /* Verify results */
+    UtAssert_True(Result == LC_WDTVAL_ERR_MODE, "Result == LC_WDTVAL_ERR_MODE");
+
+    UtAssert_True(
+        Ut_CFE_EVS_EventSent(
+            LC_WDTVAL_ERR_EID, CFE_EVS_ERROR,
+            "WDT verify err: WP = 0, Err = 7, DType = 1, Oper = 1, MID = 8191"),
+        "WDT verify err: WP = 0, Err = 7, DType = 1, Oper = 1, MID = 8191");
+
+    UtAssert_True(Ut_CFE_EVS_EventSent(
+                      LC_WDTVAL_INF_EID, CFE_EVS_INFORMATION,
+                      "WDT verify results: good = 0, bad = 176, unused = 0"),
+                  "WDT verify results: good = 0, bad = 176, unused = 0");
+
+    UtAssert_True(Ut_CFE_EVS_GetEventQueueDepth() == 2,
+                  "Ut_CFE_EVS_GetEventQueueDepth() == 2");
+
+} /* end LC_ValidateWDT_Test_BadMonitorMode */
+
 void LC_Uint32IsNAN_Test_True(void) {
     boolean Result;
 
@@ -1787,21 +3668,44 @@ void LC_Watch_Test_AddTestCases(void) {
     UtTest_Add(LC_CreateHashTable_Test_NominalAllSameMID, LC_Test_Setup,
                LC_Test_TearDown, "LC_CreateHashTable_Test_NominalAllSameMID");
 
+    UtTest_Add(LC_CreateHashTable_Test_PerfectHashUpperByteMIDs, LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_CreateHashTable_Test_PerfectHashUpperByteMIDs");
+    UtTest_Add(LC_CreateHashTable_Test_LatestSnapshots, LC_Test_Setup,
+               LC_Test_TearDown, "LC_CreateHashTable_Test_LatestSnapshots");
+    UtTest_Add(LC_CreateHashTable_Test_SharedData, LC_Test_Setup,
+               LC_Test_TearDown, "LC_CreateHashTable_Test_SharedData");
+    UtTest_Add(LC_CreateFingerprint_Test_MergedSpans, LC_Test_Setup,
+               LC_Test_TearDown, "LC_CreateFingerprint_Test_MergedSpans");
+    UtTest_Add(LC_CreateFingerprint_Test_CustomFunction, LC_Test_Setup,
+               LC_Test_TearDown, "LC_CreateFingerprint_Test_CustomFunction");
+    UtTest_Add(LC_CreatePerfectHash_Test_ClusteredMIDs, LC_Test_Setup,
+               LC_Test_TearDown, "LC_CreatePerfectHash_Test_ClusteredMIDs");
+
+    UtTest_Add(LC_AddWatchpoint_Test_HashTableNullPointerNominal,
+               LC_Test_Setup, LC_Test_TearDown,
+               "LC_AddWatchpoint_Test_HashTableNullPointerNominal");
     UtTest_Add(
-        LC_AddWatchpoint_Test_HashTableAndWatchPtListNullPointersNominal,
-        LC_Test_Setup, LC_Test_TearDown,
-        "LC_AddWatchpoint_Test_HashTableAndWatchPtListNullPointersNominal");
-    UtTest_Add(
-        LC_AddWatchpoint_Test_HashTableAndWatchPtListNotNullPointerTwoMsgLinksMIDFound,
+        LC_AddWatchpoint_Test_HashTableNotNullPointerTwoMsgLinksMIDFound,
         LC_Test_Setup, LC_Test_TearDown,
-        "LC_AddWatchpoint_Test_"
-        "HashTableAndWatchPtListNotNullPointerTwoMsgLinksMIDFound");
+        "LC_AddWatchpoint_Test_HashTableNotNullPointerTwoMsgLinksMIDFound");
     UtTest_Add(LC_AddWatchpoint_Test_NullPointersErrorSubscribingWatchpoint,
                LC_Test_Setup, LC_Test_TearDown,
                "LC_AddWatchpoint_Test_NullPointersErrorSubscribingWatchpoint");
 
     UtTest_Add(LC_CheckMsgForWPs_Test_Nominal, LC_Test_Setup, LC_Test_TearDown,
                "LC_CheckMsgForWPs_Test_Nominal");
+    UtTest_Add(LC_CheckMsgForWPs_Test_ShortMessage, LC_Test_Setup,
+               LC_Test_TearDown, "LC_CheckMsgForWPs_Test_ShortMessage");
+    UtTest_Add(LC_CheckMsgForWPs_Test_MessagePeriod, LC_Test_Setup,
+               LC_Test_TearDown, "LC_CheckMsgForWPs_Test_MessagePeriod");
+    UtTest_Add(LC_CheckMsgForWPs_Test_MessagePeriodLCClock, LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_CheckMsgForWPs_Test_MessagePeriodLCClock");
+    UtTest_Add(LC_CheckMsgForWPs_Test_LatestValue, LC_Test_Setup,
+               LC_Test_TearDown, "LC_CheckMsgForWPs_Test_LatestValue");
+    UtTest_Add(LC_CheckMsgForWPs_Test_Decimation, LC_Test_Setup,
+               LC_Test_TearDown, "LC_CheckMsgForWPs_Test_Decimation");
     UtTest_Add(LC_CheckMsgForWPs_Test_UnreferencedMessageID, LC_Test_Setup,
                LC_Test_TearDown,
                "LC_CheckMsgForWPs_Test_UnreferencedMessageID");
@@ -1816,6 +3720,40 @@ void LC_Watch_Test_AddTestCases(void) {
     UtTest_Add(LC_ProcessWP_Test_OperatorCompareWatchFalsePreviousStale,
                LC_Test_Setup, LC_Test_TearDown,
                "LC_ProcessWP_Test_OperatorCompareWatchFalsePreviousStale");
+    UtTest_Add(LC_ProcessWPBatch_Test_Nominal, LC_Test_Setup,
+               LC_Test_TearDown, "LC_ProcessWPBatch_Test_Nominal");
+    UtTest_Add(LC_ProcessWPLadder_Test_Nominal, LC_Test_Setup,
+               LC_Test_TearDown, "LC_ProcessWPLadder_Test_Nominal");
+    UtTest_Add(LC_GetLadderBound_Test_Signed, LC_Test_Setup, LC_Test_TearDown,
+               "LC_GetLadderBound_Test_Signed");
+    UtTest_Add(LC_ProcessWPFlagBank_Test_Nominal, LC_Test_Setup,
+               LC_Test_TearDown, "LC_ProcessWPFlagBank_Test_Nominal");
+    UtTest_Add(LC_GetMaskedWPData_Test_ReuseDatum, LC_Test_Setup,
+               LC_Test_TearDown, "LC_GetMaskedWPData_Test_ReuseDatum");
+    UtTest_Add(LC_SyncWRT_Test_Nominal, LC_Test_Setup, LC_Test_TearDown,
+               "LC_SyncWRT_Test_Nominal");
+    UtTest_Add(LC_LoadWatchResults_Test_Nominal, LC_Test_Setup,
+               LC_Test_TearDown, "LC_LoadWatchResults_Test_Nominal");
+    UtTest_Add(LC_AgeWatchResults_Test_Nominal, LC_Test_Setup,
+               LC_Test_TearDown, "LC_AgeWatchResults_Test_Nominal");
+    UtTest_Add(LC_SetStaleCountdown_Test_Restart, LC_Test_Setup,
+               LC_Test_TearDown, "LC_SetStaleCountdown_Test_Restart");
+    UtTest_Add(LC_CheckMessageAges_Test_Nominal, LC_Test_Setup,
+               LC_Test_TearDown, "LC_CheckMessageAges_Test_Nominal");
+    UtTest_Add(LC_EvaluateSnapshots_Test_Nominal, LC_Test_Setup,
+               LC_Test_TearDown, "LC_EvaluateSnapshots_Test_Nominal");
+    UtTest_Add(LC_MatchFingerprint_Test_Nominal, LC_Test_Setup,
+               LC_Test_TearDown, "LC_MatchFingerprint_Test_Nominal");
+    UtTest_Add(LC_RepeatWPResults_Test_Nominal, LC_Test_Setup,
+               LC_Test_TearDown, "LC_RepeatWPResults_Test_Nominal");
+    UtTest_Add(LC_RepeatWPResults_Test_Stale, LC_Test_Setup,
+               LC_Test_TearDown, "LC_RepeatWPResults_Test_Stale");
+    UtTest_Add(LC_RefreshWPAges_Test_Nominal, LC_Test_Setup,
+               LC_Test_TearDown, "LC_RefreshWPAges_Test_Nominal");
+    UtTest_Add(LC_ProcessWPArray_Test_CountTrue, LC_Test_Setup,
+               LC_Test_TearDown, "LC_ProcessWPArray_Test_CountTrue");
+    UtTest_Add(LC_ProcessWPArray_Test_AllFalse, LC_Test_Setup,
+               LC_Test_TearDown, "LC_ProcessWPArray_Test_AllFalse");
 
     /* Note: Only testing little-ending (LE) cases.  Not testing big-endian (BE)
      * cases. */
@@ -1878,10 +3816,24 @@ void LC_Watch_Test_AddTestCases(void) {
                "LC_FloatCompare_Test_GT");
     UtTest_Add(LC_FloatCompare_Test_GE, LC_Test_Setup, LC_Test_TearDown,
                "LC_FloatCompare_Test_GE");
+    UtTest_Add(LC_FloatCompare_Test_LTWithinTolerance, LC_Test_Setup,
+               LC_Test_TearDown, "LC_FloatCompare_Test_LTWithinTolerance");
     UtTest_Add(LC_FloatCompare_Test_InvalidOperatorID, LC_Test_Setup,
                LC_Test_TearDown, "LC_FloatCompare_Test_InvalidOperatorID");
     UtTest_Add(LC_FloatCompare_Test_NaN, LC_Test_Setup, LC_Test_TearDown,
                "LC_FloatCompare_Test_NaN");
+    UtTest_Add(LC_SignedCompareBatch_Test_Nominal, LC_Test_Setup,
+               LC_Test_TearDown, "LC_SignedCompareBatch_Test_Nominal");
+    UtTest_Add(LC_UnsignedCompareBatch_Test_Nominal, LC_Test_Setup,
+               LC_Test_TearDown, "LC_UnsignedCompareBatch_Test_Nominal");
+    UtTest_Add(LC_FloatCompareBatch_Test_NaN, LC_Test_Setup,
+               LC_Test_TearDown, "LC_FloatCompareBatch_Test_NaN");
+    UtTest_Add(LC_SignedCompareBatch_Test_SevenLanes, LC_Test_Setup,
+               LC_Test_TearDown, "LC_SignedCompareBatch_Test_SevenLanes");
+    UtTest_Add(LC_UnsignedCompareBatch_Test_SevenLanes, LC_Test_Setup,
+               LC_Test_TearDown, "LC_UnsignedCompareBatch_Test_SevenLanes");
+    UtTest_Add(LC_FloatCompareBatch_Test_SevenLanes, LC_Test_Setup,
+               LC_Test_TearDown, "LC_FloatCompareBatch_Test_SevenLanes");
 
     UtTest_Add(LC_WPOffsetValid_Test_DataUByte, LC_Test_Setup, LC_Test_TearDown,
                "LC_WPOffsetValid_Test_DataUByte");
@@ -1918,8 +3870,30 @@ void LC_Watch_Test_AddTestCases(void) {
     UtTest_Add(LC_GetSizedWPData_Test_DataFloatLELittleEndian, LC_Test_Setup,
                LC_Test_TearDown,
                "LC_GetSizedWPData_Test_DataFloatLELittleEndian");
-    UtTest_Add(LC_GetSizedWPData_Test_DataTypeError, LC_Test_Setup,
-               LC_Test_TearDown, "LC_GetSizedWPData_Test_DataTypeError");
+
+    UtTest_Add(LC_GetSizedWPData_Test_SignedWordSwapMapFallback,
+               LC_Test_Setup, LC_Test_TearDown,
+               "LC_GetSizedWPData_Test_SignedWordSwapMapFallback");
+    UtTest_Add(LC_GetSizedWPData_Test_DataUDWordBEKernel, LC_Test_Setup,
+               LC_Test_TearDown, "LC_GetSizedWPData_Test_DataUDWordBEKernel");
+
+    UtTest_Add(LC_CompileWatchpoint_Test_SignedWordBE, LC_Test_Setup,
+               LC_Test_TearDown, "LC_CompileWatchpoint_Test_SignedWordBE");
+    UtTest_Add(LC_CompileWatchpoint_Test_UnsignedByte, LC_Test_Setup,
+               LC_Test_TearDown, "LC_CompileWatchpoint_Test_UnsignedByte");
+    UtTest_Add(LC_CompileWatchpoint_Test_UndefinedDataType, LC_Test_Setup,
+               LC_Test_TearDown,
+               "LC_CompileWatchpoint_Test_UndefinedDataType");
+    UtTest_Add(LC_CompileWatchpoint_Test_AcceptMask, LC_Test_Setup,
+               LC_Test_TearDown, "LC_CompileWatchpoint_Test_AcceptMask");
+    UtTest_Add(LC_CreateBatches_Test_GroupByCompareType, LC_Test_Setup,
+               LC_Test_TearDown, "LC_CreateBatches_Test_GroupByCompareType");
+    UtTest_Add(LC_CreateBatches_Test_SplitLongRun, LC_Test_Setup,
+               LC_Test_TearDown, "LC_CreateBatches_Test_SplitLongRun");
+    UtTest_Add(LC_CreateBatches_Test_Ladder, LC_Test_Setup, LC_Test_TearDown,
+               "LC_CreateBatches_Test_Ladder");
+    UtTest_Add(LC_CreateBatches_Test_FlagBank, LC_Test_Setup,
+               LC_Test_TearDown, "LC_CreateBatches_Test_FlagBank");
 
     UtTest_Add(LC_ValidateWDT_Test_UnusedTableEntry, LC_Test_Setup,
                LC_Test_TearDown, "LC_ValidateWDT_Test_UnusedTableEntry");
@@ -1937,6 +3911,10 @@ void LC_Watch_Test_AddTestCases(void) {
                LC_Test_TearDown, "LC_ValidateWDT_Test_FloatingPointPassed");
     UtTest_Add(LC_ValidateWDT_Test_NonFloatingPointPassed, LC_Test_Setup,
                LC_Test_TearDown, "LC_ValidateWDT_Test_NonFloatingPointPassed");
+    UtTest_Add(LC_ValidateWDT_Test_BadArraySettings, LC_Test_Setup,
+               LC_Test_TearDown, "LC_ValidateWDT_Test_BadArraySettings");
+    UtTest_Add(LC_ValidateWDT_Test_BadMonitorMode, LC_Test_Setup,
+               LC_Test_TearDown, "LC_ValidateWDT_Test_BadMonitorMode");
 
     UtTest_Add(LC_Uint32IsNAN_Test_True, LC_Test_Setup, LC_Test_TearDown,
                "LC_Uint32IsNAN_Test_True");